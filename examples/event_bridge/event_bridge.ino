@@ -0,0 +1,81 @@
+/* ============================================================================
+ * TwiST Framework v1.3.0 | Event Bridge Example
+ * ============================================================================
+ *
+ * Forward EventBus topics to a PC dashboard / test harness over WiFi UDP.
+ *
+ * Outgoing: "distance.changed" (at most 20/s) - every event of a tick
+ *           leaves in ONE datagram (WIRE_EVENTS frames, Core/EventCodec.h)
+ * Incoming: "app.estop" - injected with publishAsync(), so listeners run
+ *           at the start of the next tick like any other queued event
+ *
+ * PC side: bind UDP 4220, send one datagram to the board to register as
+ * peer, then decode frames with WireFrameParser + EventBatchReader (same
+ * pure C++ code). Event::data is not forwarded. test/EventBridgeClient.h
+ * is a reference client (POSIX sockets) - test/test_event_bridge.cpp runs
+ * it against this bridge over 127.0.0.1.
+ *
+ * Author: Voldemaras Birskys
+ * License: MIT
+ * ============================================================================ */
+
+#include <WiFi.h>
+#include "src/TwiST_Framework/TwiST.h"
+#include "src/TwiST_Framework/ApplicationConfig.h"  // Device abstraction
+#include "src/TwiST_Framework/Core/EventBridge.h"
+#include "src/TwiST_Framework/Drivers/Transport/UDPTransport.h"
+
+using namespace TwiST;
+
+const char* WIFI_SSID = "your-ssid";
+const char* WIFI_PASSWORD = "your-password";
+
+// ============================================================================
+// FRAMEWORK + EVENT BRIDGE
+// ============================================================================
+
+TwiSTFramework framework;
+Drivers::UDPTransport link(4220);   // Replies to whoever talked last
+EventBridge events(link, framework.eventBus());
+
+void onEmergencyStop(const Event& event) {
+    Logger::logf(Logger::Level::WARNING, "MAIN", "Remote e-stop (source %u)", event.sourceDeviceId);
+    for (uint8_t i = 0; i < framework.registry()->getDeviceCount(); i++) {
+        framework.registry()->getDeviceAt(i)->disable();
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    while (WiFi.status() != WL_CONNECTED) {
+        delay(250);
+    }
+
+    framework.initialize();
+    App::initializeSystem(framework);
+
+    link.begin();
+    events.exportTopic("distance.changed", 50);
+    events.importTopic("app.estop");
+    framework.eventBus().subscribe("app.estop", onEmergencyStop, PRIORITY_CRITICAL);
+
+    // AFTER_BRIDGES: the whole tick's events go out together
+    framework.addService(&events, SERVICE_AFTER_BRIDGES);
+
+    Logger::info("MAIN", "Event bridge ready on UDP 4220");
+}
+
+void loop() {
+    framework.update();
+
+    static unsigned long lastReport = 0;
+    if (millis() - lastReport > 5000) {
+        lastReport = millis();
+        Logger::logf(Logger::Level::INFO, "MAIN", "Events sent: %lu, received: %lu, limited: %lu, dropped: %lu",
+                    events.getEventsSent(), events.getEventsReceived(),
+                    events.getEventsRateLimited(), events.getEventsDropped());
+    }
+}
@@ -0,0 +1,58 @@
+/* ============================================================================
+ * TwiST Framework v1.3.0 | Remote Control Example
+ * ============================================================================
+ *
+ * Drive every registered device from a PC over a binary command link.
+ *
+ * The PC sends WIRE_COMMAND frames (Core/CommandProtocol.h):
+ *   - CommandWriter builds the payload (same code compiles on the PC)
+ *   - WireFrame::finalize() adds sync, type, length and CRC
+ *   - Sequence 0 = no response (use for 100+ Hz batch streaming)
+ *
+ * Link: Serial1 (UART) so the Logger keeps USB Serial for text.
+ * For WiFi, swap SerialTransport for Drivers::UDPTransport.
+ *
+ * Author: Voldemaras Birskys
+ * License: MIT
+ * ============================================================================ */
+
+#include "src/TwiST_Framework/TwiST.h"
+#include "src/TwiST_Framework/ApplicationConfig.h"  // Device abstraction
+#include "src/TwiST_Framework/Core/CommandChannel.h"
+#include "src/TwiST_Framework/Drivers/Transport/SerialTransport.h"
+
+using namespace TwiST;
+
+// ============================================================================
+// FRAMEWORK + COMMAND LINK
+// ============================================================================
+
+TwiSTFramework framework;
+Drivers::SerialTransport link(Serial1);
+CommandChannel commands(link, *framework.registry());
+
+void setup() {
+    Serial.begin(115200);
+    Serial1.begin(921600);
+    delay(1000);
+
+    framework.initialize();
+    App::initializeSystem(framework);
+
+    // BEFORE_DEVICES: commands apply at the start of each tick
+    framework.addService(&commands, SERVICE_BEFORE_DEVICES);
+
+    Logger::info("MAIN", "Remote control ready on Serial1");
+}
+
+void loop() {
+    framework.update();
+
+    static unsigned long lastReport = 0;
+    if (millis() - lastReport > 5000) {
+        lastReport = millis();
+        Logger::logf(Logger::Level::INFO, "MAIN", "Frames: %lu, applied: %lu, failed: %lu, malformed: %lu",
+                    commands.getFrameCount(), commands.getAppliedCount(),
+                    commands.getFailedCount(), commands.getMalformedCount());
+    }
+}
@@ -14,7 +14,7 @@
  * 3. This file and main.ino stay UNCHANGED!
  *
  * Author: Voldemaras Birskys
- * Version: 1.2.0 (Memory Safety: std::unique_ptr for automatic cleanup)
+ * Version: 1.3.0 (Static arena: drivers and devices never touch the heap)
  */
 
 #include "ApplicationConfig.h"
@@ -22,11 +22,28 @@
 #include "TwiST_ConfigValidator.h"     // For runSystemConfigSafetyCheck()
 #include "TwiST.h"                     // For TwiSTFramework class definition
 #include "Core/Logger.h"               // For centralized logging (v1.2.0)
+#include "Core/Arena.h"                // Static storage for drivers and devices
 #include "Drivers/PWM/PCA9685.h"       // Concrete PWM driver
+#include "Drivers/PWM/ESP32LEDC.h"     // Concrete PWM driver (on-chip)
 #include "Drivers/ADC/ESP32ADC.h"      // Concrete ADC driver
 #include "Drivers/Distance/HCSR04.h"   // Concrete distance sensor driver
+#include "Drivers/Stepper/StepEngine.h"  // Timer-driven step pulse engine
+#include "Drivers/GPIO/ESP32DigitalInput.h"  // GPIO edge capture for inputs
+#include "Drivers/Encoder/ESP32PCNT.h"   // Pulse counter quadrature decoding
+#if TWIST_ENABLE_RECORDING
+#include "Core/DriverRecorder.h"         // Driver I/O recorder service
+#include "Drivers/Record/RecordingDrivers.h"  // Recording decorators
+#endif
+#if TWIST_ENABLE_SAFETY
+#include "Core/SafetySupervisor.h"       // Servo supply budget + stall detection
+#endif
+#if TWIST_ENABLE_ASYNC_I2C
+#include "Core/I2CQueue.h"               // Background I2C writes
+#include "Drivers/I2C/WireI2CBus.h"      // Wire-backed bus for the queue
+#include <Wire.h>
+#endif
 #include <Arduino.h>                   // For Serial debugging
-#include <memory>                      // For std::unique_ptr, std::make_unique
+#include <algorithm>                   // For std::max (arena sizing)
 
 namespace TwiST {
 namespace App {
@@ -36,14 +53,31 @@ using TwiST::PWM_DRIVER_COUNT;
 using TwiST::SERVO_COUNT;
 using TwiST::JOYSTICK_COUNT;
 using TwiST::DISTANCE_SENSOR_COUNT;
+using TwiST::STEPPER_COUNT;
+using TwiST::DIGITAL_INPUT_COUNT;
+using TwiST::ENCODER_COUNT;
+using TwiST::DC_SERVO_COUNT;
+using TwiST::DISTANCE_ARRAY_COUNT;
+using TwiST::DISTANCE_ARRAY_SENSOR_COUNT;
+using TwiST::ANALOG_INPUT_ARRAY_COUNT;
+using TwiST::ANALOG_AXIS_COUNT;
 
 // Import config structs from TwiST_Config.h
 using TwiST::PWM_DRIVER_CONFIGS;
 using TwiST::SERVO_CONFIGS;
 using TwiST::JOYSTICK_CONFIGS;
 using TwiST::DISTANCE_SENSOR_CONFIGS;
+using TwiST::STEPPER_CONFIGS;
+using TwiST::DIGITAL_INPUT_CONFIGS;
+using TwiST::ENCODER_CONFIGS;
+using TwiST::DC_SERVO_CONFIGS;
+using TwiST::DISTANCE_ARRAY_CONFIGS;
+using TwiST::DISTANCE_ARRAY_SENSOR_CONFIGS;
+using TwiST::ANALOG_INPUT_ARRAY_CONFIGS;
+using TwiST::ANALOG_AXIS_CONFIGS;
 using TwiST::PWMDriverType;
 using TwiST::CalibrationMode;
+using TwiST::ServoHold;
 
 // Import validation function
 using TwiST::runSystemConfigSafetyCheck;
@@ -53,17 +87,116 @@ using TwiST::runSystemConfigSafetyCheck;
 // ============================================================================
 
 namespace {
-    // Driver storage - std::unique_ptr for automatic memory management (v1.2.0)
-    // RAII (Resource Acquisition Is Initialization) - automatic cleanup
-    std::array<std::unique_ptr<Drivers::PCA9685>, PWM_DRIVER_COUNT> pwmDrivers;
-    std::array<std::unique_ptr<Drivers::ESP32ADC>, JOYSTICK_COUNT * 2> adcDrivers;  // 2 per joystick (X and Y)
-    std::array<std::unique_ptr<Drivers::HCSR04>, DISTANCE_SENSOR_COUNT> ultrasonicDrivers;
+    // Each PWM slot may hold either driver type
+    constexpr size_t PWM_DRIVER_BYTES = std::max(Arena::footprint<Drivers::PCA9685>(),
+                                                 Arena::footprint<Drivers::ESP32LEDC>());
 
-    // Device storage - std::unique_ptr for clear ownership semantics
-    // Memory: Allocated at startup, automatically freed on shutdown (RAII)
-    std::array<std::unique_ptr<Devices::Servo>, SERVO_COUNT> servos;
-    std::array<std::unique_ptr<Devices::Joystick>, JOYSTICK_COUNT> joysticks;
-    std::array<std::unique_ptr<Devices::DistanceSensor>, DISTANCE_SENSOR_COUNT> distanceSensors;
+    // Exact size for this configuration - everything created below, once
+    constexpr size_t APP_ARENA_BYTES =
+        PWM_DRIVER_COUNT * PWM_DRIVER_BYTES
+        + (JOYSTICK_COUNT * 2 + ANALOG_AXIS_COUNT) * Arena::footprint<Drivers::ESP32ADC>()
+        + (DISTANCE_SENSOR_COUNT + DISTANCE_ARRAY_SENSOR_COUNT) * Arena::footprint<Drivers::HCSR04>()
+        + (STEPPER_COUNT > 0 ? Arena::footprint<Drivers::StepEngine>() : 0)
+        + (DIGITAL_INPUT_COUNT > 0 ? Arena::footprint<Drivers::ESP32DigitalInput>() : 0)
+        + ENCODER_COUNT * Arena::footprint<Drivers::ESP32PCNT>()
+        + SERVO_COUNT * Arena::footprint<Devices::Servo>()
+        + JOYSTICK_COUNT * Arena::footprint<Devices::Joystick>()
+        + DISTANCE_SENSOR_COUNT * Arena::footprint<Devices::DistanceSensor>()
+        + STEPPER_COUNT * Arena::footprint<Devices::Stepper>()
+        + DIGITAL_INPUT_COUNT * Arena::footprint<Devices::DigitalInput>()
+        + ENCODER_COUNT * Arena::footprint<Devices::Encoder>()
+        + DC_SERVO_COUNT * Arena::footprint<Devices::DCServo>()
+        + DISTANCE_ARRAY_COUNT * Arena::footprint<Devices::DistanceArray>()
+        + ANALOG_INPUT_ARRAY_COUNT * Arena::footprint<Devices::AnalogInputArray>()
+#if TWIST_ENABLE_RECORDING
+        + PWM_DRIVER_COUNT * Arena::footprint<Drivers::RecordingPWM>()
+        + JOYSTICK_COUNT * 2 * Arena::footprint<Drivers::RecordingADC>()
+        + DISTANCE_SENSOR_COUNT * Arena::footprint<Drivers::RecordingDistance>()
+#endif
+#if TWIST_ENABLE_SAFETY
+        + Arena::footprint<SafetySupervisor>()
+#endif
+        ;
+
+    // Static storage (.bss) - sealed at the end of initializeSystem()
+    StaticArena<APP_ARENA_BYTES> appArena("APP");
+
+    // Halts if APP_ARENA_BYTES is out of date (missing footprint above)
+    template<typename T, typename... Args>
+    T* make(Args&&... args) {
+        return appArena.createOrHalt<T>(std::forward<Args>(args)...);
+    }
+
+    // Driver storage - objects live in appArena for the whole run
+    std::array<IPWMDriver*, PWM_DRIVER_COUNT> pwmDrivers;  // PCA9685 or ESP32LEDC
+    std::array<Drivers::ESP32ADC*, JOYSTICK_COUNT * 2> adcDrivers;  // 2 per joystick (X and Y)
+    std::array<Drivers::HCSR04*, DISTANCE_SENSOR_COUNT> ultrasonicDrivers;
+    Drivers::StepEngine* stepEngine;  // One timer for all steppers (created if STEPPER_COUNT > 0)
+    Drivers::ESP32DigitalInput* inputDriver;  // All input lines (created if DIGITAL_INPUT_COUNT > 0)
+    std::array<Drivers::ESP32PCNT*, ENCODER_COUNT> encoderDrivers;  // Shared by Encoder + DCServo
+    std::array<Drivers::HCSR04*, DISTANCE_ARRAY_SENSOR_COUNT> arraySensorDrivers;  // Owned by their DistanceArray
+    std::array<Drivers::ESP32ADC*, ANALOG_AXIS_COUNT> analogAxisDrivers;  // Scanned by their AnalogInputArray
+
+    // Device storage - created once at startup, never freed (appArena)
+    std::array<Devices::Servo*, SERVO_COUNT> servos;
+    std::array<Devices::Joystick*, JOYSTICK_COUNT> joysticks;
+    std::array<Devices::DistanceSensor*, DISTANCE_SENSOR_COUNT> distanceSensors;
+    std::array<Devices::Stepper*, STEPPER_COUNT> steppers;
+    std::array<Devices::DigitalInput*, DIGITAL_INPUT_COUNT> digitalInputs;
+    std::array<Devices::Encoder*, ENCODER_COUNT> encoders;
+    std::array<Devices::DCServo*, DC_SERVO_COUNT> dcServos;
+    std::array<Devices::DistanceArray*, DISTANCE_ARRAY_COUNT> distanceArrays;
+    std::array<Devices::AnalogInputArray*, ANALOG_INPUT_ARRAY_COUNT> analogInputArrays;
+
+#if TWIST_ENABLE_RECORDING
+    // Recording decorators sit between devices and real drivers
+    // Stream id = driver index within its kind (matches ReplayDrivers)
+    DriverRecorder driverRecorder;
+    std::array<Drivers::RecordingPWM*, PWM_DRIVER_COUNT> recordingPwm;
+    std::array<Drivers::RecordingADC*, JOYSTICK_COUNT * 2> recordingAdc;
+    std::array<Drivers::RecordingDistance*, DISTANCE_SENSOR_COUNT> recordingDistance;
+#endif
+
+#if TWIST_ENABLE_SAFETY
+    // Needs the framework EventBus - created in initializeSystem()
+    SafetySupervisor* safetySupervisor;
+#endif
+
+#if TWIST_ENABLE_ASYNC_I2C
+    // Worker task owns Wire after initializeDevices() - PCA9685 setPWM() only queues
+    Drivers::WireI2CBus i2cBus(Wire);
+    I2CQueue i2cQueue(i2cBus);
+#endif
+
+    // Driver seen by devices (recording decorator when enabled)
+    IPWMDriver& pwmDriverFor(uint8_t index) {
+#if TWIST_ENABLE_RECORDING
+        if (!recordingPwm[index]) {
+            recordingPwm[index] = make<Drivers::RecordingPWM>(*pwmDrivers[index], driverRecorder, index);
+        }
+        return *recordingPwm[index];
+#else
+        return *pwmDrivers[index];
+#endif
+    }
+
+    IADCDriver& adcDriverFor(uint8_t index) {
+#if TWIST_ENABLE_RECORDING
+        recordingAdc[index] = make<Drivers::RecordingADC>(*adcDrivers[index], driverRecorder, index);
+        return *recordingAdc[index];
+#else
+        return *adcDrivers[index];
+#endif
+    }
+
+    IDistanceDriver& distanceDriverFor(uint8_t index) {
+#if TWIST_ENABLE_RECORDING
+        recordingDistance[index] = make<Drivers::RecordingDistance>(*ultrasonicDrivers[index], driverRecorder, index);
+        return *recordingDistance[index];
+#else
+        return *ultrasonicDrivers[index];
+#endif
+    }
 }
 
 // ============================================================================
@@ -89,20 +222,35 @@ void initializeDevices(EventBus& eventBus) {
     for (uint8_t i = 0; i < PWM_DRIVER_COUNT; i++) {
         const auto& cfg = PWM_DRIVER_CONFIGS[i];
 
-        // Factory pattern: Create driver based on type from config (v1.2.0: std::make_unique)
+        // Factory pattern: Create driver based on type from config (storage from appArena)
         switch (cfg.type) {
-            case PWMDriverType::PCA9685:
-                pwmDrivers[i] = std::make_unique<Drivers::PCA9685>(cfg.i2cAddress);
-                pwmDrivers[i]->begin(XIAO_SDA_PIN, XIAO_SCL_PIN);
-                pwmDrivers[i]->setFrequency(cfg.frequency);
+            case PWMDriverType::PCA9685: {
+                auto pca = make<Drivers::PCA9685>(cfg.i2cAddress);
+                pca->begin(XIAO_SDA_PIN, XIAO_SCL_PIN);
+                pca->setFrequency(cfg.frequency);
+#if TWIST_ENABLE_ASYNC_I2C
+                pca->setQueue(&i2cQueue);
+#endif
+                pwmDrivers[i] = pca;
                 Logger::logf(Logger::Level::INFO, "PWM", "PCA9685 driver %d at 0x%02X, %dHz",
                             i, cfg.i2cAddress, cfg.frequency);
                 break;
+            }
 
-            case PWMDriverType::ESP32_LEDC:
-                // Future: ESP32 native LEDC driver
-                Logger::fatal("PWM", "ESP32_LEDC not implemented - use PCA9685 or implement ESP32_LEDC driver");
+            case PWMDriverType::ESP32_LEDC: {
+                auto ledc = make<Drivers::ESP32LEDC>(cfg.frequency, cfg.resolutionBits);
+                for (uint8_t p = 0; p < LEDC_PIN_COUNT; p++) {
+                    if (LEDC_PIN_CONFIGS[p].pwmDriverIndex == i) {
+                        ledc->attach(LEDC_PIN_CONFIGS[p].pwmChannel, LEDC_PIN_CONFIGS[p].gpio);
+                    }
+                }
+                if (!ledc->begin()) {
+                    Logger::fatal("PWM", "LEDC driver failed validation - fix LEDC_PIN_CONFIGS");
+                }
+                pwmDrivers[i] = ledc;
+                Logger::logf(Logger::Level::INFO, "PWM", "LEDC driver %d, %dHz", i, cfg.frequency);
                 break;
+            }
 
             default:
                 Logger::logf(Logger::Level::FATAL, "PWM", "Unknown driver type: %d - fix TwiST_Config.h",
@@ -110,36 +258,109 @@ void initializeDevices(EventBus& eventBus) {
         }
     }
 
+#if TWIST_ENABLE_ASYNC_I2C
+    // Blocking PCA9685 setup is done - hand the bus to the worker
+    i2cQueue.startTask();
+#endif
+
     // ========================================================================
-    // Create ADC drivers dynamically (2 per joystick) - v1.2.0: std::make_unique
+    // Create ADC drivers dynamically (2 per joystick)
     // ========================================================================
     Logger::info("APP", "Creating ADC drivers...");
     for (uint8_t i = 0; i < JOYSTICK_COUNT; i++) {
         const auto& cfg = JOYSTICK_CONFIGS[i];
-        adcDrivers[i * 2] = std::make_unique<Drivers::ESP32ADC>(cfg.xPin);
-        adcDrivers[i * 2 + 1] = std::make_unique<Drivers::ESP32ADC>(cfg.yPin);
+        adcDrivers[i * 2] = make<Drivers::ESP32ADC>(cfg.xPin);
+        adcDrivers[i * 2 + 1] = make<Drivers::ESP32ADC>(cfg.yPin);
         Logger::logf(Logger::Level::INFO, "ADC", "Joystick '%s': X=GPIO%d, Y=GPIO%d",
                     cfg.name, cfg.xPin, cfg.yPin);
     }
+    for (uint8_t i = 0; i < ANALOG_AXIS_COUNT; i++) {
+        const auto& cfg = ANALOG_AXIS_CONFIGS[i];
+        analogAxisDrivers[i] = make<Drivers::ESP32ADC>(cfg.pin);
+        Logger::logf(Logger::Level::INFO, "ADC", "Analog array '%s': axis GPIO%d",
+                    ANALOG_INPUT_ARRAY_CONFIGS[cfg.arrayIndex].name, cfg.pin);
+    }
 
     // ========================================================================
-    // Create ultrasonic drivers dynamically - v1.2.0: std::make_unique
+    // Create ultrasonic drivers dynamically
     // ========================================================================
     Logger::info("APP", "Creating ultrasonic drivers...");
     for (uint8_t i = 0; i < DISTANCE_SENSOR_COUNT; i++) {
         const auto& cfg = DISTANCE_SENSOR_CONFIGS[i];
-        ultrasonicDrivers[i] = std::make_unique<Drivers::HCSR04>(cfg.trigPin, cfg.echoPin);
+        ultrasonicDrivers[i] = make<Drivers::HCSR04>(cfg.trigPin, cfg.echoPin);
         Logger::logf(Logger::Level::INFO, "ULTRASONIC", "'%s': TRIG=GPIO%d, ECHO=GPIO%d",
                     cfg.name, cfg.trigPin, cfg.echoPin);
     }
 
     // ========================================================================
-    // Initialize servos from config - v1.2.0: std::make_unique
+    // Create step engine - one axis per stepper, pins validated by begin()
+    // ========================================================================
+    if (STEPPER_COUNT > 0) {
+        Logger::info("APP", "Creating step engine...");
+        stepEngine = make<Drivers::StepEngine>();
+        for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+            const auto& cfg = STEPPER_CONFIGS[i];
+            if (stepEngine->addAxis(cfg.stepPin, cfg.dirPin, cfg.enablePin) != (int8_t)i) {
+                Logger::fatal("STEP", "Stepper axis rejected - fix STEPPER_CONFIGS");
+            }
+            Logger::logf(Logger::Level::INFO, "STEP", "'%s': STEP=GPIO%d, DIR=GPIO%d, EN=%d",
+                        cfg.name, cfg.stepPin, cfg.dirPin, cfg.enablePin);
+        }
+        if (!stepEngine->begin()) {
+            Logger::fatal("STEP", "Step engine failed to start");
+        }
+    }
+
+    // ========================================================================
+    // Create input driver - one line per digital input
+    // ========================================================================
+    if (DIGITAL_INPUT_COUNT > 0) {
+        Logger::info("APP", "Creating input driver...");
+        inputDriver = make<Drivers::ESP32DigitalInput>();
+        for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+            const auto& cfg = DIGITAL_INPUT_CONFIGS[i];
+            if (inputDriver->addLine(cfg.gpio, cfg.activeLow, cfg.pullup, cfg.interrupt) != (int8_t)i) {
+                Logger::fatal("INPUT", "Input line rejected - fix DIGITAL_INPUT_CONFIGS");
+            }
+            Logger::logf(Logger::Level::INFO, "INPUT", "'%s': GPIO%d (%s)",
+                        cfg.name, cfg.gpio, cfg.interrupt ? "interrupt" : "polled");
+        }
+        if (!inputDriver->begin()) {
+            Logger::fatal("INPUT", "Input driver failed to start");
+        }
+    }
+
+    // ========================================================================
+    // Create encoder drivers - one pulse counter unit each
+    // ========================================================================
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        const auto& cfg = ENCODER_CONFIGS[i];
+        encoderDrivers[i] = make<Drivers::ESP32PCNT>(cfg.pinA, cfg.pinB, cfg.glitchFilterNs);
+        if (!encoderDrivers[i]->begin()) {
+            Logger::fatal("PCNT", "Encoder driver failed to start - fix ENCODER_CONFIGS");
+        }
+        Logger::logf(Logger::Level::INFO, "PCNT", "'%s': A=GPIO%d, B=GPIO%d",
+                    cfg.name, cfg.pinA, cfg.pinB);
+    }
+
+    // ========================================================================
+    // Create distance array sensor drivers - fired in turn by their array
+    // ========================================================================
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_SENSOR_COUNT; i++) {
+        const auto& cfg = DISTANCE_ARRAY_SENSOR_CONFIGS[i];
+        arraySensorDrivers[i] = make<Drivers::HCSR04>(cfg.trigPin, cfg.echoPin);
+        arraySensorDrivers[i]->begin();
+        Logger::logf(Logger::Level::INFO, "ULTRASONIC", "'%s' sensor at %.0f deg: TRIG=GPIO%d, ECHO=GPIO%d",
+                    DISTANCE_ARRAY_CONFIGS[cfg.arrayIndex].name, cfg.bearingDeg, cfg.trigPin, cfg.echoPin);
+    }
+
+    // ========================================================================
+    // Initialize servos from config
     // ========================================================================
     for (uint8_t i = 0; i < SERVO_COUNT; i++) {
         const auto& cfg = SERVO_CONFIGS[i];
-        servos[i] = std::make_unique<Devices::Servo>(
-            *pwmDrivers[cfg.pwmDriverIndex],  // Use dynamic driver
+        servos[i] = make<Devices::Servo>(
+            pwmDriverFor(cfg.pwmDriverIndex),  // Use dynamic driver
             cfg.pwmChannel,
             cfg.deviceId,
             cfg.name,
@@ -151,13 +372,13 @@ void initializeDevices(EventBus& eventBus) {
     }
 
     // ========================================================================
-    // Initialize joysticks from config - v1.2.0: std::make_unique
+    // Initialize joysticks from config
     // ========================================================================
     for (uint8_t i = 0; i < JOYSTICK_COUNT; i++) {
         const auto& cfg = JOYSTICK_CONFIGS[i];
-        joysticks[i] = std::make_unique<Devices::Joystick>(
-            *adcDrivers[i * 2],      // X-axis driver
-            *adcDrivers[i * 2 + 1],  // Y-axis driver
+        joysticks[i] = make<Devices::Joystick>(
+            adcDriverFor(i * 2),      // X-axis driver
+            adcDriverFor(i * 2 + 1),  // Y-axis driver
             cfg.deviceId,
             cfg.name,
             eventBus
@@ -168,12 +389,12 @@ void initializeDevices(EventBus& eventBus) {
     }
 
     // ========================================================================
-    // Initialize distance sensors from config - v1.2.0: std::make_unique
+    // Initialize distance sensors from config
     // ========================================================================
     for (uint8_t i = 0; i < DISTANCE_SENSOR_COUNT; i++) {
         const auto& cfg = DISTANCE_SENSOR_CONFIGS[i];
-        distanceSensors[i] = std::make_unique<Devices::DistanceSensor>(
-            *ultrasonicDrivers[i],  // Use dynamic driver
+        distanceSensors[i] = make<Devices::DistanceSensor>(
+            distanceDriverFor(i),  // Use dynamic driver
             cfg.deviceId,
             cfg.name,
             eventBus,
@@ -184,6 +405,127 @@ void initializeDevices(EventBus& eventBus) {
         distanceSensors[i]->initialize();
     }
 
+    // ========================================================================
+    // Initialize steppers from config (axis i = STEPPER_CONFIGS[i])
+    // ========================================================================
+    for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+        const auto& cfg = STEPPER_CONFIGS[i];
+        steppers[i] = make<Devices::Stepper>(
+            *stepEngine,
+            i,
+            cfg.deviceId,
+            cfg.name,
+            eventBus
+        );
+        Logger::logf(Logger::Level::INFO, "STEPPER", "Initializing %s (ID %d, axis %d)",
+                    cfg.name, cfg.deviceId, i);
+        steppers[i]->initialize();
+    }
+
+    // ========================================================================
+    // Initialize digital inputs from config (line i = DIGITAL_INPUT_CONFIGS[i])
+    // ========================================================================
+    for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+        const auto& cfg = DIGITAL_INPUT_CONFIGS[i];
+        digitalInputs[i] = make<Devices::DigitalInput>(
+            *inputDriver,
+            i,
+            cfg.deviceId,
+            cfg.name,
+            eventBus
+        );
+        Logger::logf(Logger::Level::INFO, "INPUT", "Initializing %s (ID %d, line %d)",
+                    cfg.name, cfg.deviceId, i);
+        digitalInputs[i]->initialize();
+    }
+
+    // ========================================================================
+    // Initialize encoders from config
+    // ========================================================================
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        const auto& cfg = ENCODER_CONFIGS[i];
+        encoders[i] = make<Devices::Encoder>(
+            *encoderDrivers[i],
+            cfg.deviceId,
+            cfg.name,
+            eventBus
+        );
+        Logger::logf(Logger::Level::INFO, "ENCODER", "Initializing %s (ID %d)",
+                    cfg.name, cfg.deviceId);
+        encoders[i]->initialize();
+    }
+
+    // ========================================================================
+    // Initialize DC servos from config (encoder driver shared with its Encoder)
+    // ========================================================================
+    for (uint8_t i = 0; i < DC_SERVO_COUNT; i++) {
+        const auto& cfg = DC_SERVO_CONFIGS[i];
+        dcServos[i] = make<Devices::DCServo>(
+            *encoderDrivers[cfg.encoderIndex],
+            pwmDriverFor(cfg.pwmDriverIndex),
+            cfg.pwmChannelA,
+            cfg.pwmChannelB,
+            cfg.deviceId,
+            cfg.name,
+            eventBus,
+            cfg.rateHz
+        );
+        Logger::logf(Logger::Level::INFO, "DCSERVO", "Initializing %s (ID %d, encoder %d, PWM driver %d, channels %d/%d)",
+                    cfg.name, cfg.deviceId, cfg.encoderIndex, cfg.pwmDriverIndex, cfg.pwmChannelA, cfg.pwmChannelB);
+        dcServos[i]->initialize();
+    }
+
+    // ========================================================================
+    // Initialize distance arrays from config (sensors collected by arrayIndex)
+    // ========================================================================
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_COUNT; i++) {
+        const auto& cfg = DISTANCE_ARRAY_CONFIGS[i];
+        IDistanceDriver* ring[TWIST_OCCUPANCY_MAX_SOURCES];
+        float bearings[TWIST_OCCUPANCY_MAX_SOURCES];
+        uint8_t count = 0;
+        for (uint8_t j = 0; j < DISTANCE_ARRAY_SENSOR_COUNT && count < TWIST_OCCUPANCY_MAX_SOURCES; j++) {
+            if (DISTANCE_ARRAY_SENSOR_CONFIGS[j].arrayIndex != i) continue;
+            ring[count] = arraySensorDrivers[j];
+            bearings[count] = DISTANCE_ARRAY_SENSOR_CONFIGS[j].bearingDeg;
+            count++;
+        }
+        distanceArrays[i] = make<Devices::DistanceArray>(
+            ring,
+            bearings,
+            count,
+            cfg.deviceId,
+            cfg.name,
+            eventBus,
+            cfg.sectors
+        );
+        Logger::logf(Logger::Level::INFO, "ARRAY", "Initializing %s (ID %d, %d sensors, %d sectors)",
+                    cfg.name, cfg.deviceId, count, cfg.sectors);
+        distanceArrays[i]->initialize();
+    }
+
+    // ========================================================================
+    // Initialize analog input arrays from config (axes collected by arrayIndex)
+    // ========================================================================
+    for (uint8_t i = 0; i < ANALOG_INPUT_ARRAY_COUNT; i++) {
+        const auto& cfg = ANALOG_INPUT_ARRAY_CONFIGS[i];
+        IADCDriver* axes[TWIST_ANALOG_MAX_AXES];
+        uint8_t count = 0;
+        for (uint8_t j = 0; j < ANALOG_AXIS_COUNT && count < TWIST_ANALOG_MAX_AXES; j++) {
+            if (ANALOG_AXIS_CONFIGS[j].arrayIndex != i) continue;
+            axes[count++] = analogAxisDrivers[j];
+        }
+        analogInputArrays[i] = make<Devices::AnalogInputArray>(
+            axes,
+            count,
+            cfg.deviceId,
+            cfg.name,
+            eventBus
+        );
+        Logger::logf(Logger::Level::INFO, "ANALOG", "Initializing %s (ID %d, %d axes)",
+                    cfg.name, cfg.deviceId, count);
+        analogInputArrays[i]->initialize();
+    }
+
     Logger::info("APP", "All devices created");
 }
 
@@ -203,6 +545,22 @@ void calibrateDevices() {
             Logger::logf(Logger::Level::INFO, "APP", "%s: calibrate(%d, %d, %d, %d)",
                         cfg.name, cfg.minUs, cfg.maxUs, cfg.angleMin, cfg.angleMax);
         }
+
+        servos[i]->setOutputDeadband(cfg.deadbandTicks);
+        servos[i]->setOutputSlewRate(cfg.slewTicksPerSec);
+        servos[i]->setOutputSmoothing(cfg.smoothingMs);
+        if (cfg.deadbandTicks > 0 || cfg.slewTicksPerSec > 0 || cfg.smoothingMs > 0) {
+            Logger::logf(Logger::Level::INFO, "APP", "%s: deadband %d ticks, slew %d ticks/s, smoothing %d ms",
+                        cfg.name, cfg.deadbandTicks, cfg.slewTicksPerSec, cfg.smoothingMs);
+        }
+
+        if (cfg.hold == ServoHold::RELEASE_IDLE) {
+            servos[i]->setHoldPolicy(Devices::Servo::RELEASE_WHEN_IDLE, cfg.releaseMs);
+            Logger::logf(Logger::Level::INFO, "APP", "%s: release after %d ms at rest", cfg.name, cfg.releaseMs);
+        } else if (cfg.hold == ServoHold::RELEASE_DISABLED) {
+            servos[i]->setHoldPolicy(Devices::Servo::RELEASE_WHEN_DISABLED);
+            Logger::logf(Logger::Level::INFO, "APP", "%s: release while disabled", cfg.name);
+        }
     }
 
     // Calibrate joysticks
@@ -224,6 +582,67 @@ void calibrateDevices() {
                     cfg.name, cfg.filterStrength);
     }
 
+    // Calibrate steppers
+    for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+        const auto& cfg = STEPPER_CONFIGS[i];
+        steppers[i]->setStepsPerUnit(cfg.stepsPerUnit);
+        steppers[i]->setSpeed(cfg.maxSpeed);
+        steppers[i]->setAcceleration(cfg.acceleration);
+        steppers[i]->setLimits(cfg.minPosition, cfg.maxPosition);
+        Logger::logf(Logger::Level::INFO, "APP", "%s: %.2f steps/unit, %.1f units/s, %.1f units/s^2",
+                    cfg.name, cfg.stepsPerUnit, cfg.maxSpeed, cfg.acceleration);
+    }
+
+    // Configure digital inputs
+    for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+        const auto& cfg = DIGITAL_INPUT_CONFIGS[i];
+        digitalInputs[i]->setDebounceMs(cfg.debounceMs);
+        digitalInputs[i]->setLongPressMs(cfg.longPressMs);
+        Logger::logf(Logger::Level::INFO, "APP", "%s: debounce %d ms, long press %lu ms",
+                    cfg.name, cfg.debounceMs, (unsigned long)cfg.longPressMs);
+    }
+
+    // Calibrate encoders
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        encoders[i]->setCountsPerUnit(ENCODER_CONFIGS[i].countsPerUnit);
+    }
+
+    // Tune DC servos (scale comes from the feedback encoder)
+    for (uint8_t i = 0; i < DC_SERVO_COUNT; i++) {
+        const auto& cfg = DC_SERVO_CONFIGS[i];
+        dcServos[i]->setCountsPerUnit(ENCODER_CONFIGS[cfg.encoderIndex].countsPerUnit);
+        dcServos[i]->setGains(cfg.kp, cfg.ki, cfg.kd);
+        dcServos[i]->setFeedForward(cfg.kv, cfg.ks);
+        dcServos[i]->setMaxSpeed(cfg.maxSpeed);
+        dcServos[i]->setLimits(cfg.minPosition, cfg.maxPosition);
+        Logger::logf(Logger::Level::INFO, "APP", "%s: %d Hz, kp=%.4f ki=%.4f kd=%.5f kv=%.5f",
+                    cfg.name, cfg.rateHz, cfg.kp, cfg.ki, cfg.kd, cfg.kv);
+    }
+
+    // Configure distance arrays
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_COUNT; i++) {
+        const auto& cfg = DISTANCE_ARRAY_CONFIGS[i];
+        distanceArrays[i]->setSlotInterval(cfg.slotMs);
+        distanceArrays[i]->setBeamWidth(cfg.beamDeg);
+        distanceArrays[i]->setAlertDistance(cfg.alertCm);
+        Logger::logf(Logger::Level::INFO, "APP", "%s: %d ms slots, %.0f deg beam, alert %.1f cm",
+                    cfg.name, cfg.slotMs, cfg.beamDeg, cfg.alertCm);
+    }
+
+    // Calibrate analog input arrays (axis order = order in ANALOG_AXIS_CONFIGS)
+    for (uint8_t i = 0; i < ANALOG_INPUT_ARRAY_COUNT; i++) {
+        const auto& cfg = ANALOG_INPUT_ARRAY_CONFIGS[i];
+        uint8_t axis = 0;
+        for (uint8_t j = 0; j < ANALOG_AXIS_COUNT; j++) {
+            const auto& axisCfg = ANALOG_AXIS_CONFIGS[j];
+            if (axisCfg.arrayIndex != i) continue;
+            analogInputArrays[i]->calibrateAxis(axis++, axisCfg.min, axisCfg.center, axisCfg.max);
+        }
+        analogInputArrays[i]->setDeadzone(cfg.deadzone);
+        analogInputArrays[i]->setChangeThreshold(cfg.changeThreshold);
+        Logger::logf(Logger::Level::INFO, "APP", "%s: %d axes calibrated", cfg.name, axis);
+    }
+
     Logger::info("APP", "All devices calibrated");
 }
 
@@ -231,22 +650,53 @@ void registerAllDevices(DeviceRegistry* registry) {
     Logger::info("APP", "Registering devices to framework...");
 
     for (uint8_t i = 0; i < SERVO_COUNT; i++) {
-        registry->registerDevice(servos[i].get());
+        registry->registerDevice(servos[i]);
         Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", servos[i]->getName());
     }
 
     for (uint8_t i = 0; i < JOYSTICK_COUNT; i++) {
-        registry->registerDevice(joysticks[i].get());
+        registry->registerDevice(joysticks[i]);
         Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", joysticks[i]->getName());
     }
 
     for (uint8_t i = 0; i < DISTANCE_SENSOR_COUNT; i++) {
-        registry->registerDevice(distanceSensors[i].get());
+        registry->registerDevice(distanceSensors[i]);
         Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", distanceSensors[i]->getName());
     }
 
+    for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+        registry->registerDevice(steppers[i]);
+        Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", steppers[i]->getName());
+    }
+
+    for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+        registry->registerDevice(digitalInputs[i]);
+        Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", digitalInputs[i]->getName());
+    }
+
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        registry->registerDevice(encoders[i]);
+        Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", encoders[i]->getName());
+    }
+
+    for (uint8_t i = 0; i < DC_SERVO_COUNT; i++) {
+        registry->registerDevice(dcServos[i]);
+        Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", dcServos[i]->getName());
+    }
+
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_COUNT; i++) {
+        registry->registerDevice(distanceArrays[i]);
+        Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", distanceArrays[i]->getName());
+    }
+
+    for (uint8_t i = 0; i < ANALOG_INPUT_ARRAY_COUNT; i++) {
+        registry->registerDevice(analogInputArrays[i]);
+        Logger::logf(Logger::Level::INFO, "APP", "Registered: %s", analogInputArrays[i]->getName());
+    }
+
     Logger::logf(Logger::Level::INFO, "APP", "Total devices registered: %d",
-                SERVO_COUNT + JOYSTICK_COUNT + DISTANCE_SENSOR_COUNT);
+                SERVO_COUNT + JOYSTICK_COUNT + DISTANCE_SENSOR_COUNT + STEPPER_COUNT + DIGITAL_INPUT_COUNT +
+                ENCODER_COUNT + DC_SERVO_COUNT + DISTANCE_ARRAY_COUNT + ANALOG_INPUT_ARRAY_COUNT);
 }
 
 Devices::Servo& getServo(uint8_t index) {
@@ -339,6 +789,180 @@ Devices::DistanceSensor& distanceSensor(const char* name) {
     return getDistanceSensorByName(name);
 }
 
+Devices::Stepper& getStepper(uint8_t index) {
+    if (index >= STEPPER_COUNT) {
+        Logger::logf(Logger::Level::ERROR, "APP", "Invalid stepper index %d (%d configured)", index, STEPPER_COUNT);
+        Logger::fatal("APP", "System halted - fix application code (check stepper index)");
+    }
+    return *steppers[index];
+}
+
+Devices::Stepper& getStepperByName(const char* name) {
+    for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+        if (strcmp(steppers[i]->getName(), name) == 0) {
+            return *steppers[i];
+        }
+    }
+
+    // Not found - CRITICAL ERROR, halt system
+    Logger::logf(Logger::Level::ERROR, "APP", "Stepper not found: '%s'", name);
+    Logger::error("APP", "Available steppers:");
+    for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+        Logger::logf(Logger::Level::ERROR, "APP", "  - '%s'", steppers[i]->getName());
+    }
+    Logger::fatal("APP", "System halted - fix application code (check device name)");
+    // Logger::fatal() halts MCU internally
+}
+
+Devices::Stepper& stepper(const char* name) {
+    return getStepperByName(name);
+}
+
+Devices::DigitalInput& getDigitalInput(uint8_t index) {
+    if (index >= DIGITAL_INPUT_COUNT) {
+        Logger::logf(Logger::Level::ERROR, "APP", "Invalid input index %d (%d configured)", index, DIGITAL_INPUT_COUNT);
+        Logger::fatal("APP", "System halted - fix application code (check input index)");
+    }
+    return *digitalInputs[index];
+}
+
+Devices::DigitalInput& getDigitalInputByName(const char* name) {
+    for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+        if (strcmp(digitalInputs[i]->getName(), name) == 0) {
+            return *digitalInputs[i];
+        }
+    }
+
+    // Not found - CRITICAL ERROR, halt system
+    Logger::logf(Logger::Level::ERROR, "APP", "Digital input not found: '%s'", name);
+    Logger::error("APP", "Available digital inputs:");
+    for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+        Logger::logf(Logger::Level::ERROR, "APP", "  - '%s'", digitalInputs[i]->getName());
+    }
+    Logger::fatal("APP", "System halted - fix application code (check device name)");
+    // Logger::fatal() halts MCU internally
+}
+
+Devices::DigitalInput& digitalInput(const char* name) {
+    return getDigitalInputByName(name);
+}
+
+Devices::Encoder& getEncoder(uint8_t index) {
+    if (index >= ENCODER_COUNT) {
+        Logger::logf(Logger::Level::ERROR, "APP", "Invalid encoder index %d (%d configured)", index, ENCODER_COUNT);
+        Logger::fatal("APP", "System halted - fix application code (check encoder index)");
+    }
+    return *encoders[index];
+}
+
+Devices::Encoder& getEncoderByName(const char* name) {
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        if (strcmp(encoders[i]->getName(), name) == 0) {
+            return *encoders[i];
+        }
+    }
+
+    // Not found - CRITICAL ERROR, halt system
+    Logger::logf(Logger::Level::ERROR, "APP", "Encoder not found: '%s'", name);
+    Logger::error("APP", "Available encoders:");
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        Logger::logf(Logger::Level::ERROR, "APP", "  - '%s'", encoders[i]->getName());
+    }
+    Logger::fatal("APP", "System halted - fix application code (check device name)");
+    // Logger::fatal() halts MCU internally
+}
+
+Devices::Encoder& encoder(const char* name) {
+    return getEncoderByName(name);
+}
+
+Devices::DCServo& getDCServo(uint8_t index) {
+    if (index >= DC_SERVO_COUNT) {
+        Logger::logf(Logger::Level::ERROR, "APP", "Invalid DC servo index %d (%d configured)", index, DC_SERVO_COUNT);
+        Logger::fatal("APP", "System halted - fix application code (check DC servo index)");
+    }
+    return *dcServos[index];
+}
+
+Devices::DCServo& getDCServoByName(const char* name) {
+    for (uint8_t i = 0; i < DC_SERVO_COUNT; i++) {
+        if (strcmp(dcServos[i]->getName(), name) == 0) {
+            return *dcServos[i];
+        }
+    }
+
+    // Not found - CRITICAL ERROR, halt system
+    Logger::logf(Logger::Level::ERROR, "APP", "DC servo not found: '%s'", name);
+    Logger::error("APP", "Available DC servos:");
+    for (uint8_t i = 0; i < DC_SERVO_COUNT; i++) {
+        Logger::logf(Logger::Level::ERROR, "APP", "  - '%s'", dcServos[i]->getName());
+    }
+    Logger::fatal("APP", "System halted - fix application code (check device name)");
+    // Logger::fatal() halts MCU internally
+}
+
+Devices::DCServo& dcServo(const char* name) {
+    return getDCServoByName(name);
+}
+
+Devices::DistanceArray& getDistanceArray(uint8_t index) {
+    if (index >= DISTANCE_ARRAY_COUNT) {
+        Logger::logf(Logger::Level::ERROR, "APP", "Invalid distance array index %d (%d configured)", index, DISTANCE_ARRAY_COUNT);
+        Logger::fatal("APP", "System halted - fix application code (check distance array index)");
+    }
+    return *distanceArrays[index];
+}
+
+Devices::DistanceArray& getDistanceArrayByName(const char* name) {
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_COUNT; i++) {
+        if (strcmp(distanceArrays[i]->getName(), name) == 0) {
+            return *distanceArrays[i];
+        }
+    }
+
+    // Not found - CRITICAL ERROR, halt system
+    Logger::logf(Logger::Level::ERROR, "APP", "Distance array not found: '%s'", name);
+    Logger::error("APP", "Available distance arrays:");
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_COUNT; i++) {
+        Logger::logf(Logger::Level::ERROR, "APP", "  - '%s'", distanceArrays[i]->getName());
+    }
+    Logger::fatal("APP", "System halted - fix application code (check device name)");
+    // Logger::fatal() halts MCU internally
+}
+
+Devices::DistanceArray& distanceArray(const char* name) {
+    return getDistanceArrayByName(name);
+}
+
+Devices::AnalogInputArray& getAnalogInputArray(uint8_t index) {
+    if (index >= ANALOG_INPUT_ARRAY_COUNT) {
+        Logger::logf(Logger::Level::ERROR, "APP", "Invalid analog input array index %d (%d configured)", index, ANALOG_INPUT_ARRAY_COUNT);
+        Logger::fatal("APP", "System halted - fix application code (check analog input array index)");
+    }
+    return *analogInputArrays[index];
+}
+
+Devices::AnalogInputArray& getAnalogInputArrayByName(const char* name) {
+    for (uint8_t i = 0; i < ANALOG_INPUT_ARRAY_COUNT; i++) {
+        if (strcmp(analogInputArrays[i]->getName(), name) == 0) {
+            return *analogInputArrays[i];
+        }
+    }
+
+    // Not found - CRITICAL ERROR, halt system
+    Logger::logf(Logger::Level::ERROR, "APP", "Analog input array not found: '%s'", name);
+    Logger::error("APP", "Available analog input arrays:");
+    for (uint8_t i = 0; i < ANALOG_INPUT_ARRAY_COUNT; i++) {
+        Logger::logf(Logger::Level::ERROR, "APP", "  - '%s'", analogInputArrays[i]->getName());
+    }
+    Logger::fatal("APP", "System halted - fix application code (check device name)");
+    // Logger::fatal() halts MCU internally
+}
+
+Devices::AnalogInputArray& analogInputArray(const char* name) {
+    return getAnalogInputArrayByName(name);
+}
+
 uint8_t getServoCount() {
     return SERVO_COUNT;
 }
@@ -351,6 +975,55 @@ uint8_t getDistanceSensorCount() {
     return DISTANCE_SENSOR_COUNT;
 }
 
+uint8_t getStepperCount() {
+    return STEPPER_COUNT;
+}
+
+uint8_t getDigitalInputCount() {
+    return DIGITAL_INPUT_COUNT;
+}
+
+uint8_t getEncoderCount() {
+    return ENCODER_COUNT;
+}
+
+uint8_t getDCServoCount() {
+    return DC_SERVO_COUNT;
+}
+
+uint8_t getDistanceArrayCount() {
+    return DISTANCE_ARRAY_COUNT;
+}
+
+uint8_t getAnalogInputArrayCount() {
+    return ANALOG_INPUT_ARRAY_COUNT;
+}
+
+const Arena& arena() {
+    return appArena;
+}
+
+#if TWIST_ENABLE_RECORDING
+DriverRecorder& recorder() {
+    return driverRecorder;
+}
+#endif
+
+#if TWIST_ENABLE_SAFETY
+SafetySupervisor& safety() {
+    if (!safetySupervisor) {
+        Logger::fatal("APP", "App::safety() called before initializeSystem()");
+    }
+    return *safetySupervisor;
+}
+#endif
+
+#if TWIST_ENABLE_ASYNC_I2C
+I2CQueue& i2c() {
+    return i2cQueue;
+}
+#endif
+
 // ============================================================================
 // Phase 2: Single Entry Point API (v1.1.0)
 // ============================================================================
@@ -364,6 +1037,33 @@ void initializeSystem(TwiSTFramework& framework) {
 
     // Step 3: Register devices to framework (enables framework.loop() updates)
     registerAllDevices(framework.registry());
+
+#if TWIST_ENABLE_RECORDING
+    // Step 4: Start recording driver I/O (LittleFS mounted by framework.initialize())
+    if (driverRecorder.open(TWIST_RECORDING_PATH, TWIST_RECORDING_MAX_BYTES)) {
+        framework.addService(&driverRecorder, SERVICE_AFTER_BRIDGES);
+    }
+#endif
+
+#if TWIST_ENABLE_SAFETY
+    // Step 5: Gate timed servo moves on the supply budget
+    safetySupervisor = make<SafetySupervisor>(framework.eventBus(), TWIST_SAFETY_BUDGET_MA);
+    for (uint8_t i = 0; i < SERVO_COUNT; i++) {
+        safetySupervisor->supervise(*servos[i]);
+        servos[i]->setMotionSupervisor(safetySupervisor);
+    }
+    framework.addService(safetySupervisor, SERVICE_AFTER_BRIDGES);
+    Logger::logf(Logger::Level::INFO, "APP", "Safety supervisor: %d servos, budget %.0f mA",
+                SERVO_COUNT, TWIST_SAFETY_BUDGET_MA);
+#endif
+
+#if TWIST_ENABLE_ASYNC_I2C
+    // Step 6: Retire finished I2C writes (stats, callbacks) once per loop
+    framework.addService(&i2cQueue, SERVICE_AFTER_BRIDGES);
+#endif
+
+    // Startup objects are all in place - later requests are bugs
+    appArena.seal();
 }
 
 }  // namespace App
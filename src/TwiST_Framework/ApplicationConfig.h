@@ -25,8 +25,25 @@
 #include "Devices/Servo.h"
 #include "Devices/Joystick.h"
 #include "Devices/DistanceSensor.h"
+#include "Devices/Stepper.h"
+#include "Devices/DigitalInput.h"
+#include "Devices/Encoder.h"
+#include "Devices/DCServo.h"
+#include "Devices/DistanceArray.h"
+#include "Devices/AnalogInputArray.h"
 #include "Core/EventBus.h"
 #include "Core/DeviceRegistry.h"
+#include "Core/Arena.h"
+#include "TwiST_Config.h"
+#if TWIST_ENABLE_RECORDING
+#include "Core/DriverRecorder.h"
+#endif
+#if TWIST_ENABLE_SAFETY
+#include "Core/SafetySupervisor.h"
+#endif
+#if TWIST_ENABLE_ASYNC_I2C
+#include "Core/I2CQueue.h"
+#endif
 
 // Forward declaration (global scope - TwiSTFramework is NOT in TwiST namespace)
 class TwiSTFramework;
@@ -189,6 +206,196 @@ uint8_t getJoystickCount();
  */
 uint8_t getDistanceSensorCount();
 
+/**
+ * @brief Get stepper by index
+ * @param index Stepper index (0-based)
+ * @return Reference to Stepper instance
+ *
+ * Example: App::getStepper(0).setValue(120.0f);
+ * NOTE: Prefer getStepperByName() for production code (name-based access is stable)
+ */
+Devices::Stepper& getStepper(uint8_t index);
+
+/**
+ * @brief Get stepper by name (production-style access)
+ * @param name Device name (e.g., "Slide")
+ * @return Reference to Stepper instance
+ */
+Devices::Stepper& getStepperByName(const char* name);
+
+/**
+ * @brief Clean alias for getStepperByName() - production style
+ * @param name Device name (e.g., "Slide")
+ * @return Reference to Stepper instance
+ *
+ * Example: App::stepper("Slide").moveTo(120.0f, 2000);
+ */
+Devices::Stepper& stepper(const char* name);
+
+/**
+ * @brief Get number of steppers configured
+ * @return Stepper count
+ */
+uint8_t getStepperCount();
+
+/**
+ * @brief Get digital input by index
+ * @param index Input index (0-based)
+ * @return Reference to DigitalInput instance
+ *
+ * Example: if (App::getDigitalInput(0).isPressed()) { ... }
+ * NOTE: Prefer getDigitalInputByName() for production code (name-based access is stable)
+ */
+Devices::DigitalInput& getDigitalInput(uint8_t index);
+
+/**
+ * @brief Get digital input by name (production-style access)
+ * @param name Device name (e.g., "StartButton")
+ * @return Reference to DigitalInput instance
+ */
+Devices::DigitalInput& getDigitalInputByName(const char* name);
+
+/**
+ * @brief Clean alias for getDigitalInputByName() - production style
+ * @param name Device name (e.g., "StartButton")
+ * @return Reference to DigitalInput instance
+ *
+ * Example: App::digitalInput("StartButton").getPressCount();
+ */
+Devices::DigitalInput& digitalInput(const char* name);
+
+/**
+ * @brief Get number of digital inputs configured
+ * @return Digital input count
+ */
+uint8_t getDigitalInputCount();
+
+/**
+ * @brief Get encoder by index
+ * @param index Encoder index (0-based)
+ * @return Reference to Encoder instance
+ *
+ * Example: float deg = App::getEncoder(0).getPosition();
+ * NOTE: Prefer getEncoderByName() for production code (name-based access is stable)
+ */
+Devices::Encoder& getEncoder(uint8_t index);
+
+/**
+ * @brief Get encoder by name (production-style access)
+ * @param name Device name (e.g., "ElbowEnc")
+ * @return Reference to Encoder instance
+ */
+Devices::Encoder& getEncoderByName(const char* name);
+
+/**
+ * @brief Clean alias for getEncoderByName() - production style
+ * @param name Device name (e.g., "ElbowEnc")
+ * @return Reference to Encoder instance
+ *
+ * Example: App::encoder("ElbowEnc").getVelocity();
+ */
+Devices::Encoder& encoder(const char* name);
+
+/**
+ * @brief Get number of encoders configured
+ * @return Encoder count
+ */
+uint8_t getEncoderCount();
+
+/**
+ * @brief Get DC servo by index
+ * @param index DC servo index (0-based)
+ * @return Reference to DCServo instance
+ *
+ * Example: App::getDCServo(0).setValue(45.0f);
+ * NOTE: Prefer getDCServoByName() for production code (name-based access is stable)
+ */
+Devices::DCServo& getDCServo(uint8_t index);
+
+/**
+ * @brief Get DC servo by name (production-style access)
+ * @param name Device name (e.g., "Elbow")
+ * @return Reference to DCServo instance
+ */
+Devices::DCServo& getDCServoByName(const char* name);
+
+/**
+ * @brief Clean alias for getDCServoByName() - production style
+ * @param name Device name (e.g., "Elbow")
+ * @return Reference to DCServo instance
+ *
+ * Example: App::dcServo("Elbow").moveTo(45.0f, 500);
+ */
+Devices::DCServo& dcServo(const char* name);
+
+/**
+ * @brief Get number of DC servos configured
+ * @return DC servo count
+ */
+uint8_t getDCServoCount();
+
+/**
+ * @brief Get distance array by index
+ * @param index Distance array index (0-based)
+ * @return Reference to DistanceArray instance
+ *
+ * NOTE: Prefer getDistanceArrayByName() for production code (name-based access is stable)
+ */
+Devices::DistanceArray& getDistanceArray(uint8_t index);
+
+/**
+ * @brief Get distance array by name (production-style access)
+ * @param name Device name (e.g., "Sonar")
+ * @return Reference to DistanceArray instance
+ */
+Devices::DistanceArray& getDistanceArrayByName(const char* name);
+
+/**
+ * @brief Clean alias for getDistanceArrayByName() - production style
+ * @param name Device name (e.g., "Sonar")
+ * @return Reference to DistanceArray instance
+ *
+ * Example: float ahead = App::distanceArray("Sonar").rangeAt(0.0f);
+ */
+Devices::DistanceArray& distanceArray(const char* name);
+
+/**
+ * @brief Get number of distance arrays configured
+ * @return Distance array count
+ */
+uint8_t getDistanceArrayCount();
+
+/**
+ * @brief Get analog input array by index
+ * @param index Analog input array index (0-based)
+ * @return Reference to AnalogInputArray instance
+ *
+ * NOTE: Prefer getAnalogInputArrayByName() for production code (name-based access is stable)
+ */
+Devices::AnalogInputArray& getAnalogInputArray(uint8_t index);
+
+/**
+ * @brief Get analog input array by name (production-style access)
+ * @param name Device name (e.g., "Console")
+ * @return Reference to AnalogInputArray instance
+ */
+Devices::AnalogInputArray& getAnalogInputArrayByName(const char* name);
+
+/**
+ * @brief Clean alias for getAnalogInputArrayByName() - production style
+ * @param name Device name (e.g., "Console")
+ * @return Reference to AnalogInputArray instance
+ *
+ * Example: const float* axes = App::analogInputArray("Console").getValues();
+ */
+Devices::AnalogInputArray& analogInputArray(const char* name);
+
+/**
+ * @brief Get number of analog input arrays configured
+ * @return Analog input array count
+ */
+uint8_t getAnalogInputArrayCount();
+
 /**
  * @brief Single entry point: initialize, calibrate, and register all devices
  * @param framework Reference to TwiST framework instance
@@ -218,6 +425,44 @@ uint8_t getDistanceSensorCount();
  */
 void initializeSystem(TwiSTFramework& framework);
 
+/**
+ * @brief Get the static arena holding every driver and device
+ * @return Arena sized from TwiST_Config.h, sealed by initializeSystem()
+ *
+ * Example: Serial.printf("%u of %u bytes\n", App::arena().getUsed(), App::arena().getCapacity());
+ */
+const Arena& arena();
+
+#if TWIST_ENABLE_RECORDING
+/**
+ * @brief Get the driver I/O recorder (TWIST_ENABLE_RECORDING only)
+ * @return Recorder started by initializeSystem()
+ *
+ * Example: App::recorder().close();  // Flush before reading the log
+ */
+DriverRecorder& recorder();
+#endif
+
+#if TWIST_ENABLE_SAFETY
+/**
+ * @brief Get the servo safety supervisor (TWIST_ENABLE_SAFETY only)
+ * @return Supervisor created by initializeSystem() - every servo attached
+ *
+ * Example: App::safety().attachFeedback(100, App::getJoystick(0), 0, 0.0f, 180.0f);
+ */
+SafetySupervisor& safety();
+#endif
+
+#if TWIST_ENABLE_ASYNC_I2C
+/**
+ * @brief Get the PCA9685 I2C write queue (TWIST_ENABLE_ASYNC_I2C only)
+ * @return Queue every PCA9685 driver writes through
+ *
+ * Example: Serial.printf("I2C busy %.0f%%\n", App::i2c().getUtilization() * 100.0f);
+ */
+I2CQueue& i2c();
+#endif
+
 }  // namespace App
 }  // namespace TwiST
 
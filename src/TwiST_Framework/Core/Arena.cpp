@@ -0,0 +1,52 @@
+#include "Arena.h"
+#include "Logger.h"
+#include <stdio.h>
+
+namespace TwiST {
+
+    Arena::Arena(uint8_t* buffer, size_t capacity, const char* name)
+        : _buffer(buffer),
+          _capacity(capacity),
+          _used(0),
+          _objects(0),
+          _failed(0),
+          _sealed(false),
+          _name(name) {
+    }
+
+    void* Arena::allocate(size_t size) {
+        if (_sealed) {
+            _failed++;
+            Logger::logf(Logger::Level::ERROR, "ARENA", "%s: %u bytes requested after seal",
+                        _name, (unsigned)size);
+            return NULL;
+        }
+
+        size_t rounded = (size + ALIGN - 1) & ~(ALIGN - 1);
+        if (rounded > _capacity - _used) {
+            _failed++;
+            Logger::logf(Logger::Level::ERROR, "ARENA", "%s full: %u bytes requested, %u of %u free",
+                        _name, (unsigned)size, (unsigned)(_capacity - _used), (unsigned)_capacity);
+            return NULL;
+        }
+
+        void* mem = _buffer + _used;
+        _used += rounded;
+        _objects++;
+        return mem;
+    }
+
+    void Arena::halt() const {
+        char message[64];
+        snprintf(message, sizeof(message), "%s arena exhausted - its size is out of date", _name);
+        Logger::fatal("ARENA", message);
+    }
+
+    void Arena::seal() {
+        if (_sealed) return;
+        _sealed = true;
+        Logger::logf(Logger::Level::INFO, "ARENA", "%s sealed: %u objects, %u of %u bytes",
+                    _name, (unsigned)_objects, (unsigned)_used, (unsigned)_capacity);
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,141 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      Arena.h
+ * @brief     Static bump allocator for objects that live for the whole run
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Memory Utility (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Storage is a fixed buffer sized at compile time (StaticArena<N>) -
+ *   drivers and devices never touch the heap, so a long run cannot
+ *   fragment it
+ * - Objects are created during startup and never destroyed - the arena
+ *   has no free(), only seal()
+ * - After seal() every create() fails (logged, returns NULL): a late
+ *   allocation is a bug to find, not memory to hand out
+ *
+ * CAPABILITIES:
+ * - create<T>(args...) - placement new, alignment up to TWIST_ARENA_ALIGN
+ * - footprint<T>() - compile-time size of one object, for sizing N
+ * - Used / capacity / failed-request accounting
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_ARENA_H
+#define TWIST_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <utility>
+
+// Alignment of every arena object (covers double / int64_t members)
+#ifndef TWIST_ARENA_ALIGN
+#define TWIST_ARENA_ALIGN 8
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Bump allocator over a caller-provided buffer
+     *
+     * Example:
+     * ```cpp
+     * StaticArena<Arena::footprint<Servo>() * 4> arena("SERVOS");
+     * Servo* s = arena.create<Servo>(pwm, 0, 1, "Base", eventBus);
+     * arena.seal();                              // Startup done
+     * ```
+     */
+    class Arena {
+    public:
+        static constexpr size_t ALIGN = TWIST_ARENA_ALIGN;
+
+        /**
+         * @brief Bytes one T takes in an arena (sum these to size a StaticArena)
+         */
+        template<typename T>
+        static constexpr size_t footprint() {
+            return (sizeof(T) + ALIGN - 1) & ~(ALIGN - 1);
+        }
+
+        Arena(uint8_t* buffer, size_t capacity, const char* name);
+
+        /**
+         * @brief Construct a T in the arena
+         * @return NULL if sealed or out of space (logged)
+         */
+        template<typename T, typename... Args>
+        T* create(Args&&... args) {
+            static_assert(alignof(T) <= ALIGN, "Type needs more alignment than TWIST_ARENA_ALIGN");
+            void* mem = allocate(sizeof(T));
+            return mem ? new (mem) T(std::forward<Args>(args)...) : NULL;
+        }
+
+        /**
+         * @brief create() for arenas sized exactly at compile time
+         * @return Never NULL - running out means the size is out of date: Logger::fatal() halts
+         */
+        template<typename T, typename... Args>
+        T* createOrHalt(Args&&... args) {
+            T* obj = create<T>(std::forward<Args>(args)...);
+            if (!obj) halt();
+            return obj;
+        }
+
+        /**
+         * @brief Raw aligned block (rounded up to ALIGN)
+         * @return NULL if sealed or out of space (logged)
+         */
+        void* allocate(size_t size);
+
+        /**
+         * @brief End of startup - later requests fail
+         */
+        void seal();
+        bool isSealed() const { return _sealed; }
+
+        const char* getName() const { return _name; }
+        size_t getUsed() const { return _used; }
+        size_t getCapacity() const { return _capacity; }
+        size_t getFree() const { return _capacity - _used; }
+        size_t getObjectCount() const { return _objects; }
+        unsigned long getFailedCount() const { return _failed; }  // Refused requests (full or sealed)
+
+    private:
+        uint8_t* _buffer;
+        size_t _capacity;
+        size_t _used;
+        size_t _objects;
+        unsigned long _failed;
+        bool _sealed;
+        const char* _name;
+
+        void halt() const;
+    };
+
+    /**
+     * @brief Arena with its own storage (static object = .bss, not heap)
+     */
+    template<size_t N>
+    class StaticArena : public Arena {
+    public:
+        explicit StaticArena(const char* name)
+            : Arena(_storage, N, name) {}
+
+    private:
+        alignas(TWIST_ARENA_ALIGN) uint8_t _storage[N > 0 ? N : 1];
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_ARENA_H
@@ -0,0 +1,422 @@
+#include "Behavior.h"
+
+#if TWIST_ENABLE_BEHAVIORS
+
+#include "Logger.h"
+#include <string.h>
+
+namespace TwiST {
+
+    static_assert(BehaviorRunner::CAPACITY > 0 && BehaviorRunner::CAPACITY < 0xFFFF,
+                  "TWIST_BEHAVIOR_CAPACITY must be 1..65534");
+    static_assert(TWIST_BEHAVIOR_TOPICS > 0 && TWIST_BEHAVIOR_TOPICS < 256,
+                  "TWIST_BEHAVIOR_TOPICS must be 1..255");
+
+    namespace {
+        // Frame pool - coroutine frames are created before start(), so it is not per runner
+        constexpr size_t FRAME_ALIGN = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        constexpr size_t FRAME_STRIDE = (TWIST_BEHAVIOR_FRAME_BYTES + FRAME_ALIGN - 1) / FRAME_ALIGN * FRAME_ALIGN;
+
+        alignas(FRAME_ALIGN) uint8_t g_frames[TWIST_BEHAVIOR_CAPACITY * FRAME_STRIDE];
+        uint16_t g_freeFrames[TWIST_BEHAVIOR_CAPACITY];
+        uint16_t g_freeFrameCount = 0;
+        uint16_t g_untouchedFrames = TWIST_BEHAVIOR_CAPACITY;  // Never handed out yet
+        uint16_t g_framesInUse = 0;
+        size_t g_largestFrame = 0;
+        unsigned long g_frameFailures = 0;
+
+        std::coroutine_handle<BehaviorPromise> handleAt(void* frame) {
+            return std::coroutine_handle<BehaviorPromise>::from_address(frame);
+        }
+    }
+
+    // ===== Promise / Frame Pool =====
+
+    Behavior BehaviorPromise::get_return_object() noexcept {
+        return Behavior(std::coroutine_handle<BehaviorPromise>::from_promise(*this));
+    }
+
+    Behavior BehaviorPromise::get_return_object_on_allocation_failure() noexcept {
+        return Behavior(nullptr);
+    }
+
+    void BehaviorPromise::unhandled_exception() noexcept {
+        Logger::fatal("BEHAVIOR", "Unhandled exception in behavior");
+    }
+
+    void* BehaviorPromise::operator new(size_t size) noexcept {
+        if (size > g_largestFrame) g_largestFrame = size;
+
+        if (size > TWIST_BEHAVIOR_FRAME_BYTES) {
+            g_frameFailures++;
+            Logger::logf(Logger::Level::ERROR, "BEHAVIOR", "Frame needs %u bytes - raise TWIST_BEHAVIOR_FRAME_BYTES (%u)",
+                        (unsigned)size, (unsigned)TWIST_BEHAVIOR_FRAME_BYTES);
+            return NULL;
+        }
+
+        uint16_t index;
+        if (g_freeFrameCount > 0) {
+            index = g_freeFrames[--g_freeFrameCount];
+        } else if (g_untouchedFrames > 0) {
+            index = TWIST_BEHAVIOR_CAPACITY - g_untouchedFrames--;
+        } else {
+            g_frameFailures++;
+            Logger::logf(Logger::Level::ERROR, "BEHAVIOR", "Frame pool full (%d) - raise TWIST_BEHAVIOR_CAPACITY",
+                        TWIST_BEHAVIOR_CAPACITY);
+            return NULL;
+        }
+        g_framesInUse++;
+        return &g_frames[index * FRAME_STRIDE];
+    }
+
+    void BehaviorPromise::operator delete(void* frame) noexcept {
+        if (frame == NULL) return;
+        g_freeFrames[g_freeFrameCount++] = (uint16_t)(((uint8_t*)frame - g_frames) / FRAME_STRIDE);
+        g_framesInUse--;
+    }
+
+    Behavior::~Behavior() {
+        if (_handle) _handle.destroy();
+    }
+
+    uint16_t BehaviorRunner::getFramesInUse() { return g_framesInUse; }
+    size_t BehaviorRunner::getLargestFrame() { return g_largestFrame; }
+    unsigned long BehaviorRunner::getFrameFailures() { return g_frameFailures; }
+
+    // ===== Awaiters =====
+
+    namespace Behaviors {
+
+        bool SleepAwaiter::await_suspend(std::coroutine_handle<BehaviorPromise> handle) noexcept {
+            BehaviorPromise& promise = handle.promise();
+            return promise.runner->waitTimer(promise.slot, BehaviorRunner::WAIT_TIMER, delayUs);
+        }
+
+        bool MotionAwaiter::await_suspend(std::coroutine_handle<BehaviorPromise> handle) noexcept {
+            BehaviorPromise& promise = handle.promise();
+            uint32_t checkUs = TWIST_BEHAVIOR_MOTION_POLL_US;
+            if (command) {
+                device->moveTo(target, durationMs);
+                checkUs = toMicros(durationMs);  // Expected arrival - verified with isMoving()
+            }
+            promise.runner->_slots[promise.slot].device = device;
+            return promise.runner->waitTimer(promise.slot, BehaviorRunner::WAIT_MOTION, checkUs);
+        }
+
+        bool EventAwaiter::await_suspend(std::coroutine_handle<BehaviorPromise> handle) noexcept {
+            BehaviorPromise& promise = handle.promise();
+            received = Event();
+            return promise.runner->waitEvent(promise.slot, name, timeoutUs, &received);
+        }
+
+    }  // namespace Behaviors
+
+    // ===== Runner =====
+
+    BehaviorRunner::BehaviorRunner(EventBus& eventBus, TimerService& timers)
+        : _eventBus(eventBus),
+          _timers(timers),
+          _freeCount(CAPACITY),
+          _readyHead(NO_SLOT),
+          _readyTail(NO_SLOT),
+          _readyCount(0),
+          _running(NO_SLOT),
+          _topicCount(0),
+          _peak(0),
+          _started(0),
+          _completed(0),
+          _cancelled(0),
+          _resumes(0),
+          _rejected(0) {
+        for (uint16_t i = 0; i < CAPACITY; i++) {
+            _slots[i].frame = NULL;
+            _slots[i].generation = 1;
+            _free[i] = CAPACITY - 1 - i;  // Pop order 0, 1, 2...
+        }
+    }
+
+    BehaviorRunner::~BehaviorRunner() {
+        cancelAll();
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            _eventBus.unsubscribe(_topics[i].listenerId);
+        }
+    }
+
+    BehaviorHandle BehaviorRunner::start(Behavior behavior, const char* name) {
+        if (!behavior.isValid()) {
+            _rejected++;
+            Logger::logf(Logger::Level::ERROR, "BEHAVIOR", "Cannot start '%s': no coroutine frame", name ? name : "?");
+            return 0;
+        }
+        if (_freeCount == 0) {
+            _rejected++;
+            Logger::logf(Logger::Level::ERROR, "BEHAVIOR", "Cannot start '%s': %d behaviors running", name ? name : "?", CAPACITY);
+            return 0;
+        }
+
+        uint16_t index = _free[--_freeCount];
+        Slot& slot = _slots[index];
+        slot.frame = behavior._handle.address();
+        slot.name = name;
+        slot.timer = 0;
+        slot.device = NULL;
+        slot.eventOut = NULL;
+        slot.wait = WAIT_NONE;
+        slot.ready = false;
+        slot.cancelled = false;
+
+        BehaviorPromise& promise = behavior._handle.promise();
+        promise.runner = this;
+        promise.slot = index;
+        behavior._handle = nullptr;  // Runner owns the frame now
+
+        makeReady(index);
+        _started++;
+        if (getRunningCount() > _peak) _peak = getRunningCount();
+        return ((uint32_t)slot.generation << 16) | index;
+    }
+
+    bool BehaviorRunner::cancel(BehaviorHandle handle) {
+        Slot* slot = lookup(handle);
+        if (slot == NULL) return false;
+
+        uint16_t index = (uint16_t)(slot - _slots);
+        if (index == _running) {
+            // Cannot destroy a running frame - update() does it once it suspends
+            if (slot->cancelled) return false;
+            slot->cancelled = true;
+        } else {
+            finish(index);
+        }
+        _cancelled++;
+        return true;
+    }
+
+    void BehaviorRunner::cancelAll() {
+        for (uint16_t i = 0; i < CAPACITY; i++) {
+            if (_slots[i].frame != NULL) {
+                cancel(((uint32_t)_slots[i].generation << 16) | i);
+            }
+        }
+    }
+
+    bool BehaviorRunner::isRunning(BehaviorHandle handle) const {
+        return lookup(handle) != NULL;
+    }
+
+    // ===== IService =====
+
+    void BehaviorRunner::update() {
+        // Only what was ready on entry - wakes raised by these steps run next pass
+        uint16_t budget = _readyCount;
+        while (budget-- > 0 && _readyHead != NO_SLOT) {
+            uint16_t index = _readyHead;
+            listRemove(_readyHead, _readyTail, index);
+            _readyCount--;
+
+            Slot& slot = _slots[index];
+            slot.ready = false;
+            slot.wait = WAIT_NONE;
+
+            std::coroutine_handle<BehaviorPromise> handle = handleAt(slot.frame);
+            _running = index;
+            handle.resume();
+            _running = NO_SLOT;
+            _resumes++;
+
+            if (handle.done()) {
+                _completed++;
+                Logger::logf(Logger::Level::DEBUG, "BEHAVIOR", "'%s' finished", slot.name ? slot.name : "?");
+                finish(index);
+            } else if (slot.cancelled) {
+                finish(index);
+            }
+        }
+    }
+
+    uint32_t BehaviorRunner::getTimeUntilUpdate(uint32_t nowUs) const {
+        // Waits are timers or events - the framework already idles on both
+        return (_readyCount > 0) ? 0 : UINT32_MAX;
+    }
+
+    // ===== Waits =====
+
+    bool BehaviorRunner::waitTimer(uint16_t index, WaitType type, uint32_t delayUs) {
+        Slot& slot = _slots[index];
+        slot.timer = _timers.call(onTimer, &slot, delayUs);
+        if (slot.timer == 0) {
+            _rejected++;
+            return false;  // TimerService logged why
+        }
+        slot.wait = type;
+        return true;
+    }
+
+    bool BehaviorRunner::waitEvent(uint16_t index, const char* name, uint32_t timeoutUs, Event* out) {
+        int topic = findTopic(name);
+        if (topic < 0) {
+            _rejected++;
+            out->name = NULL;
+            return false;
+        }
+
+        Slot& slot = _slots[index];
+        if (timeoutUs > 0) {
+            slot.timer = _timers.call(onTimer, &slot, timeoutUs);
+            if (slot.timer == 0) {
+                _rejected++;
+                out->name = NULL;
+                return false;
+            }
+        }
+        slot.wait = WAIT_EVENT;
+        slot.topic = (uint8_t)topic;
+        slot.eventOut = out;
+        listPush(_topics[topic].head, _topics[topic].tail, index);
+        return true;
+    }
+
+    void BehaviorRunner::onTimer(void* context) {
+        Slot* slot = (Slot*)context;
+        BehaviorRunner* runner = handleAt(slot->frame).promise().runner;
+        uint16_t index = (uint16_t)(slot - runner->_slots);
+        slot->timer = 0;
+
+        switch (slot->wait) {
+            case WAIT_MOTION:
+                // Still easing in (or a stepper slower than its estimate) - look again shortly
+                if (slot->device->isMoving()) {
+                    slot->timer = runner->_timers.call(onTimer, slot, TWIST_BEHAVIOR_MOTION_POLL_US);
+                    if (slot->timer != 0) return;
+                }
+                break;
+            case WAIT_EVENT: {
+                Topic& topic = runner->_topics[slot->topic];
+                runner->listRemove(topic.head, topic.tail, index);
+                slot->eventOut->name = NULL;  // Timed out
+                break;
+            }
+            default:
+                break;
+        }
+        runner->makeReady(index);
+    }
+
+    void BehaviorRunner::onTopicEvent(const Event& event, void* context) {
+        Topic* topic = (Topic*)context;
+        BehaviorRunner* runner = topic->owner;
+
+        while (topic->head != NO_SLOT) {
+            uint16_t index = topic->head;
+            Slot& slot = runner->_slots[index];
+            runner->listRemove(topic->head, topic->tail, index);
+            if (slot.timer != 0) {
+                runner->_timers.cancel(slot.timer);
+                slot.timer = 0;
+            }
+            *slot.eventOut = event;
+            slot.eventOut->data = NULL;  // Payload does not outlive dispatch
+            runner->makeReady(index);
+        }
+    }
+
+    // ===== Helpers =====
+
+    BehaviorRunner::Slot* BehaviorRunner::lookup(BehaviorHandle handle) {
+        uint16_t index = (uint16_t)(handle & 0xFFFF);
+        if (handle == 0 || index >= CAPACITY) return NULL;
+        Slot& slot = _slots[index];
+        return (slot.frame != NULL && slot.generation == (uint16_t)(handle >> 16)) ? &slot : NULL;
+    }
+
+    const BehaviorRunner::Slot* BehaviorRunner::lookup(BehaviorHandle handle) const {
+        return const_cast<BehaviorRunner*>(this)->lookup(handle);
+    }
+
+    int BehaviorRunner::findTopic(const char* name) {
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            if (_topics[i].name == name || strcmp(_topics[i].name, name) == 0) return i;
+        }
+        if (_topicCount >= TWIST_BEHAVIOR_TOPICS) {
+            Logger::logf(Logger::Level::ERROR, "BEHAVIOR", "Cannot wait for '%s': %d event names in use - raise TWIST_BEHAVIOR_TOPICS",
+                        name, TWIST_BEHAVIOR_TOPICS);
+            return -1;
+        }
+
+        Topic& topic = _topics[_topicCount];
+        topic.name = name;
+        topic.owner = this;
+        topic.head = NO_SLOT;
+        topic.tail = NO_SLOT;
+        topic.listenerId = _eventBus.subscribe(name, onTopicEvent, &topic);
+        if (topic.listenerId == 0) {
+            Logger::logf(Logger::Level::ERROR, "BEHAVIOR", "Cannot wait for '%s': no free event listener", name);
+            return -1;
+        }
+        return _topicCount++;
+    }
+
+    void BehaviorRunner::makeReady(uint16_t index) {
+        Slot& slot = _slots[index];
+        if (slot.ready) return;
+        slot.ready = true;
+        slot.wait = WAIT_NONE;
+        listPush(_readyHead, _readyTail, index);
+        _readyCount++;
+    }
+
+    void BehaviorRunner::clearWait(uint16_t index) {
+        Slot& slot = _slots[index];
+        if (slot.timer != 0) {
+            _timers.cancel(slot.timer);
+            slot.timer = 0;
+        }
+        if (slot.wait == WAIT_EVENT) {
+            listRemove(_topics[slot.topic].head, _topics[slot.topic].tail, index);
+        }
+        if (slot.ready) {
+            listRemove(_readyHead, _readyTail, index);
+            _readyCount--;
+            slot.ready = false;
+        }
+        slot.wait = WAIT_NONE;
+    }
+
+    void BehaviorRunner::finish(uint16_t index) {
+        Slot& slot = _slots[index];
+        clearWait(index);
+        handleAt(slot.frame).destroy();  // Frame back to the pool
+        slot.frame = NULL;
+        slot.generation++;
+        if (slot.generation == 0) slot.generation = 1;  // Keep handles non-zero
+        _free[_freeCount++] = index;
+    }
+
+    void BehaviorRunner::listPush(uint16_t& head, uint16_t& tail, uint16_t index) {
+        _slots[index].next = NO_SLOT;
+        _slots[index].prev = tail;
+        if (tail != NO_SLOT) {
+            _slots[tail].next = index;
+        } else {
+            head = index;
+        }
+        tail = index;
+    }
+
+    void BehaviorRunner::listRemove(uint16_t& head, uint16_t& tail, uint16_t index) {
+        Slot& slot = _slots[index];
+        if (slot.prev != NO_SLOT) {
+            _slots[slot.prev].next = slot.next;
+        } else {
+            head = slot.next;
+        }
+        if (slot.next != NO_SLOT) {
+            _slots[slot.next].prev = slot.prev;
+        } else {
+            tail = slot.prev;
+        }
+    }
+
+}  // namespace TwiST
+
+#endif // TWIST_ENABLE_BEHAVIORS
@@ -0,0 +1,337 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      Behavior.h
+ * @brief     Coroutine behaviors: co_await moveTo / sleep / event in sequence
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (added with framework.addService)
+ * - Hardware:     None
+ * - Implements:   IService
+ *
+ * PRINCIPLES:
+ * - A sequence reads top to bottom ("move, wait for the sensor, move
+ *   again") instead of a hand-rolled state machine around isMoving()
+ * - Coroutine frames come from a fixed pool (TWIST_BEHAVIOR_CAPACITY x
+ *   TWIST_BEHAVIOR_FRAME_BYTES) - nothing is allocated from the heap
+ * - A behavior is resumed only when what it awaits completes: sleeps and
+ *   motion end times are TimerService timers, events wake their waiters
+ *   from one EventBus listener per topic. Waiting behaviors cost nothing
+ *   per pass
+ * - Resumed on the loop task only, from TwiSTFramework::update()
+ * - Requires C++20 coroutines - compiled out unless TWIST_ENABLE_BEHAVIORS
+ *
+ * CAPABILITIES:
+ * - Behaviors::moveTo(device, target, ms) - command a move, resume on arrival
+ * - Behaviors::waitIdle(device) - resume when a running move finishes
+ * - Behaviors::sleep(ms)
+ * - Behaviors::event(name, timeoutMs) - resume on the next matching event
+ * - Start / cancel by handle, frame pool and wake statistics
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_BEHAVIOR_H
+#define TWIST_BEHAVIOR_H
+
+#include "../TwiST_Config.h"
+
+#if TWIST_ENABLE_BEHAVIORS
+
+#if !defined(__cpp_impl_coroutine)
+#error "TWIST_ENABLE_BEHAVIORS needs C++20 coroutines (build with -std=gnu++2a or newer)"
+#endif
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/IOutputDevice.h"
+#include "EventBus.h"
+#include "TimerService.h"
+#include <coroutine>
+#include <stddef.h>
+#include <stdint.h>
+
+// How often a finished-on-paper move is re-checked while isMoving() is still true
+#ifndef TWIST_BEHAVIOR_MOTION_POLL_US
+#define TWIST_BEHAVIOR_MOTION_POLL_US 2000
+#endif
+
+namespace TwiST {
+
+    class Behavior;
+    class BehaviorRunner;
+
+    // 0 = invalid / not running
+    typedef uint32_t BehaviorHandle;
+
+    /**
+     * @brief Coroutine promise of Behavior - frames come from the fixed pool
+     */
+    struct BehaviorPromise {
+        BehaviorRunner* runner = nullptr;   // Set by BehaviorRunner::start()
+        uint16_t slot = 0;
+
+        Behavior get_return_object() noexcept;
+        static Behavior get_return_object_on_allocation_failure() noexcept;
+        std::suspend_always initial_suspend() noexcept { return {}; }   // First step runs in update()
+        std::suspend_always final_suspend() noexcept { return {}; }     // Runner destroys the frame
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept;
+
+        static void* operator new(size_t size) noexcept;
+        static void operator delete(void* frame) noexcept;
+    };
+
+    /**
+     * @brief Return type of a behavior coroutine (move-only, hand to start())
+     */
+    class Behavior {
+    public:
+        typedef BehaviorPromise promise_type;
+
+        Behavior(Behavior&& other) noexcept : _handle(other._handle) { other._handle = nullptr; }
+        Behavior(const Behavior&) = delete;
+        Behavior& operator=(const Behavior&) = delete;
+        ~Behavior();    // Frees a frame that was never started
+
+        /**
+         * @brief false if the frame pool was exhausted (logged)
+         */
+        bool isValid() const { return (bool)_handle; }
+
+    private:
+        friend struct BehaviorPromise;
+        friend class BehaviorRunner;
+
+        explicit Behavior(std::coroutine_handle<BehaviorPromise> handle) : _handle(handle) {}
+
+        std::coroutine_handle<BehaviorPromise> _handle;
+    };
+
+    namespace Behaviors {
+
+        // Waits past ~71 minutes do not fit in microseconds - wait the maximum
+        inline uint32_t toMicros(uint32_t ms) {
+            return (ms > UINT32_MAX / 1000U) ? UINT32_MAX : ms * 1000U;
+        }
+
+        struct SleepAwaiter {
+            uint32_t delayUs;
+
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<BehaviorPromise> handle) noexcept;
+            void await_resume() const noexcept {}
+        };
+
+        struct MotionAwaiter {
+            IOutputDevice* device;
+            float target;
+            uint32_t durationMs;
+            bool command;               // false = only wait for the running move
+
+            bool await_ready() const noexcept { return !command && !device->isMoving(); }
+            bool await_suspend(std::coroutine_handle<BehaviorPromise> handle) noexcept;
+            void await_resume() const noexcept {}
+        };
+
+        struct EventAwaiter {
+            const char* name;
+            uint32_t timeoutUs;
+            Event received;             // Filled on wake (.name = NULL on timeout)
+
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<BehaviorPromise> handle) noexcept;
+            Event await_resume() const noexcept { return received; }
+        };
+
+        /**
+         * @brief Resume after ms milliseconds (at most UINT32_MAX us, ~71 minutes)
+         */
+        inline SleepAwaiter sleep(uint32_t ms) {
+            return SleepAwaiter{toMicros(ms)};
+        }
+
+        /**
+         * @brief Command device->moveTo(target, durationMs), resume when it stops moving
+         */
+        inline MotionAwaiter moveTo(IOutputDevice& device, float target, uint32_t durationMs) {
+            return MotionAwaiter{&device, target, durationMs, true};
+        }
+
+        /**
+         * @brief Resume when a move started elsewhere finishes (immediately if idle)
+         */
+        inline MotionAwaiter waitIdle(IOutputDevice& device) {
+            return MotionAwaiter{&device, 0.0f, 0, false};
+        }
+
+        /**
+         * @brief Resume on the next event named name (static string)
+         * @param timeoutMs 0 = wait forever; on timeout the returned Event has .name == NULL
+         * @return The event (.data is NULL - the payload only lives during dispatch)
+         */
+        inline EventAwaiter event(const char* name, uint32_t timeoutMs = 0) {
+            return EventAwaiter{name, toMicros(timeoutMs), Event()};
+        }
+
+    }  // namespace Behaviors
+
+    /**
+     * @brief Runs behavior coroutines from TwiSTFramework::update()
+     *
+     * Example:
+     * ```cpp
+     * Behavior pickAndPlace(Servo& base, Servo& gripper) {
+     *     while (true) {
+     *         co_await Behaviors::event("distance.changed");
+     *         co_await Behaviors::moveTo(base, 120.0f, 800);
+     *         co_await Behaviors::moveTo(gripper, 90.0f, 300);
+     *         co_await Behaviors::sleep(500);
+     *         co_await Behaviors::moveTo(base, 30.0f, 800);
+     *     }
+     * }
+     *
+     * BehaviorRunner behaviors(framework.eventBus(), framework.timers());
+     * framework.addService(&behaviors, SERVICE_BEFORE_DEVICES);
+     * behaviors.start(pickAndPlace(App::servo("Base"), App::servo("Gripper")), "PickPlace");
+     * ```
+     */
+    class BehaviorRunner : public IService {
+    public:
+        static constexpr uint16_t CAPACITY = TWIST_BEHAVIOR_CAPACITY;
+
+        BehaviorRunner(EventBus& eventBus, TimerService& timers);
+        ~BehaviorRunner();
+
+        // ===== Control =====
+
+        /**
+         * @brief Take ownership of a behavior; its first step runs on the next update()
+         * @param name Static string for diagnostics (may be NULL)
+         * @return Handle, or 0 if the behavior has no frame or all slots are busy (logged)
+         */
+        BehaviorHandle start(Behavior behavior, const char* name = NULL);
+
+        /**
+         * @brief Stop a behavior and free its frame (safe from inside itself)
+         * @return false if it already finished or the handle is invalid
+         */
+        bool cancel(BehaviorHandle handle);
+
+        void cancelAll();
+
+        bool isRunning(BehaviorHandle handle) const;
+
+        // ===== IService =====
+
+        /**
+         * @brief Resume every behavior whose wait completed
+         */
+        void update() override;
+        const char* getName() const override { return "Behaviors"; }
+        uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+        // ===== Statistics =====
+
+        uint16_t getRunningCount() const { return CAPACITY - _freeCount; }
+        uint16_t getPeakRunningCount() const { return _peak; }
+        uint16_t getReadyCount() const { return _readyCount; }
+        unsigned long getStartedCount() const { return _started; }
+        unsigned long getCompletedCount() const { return _completed; }
+        unsigned long getCancelledCount() const { return _cancelled; }
+        unsigned long getResumeCount() const { return _resumes; }
+        unsigned long getRejectedCount() const { return _rejected; }   // Failed starts and waits
+
+        // Frame pool (shared by every runner)
+        static uint16_t getFramesInUse();
+        static size_t getLargestFrame();           // Biggest frame requested - tune TWIST_BEHAVIOR_FRAME_BYTES
+        static unsigned long getFrameFailures();
+
+    private:
+        friend struct Behaviors::SleepAwaiter;
+        friend struct Behaviors::MotionAwaiter;
+        friend struct Behaviors::EventAwaiter;
+
+        static constexpr uint16_t NO_SLOT = 0xFFFF;
+
+        enum WaitType : uint8_t {
+            WAIT_NONE,          // Running, or queued to run
+            WAIT_TIMER,
+            WAIT_MOTION,
+            WAIT_EVENT
+        };
+
+        struct Slot {
+            void* frame;                // Coroutine frame, NULL = free
+            const char* name;
+            TimerHandle timer;          // Sleep, motion check or event timeout
+            IOutputDevice* device;      // WAIT_MOTION
+            Event* eventOut;            // WAIT_EVENT - EventAwaiter::received
+            uint16_t generation;        // Bumped on free - invalidates old handles
+            uint16_t next;              // Ready queue or topic waiter list
+            uint16_t prev;
+            WaitType wait;
+            uint8_t topic;
+            bool ready;
+            bool cancelled;             // cancel() from inside the behavior itself
+        };
+
+        // One EventBus listener per distinct awaited event name
+        struct Topic {
+            const char* name;
+            BehaviorRunner* owner;
+            uint16_t listenerId;
+            uint16_t head;
+            uint16_t tail;
+        };
+
+        EventBus& _eventBus;
+        TimerService& _timers;
+
+        Slot _slots[CAPACITY];
+        uint16_t _free[CAPACITY];
+        uint16_t _freeCount;
+
+        uint16_t _readyHead;
+        uint16_t _readyTail;
+        uint16_t _readyCount;
+        uint16_t _running;              // Slot being resumed, NO_SLOT outside update()
+
+        Topic _topics[TWIST_BEHAVIOR_TOPICS];
+        uint8_t _topicCount;
+
+        uint16_t _peak;
+        unsigned long _started;
+        unsigned long _completed;
+        unsigned long _cancelled;
+        unsigned long _resumes;
+        unsigned long _rejected;
+
+        // Awaiter hooks - false = could not wait (logged), resume at once
+        bool waitTimer(uint16_t index, WaitType type, uint32_t delayUs);
+        bool waitEvent(uint16_t index, const char* name, uint32_t timeoutUs, Event* out);
+
+        static void onTimer(void* context);
+        static void onTopicEvent(const Event& event, void* context);
+
+        Slot* lookup(BehaviorHandle handle);
+        const Slot* lookup(BehaviorHandle handle) const;
+        int findTopic(const char* name);
+        void makeReady(uint16_t index);
+        void clearWait(uint16_t index);
+        void finish(uint16_t index);
+
+        // Intrusive lists over Slot::next / Slot::prev
+        void listPush(uint16_t& head, uint16_t& tail, uint16_t index);
+        void listRemove(uint16_t& head, uint16_t& tail, uint16_t index);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_ENABLE_BEHAVIORS
+
+#endif // TWIST_BEHAVIOR_H
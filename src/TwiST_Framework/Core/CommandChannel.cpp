@@ -0,0 +1,196 @@
+#include "CommandChannel.h"
+#include <ArduinoJson.h>
+#include <string.h>
+
+namespace TwiST {
+
+    CommandChannel::CommandChannel(ITransport& transport, DeviceRegistry& registry)
+        : _transport(transport),
+          _registry(registry),
+          _frames(0),
+          _applied(0),
+          _failed(0),
+          _malformed(0),
+          _responsesDropped(0) {
+    }
+
+    // ===== IService =====
+
+    void CommandChannel::update() {
+        uint8_t buffer[64];
+        size_t budget = TWIST_COMMAND_MAX_BYTES_PER_TICK;
+
+        while (budget > 0) {
+            size_t chunk = (budget < sizeof(buffer)) ? budget : sizeof(buffer);
+            size_t received = _transport.receive(buffer, chunk);
+            if (received == 0) break;
+            budget -= received;
+
+            for (size_t i = 0; i < received; i++) {
+                if (!_parser.feed(buffer[i]) || _parser.type() != WIRE_COMMAND) {
+                    continue;
+                }
+
+                _frames++;
+                uint8_t frame[WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+                size_t responseLength = execute(_parser.payload(), _parser.length(),
+                                                WireFrame::payload(frame), TWIST_WIRE_MAX_PAYLOAD);
+                if (responseLength > 0) {
+                    sendResponse(frame, WireFrame::finalize(frame, WIRE_RESPONSE, (uint16_t)responseLength));
+                }
+            }
+        }
+    }
+
+    // ===== Command Execution =====
+
+    size_t CommandChannel::execute(const uint8_t* payload, size_t length, uint8_t* response, size_t capacity) {
+        CommandReader reader(payload, length);
+
+        // Sequence 0 = fire-and-forget
+        bool respond = (response != NULL && capacity >= CommandProtocol::RESPONSE_HEADER_SIZE &&
+                        reader.getSequence() != 0);
+        uint8_t unused[CommandProtocol::RESPONSE_HEADER_SIZE];
+        CommandResponseWriter writer(respond ? response : unused, respond ? capacity : sizeof(unused),
+                                     reader.getSequence());
+        CommandResponseWriter* out = respond ? &writer : NULL;
+
+        Command command;
+        while (reader.next(command)) {
+            CommandStatus status = apply(command, out);
+            if (status == CMD_OK) {
+                _applied++;
+            } else {
+                _failed++;
+            }
+            if (out) out->recordResult(status);
+        }
+
+        if (reader.isMalformed()) {
+            _malformed++;
+            if (out) out->recordResult(CMD_ERR_MALFORMED);
+        }
+
+        return out ? out->length() : 0;
+    }
+
+    CommandStatus CommandChannel::apply(const Command& command, CommandResponseWriter* response) {
+        if (command.opcode == CMD_SET_BATCH) return applyBatch(command);
+        if (command.opcode == CMD_LIST) return addList(response);
+
+        IDevice* device = _registry.findDevice(command.deviceId);
+        if (device == NULL) return CMD_ERR_UNKNOWN_DEVICE;
+
+        switch (command.opcode) {
+            case CMD_SET_VALUE:
+            case CMD_MOVE_TO: {
+                IOutputDevice* output = _registry.getOutputDevice(command.deviceId);
+                if (output == NULL) return CMD_ERR_NOT_OUTPUT;
+                if (command.opcode == CMD_SET_VALUE) {
+                    output->setValue(command.value);
+                } else {
+                    output->moveTo(command.value, command.durationMs);
+                }
+                return CMD_OK;
+            }
+
+            case CMD_ENABLE:
+                if (command.enabled) {
+                    device->enable();
+                } else {
+                    device->disable();
+                }
+                return CMD_OK;
+
+            case CMD_CONFIGURE:
+                return applyConfigure(device, command);
+
+            case CMD_QUERY:
+                return addQuery(device, response);
+
+            default:
+                return CMD_ERR_MALFORMED;
+        }
+    }
+
+    CommandStatus CommandChannel::applyBatch(const Command& command) {
+        CommandStatus result = CMD_OK;
+        for (uint8_t i = 0; i < command.batchCount; i++) {
+            uint16_t deviceId;
+            float value;
+            CommandProtocol::batchEntry(command, i, deviceId, value);
+
+            IOutputDevice* output = _registry.getOutputDevice(deviceId);
+            if (output == NULL) {
+                result = CMD_ERR_UNKNOWN_DEVICE;  // Apply the rest anyway
+                continue;
+            }
+            output->setValue(value);
+        }
+        return result;
+    }
+
+    CommandStatus CommandChannel::applyConfigure(IDevice* device, const Command& command) {
+        // Devices take configuration as a JSON document - build a one-key document
+        char key[TWIST_COMMAND_MAX_KEY_LENGTH + 1];
+        if (command.keyLength == 0 || command.keyLength >= sizeof(key)) {
+            return CMD_ERR_MALFORMED;
+        }
+        memcpy(key, command.key, command.keyLength);
+        key[command.keyLength] = '\0';
+
+        // One member plus the copied key. A write that does not fit is dropped
+        // silently by ArduinoJson - never hand the device an empty document.
+        StaticJsonDocument<JSON_OBJECT_SIZE(1) + sizeof(key)> doc;
+        doc[key] = command.value;
+        if (doc.overflowed()) return CMD_ERR_REJECTED;
+        return device->configure(doc) ? CMD_OK : CMD_ERR_REJECTED;
+    }
+
+    CommandStatus CommandChannel::addQuery(IDevice* device, CommandResponseWriter* response) {
+        if (response == NULL) return CMD_OK;  // Fire-and-forget query is a no-op
+
+        uint8_t flags = 0;
+        float value = 0.0f;
+        if (device->isEnabled()) flags |= QUERY_ENABLED;
+
+        if (device->hasCapability(CAP_OUTPUT)) {
+            IOutputDevice* output = static_cast<IOutputDevice*>(device);
+            flags |= QUERY_OUTPUT;
+            if (output->isMoving()) flags |= QUERY_MOVING;
+            value = output->getValue();
+        } else if (device->hasCapability(CAP_INPUT)) {
+            flags |= QUERY_INPUT;
+            value = static_cast<IInputDevice*>(device)->readAnalog(0);
+        }
+
+        DeviceInfo info = device->getInfo();
+        return response->addQuery(info.id, (uint8_t)device->getState(), flags, value) ? CMD_OK : CMD_ERR_NO_ROOM;
+    }
+
+    CommandStatus CommandChannel::addList(CommandResponseWriter* response) {
+        if (response == NULL) return CMD_OK;
+
+        for (uint8_t i = 0; i < _registry.getDeviceCount(); i++) {
+            IDevice* device = _registry.getDeviceAt(i);
+            DeviceInfo info = device->getInfo();
+            if (!response->addListEntry(info.id, info.capabilities, info.name)) {
+                return CMD_ERR_NO_ROOM;
+            }
+        }
+        return CMD_OK;
+    }
+
+    // ===== Private Helpers =====
+
+    void CommandChannel::sendResponse(const uint8_t* frame, size_t length) {
+        // Whole frames only - a torn response would desync the host parser
+        if (_transport.writable() < length) {
+            _responsesDropped++;
+            return;
+        }
+        _transport.send(frame, length);
+        _transport.flush();
+    }
+
+}  // namespace TwiST
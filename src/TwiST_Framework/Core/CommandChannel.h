@@ -0,0 +1,110 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      CommandChannel.h
+ * @brief     Remote control of registry devices over a framed binary link
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService, SERVICE_BEFORE_DEVICES)
+ * - Hardware:     None (uses ITransport)
+ * - Implements:   IService
+ *
+ * PRINCIPLES:
+ * - Runs at the START of update() - commands land on a tick boundary,
+ *   before devices animate and bridges map
+ * - Commands are applied straight from the parser buffer (CommandReader)
+ * - Targets devices by ID through DeviceRegistry - no device knows about it
+ * - Transport-agnostic: SerialTransport, UDPTransport, LoopbackTransport
+ *
+ * CAPABILITIES:
+ * - setValue / moveTo / batch-set of N outputs / enable / configure
+ * - State queries and device listing (WIRE_RESPONSE frames)
+ * - Sequence 0 = fire-and-forget (no response) for high-rate streaming
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_COMMAND_CHANNEL_H
+#define TWIST_COMMAND_CHANNEL_H
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/ITransport.h"
+#include "DeviceRegistry.h"
+#include "WireFrame.h"
+#include "CommandProtocol.h"
+
+// Receive bytes processed per update() (bounds time spent in one tick)
+#ifndef TWIST_COMMAND_MAX_BYTES_PER_TICK
+#define TWIST_COMMAND_MAX_BYTES_PER_TICK 1024
+#endif
+
+// Longest CONFIGURE key (sizes the one-member JSON document it is applied with)
+#ifndef TWIST_COMMAND_MAX_KEY_LENGTH
+#define TWIST_COMMAND_MAX_KEY_LENGTH 31
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Remote command service
+     *
+     * Example usage:
+     * ```cpp
+     * Drivers::SerialTransport link(Serial1);
+     * CommandChannel commands(link, *framework.registry());
+     * framework.addService(&commands, SERVICE_BEFORE_DEVICES);
+     * ```
+     */
+    class CommandChannel : public IService {
+    public:
+        CommandChannel(ITransport& transport, DeviceRegistry& registry);
+
+        // IService
+        void update() override;
+        const char* getName() const override { return "CommandChannel"; }
+
+        /**
+         * @brief Apply one command payload directly (bypasses the transport)
+         * @param payload WIRE_COMMAND payload
+         * @param length Payload length
+         * @param response Response payload buffer (NULL = no response)
+         * @param capacity Response buffer size
+         * @return Response payload length (0 if none)
+         */
+        size_t execute(const uint8_t* payload, size_t length, uint8_t* response, size_t capacity);
+
+        // Statistics
+        unsigned long getFrameCount() const { return _frames; }
+        unsigned long getAppliedCount() const { return _applied; }
+        unsigned long getFailedCount() const { return _failed; }
+        unsigned long getMalformedCount() const { return _malformed; }
+        unsigned long getResponseDroppedCount() const { return _responsesDropped; }
+        const WireFrameParser& getParser() const { return _parser; }
+
+    private:
+        ITransport& _transport;
+        DeviceRegistry& _registry;
+        WireFrameParser _parser;
+
+        unsigned long _frames;
+        unsigned long _applied;
+        unsigned long _failed;
+        unsigned long _malformed;
+        unsigned long _responsesDropped;
+
+        CommandStatus apply(const Command& command, CommandResponseWriter* response);
+        CommandStatus applyBatch(const Command& command);
+        CommandStatus applyConfigure(IDevice* device, const Command& command);
+        CommandStatus addQuery(IDevice* device, CommandResponseWriter* response);
+        CommandStatus addList(CommandResponseWriter* response);
+        void sendResponse(const uint8_t* frame, size_t length);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_COMMAND_CHANNEL_H
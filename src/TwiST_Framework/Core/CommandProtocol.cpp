@@ -0,0 +1,348 @@
+#include "CommandProtocol.h"
+#include <string.h>
+
+namespace TwiST {
+
+    // ===== Field Helpers =====
+
+    void CommandProtocol::putU16(uint8_t* out, uint16_t value) {
+        out[0] = (uint8_t)(value & 0xFF);
+        out[1] = (uint8_t)(value >> 8);
+    }
+
+    void CommandProtocol::putF32(uint8_t* out, float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        out[0] = (uint8_t)(bits & 0xFF);
+        out[1] = (uint8_t)(bits >> 8);
+        out[2] = (uint8_t)(bits >> 16);
+        out[3] = (uint8_t)(bits >> 24);
+    }
+
+    uint16_t CommandProtocol::getU16(const uint8_t* in) {
+        return (uint16_t)in[0] | ((uint16_t)in[1] << 8);
+    }
+
+    float CommandProtocol::getF32(const uint8_t* in) {
+        uint32_t bits = (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+                        ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void CommandProtocol::batchEntry(const Command& command, uint8_t index, uint16_t& deviceId, float& value) {
+        const uint8_t* entry = command.batch + index * BATCH_ENTRY_SIZE;
+        deviceId = getU16(entry);
+        value = (int16_t)getU16(entry + 2) / BATCH_SCALE;
+    }
+
+    // ===== CommandReader =====
+
+    CommandReader::CommandReader(const uint8_t* payload, size_t length)
+        : _data(payload),
+          _length(length),
+          _position(CommandProtocol::HEADER_SIZE),
+          _sequence(0),
+          _count(0),
+          _decoded(0),
+          _malformed(false) {
+
+        if (payload == NULL || length < CommandProtocol::HEADER_SIZE) {
+            _malformed = true;
+            return;
+        }
+        _sequence = payload[0];
+        _count = payload[1];
+    }
+
+    bool CommandReader::next(Command& out) {
+        if (_malformed || _decoded >= _count) return false;
+
+        size_t remaining = _length - _position;
+        if (remaining < 1) {
+            _malformed = true;
+            return false;
+        }
+
+        const uint8_t* p = _data + _position;
+        memset(&out, 0, sizeof(out));
+        out.opcode = (CommandOpcode)p[0];
+
+        size_t size = 0;
+        bool ok = false;
+        switch (out.opcode) {
+            case CMD_SET_VALUE:
+                size = 1 + 2 + 4;
+                if (remaining >= size) {
+                    out.deviceId = CommandProtocol::getU16(p + 1);
+                    out.value = CommandProtocol::getF32(p + 3);
+                    ok = true;
+                }
+                break;
+
+            case CMD_MOVE_TO:
+                size = 1 + 2 + 4 + 2;
+                if (remaining >= size) {
+                    out.deviceId = CommandProtocol::getU16(p + 1);
+                    out.value = CommandProtocol::getF32(p + 3);
+                    out.durationMs = CommandProtocol::getU16(p + 7);
+                    ok = true;
+                }
+                break;
+
+            case CMD_SET_BATCH:
+                if (remaining >= 2) {
+                    out.batchCount = p[1];
+                    size = 2 + (size_t)out.batchCount * CommandProtocol::BATCH_ENTRY_SIZE;
+                    if (remaining >= size) {
+                        out.batch = p + 2;
+                        ok = true;
+                    }
+                }
+                break;
+
+            case CMD_ENABLE:
+                size = 1 + 2 + 1;
+                if (remaining >= size) {
+                    out.deviceId = CommandProtocol::getU16(p + 1);
+                    out.enabled = (p[3] != 0);
+                    ok = true;
+                }
+                break;
+
+            case CMD_CONFIGURE:
+                if (remaining >= 4) {
+                    out.deviceId = CommandProtocol::getU16(p + 1);
+                    out.keyLength = p[3];
+                    size = 4 + (size_t)out.keyLength + 4;
+                    if (remaining >= size) {
+                        out.key = (const char*)(p + 4);
+                        out.value = CommandProtocol::getF32(p + 4 + out.keyLength);
+                        ok = true;
+                    }
+                }
+                break;
+
+            case CMD_QUERY:
+                size = 1 + 2;
+                if (remaining >= size) {
+                    out.deviceId = CommandProtocol::getU16(p + 1);
+                    ok = true;
+                }
+                break;
+
+            case CMD_LIST:
+                size = 1;
+                ok = true;
+                break;
+        }
+
+        if (!ok) {
+            // Unknown opcode or truncated arguments - the rest is unreadable
+            _malformed = true;
+            return false;
+        }
+
+        _position += size;
+        _decoded++;
+        return true;
+    }
+
+    // ===== CommandWriter =====
+
+    CommandWriter::CommandWriter(uint8_t* payload, size_t capacity, uint8_t sequence)
+        : _data(payload),
+          _capacity(capacity),
+          _position(CommandProtocol::HEADER_SIZE),
+          _count(0),
+          _overflowed(false) {
+        _data[0] = sequence;
+        _data[1] = 0;
+    }
+
+    uint8_t* CommandWriter::reserve(size_t bytes) {
+        if (_count == 255 || _position + bytes > _capacity) {
+            _overflowed = true;
+            return NULL;
+        }
+        uint8_t* p = _data + _position;
+        _position += bytes;
+        _data[1] = ++_count;
+        return p;
+    }
+
+    bool CommandWriter::setValue(uint16_t deviceId, float value) {
+        uint8_t* p = reserve(7);
+        if (p == NULL) return false;
+        p[0] = CMD_SET_VALUE;
+        CommandProtocol::putU16(p + 1, deviceId);
+        CommandProtocol::putF32(p + 3, value);
+        return true;
+    }
+
+    bool CommandWriter::moveTo(uint16_t deviceId, float target, uint16_t durationMs) {
+        uint8_t* p = reserve(9);
+        if (p == NULL) return false;
+        p[0] = CMD_MOVE_TO;
+        CommandProtocol::putU16(p + 1, deviceId);
+        CommandProtocol::putF32(p + 3, target);
+        CommandProtocol::putU16(p + 7, durationMs);
+        return true;
+    }
+
+    bool CommandWriter::setBatch(const uint16_t* deviceIds, const float* values, uint8_t count) {
+        uint8_t* p = reserve(2 + (size_t)count * CommandProtocol::BATCH_ENTRY_SIZE);
+        if (p == NULL) return false;
+        p[0] = CMD_SET_BATCH;
+        p[1] = count;
+        for (uint8_t i = 0; i < count; i++) {
+            float scaled = values[i] * CommandProtocol::BATCH_SCALE;
+            if (scaled != scaled) scaled = 0.0f;  // NaN - converting it to int16 is undefined
+            if (scaled > 32767.0f) scaled = 32767.0f;
+            if (scaled < -32767.0f) scaled = -32767.0f;
+            int16_t fixed = (int16_t)(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+
+            uint8_t* entry = p + 2 + i * CommandProtocol::BATCH_ENTRY_SIZE;
+            CommandProtocol::putU16(entry, deviceIds[i]);
+            CommandProtocol::putU16(entry + 2, (uint16_t)fixed);
+        }
+        return true;
+    }
+
+    bool CommandWriter::enable(uint16_t deviceId, bool enabled) {
+        uint8_t* p = reserve(4);
+        if (p == NULL) return false;
+        p[0] = CMD_ENABLE;
+        CommandProtocol::putU16(p + 1, deviceId);
+        p[3] = enabled ? 1 : 0;
+        return true;
+    }
+
+    bool CommandWriter::configure(uint16_t deviceId, const char* key, float value) {
+        size_t keyLength = key ? strlen(key) : 0;
+        if (keyLength > 255) return false;
+
+        uint8_t* p = reserve(4 + keyLength + 4);
+        if (p == NULL) return false;
+        p[0] = CMD_CONFIGURE;
+        CommandProtocol::putU16(p + 1, deviceId);
+        p[3] = (uint8_t)keyLength;
+        memcpy(p + 4, key, keyLength);
+        CommandProtocol::putF32(p + 4 + keyLength, value);
+        return true;
+    }
+
+    bool CommandWriter::query(uint16_t deviceId) {
+        uint8_t* p = reserve(3);
+        if (p == NULL) return false;
+        p[0] = CMD_QUERY;
+        CommandProtocol::putU16(p + 1, deviceId);
+        return true;
+    }
+
+    bool CommandWriter::list() {
+        uint8_t* p = reserve(1);
+        if (p == NULL) return false;
+        p[0] = CMD_LIST;
+        return true;
+    }
+
+    // ===== CommandResponseWriter =====
+
+    CommandResponseWriter::CommandResponseWriter(uint8_t* payload, size_t capacity, uint8_t sequence)
+        : _data(payload),
+          _capacity(capacity),
+          _position(CommandProtocol::RESPONSE_HEADER_SIZE) {
+        _data[0] = sequence;
+        _data[1] = 0;       // applied
+        _data[2] = 0;       // failed
+        _data[3] = CMD_OK;  // first error
+        _data[4] = 0;       // entries
+    }
+
+    void CommandResponseWriter::recordResult(CommandStatus status) {
+        if (status == CMD_OK) {
+            if (_data[1] < 255) _data[1]++;
+            return;
+        }
+        if (_data[2] == 0) _data[3] = status;
+        if (_data[2] < 255) _data[2]++;
+    }
+
+    bool CommandResponseWriter::addQuery(uint16_t deviceId, uint8_t state, uint8_t flags, float value) {
+        if (_data[4] == 255 || _position + CommandProtocol::QUERY_ENTRY_SIZE > _capacity) {
+            return false;
+        }
+        uint8_t* p = _data + _position;
+        p[0] = CMD_QUERY;
+        CommandProtocol::putU16(p + 1, deviceId);
+        p[3] = state;
+        p[4] = flags;
+        CommandProtocol::putF32(p + 5, value);
+        _position += CommandProtocol::QUERY_ENTRY_SIZE;
+        _data[4]++;
+        return true;
+    }
+
+    bool CommandResponseWriter::addListEntry(uint16_t deviceId, uint16_t capabilities, const char* name) {
+        size_t nameLength = name ? strlen(name) : 0;
+        if (nameLength > 255) nameLength = 255;
+
+        size_t size = CommandProtocol::LIST_ENTRY_BASE_SIZE + nameLength;
+        if (_data[4] == 255 || _position + size > _capacity) {
+            return false;
+        }
+        uint8_t* p = _data + _position;
+        p[0] = CMD_LIST;
+        CommandProtocol::putU16(p + 1, deviceId);
+        CommandProtocol::putU16(p + 3, capabilities);
+        p[5] = (uint8_t)nameLength;
+        memcpy(p + 6, name, nameLength);
+        _position += size;
+        _data[4]++;
+        return true;
+    }
+
+    // ===== CommandResponseReader =====
+
+    CommandResponseReader::CommandResponseReader(const uint8_t* payload, size_t length)
+        : _data(payload),
+          _length(length),
+          _position(CommandProtocol::RESPONSE_HEADER_SIZE),
+          _valid(payload != NULL && length >= CommandProtocol::RESPONSE_HEADER_SIZE) {
+    }
+
+    bool CommandResponseReader::next(CommandResponseEntry& out) {
+        if (!_valid || _position >= _length) return false;
+
+        const uint8_t* p = _data + _position;
+        size_t remaining = _length - _position;
+        memset(&out, 0, sizeof(out));
+        out.tag = (CommandOpcode)p[0];
+
+        if (out.tag == CMD_QUERY && remaining >= CommandProtocol::QUERY_ENTRY_SIZE) {
+            out.deviceId = CommandProtocol::getU16(p + 1);
+            out.state = p[3];
+            out.flags = p[4];
+            out.value = CommandProtocol::getF32(p + 5);
+            _position += CommandProtocol::QUERY_ENTRY_SIZE;
+            return true;
+        }
+
+        if (out.tag == CMD_LIST && remaining >= CommandProtocol::LIST_ENTRY_BASE_SIZE) {
+            size_t size = CommandProtocol::LIST_ENTRY_BASE_SIZE + p[5];
+            if (remaining < size) return false;
+            out.deviceId = CommandProtocol::getU16(p + 1);
+            out.capabilities = CommandProtocol::getU16(p + 3);
+            out.nameLength = p[5];
+            out.name = (const char*)(p + 6);
+            _position += size;
+            return true;
+        }
+
+        _valid = false;  // Unknown or truncated entry
+        return false;
+    }
+
+}  // namespace TwiST
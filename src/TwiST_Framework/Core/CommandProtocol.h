@@ -0,0 +1,248 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      CommandProtocol.h
+ * @brief     Compact binary command/response payloads for remote control
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Protocol Codec (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - the same code builds the PC-side client
+ * - Commands are decoded IN PLACE from the frame payload (no copies, no JSON)
+ * - Every read is bounds-checked - a malformed frame stops decoding, never crashes
+ * - Little-endian, fixed-width fields
+ *
+ * COMMAND PAYLOAD (WIRE_COMMAND frame):
+ *   u8 sequence (0 = no response), u8 command count, then per command:
+ *   SET_VALUE  u16 id, f32 value
+ *   MOVE_TO    u16 id, f32 target, u16 durationMs
+ *   SET_BATCH  u8 n, n x (u16 id, i16 value * 100)
+ *   ENABLE     u16 id, u8 enabled
+ *   CONFIGURE  u16 id, u8 keyLength, key bytes, f32 value
+ *   QUERY      u16 id
+ *   LIST       (no arguments)
+ *
+ * RESPONSE PAYLOAD (WIRE_RESPONSE frame):
+ *   u8 sequence, u8 applied, u8 failed, u8 first error, u8 entry count, then:
+ *   QUERY entry  u8 tag, u16 id, u8 state, u8 flags, f32 value
+ *   LIST entry   u8 tag, u16 id, u16 capabilities, u8 nameLength, name bytes
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_COMMAND_PROTOCOL_H
+#define TWIST_COMMAND_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace TwiST {
+
+    // Command opcodes (one byte on the wire)
+    enum CommandOpcode : uint8_t {
+        CMD_SET_VALUE = 0x01,
+        CMD_MOVE_TO   = 0x02,
+        CMD_SET_BATCH = 0x03,
+        CMD_ENABLE    = 0x04,
+        CMD_CONFIGURE = 0x05,
+        CMD_QUERY     = 0x06,
+        CMD_LIST      = 0x07
+    };
+
+    // Per-command result (first error is reported in the response header)
+    enum CommandStatus : uint8_t {
+        CMD_OK                 = 0,
+        CMD_ERR_MALFORMED      = 1,
+        CMD_ERR_UNKNOWN_DEVICE = 2,
+        CMD_ERR_NOT_OUTPUT     = 3,
+        CMD_ERR_REJECTED       = 4,
+        CMD_ERR_NO_ROOM        = 5     // Response full (query/list truncated)
+    };
+
+    // Query entry flags
+    enum CommandQueryFlag : uint8_t {
+        QUERY_ENABLED = 0x01,
+        QUERY_MOVING  = 0x02,
+        QUERY_OUTPUT  = 0x04,
+        QUERY_INPUT   = 0x08
+    };
+
+    /**
+     * @brief One decoded command - pointers refer into the frame payload
+     */
+    struct Command {
+        CommandOpcode opcode;
+        uint16_t deviceId;
+        float value;                // SET_VALUE/MOVE_TO/CONFIGURE
+        uint16_t durationMs;        // MOVE_TO
+        bool enabled;               // ENABLE
+        const char* key;            // CONFIGURE (NOT null-terminated)
+        uint8_t keyLength;
+        const uint8_t* batch;       // SET_BATCH entries
+        uint8_t batchCount;
+    };
+
+    /**
+     * @brief One decoded response entry
+     */
+    struct CommandResponseEntry {
+        CommandOpcode tag;          // CMD_QUERY or CMD_LIST
+        uint16_t deviceId;
+        uint8_t state;              // QUERY: DeviceState
+        uint8_t flags;              // QUERY: CommandQueryFlag bits
+        float value;                // QUERY: output value / input axis 0
+        uint16_t capabilities;      // LIST
+        const char* name;           // LIST (NOT null-terminated)
+        uint8_t nameLength;
+    };
+
+    namespace CommandProtocol {
+        static constexpr size_t HEADER_SIZE = 2;
+        static constexpr size_t RESPONSE_HEADER_SIZE = 5;
+        static constexpr size_t BATCH_ENTRY_SIZE = 4;
+        static constexpr float BATCH_SCALE = 100.0f;     // i16 centi-units (+-327.67)
+        static constexpr size_t QUERY_ENTRY_SIZE = 9;
+        static constexpr size_t LIST_ENTRY_BASE_SIZE = 6;
+
+        void putU16(uint8_t* out, uint16_t value);
+        void putF32(uint8_t* out, float value);
+        uint16_t getU16(const uint8_t* in);
+        float getF32(const uint8_t* in);
+
+        /**
+         * @brief Read entry i of a SET_BATCH command
+         */
+        void batchEntry(const Command& command, uint8_t index, uint16_t& deviceId, float& value);
+    }
+
+    /**
+     * @brief Iterates commands inside a received payload (device side)
+     *
+     * Example:
+     * ```cpp
+     * CommandReader reader(payload, length);
+     * Command cmd;
+     * while (reader.next(cmd)) { apply(cmd); }
+     * if (reader.isMalformed()) { ... }
+     * ```
+     */
+    class CommandReader {
+    public:
+        CommandReader(const uint8_t* payload, size_t length);
+
+        uint8_t getSequence() const { return _sequence; }
+        uint8_t getCommandCount() const { return _count; }
+
+        /**
+         * @brief Decode next command
+         * @param out Decoded command (valid while the payload is)
+         * @return false when done or malformed
+         */
+        bool next(Command& out);
+
+        bool isMalformed() const { return _malformed; }
+
+    private:
+        const uint8_t* _data;
+        size_t _length;
+        size_t _position;
+        uint8_t _sequence;
+        uint8_t _count;
+        uint8_t _decoded;
+        bool _malformed;
+    };
+
+    /**
+     * @brief Builds a command payload (PC client, node links, tests)
+     *
+     * Example:
+     * ```cpp
+     * uint8_t frame[WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+     * CommandWriter writer(WireFrame::payload(frame), TWIST_WIRE_MAX_PAYLOAD, seq);
+     * writer.setBatch(ids, angles, 16);
+     * size_t n = WireFrame::finalize(frame, WIRE_COMMAND, writer.length());
+     * ```
+     */
+    class CommandWriter {
+    public:
+        CommandWriter(uint8_t* payload, size_t capacity, uint8_t sequence);
+
+        bool setValue(uint16_t deviceId, float value);
+        bool moveTo(uint16_t deviceId, float target, uint16_t durationMs);
+        bool setBatch(const uint16_t* deviceIds, const float* values, uint8_t count);
+        bool enable(uint16_t deviceId, bool enabled);
+        bool configure(uint16_t deviceId, const char* key, float value);
+        bool query(uint16_t deviceId);
+        bool list();
+
+        size_t length() const { return _position; }
+        uint8_t getCommandCount() const { return _count; }
+
+        /**
+         * @brief true if any command did not fit (it was not written)
+         */
+        bool isOverflowed() const { return _overflowed; }
+
+    private:
+        uint8_t* _data;
+        size_t _capacity;
+        size_t _position;
+        uint8_t _count;
+        bool _overflowed;
+
+        uint8_t* reserve(size_t bytes);
+    };
+
+    /**
+     * @brief Builds a response payload (device side)
+     */
+    class CommandResponseWriter {
+    public:
+        CommandResponseWriter(uint8_t* payload, size_t capacity, uint8_t sequence);
+
+        void recordResult(CommandStatus status);
+        bool addQuery(uint16_t deviceId, uint8_t state, uint8_t flags, float value);
+        bool addListEntry(uint16_t deviceId, uint16_t capabilities, const char* name);
+
+        size_t length() const { return _position; }
+
+    private:
+        uint8_t* _data;
+        size_t _capacity;
+        size_t _position;
+    };
+
+    /**
+     * @brief Iterates a received response payload (PC client, tests)
+     */
+    class CommandResponseReader {
+    public:
+        CommandResponseReader(const uint8_t* payload, size_t length);
+
+        bool isValid() const { return _valid; }
+        uint8_t getSequence() const { return _valid ? _data[0] : 0; }
+        uint8_t getAppliedCount() const { return _valid ? _data[1] : 0; }
+        uint8_t getFailedCount() const { return _valid ? _data[2] : 0; }
+        CommandStatus getFirstError() const { return _valid ? (CommandStatus)_data[3] : CMD_ERR_MALFORMED; }
+        uint8_t getEntryCount() const { return _valid ? _data[4] : 0; }
+
+        bool next(CommandResponseEntry& out);
+
+    private:
+        const uint8_t* _data;
+        size_t _length;
+        size_t _position;
+        bool _valid;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_COMMAND_PROTOCOL_H
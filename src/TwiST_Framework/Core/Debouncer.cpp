@@ -0,0 +1,108 @@
+#include "Debouncer.h"
+
+namespace TwiST {
+
+    Debouncer::Debouncer(uint32_t windowUs)
+        : _window(windowUs == 0 ? 1 : windowUs),
+          _level(0),
+          _state(false),
+          _raw(false),
+          _settled(true),
+          _lastUs(0),
+          _candidateUs(0),
+          _returnUs(0),
+          _transitionUs(0),
+          _detectedUs(0),
+          _rejected(0) {
+    }
+
+    void Debouncer::setWindow(uint32_t windowUs) {
+        _window = (windowUs == 0) ? 1 : windowUs;
+        _level = _state ? _window : 0;
+        _settled = true;
+    }
+
+    void Debouncer::reset(bool level, uint32_t nowUs) {
+        _state = level;
+        _raw = level;
+        _level = level ? _window : 0;
+        _settled = true;
+        _lastUs = nowUs;
+        _candidateUs = nowUs;
+        _returnUs = nowUs;
+        _transitionUs = nowUs;
+        _detectedUs = nowUs;
+    }
+
+    bool Debouncer::edge(bool level, uint32_t timestampUs) {
+        bool changed = integrate(timestampUs);
+        if (level == _raw) return changed;  // Duplicate (e.g. scan after interrupt)
+
+        _raw = level;
+        if (level == _state) {
+            _returnUs = _lastUs;            // Bounced back - quiet period starts
+        } else if (_settled) {
+            _candidateUs = _lastUs;         // First edge of a possible transition
+            _settled = false;
+        }
+        return changed;
+    }
+
+    bool Debouncer::advance(uint32_t nowUs) {
+        return integrate(nowUs);
+    }
+
+    uint32_t Debouncer::getPendingMicros(uint32_t nowUs) const {
+        if (_raw == _state) return UINT32_MAX;
+        uint32_t room = _raw ? _window - _level : _level;
+        int32_t span = (int32_t)(nowUs - _lastUs);
+        uint32_t elapsed = (span > 0) ? (uint32_t)span : 0;
+        return (elapsed >= room) ? 0 : room - elapsed;
+    }
+
+    bool Debouncer::integrate(uint32_t untilUs) {
+        // Late edge (captured after the last advance() read the clock) - no time to add
+        int32_t span = (int32_t)(untilUs - _lastUs);
+        if (span <= 0) return false;
+        uint32_t dt = (uint32_t)span;
+        uint32_t start = _lastUs;
+        _lastUs = untilUs;
+
+        bool changed = false;
+        if (_raw) {
+            uint32_t room = _window - _level;
+            if (dt < room) {
+                _level += dt;
+            } else {
+                _level = _window;
+                if (!_state) {
+                    _state = true;
+                    changed = true;
+                    _detectedUs = start + room;
+                }
+            }
+        } else {
+            uint32_t room = _level;
+            if (dt < room) {
+                _level -= dt;
+            } else {
+                _level = 0;
+                if (_state) {
+                    _state = false;
+                    changed = true;
+                    _detectedUs = start + room;
+                }
+            }
+        }
+
+        if (changed) {
+            _transitionUs = _candidateUs;
+            _settled = true;
+        } else if (!_settled && _raw == _state && (uint32_t)(untilUs - _returnUs) >= _window) {
+            _settled = true;                // Excursion died out - a spike, not a transition
+            _rejected++;
+        }
+        return changed;
+    }
+
+}  // namespace TwiST
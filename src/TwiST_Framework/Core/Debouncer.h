@@ -0,0 +1,109 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      Debouncer.h
+ * @brief     Time-integrating contact debouncer driven by edge timestamps
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Signal Conditioning (no hardware)
+ * - Hardware:     None
+ * - Dependency:   None
+ *
+ * PRINCIPLES:
+ * - Integrator, not lockout: the count rises while the raw level is
+ *   active and falls while inactive; the state flips only at full scale
+ *   or zero. Isolated spikes shorter than the window never flip it.
+ * - Continuous time: fed with captured edge timestamps, not samples -
+ *   result does not depend on how often update() runs
+ * - Reports the PHYSICAL edge time (first edge of the accepted
+ *   transition), not the moment the debounce window expired; an
+ *   excursion ends only after a full quiet window at the old level
+ * - Pure C++ - builds on a host for synthetic bounce traces
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DEBOUNCER_H
+#define TWIST_DEBOUNCER_H
+
+#include <stdint.h>
+
+namespace TwiST {
+
+    /**
+     * @brief Single-line debouncer
+     *
+     * Example usage:
+     * ```cpp
+     * Debouncer button(10000);                 // 10 ms integrator
+     * button.reset(false, nowUs);
+     * if (button.edge(level, edgeUs)) { ... }  // Each captured edge, in order
+     * if (button.advance(nowUs)) {             // Then up to "now"
+     *     bool pressed = button.getState();
+     *     uint32_t at = button.getTransitionMicros();
+     * }
+     * ```
+     */
+    class Debouncer {
+    public:
+        explicit Debouncer(uint32_t windowUs = 10000);
+
+        /**
+         * @brief Set the integrator full scale (time a level must dominate)
+         */
+        void setWindow(uint32_t windowUs);
+        uint32_t getWindow() const { return _window; }
+
+        /**
+         * @brief Force a settled state (no transition reported)
+         */
+        void reset(bool level, uint32_t nowUs);
+
+        /**
+         * @brief Raw level changed at timestampUs (edges in time order)
+         * @return true if the debounced state changed before this edge
+         */
+        bool edge(bool level, uint32_t timestampUs);
+
+        /**
+         * @brief Integrate the current raw level up to nowUs
+         * @return true if the debounced state changed
+         */
+        bool advance(uint32_t nowUs);
+
+        /**
+         * @brief Time until the state flips if the raw level stays as it is
+         * @return Microseconds, UINT32_MAX if the raw level matches the state
+         */
+        uint32_t getPendingMicros(uint32_t nowUs) const;
+
+        bool getState() const { return _state; }
+        bool getRawLevel() const { return _raw; }
+        uint32_t getTransitionMicros() const { return _transitionUs; }  // First edge of last accepted change
+        uint32_t getDetectedMicros() const { return _detectedUs; }      // When the window filled
+        uint32_t getRejectedCount() const { return _rejected; }         // Excursions that never flipped state
+
+    private:
+        uint32_t _window;
+        uint32_t _level;            // Integrator 0.._window
+        bool _state;
+        bool _raw;
+        bool _settled;              // No excursion in progress
+        uint32_t _lastUs;
+        uint32_t _candidateUs;      // First edge away from the settled state
+        uint32_t _returnUs;         // Last edge back to the settled state
+        uint32_t _transitionUs;
+        uint32_t _detectedUs;
+        uint32_t _rejected;
+
+        bool integrate(uint32_t untilUs);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_DEBOUNCER_H
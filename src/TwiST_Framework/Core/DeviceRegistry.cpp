@@ -1,10 +1,12 @@
 #include "DeviceRegistry.h"
 #include "Logger.h"  // For centralized logging (v1.2.0)
+#include "Tracer.h"  // For TWIST_TRACE_SCOPE
+#include "LoopMonitor.h"  // For per-device sections
 #include <string.h>
 
 using TwiST::Logger;  // Use Logger from TwiST namespace
 
-DeviceRegistry::DeviceRegistry() : _deviceCount(0) {
+DeviceRegistry::DeviceRegistry() : _deviceCount(0), _loopMonitor(NULL) {
     // Initialize device array to NULL
     for (uint8_t i = 0; i < MAX_DEVICES; i++) {
         _devices[i] = NULL;
@@ -163,6 +165,13 @@ uint8_t DeviceRegistry::getOutputDeviceCount() const {
     return count;
 }
 
+IDevice* DeviceRegistry::getDeviceAt(uint8_t index) const {
+    if (index >= _deviceCount) {
+        return NULL;
+    }
+    return _devices[index];
+}
+
 // ===== Type-Safe Access =====
 
 IInputDevice* DeviceRegistry::getInputDevice(uint16_t deviceId) {
@@ -206,9 +215,46 @@ bool DeviceRegistry::initializeAll() {
 void DeviceRegistry::updateAll() {
     for (uint8_t i = 0; i < _deviceCount; i++) {
         if (_devices[i] && _devices[i]->isEnabled()) {
+            TWIST_TRACE_SCOPE(_devices[i]->getName());
+            if (_loopMonitor) _loopMonitor->enterSection(TwiST::SECTION_DEVICE, _devices[i]->getName());
             _devices[i]->update();
+            if (_loopMonitor) _loopMonitor->exitSection();
+        }
+    }
+}
+
+uint32_t DeviceRegistry::getTimeUntilUpdate(uint32_t nowUs) const {
+    uint32_t wait = UINT32_MAX;
+    for (uint8_t i = 0; i < _deviceCount && wait > 0; i++) {
+        if (_devices[i] && _devices[i]->isEnabled()) {
+            uint32_t device = _devices[i]->getTimeUntilUpdate(nowUs);
+            if (device < wait) wait = device;
+        }
+    }
+    return wait;
+}
+
+// ===== Snapshot =====
+
+uint32_t DeviceRegistry::snapshot() {
+    TWIST_TRACE_SCOPE("DeviceRegistry::snapshot");
+    RegistrySnapshot& frame = _snapshot.beginWrite();
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < _deviceCount; i++) {
+        IDevice* device = _devices[i];
+        if (!device) continue;
+
+        DeviceSnapshot& record = frame.devices[count++];
+        record.id = device->getInfo().id;
+        record.state = (uint8_t)device->getState();
+        record.flags = device->isEnabled() ? SNAPSHOT_ENABLED : 0;
+        if (device->hasCapability(CAP_OUTPUT) && static_cast<IOutputDevice*>(device)->isMoving()) {
+            record.flags |= SNAPSHOT_MOVING;
         }
+        record.valueCount = device->captureState(record.values, TWIST_SNAPSHOT_VALUES);
     }
+    frame.count = count;
+    return _snapshot.publish(micros());
 }
 
 void DeviceRegistry::shutdownAll() {
@@ -23,6 +23,7 @@
  * - Type-safe casting to input/output devices
  * - Iterate over devices with filters
  * - Bulk initialization and shutdown
+ * - Lock-free bulk state snapshot (double-buffered, generation-stamped)
  *
  * AUTHOR:    Voldemaras Birskys
  * EMAIL:     voldemaras@gmail.com
@@ -37,9 +38,12 @@
 #include "../Interfaces/IDevice.h"
 #include "../Interfaces/IInputDevice.h"
 #include "../Interfaces/IOutputDevice.h"
+#include "DeviceSnapshot.h"
 
 using namespace TwiST;  // Use TwiST namespace for interfaces
 
+namespace TwiST { class LoopMonitor; }  // Optional per-device timing (Core/LoopMonitor.h)
+
 // Maximum number of devices (configurable, can be increased)
 #ifndef MAX_DEVICES
 #define MAX_DEVICES 32
@@ -160,6 +164,13 @@ public:
      */
     uint8_t getOutputDeviceCount() const;
 
+    /**
+     * @brief Get device by registration index
+     * @param index 0 to getDeviceCount() - 1
+     * @return Device pointer or NULL if out of range
+     */
+    IDevice* getDeviceAt(uint8_t index) const;
+
     // ===== Type-Safe Access =====
 
     /**
@@ -189,14 +200,58 @@ public:
      */
     void updateAll();
 
+    /**
+     * @brief Earliest time any enabled device needs update()
+     * @param nowUs Current micros()
+     * @return Microseconds (0 = next pass, UINT32_MAX = nothing scheduled)
+     */
+    uint32_t getTimeUntilUpdate(uint32_t nowUs) const;
+
     /**
      * @brief Shutdown all registered devices
      */
     void shutdownAll();
 
+    // ===== Snapshot =====
+
+    /**
+     * @brief Capture every device's hot state and publish it as the newest frame
+     *
+     * Loop task only (single writer). One captureState() per device into
+     * preallocated records - no allocation, no JSON.
+     *
+     * @return Generation of the new frame
+     */
+    uint32_t snapshot();
+
+    /**
+     * @brief Copy the newest complete snapshot (safe from any task or core)
+     * @param out Destination frame
+     * @return false if nothing captured yet or the writer kept overwriting it
+     */
+    bool readSnapshot(RegistrySnapshot& out) const { return _snapshot.read(out); }
+
+    /**
+     * @brief Generation of the newest frame (0 = none yet)
+     */
+    uint32_t getSnapshotGeneration() const { return _snapshot.getGeneration(); }
+
+    /**
+     * @brief Reader statistics (retries, failed reads)
+     */
+    const SnapshotBuffer& getSnapshotBuffer() const { return _snapshot; }
+
+    /**
+     * @brief Report each device update to a loop monitor
+     * @param monitor Monitor (NULL = none)
+     */
+    void setLoopMonitor(TwiST::LoopMonitor* monitor) { _loopMonitor = monitor; }
+
 private:
     IDevice* _devices[MAX_DEVICES];
     uint8_t _deviceCount;
+    TwiST::LoopMonitor* _loopMonitor;
+    SnapshotBuffer _snapshot;
 
     // Helper to check if filter matches device
     bool matchesFilter(IDevice* device, const DeviceFilter& filter);
@@ -0,0 +1,66 @@
+#include "DeviceSnapshot.h"
+#include <string.h>
+#include <stddef.h>
+
+namespace TwiST {
+
+    SnapshotBuffer::SnapshotBuffer()
+        : _writing(0),
+          _generation(0),
+          _retries(0),
+          _failedReads(0) {
+        for (uint8_t i = 0; i < 2; i++) {
+            _slots[i].sequence.store(0, std::memory_order_relaxed);
+            _slots[i].frame.generation = 0;
+            _slots[i].frame.timestampUs = 0;
+            _slots[i].frame.count = 0;
+        }
+    }
+
+    // ===== Writer =====
+
+    RegistrySnapshot& SnapshotBuffer::beginWrite() {
+        // Never the newest slot - readers keep copying that one meanwhile
+        _writing = (uint8_t)((_generation.load(std::memory_order_relaxed) + 1) & 1);
+        Slot& slot = _slots[_writing];
+        slot.sequence.fetch_add(1, std::memory_order_relaxed);   // Odd: writer inside
+        std::atomic_thread_fence(std::memory_order_release);
+        return slot.frame;
+    }
+
+    uint32_t SnapshotBuffer::publish(uint32_t timestampUs) {
+        Slot& slot = _slots[_writing];
+        uint32_t generation = _generation.load(std::memory_order_relaxed) + 1;
+        slot.frame.generation = generation;
+        slot.frame.timestampUs = timestampUs;
+        slot.sequence.fetch_add(1, std::memory_order_release);   // Even: frame complete
+        _generation.store(generation, std::memory_order_release);
+        return generation;
+    }
+
+    // ===== Readers =====
+
+    bool SnapshotBuffer::read(RegistrySnapshot& out) const {
+        for (uint8_t attempt = 0; attempt < TWIST_SNAPSHOT_READ_RETRIES; attempt++) {
+            uint32_t generation = _generation.load(std::memory_order_acquire);
+            if (generation == 0) return false;
+
+            const Slot& slot = _slots[generation & 1];
+            uint32_t before = slot.sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                uint8_t count = slot.frame.count;
+                if (count > MAX_DEVICES) count = MAX_DEVICES;  // Torn read - rejected below
+                memcpy(&out, &slot.frame, offsetof(RegistrySnapshot, devices) + count * sizeof(DeviceSnapshot));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == before && out.generation == generation) {
+                    out.count = count;
+                    return true;
+                }
+            }
+            _retries.fetch_add(1, std::memory_order_relaxed);
+        }
+        _failedReads.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+}  // namespace TwiST
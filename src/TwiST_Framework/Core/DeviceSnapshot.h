@@ -0,0 +1,135 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      DeviceSnapshot.h
+ * @brief     Double-buffered, generation-stamped copy of every device's hot state
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Data Structure (owned by DeviceRegistry)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - a PC-side reader can use the same structs
+ * - Plain-old-data records in preallocated storage: capture never
+ *   allocates and never formats
+ * - One writer (the loop task), any number of readers on other tasks or
+ *   cores. Two slots, each guarded by a sequence counter: readers copy the
+ *   newest slot and retry if the writer lapped them - no locks, no torn
+ *   frames
+ *
+ * CAPABILITIES:
+ * - Per device: ID, DeviceState, enabled / moving flags, up to
+ *   TWIST_SNAPSHOT_VALUES floats (IDevice::captureState)
+ * - Generation counter and capture timestamp per frame
+ * - Reader retry / give-up statistics
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DEVICE_SNAPSHOT_H
+#define TWIST_DEVICE_SNAPSHOT_H
+
+#include "../TwiST_Config.h"
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+#include <atomic>
+
+// Times a reader retries when the writer overwrites the slot it is copying
+#ifndef TWIST_SNAPSHOT_READ_RETRIES
+#define TWIST_SNAPSHOT_READ_RETRIES 8
+#endif
+
+namespace TwiST {
+
+    // DeviceSnapshot::flags
+    enum SnapshotFlag : uint8_t {
+        SNAPSHOT_ENABLED = 0x01,
+        SNAPSHOT_MOVING  = 0x02     // Output devices: isMoving()
+    };
+
+    /**
+     * @brief Hot state of one device at capture time
+     */
+    struct DeviceSnapshot {
+        uint16_t id;
+        uint8_t state;              // DeviceState
+        uint8_t flags;              // SnapshotFlag bits
+        uint8_t valueCount;         // Valid entries in values[]
+        float values[TWIST_SNAPSHOT_VALUES];  // Meaning per device type (see captureState)
+    };
+
+    /**
+     * @brief Every registered device, captured in one registry pass
+     */
+    struct RegistrySnapshot {
+        uint32_t generation;        // 1, 2, 3... (0 = nothing captured yet)
+        uint32_t timestampUs;       // micros() at capture
+        uint8_t count;              // Valid entries in devices[] (registration order)
+        DeviceSnapshot devices[MAX_DEVICES];
+    };
+
+    /**
+     * @brief Single-writer, multi-reader double buffer for RegistrySnapshot
+     *
+     * Example (DeviceRegistry does the writer side):
+     * ```cpp
+     * RegistrySnapshot& frame = buffer.beginWrite();
+     * frame.count = 0;                           // ... fill records ...
+     * buffer.publish(micros());
+     *
+     * RegistrySnapshot copy;                     // Any task / core
+     * if (buffer.read(copy)) { ... }
+     * ```
+     */
+    class SnapshotBuffer {
+    public:
+        SnapshotBuffer();
+
+        // ===== Writer (one task) =====
+
+        /**
+         * @brief Slot to fill - not visible to readers until publish()
+         */
+        RegistrySnapshot& beginWrite();
+
+        /**
+         * @brief Stamp the slot and make it the newest frame
+         * @return Generation of the published frame
+         */
+        uint32_t publish(uint32_t timestampUs);
+
+        // ===== Readers (any task / core) =====
+
+        /**
+         * @brief Copy the newest complete frame
+         * @param out Destination (only devices[0..count) are copied)
+         * @return false if nothing published yet, or the writer lapped the
+         *         reader TWIST_SNAPSHOT_READ_RETRIES times in a row
+         */
+        bool read(RegistrySnapshot& out) const;
+
+        uint32_t getGeneration() const { return _generation.load(std::memory_order_acquire); }
+        uint32_t getRetryCount() const { return _retries.load(std::memory_order_relaxed); }
+        uint32_t getFailedReadCount() const { return _failedReads.load(std::memory_order_relaxed); }
+
+    private:
+        struct Slot {
+            std::atomic<uint32_t> sequence;     // Odd while the writer is inside
+            RegistrySnapshot frame;
+        };
+
+        Slot _slots[2];
+        uint8_t _writing;                       // Slot handed out by beginWrite()
+        std::atomic<uint32_t> _generation;
+        mutable std::atomic<uint32_t> _retries;
+        mutable std::atomic<uint32_t> _failedReads;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_DEVICE_SNAPSHOT_H
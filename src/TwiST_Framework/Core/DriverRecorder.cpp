@@ -0,0 +1,148 @@
+#include "DriverRecorder.h"
+#include "Logger.h"
+#include <Arduino.h>
+
+namespace TwiST {
+
+    DriverRecorder::DriverRecorder()
+        : _open(false),
+          _maxBytes(0),
+          _active(0),
+          _recorded(0),
+          _dropped(0),
+          _written(0) {
+        _fill[0] = _fill[1] = 0;
+        _full[0] = _full[1] = false;
+    }
+
+    DriverRecorder::~DriverRecorder() {
+        close();
+    }
+
+    // ===== Lifecycle =====
+
+    bool DriverRecorder::open(const char* path, size_t maxBytes) {
+        close();
+
+        _file = LittleFS.open(path, "w");
+        if (!_file) {
+            Logger::logf(Logger::Level::ERROR, "RECORDER", "Cannot create log: %s", path);
+            return false;
+        }
+
+        uint8_t header[RecordLog::HEADER_SIZE];
+        RecordLog::writeHeader(header);
+        _written = _file.write(header, sizeof(header));
+
+        _maxBytes = maxBytes;
+        _fill[0] = _fill[1] = 0;
+        _full[0] = _full[1] = false;
+        _active = 0;
+        _recorded = 0;
+        _dropped = 0;
+        _open = true;
+
+        Logger::logf(Logger::Level::INFO, "RECORDER", "Recording to %s", path);
+        return true;
+    }
+
+    void DriverRecorder::close() {
+        if (!_open) return;
+
+        // Oldest block first, then the partially filled active block
+        uint8_t other = _active ^ 1;
+        if (_full[other]) writeBlock(other);
+        writeBlock(_active);
+
+        _file.close();
+        _open = false;
+
+        Logger::logf(Logger::Level::INFO, "RECORDER", "Recording closed: %lu records, %lu dropped, %u bytes",
+                    _recorded, _dropped, (unsigned)_written);
+    }
+
+    // ===== IRecordSink =====
+
+    void DriverRecorder::record(RecordKind kind, uint8_t stream, uint8_t channel, uint16_t value) {
+        if (!_open) return;
+
+        if (_full[_active]) {
+            _dropped++;  // Flash cannot keep up - never block the caller
+            return;
+        }
+
+        RecordEntry entry;
+        entry.timestampUs = (uint32_t)micros();
+        entry.kind = kind;
+        entry.channel = channel;
+        entry.stream = stream;
+        entry.value = value;
+
+        RecordLog::writeRecord(entry, _blocks[_active] + _fill[_active]);
+        _fill[_active] += RecordLog::RECORD_SIZE;
+        _recorded++;
+
+        if (_fill[_active] >= BLOCK_BYTES) {
+            _full[_active] = true;
+            uint8_t other = _active ^ 1;
+            if (!_full[other]) {
+                _active = other;
+            }
+        }
+    }
+
+    // ===== IService =====
+
+    void DriverRecorder::update() {
+        if (!_open) return;
+
+        // At most one block per tick - bounded flash latency
+        uint8_t other = _active ^ 1;
+        if (_full[other]) {
+            writeBlock(other);
+        } else if (_full[_active]) {
+            writeBlock(_active);
+        }
+    }
+
+    // ===== Replay Support =====
+
+    size_t DriverRecorder::loadLog(const char* path, uint8_t* buffer, size_t capacity) {
+        File file = LittleFS.open(path, "r");
+        if (!file) {
+            Logger::logf(Logger::Level::ERROR, "RECORDER", "Cannot open log: %s", path);
+            return 0;
+        }
+
+        size_t size = file.size();
+        if (size > capacity) {
+            Logger::logf(Logger::Level::WARNING, "RECORDER", "Log truncated to %u of %u bytes",
+                        (unsigned)capacity, (unsigned)size);
+            size = capacity;
+        }
+
+        size_t loaded = file.read(buffer, size);
+        file.close();
+        return loaded;
+    }
+
+    // ===== Private Helpers =====
+
+    void DriverRecorder::writeBlock(uint8_t index) {
+        size_t length = _fill[index];
+        if (_maxBytes > 0 && _written + length > _maxBytes) {
+            // Size cap reached - keep whole records only
+            size_t room = (_maxBytes > _written) ? _maxBytes - _written : 0;
+            length = room - (room % RecordLog::RECORD_SIZE);
+            _dropped += (_fill[index] - length) / RecordLog::RECORD_SIZE;
+        }
+
+        if (length > 0) {
+            _written += _file.write(_blocks[index], length);
+        }
+
+        _fill[index] = 0;
+        _full[index] = false;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,125 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      DriverRecorder.h
+ * @brief     Append-only LittleFS recorder for driver reads and output commands
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService) + IRecordSink
+ * - Hardware:     None (uses LittleFS)
+ * - Implements:   IService, IRecordSink
+ *
+ * PRINCIPLES:
+ * - Recording drivers (Drivers/Record) push records, NOT devices
+ * - record() is RAM-only (fixed double buffer) - never touches flash
+ * - update() writes at most ONE full block per tick (bounded flash stall)
+ * - Records are dropped and counted when both blocks are full
+ * - Zero heap allocation
+ *
+ * CAPABILITIES:
+ * - Timestamped capture of ADC reads, distance reads and PWM writes
+ * - Size-capped log files
+ * - Load a log back into memory for replay (RecordLogReader)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_RECORDER_H
+#define TWIST_DRIVER_RECORDER_H
+
+#include "../Interfaces/IService.h"
+#include "RecordLog.h"
+#include <LittleFS.h>
+
+// RAM block size (multiple of RecordLog::RECORD_SIZE)
+#ifndef TWIST_RECORDER_BLOCK_SIZE
+#define TWIST_RECORDER_BLOCK_SIZE 512
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Driver I/O recorder service
+     *
+     * Example usage:
+     * ```cpp
+     * DriverRecorder recorder;
+     * recorder.open("/rec/run1.twrl", 512 * 1024);
+     * Drivers::RecordingADC x(adcX, recorder, 0);  // stream 0
+     * framework.addService(&recorder);
+     * ...
+     * recorder.close();
+     * ```
+     */
+    class DriverRecorder : public IService, public IRecordSink {
+    public:
+        DriverRecorder();
+        ~DriverRecorder();
+
+        /**
+         * @brief Start a new recording (truncates file)
+         * @param path Log file path
+         * @param maxBytes File size limit (0 = unlimited)
+         * @return true if file opened
+         */
+        bool open(const char* path, size_t maxBytes = 0);
+
+        /**
+         * @brief Flush remaining records and close the file
+         */
+        void close();
+
+        bool isRecording() const { return _open; }
+
+        // IRecordSink
+        void record(RecordKind kind, uint8_t stream, uint8_t channel, uint16_t value) override;
+
+        // IService
+        void update() override;
+        const char* getName() const override { return "DriverRecorder"; }
+        uint32_t getTimeUntilUpdate(uint32_t nowUs) const override {
+            return (_open && (_full[0] || _full[1])) ? 0 : UINT32_MAX;  // Only full blocks need the loop
+        }
+
+        // Statistics
+        unsigned long getRecordCount() const { return _recorded; }
+        unsigned long getDroppedCount() const { return _dropped; }
+        size_t getBytesWritten() const { return _written; }
+
+        /**
+         * @brief Load a complete log file into memory for replay
+         * @param path Log file path
+         * @param buffer Destination
+         * @param capacity Buffer size
+         * @return Bytes loaded (0 on error)
+         */
+        static size_t loadLog(const char* path, uint8_t* buffer, size_t capacity);
+
+    private:
+        static constexpr size_t BLOCK_RECORDS = TWIST_RECORDER_BLOCK_SIZE / RecordLog::RECORD_SIZE;
+        static constexpr size_t BLOCK_BYTES = BLOCK_RECORDS * RecordLog::RECORD_SIZE;
+
+        File _file;
+        bool _open;
+        size_t _maxBytes;
+
+        uint8_t _blocks[2][BLOCK_BYTES];
+        size_t _fill[2];
+        bool _full[2];
+        uint8_t _active;
+
+        unsigned long _recorded;
+        unsigned long _dropped;
+        size_t _written;
+
+        void writeBlock(uint8_t index);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_DRIVER_RECORDER_H
@@ -0,0 +1,231 @@
+#include "EventBridge.h"
+#include "Logger.h"
+#include <Arduino.h>
+#include <string.h>
+
+namespace TwiST {
+
+    EventBridge::EventBridge(ITransport& transport, EventBus& eventBus)
+        : _transport(transport),
+          _eventBus(eventBus),
+          _topicCount(0),
+          _writer(WireFrame::payload(_frame), TWIST_WIRE_MAX_PAYLOAD, 0),
+          _sequence(0),
+          _pendingFlush(false),
+          _peerSequence(0),
+          _hasPeerSequence(false),
+          _eventsSent(0),
+          _eventsReceived(0),
+          _eventsRateLimited(0),
+          _eventsDropped(0),
+          _eventsRejected(0),
+          _flushes(0),
+          _sequenceGaps(0) {
+    }
+
+    EventBridge::~EventBridge() {
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            if (_topics[i].listenerId != 0) {
+                _eventBus.unsubscribe(_topics[i].listenerId);
+            }
+        }
+    }
+
+    // ===== Topics =====
+
+    bool EventBridge::exportTopic(const char* topic, unsigned long minIntervalMs) {
+        EventBridgeTopic* entry = addTopic(topic, EVENT_EXPORT, minIntervalMs);
+        if (entry == NULL) return false;
+
+        entry->listenerId = _eventBus.subscribe(topic, onExportEvent, entry);
+        if (entry->listenerId == 0) {
+            _topicCount--;
+            return false;
+        }
+        return true;
+    }
+
+    bool EventBridge::importTopic(const char* topic, unsigned long minIntervalMs) {
+        return addTopic(topic, EVENT_IMPORT, minIntervalMs) != NULL;
+    }
+
+    const EventBridgeTopic* EventBridge::getTopic(uint8_t index) const {
+        return (index < _topicCount) ? &_topics[index] : NULL;
+    }
+
+    EventBridgeTopic* EventBridge::addTopic(const char* topic, EventBridgeDirection direction,
+                                            unsigned long minIntervalMs) {
+        if (topic == NULL) {
+            Logger::error("EVENTBRIDGE", "Cannot bridge NULL topic");
+            return NULL;
+        }
+        if (strlen(topic) > 255) {
+            Logger::error("EVENTBRIDGE", "Topic name too long");
+            return NULL;
+        }
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            if (strcmp(_topics[i].name, topic) == 0) {
+                Logger::logf(Logger::Level::ERROR, "EVENTBRIDGE", "Topic '%s' already bridged", topic);
+                return NULL;
+            }
+        }
+        if (_topicCount >= TWIST_EVENT_BRIDGE_MAX_TOPICS) {
+            Logger::error("EVENTBRIDGE", "Topic limit reached");
+            return NULL;
+        }
+
+        EventBridgeTopic& entry = _topics[_topicCount++];
+        entry.name = topic;
+        entry.direction = direction;
+        entry.minIntervalMs = minIntervalMs;
+        entry.lastForwardMs = 0;
+        entry.forwarded = 0;
+        entry.rateLimited = 0;
+        entry.listenerId = 0;
+        entry.owner = this;
+        return &entry;
+    }
+
+    bool EventBridge::allow(EventBridgeTopic& topic, unsigned long now) {
+        if (topic.minIntervalMs > 0 && topic.forwarded > 0 &&
+            (now - topic.lastForwardMs) < topic.minIntervalMs) {
+            topic.rateLimited++;
+            _eventsRateLimited++;
+            return false;
+        }
+        return true;
+    }
+
+    // ===== Outgoing =====
+
+    void EventBridge::onExportEvent(const Event& event, void* context) {
+        EventBridgeTopic* topic = static_cast<EventBridgeTopic*>(context);
+        topic->owner->queueEvent(*topic, event);
+    }
+
+    void EventBridge::queueEvent(EventBridgeTopic& topic, const Event& event) {
+        unsigned long now = millis();
+        if (!allow(topic, now)) return;
+
+        uint32_t timestamp = (uint32_t)(event.timestamp != 0 ? event.timestamp : now);
+        if (!_writer.add(event.name, event.sourceDeviceId, (uint8_t)event.priority, timestamp)) {
+            // Frame full - hand it to the transport and start the next one
+            emitFrame();
+            if (!_writer.add(event.name, event.sourceDeviceId, (uint8_t)event.priority, timestamp)) {
+                _eventsDropped++;
+                return;
+            }
+        }
+
+        topic.forwarded++;
+        topic.lastForwardMs = now;
+    }
+
+    void EventBridge::emitFrame() {
+        uint8_t count = _writer.getCount();
+        if (count == 0) return;
+
+        size_t length = WireFrame::finalize(_frame, WIRE_EVENTS, (uint16_t)_writer.length());
+        if (_transport.writable() < length) {
+            _eventsDropped += count;    // Whole frames only
+        } else {
+            _transport.send(_frame, length);
+            _eventsSent += count;
+            _pendingFlush = true;
+        }
+
+        _sequence++;  // Dropped frames still advance - the receiver sees the gap
+        _writer = EventBatchWriter(WireFrame::payload(_frame), TWIST_WIRE_MAX_PAYLOAD, _sequence);
+    }
+
+    // ===== IService =====
+
+    void EventBridge::update() {
+        receive();
+
+        emitFrame();
+        if (_pendingFlush) {
+            _transport.flush();  // One datagram per tick
+            _pendingFlush = false;
+            _flushes++;
+        }
+    }
+
+    // ===== Incoming =====
+
+    void EventBridge::receive() {
+        uint8_t buffer[64];
+        size_t budget = TWIST_EVENT_BRIDGE_MAX_BYTES_PER_TICK;
+
+        while (budget > 0) {
+            size_t chunk = (budget < sizeof(buffer)) ? budget : sizeof(buffer);
+            size_t received = _transport.receive(buffer, chunk);
+            if (received == 0) break;
+            budget -= received;
+
+            for (size_t i = 0; i < received; i++) {
+                if (_parser.feed(buffer[i]) && _parser.type() == WIRE_EVENTS) {
+                    handleBatch(_parser.payload(), _parser.length());
+                }
+            }
+        }
+    }
+
+    void EventBridge::handleBatch(const uint8_t* payload, size_t length) {
+        EventBatchReader reader(payload, length);
+        if (!reader.isValid()) return;
+
+        if (_hasPeerSequence && reader.getSequence() != (uint16_t)(_peerSequence + 1)) {
+            _sequenceGaps++;
+        }
+        _peerSequence = reader.getSequence();
+        _hasPeerSequence = true;
+
+        unsigned long now = millis();
+        EventRecord record;
+        while (reader.next(record)) {
+            _eventsReceived++;
+
+            EventBridgeTopic* topic = findImport(record.name, record.nameLength);
+            if (topic == NULL) {
+                _eventsRejected++;
+                continue;
+            }
+            if (!allow(*topic, now)) continue;
+
+            // Check first - publishAsync() logs every overflow
+            if (_eventBus.getPendingEventCount() >= MAX_EVENT_QUEUE) {
+                _eventsDropped++;
+                continue;
+            }
+
+            // Listeners are matched per priority level - snap to a defined one
+            uint8_t priority = record.priority;
+            priority = (priority > PRIORITY_CRITICAL) ? PRIORITY_CRITICAL : priority - (priority % 10);
+
+            Event event = {
+                .name = topic->name,    // Bridge-owned string outlives the queue
+                .sourceDeviceId = record.sourceDeviceId,
+                .data = NULL,
+                .priority = (EventPriority)priority,
+                .timestamp = record.timestamp
+            };
+            _eventBus.publishAsync(event);
+
+            topic->forwarded++;
+            topic->lastForwardMs = now;
+        }
+    }
+
+    EventBridgeTopic* EventBridge::findImport(const char* name, uint8_t nameLength) {
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            EventBridgeTopic& topic = _topics[i];
+            if (topic.direction == EVENT_IMPORT &&
+                strlen(topic.name) == nameLength && memcmp(topic.name, name, nameLength) == 0) {
+                return &topic;
+            }
+        }
+        return NULL;
+    }
+
+}  // namespace TwiST
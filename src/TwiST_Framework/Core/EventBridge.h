@@ -0,0 +1,162 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      EventBridge.h
+ * @brief     Forwards selected EventBus topics to and from another process
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService, SERVICE_AFTER_BRIDGES)
+ * - Hardware:     None (uses ITransport)
+ * - Implements:   IService
+ *
+ * PRINCIPLES:
+ * - Listeners and publishers are unchanged - the bridge is just another
+ *   subscriber (exports) and another publisher (imports)
+ * - Runs at the END of update(): every event of the tick goes out in one
+ *   transport flush (one datagram on UDPTransport)
+ * - Incoming events are injected with publishAsync() and reach listeners
+ *   at the next processEvents() - never from inside the receive path
+ * - A topic is bridged in ONE direction only - no echo loops
+ * - Event names, source, priority and timestamp travel; Event::data does not.
+ *   Imported events are re-stamped with local arrival time by publishAsync()
+ *
+ * CAPABILITIES:
+ * - Per-topic minimum interval (rate limit) in each direction
+ * - Forwarded / rate-limited / dropped counters per topic and in total
+ * - Sequence gap count on received batches
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_EVENT_BRIDGE_H
+#define TWIST_EVENT_BRIDGE_H
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/ITransport.h"
+#include "EventBus.h"
+#include "EventCodec.h"
+#include "WireFrame.h"
+
+// Bridged topics (both directions together)
+#ifndef TWIST_EVENT_BRIDGE_MAX_TOPICS
+#define TWIST_EVENT_BRIDGE_MAX_TOPICS 16
+#endif
+
+// Receive bytes processed per update() (bounds time spent in one tick)
+#ifndef TWIST_EVENT_BRIDGE_MAX_BYTES_PER_TICK
+#define TWIST_EVENT_BRIDGE_MAX_BYTES_PER_TICK 1024
+#endif
+
+namespace TwiST {
+
+    enum EventBridgeDirection : uint8_t {
+        EVENT_EXPORT,   // Local EventBus -> transport
+        EVENT_IMPORT    // Transport -> local EventBus
+    };
+
+    class EventBridge;
+
+    // One bridged topic
+    struct EventBridgeTopic {
+        const char* name;
+        EventBridgeDirection direction;
+        unsigned long minIntervalMs;    // 0 = no rate limit
+        unsigned long lastForwardMs;
+        unsigned long forwarded;
+        unsigned long rateLimited;
+        uint16_t listenerId;            // EventBus subscription (exports)
+        EventBridge* owner;
+    };
+
+    /**
+     * @brief EventBus network bridge
+     *
+     * Example usage:
+     * ```cpp
+     * Drivers::UDPTransport link(4220);          // Replies to last sender
+     * EventBridge events(link, framework.eventBus());
+     * events.exportTopic("distance.changed", 50); // At most 20/s
+     * events.importTopic("app.estop");
+     * framework.addService(&events, SERVICE_AFTER_BRIDGES);
+     * ```
+     */
+    class EventBridge : public IService {
+    public:
+        EventBridge(ITransport& transport, EventBus& eventBus);
+        ~EventBridge();
+
+        /**
+         * @brief Forward a local topic to the transport
+         * @param topic Event name (must outlive the bridge)
+         * @param minIntervalMs Minimum time between forwarded events
+         * @return false if already bridged or topic table full
+         */
+        bool exportTopic(const char* topic, unsigned long minIntervalMs = 0);
+
+        /**
+         * @brief Accept a topic from the transport and publish it locally
+         * @param topic Event name (must outlive the bridge; used as Event::name)
+         * @param minIntervalMs Minimum time between injected events
+         * @return false if already bridged or topic table full
+         */
+        bool importTopic(const char* topic, unsigned long minIntervalMs = 0);
+
+        // IService
+        void update() override;
+        const char* getName() const override { return "EventBridge"; }
+
+        // Statistics
+        uint8_t getTopicCount() const { return _topicCount; }
+        const EventBridgeTopic* getTopic(uint8_t index) const;
+        unsigned long getEventsSent() const { return _eventsSent; }
+        unsigned long getEventsReceived() const { return _eventsReceived; }
+        unsigned long getEventsRateLimited() const { return _eventsRateLimited; }
+        unsigned long getEventsDropped() const { return _eventsDropped; }
+        unsigned long getEventsRejected() const { return _eventsRejected; }
+        unsigned long getFlushCount() const { return _flushes; }
+        unsigned long getSequenceGapCount() const { return _sequenceGaps; }
+
+    private:
+        ITransport& _transport;
+        EventBus& _eventBus;
+        WireFrameParser _parser;
+
+        EventBridgeTopic _topics[TWIST_EVENT_BRIDGE_MAX_TOPICS];
+        uint8_t _topicCount;
+
+        // Outgoing frame being filled by the listener
+        uint8_t _frame[WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+        EventBatchWriter _writer;
+        uint16_t _sequence;
+        bool _pendingFlush;
+
+        uint16_t _peerSequence;
+        bool _hasPeerSequence;
+
+        unsigned long _eventsSent;
+        unsigned long _eventsReceived;
+        unsigned long _eventsRateLimited;
+        unsigned long _eventsDropped;
+        unsigned long _eventsRejected;
+        unsigned long _flushes;
+        unsigned long _sequenceGaps;
+
+        static void onExportEvent(const Event& event, void* context);
+
+        EventBridgeTopic* addTopic(const char* topic, EventBridgeDirection direction, unsigned long minIntervalMs);
+        bool allow(EventBridgeTopic& topic, unsigned long now);
+        void queueEvent(EventBridgeTopic& topic, const Event& event);
+        void emitFrame();
+        void receive();
+        void handleBatch(const uint8_t* payload, size_t length);
+        EventBridgeTopic* findImport(const char* name, uint8_t nameLength);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_EVENT_BRIDGE_H
@@ -1,5 +1,6 @@
 #include "EventBus.h"
 #include "Logger.h"  // For centralized logging (v1.2.0)
+#include "Tracer.h"  // For TWIST_TRACE_SCOPE
 #include <string.h>
 
 using TwiST::Logger;  // Use Logger from TwiST namespace
@@ -17,6 +18,8 @@ EventBus::EventBus()
         _listeners[i].id = 0;
         _listeners[i].eventName = NULL;
         _listeners[i].callback = NULL;
+        _listeners[i].contextCallback = NULL;
+        _listeners[i].context = NULL;
         _listeners[i].priority = PRIORITY_NORMAL;
         _listeners[i].active = false;
     }
@@ -41,7 +44,21 @@ uint16_t EventBus::subscribe(const char* eventName, EventListener listener, Even
         Logger::error("EVENTBUS", "Cannot subscribe with NULL eventName or listener");
         return 0;
     }
+    return addSubscription(eventName, listener, NULL, NULL, priority);
+}
+
+uint16_t EventBus::subscribe(const char* eventName, EventContextListener listener, void* context,
+                             EventPriority priority) {
+    if (eventName == NULL || listener == NULL) {
+        Logger::error("EVENTBUS", "Cannot subscribe with NULL eventName or listener");
+        return 0;
+    }
+    return addSubscription(eventName, NULL, listener, context, priority);
+}
 
+uint16_t EventBus::addSubscription(const char* eventName, EventListener listener,
+                                   EventContextListener contextListener, void* context,
+                                   EventPriority priority) {
     if (_listenerCount >= MAX_EVENT_LISTENERS) {
         Logger::error("EVENTBUS", "Listener limit reached");
         return 0;
@@ -53,6 +70,8 @@ uint16_t EventBus::subscribe(const char* eventName, EventListener listener, Even
             _listeners[i].id = _nextListenerId++;
             _listeners[i].eventName = eventName;
             _listeners[i].callback = listener;
+            _listeners[i].contextCallback = contextListener;
+            _listeners[i].context = context;
             _listeners[i].priority = priority;
             _listeners[i].active = true;
             _listenerCount++;
@@ -76,6 +95,8 @@ void EventBus::unsubscribe(uint16_t listenerId) {
             _listeners[i].id = 0;
             _listeners[i].eventName = NULL;
             _listeners[i].callback = NULL;
+            _listeners[i].contextCallback = NULL;
+            _listeners[i].context = NULL;
             _listenerCount--;
             return;
         }
@@ -95,6 +116,8 @@ void EventBus::unsubscribeAll(const char* eventName) {
             _listeners[i].id = 0;
             _listeners[i].eventName = NULL;
             _listeners[i].callback = NULL;
+            _listeners[i].contextCallback = NULL;
+            _listeners[i].context = NULL;
             _listenerCount--;
         }
     }
@@ -171,6 +194,8 @@ bool EventBus::eventMatches(const char* eventName, const char* pattern) {
 }
 
 void EventBus::triggerListeners(const Event& event) {
+    TWIST_TRACE_SCOPE(event.name);
+
     // Find matching listeners, prioritize by priority level
     // Note: In a full implementation, we'd sort listeners by priority
     // For simplicity, we'll iterate in priority order
@@ -184,6 +209,8 @@ void EventBus::triggerListeners(const Event& event) {
                 // Call listener callback
                 if (_listeners[i].callback) {
                     _listeners[i].callback(event);
+                } else if (_listeners[i].contextCallback) {
+                    _listeners[i].contextCallback(event, _listeners[i].context);
                 }
             }
         }
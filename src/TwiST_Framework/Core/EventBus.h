@@ -67,11 +67,16 @@ struct Event {
 // Event listener callback
 typedef void (*EventListener)(const Event& event);
 
+// Event listener callback with user context (for listeners that are objects)
+typedef void (*EventContextListener)(const Event& event, void* context);
+
 // Internal listener registration
 struct EventSubscription {
     uint16_t id;
     const char* eventName;
     EventListener callback;
+    EventContextListener contextCallback;
+    void* context;
     EventPriority priority;
     bool active;
 };
@@ -124,6 +129,17 @@ public:
      */
     uint16_t subscribe(const char* eventName, EventListener listener, EventPriority priority = PRIORITY_NORMAL);
 
+    /**
+     * @brief Subscribe to an event with a context pointer
+     * @param eventName Event name to subscribe to
+     * @param listener Callback receiving the event and context
+     * @param context Passed back unchanged (typically the listening object)
+     * @param priority Priority level (higher priority listeners called first)
+     * @return Listener ID (for unsubscribing) or 0 if failed
+     */
+    uint16_t subscribe(const char* eventName, EventContextListener listener, void* context,
+                       EventPriority priority = PRIORITY_NORMAL);
+
     /**
      * @brief Unsubscribe a specific listener
      * @param listenerId Listener ID returned by subscribe()
@@ -195,6 +211,10 @@ private:
 
     unsigned long _totalEventCount;
 
+    // Helper to fill a free listener slot
+    uint16_t addSubscription(const char* eventName, EventListener listener,
+                             EventContextListener contextListener, void* context, EventPriority priority);
+
     // Helper to check if event name matches subscription
     bool eventMatches(const char* eventName, const char* pattern);
 
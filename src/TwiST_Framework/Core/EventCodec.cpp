@@ -0,0 +1,87 @@
+#include "EventCodec.h"
+#include "CommandProtocol.h"  // Little-endian field helpers
+#include <string.h>
+
+namespace TwiST {
+
+    namespace {
+        void putU32(uint8_t* out, uint32_t value) {
+            CommandProtocol::putU16(out, (uint16_t)(value & 0xFFFF));
+            CommandProtocol::putU16(out + 2, (uint16_t)(value >> 16));
+        }
+
+        uint32_t getU32(const uint8_t* in) {
+            return (uint32_t)CommandProtocol::getU16(in) | ((uint32_t)CommandProtocol::getU16(in + 2) << 16);
+        }
+    }
+
+    // ===== EventBatchWriter =====
+
+    EventBatchWriter::EventBatchWriter(uint8_t* payload, size_t capacity, uint16_t sequence)
+        : _data(payload),
+          _capacity(capacity),
+          _position(EventCodec::HEADER_SIZE) {
+        CommandProtocol::putU16(_data, sequence);
+        _data[2] = 0;   // Count
+    }
+
+    bool EventBatchWriter::add(const char* name, uint16_t sourceDeviceId, uint8_t priority, uint32_t timestamp) {
+        size_t nameLength = strlen(name);
+        if (nameLength > 255) return false;
+
+        size_t size = EventCodec::entrySize((uint8_t)nameLength);
+        if (_data[2] == 255 || _position + size > _capacity) {
+            return false;
+        }
+
+        uint8_t* p = _data + _position;
+        p[0] = (uint8_t)nameLength;
+        memcpy(p + 1, name, nameLength);
+        p += 1 + nameLength;
+        CommandProtocol::putU16(p, sourceDeviceId);
+        p[2] = priority;
+        putU32(p + 3, timestamp);
+
+        _position += size;
+        _data[2]++;
+        return true;
+    }
+
+    // ===== EventBatchReader =====
+
+    EventBatchReader::EventBatchReader(const uint8_t* payload, size_t length)
+        : _data(payload),
+          _length(length),
+          _position(EventCodec::HEADER_SIZE),
+          _decoded(0),
+          _valid(payload != NULL && length >= EventCodec::HEADER_SIZE) {
+    }
+
+    uint16_t EventBatchReader::getSequence() const {
+        return CommandProtocol::getU16(_data);
+    }
+
+    bool EventBatchReader::next(EventRecord& out) {
+        if (!_valid || _decoded >= getCount()) return false;
+
+        size_t remaining = _length - _position;
+        if (remaining < EventCodec::ENTRY_BASE_SIZE ||
+            remaining < EventCodec::entrySize(_data[_position])) {
+            _valid = false;
+            return false;
+        }
+
+        const uint8_t* p = _data + _position;
+        out.nameLength = p[0];
+        out.name = (const char*)(p + 1);
+        p += 1 + out.nameLength;
+        out.sourceDeviceId = CommandProtocol::getU16(p);
+        out.priority = p[2];
+        out.timestamp = getU32(p + 3);
+
+        _position += EventCodec::entrySize(out.nameLength);
+        _decoded++;
+        return true;
+    }
+
+}  // namespace TwiST
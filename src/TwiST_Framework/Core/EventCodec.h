@@ -0,0 +1,105 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      EventCodec.h
+ * @brief     Batched EventBus events on the wire
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Protocol Codec (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - dashboards and test harnesses on a PC link
+ *   the same codec the bridge uses
+ * - Many events per frame, sequence number per frame
+ * - Event names travel as length-prefixed bytes (no terminator)
+ * - Bounds-checked decoding, in place (names point into the payload)
+ *
+ * EVENT PAYLOAD (WIRE_EVENTS frame):
+ *   u16 sequence, u8 count, then per event:
+ *   u8 nameLength, name bytes, u16 sourceDeviceId, u8 priority, u32 timestampMs
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_EVENT_CODEC_H
+#define TWIST_EVENT_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace TwiST {
+
+    namespace EventCodec {
+        static constexpr size_t HEADER_SIZE = 3;
+        static constexpr size_t ENTRY_BASE_SIZE = 8;
+
+        inline size_t entrySize(uint8_t nameLength) { return ENTRY_BASE_SIZE + nameLength; }
+    }
+
+    // One decoded event (name is NOT null-terminated)
+    struct EventRecord {
+        const char* name;
+        uint8_t nameLength;
+        uint16_t sourceDeviceId;
+        uint8_t priority;           // EventPriority
+        uint32_t timestamp;         // Sender millis()
+    };
+
+    /**
+     * @brief Builds one event batch
+     */
+    class EventBatchWriter {
+    public:
+        EventBatchWriter(uint8_t* payload, size_t capacity, uint16_t sequence);
+
+        /**
+         * @brief Append one event
+         * @param name Event name (names longer than 255 bytes are rejected)
+         * @return false if the batch is full (event not written)
+         */
+        bool add(const char* name, uint16_t sourceDeviceId, uint8_t priority, uint32_t timestamp);
+
+        size_t length() const { return _position; }
+        uint8_t getCount() const { return _data[2]; }
+
+    private:
+        uint8_t* _data;
+        size_t _capacity;
+        size_t _position;
+    };
+
+    /**
+     * @brief Iterates a received event batch
+     */
+    class EventBatchReader {
+    public:
+        EventBatchReader(const uint8_t* payload, size_t length);
+
+        bool isValid() const { return _valid; }
+        uint16_t getSequence() const;
+        uint8_t getCount() const { return _data[2]; }
+
+        /**
+         * @brief Decode next event
+         * @return false when done or truncated
+         */
+        bool next(EventRecord& out);
+
+    private:
+        const uint8_t* _data;
+        size_t _length;
+        size_t _position;
+        uint8_t _decoded;
+        bool _valid;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_EVENT_CODEC_H
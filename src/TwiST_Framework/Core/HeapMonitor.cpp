@@ -0,0 +1,134 @@
+#include "HeapMonitor.h"
+#include "Logger.h"
+#include <esp_heap_caps.h>
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+namespace TwiST {
+
+    namespace {
+        // Shared with the replaced operator new (any task)
+        std::atomic<bool> g_sealed(false);
+        std::atomic<uint32_t> g_allocs(0);
+        std::atomic<uint32_t> g_frees(0);
+        std::atomic<uint32_t> g_lateAllocs(0);
+        std::atomic<uint32_t> g_lateBytes(0);
+        size_t g_firstLateSize = 0;
+        void* g_firstLateCaller = NULL;
+    }
+
+    HeapMonitor::HeapMonitor()
+        : _sealed(false),
+          _free(0),
+          _minFree(0),
+          _largest(0),
+          _freeAtSeal(0),
+          _reportedLate(0) {
+    }
+
+    // ===== Loop Hooks =====
+
+    void HeapMonitor::seal() {
+        if (_sealed) return;
+        sample();
+        _freeAtSeal = _free;
+        _sealed = true;
+        g_sealed.store(true);
+        Logger::logf(Logger::Level::INFO, "HEAP", "Sealed: %u bytes free, largest block %u%s",
+                    (unsigned)_free, (unsigned)_largest,
+                    isCounting() ? ", counting late allocations" : "");
+    }
+
+    void HeapMonitor::check() {
+        unsigned long late = g_lateAllocs.load(std::memory_order_relaxed);
+        if (late == _reportedLate) return;
+        _reportedLate = late;
+        Logger::logf(Logger::Level::WARNING, "HEAP", "%lu allocations after startup (%u bytes) - first: %u bytes from %p",
+                    late, (unsigned)g_lateBytes.load(), (unsigned)g_firstLateSize, g_firstLateCaller);
+    }
+
+    // ===== Heap Statistics =====
+
+    void HeapMonitor::sample() {
+        _free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        _minFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+        _largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    }
+
+    float HeapMonitor::getFragmentation() const {
+        if (_free == 0) return 0.0f;
+        return 1.0f - (float)_largest / (float)_free;
+    }
+
+    long HeapMonitor::getDriftSinceSeal() const {
+        if (!_sealed) return 0;
+        return (long)_freeAtSeal - (long)_free;
+    }
+
+    // ===== Allocation Counting =====
+
+    unsigned long HeapMonitor::getAllocationCount() { return g_allocs.load(); }
+    unsigned long HeapMonitor::getFreeCount() { return g_frees.load(); }
+    unsigned long HeapMonitor::getLateAllocationCount() { return g_lateAllocs.load(); }
+    size_t HeapMonitor::getLateAllocationBytes() { return g_lateBytes.load(); }
+    size_t HeapMonitor::getFirstLateSize() { return g_firstLateSize; }
+    void* HeapMonitor::getFirstLateCaller() { return g_firstLateCaller; }
+
+#if TWIST_ENABLE_HEAP_MONITOR
+    namespace {
+        void* countedAlloc(size_t size, void* caller) {
+            g_allocs.fetch_add(1, std::memory_order_relaxed);
+            if (g_sealed.load(std::memory_order_relaxed)) {
+                if (g_lateAllocs.fetch_add(1, std::memory_order_relaxed) == 0) {
+                    g_firstLateSize = size;
+                    g_firstLateCaller = caller;
+                }
+                g_lateBytes.fetch_add((uint32_t)size, std::memory_order_relaxed);
+            }
+            return malloc(size ? size : 1);
+        }
+
+        void countedFree(void* ptr) {
+            if (ptr == NULL) return;
+            g_frees.fetch_add(1, std::memory_order_relaxed);
+            free(ptr);
+        }
+    }
+#endif
+
+}  // namespace TwiST
+
+#if TWIST_ENABLE_HEAP_MONITOR
+// Global replacements - every other form (nothrow, sized delete) forwards here
+
+void* operator new(size_t size) {
+    void* ptr = TwiST::countedAlloc(size, __builtin_return_address(0));
+#if __cpp_exceptions
+    if (ptr == NULL) throw std::bad_alloc();
+#else
+    if (ptr == NULL) abort();
+#endif
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    TwiST::countedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    TwiST::countedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    TwiST::countedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    TwiST::countedFree(ptr);
+}
+#endif
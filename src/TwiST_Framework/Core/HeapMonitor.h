@@ -0,0 +1,118 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      HeapMonitor.h
+ * @brief     Heap usage accounting and post-startup allocation detection
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (owned by TwiSTFramework)
+ * - Hardware:     ESP-IDF heap_caps (8-bit capable heap)
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Startup may allocate, the loop may not: the framework seals the
+ *   monitor on its first update() and everything after that is "late"
+ * - Free / minimum / largest block are sampled on demand (printStatus,
+ *   sample()) - never per loop pass
+ * - Exact counting replaces the global operator new / delete, so it is
+ *   opt-in (TWIST_ENABLE_HEAP_MONITOR); it sees C++ allocations from every
+ *   task. C malloc() (ArduinoJson, String, IDF) only shows up as drift in
+ *   the sampled free size
+ *
+ * CAPABILITIES:
+ * - Free heap, all-time minimum, largest free block, fragmentation
+ * - Drift: bytes lost since seal (sampled, includes malloc)
+ * - Late operator new count / bytes, size and caller of the first one
+ *   (addr2line the caller to find the allocation)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_HEAP_MONITOR_H
+#define TWIST_HEAP_MONITOR_H
+
+#include "../TwiST_Config.h"
+#include <stddef.h>
+#include <stdint.h>
+
+namespace TwiST {
+
+    /**
+     * @brief Heap statistics plus the "no allocation after startup" check
+     *
+     * Example:
+     * ```cpp
+     * // TwiST_Config.h or build flags: #define TWIST_ENABLE_HEAP_MONITOR 1
+     * framework.update();                            // First pass seals
+     * ...
+     * if (HeapMonitor::getLateAllocationCount() > 0) {
+     *     Serial.printf("late new from %p\n", HeapMonitor::getFirstLateCaller());
+     * }
+     * ```
+     */
+    class HeapMonitor {
+    public:
+        HeapMonitor();
+
+        // ===== Loop Hooks (called by framework) =====
+
+        /**
+         * @brief End of startup - snapshot the heap and start counting late allocations
+         */
+        void seal();
+        bool isSealed() const { return _sealed; }
+
+        /**
+         * @brief Log newly seen late allocations (cheap - compares one counter)
+         */
+        void check();
+
+        // ===== Heap Statistics =====
+
+        /**
+         * @brief Refresh free / minimum / largest block from the allocator
+         */
+        void sample();
+
+        size_t getFreeHeap() const { return _free; }
+        size_t getMinFreeHeap() const { return _minFree; }         // Low-water mark since boot
+        size_t getLargestFreeBlock() const { return _largest; }
+        size_t getFreeAtSeal() const { return _freeAtSeal; }
+
+        /**
+         * @brief 1 - largest block / free (0 = one contiguous block)
+         */
+        float getFragmentation() const;
+
+        /**
+         * @brief Free bytes lost since seal() (negative = more free than at seal)
+         */
+        long getDriftSinceSeal() const;
+
+        // ===== Allocation Counting (TWIST_ENABLE_HEAP_MONITOR) =====
+
+        static bool isCounting() { return TWIST_ENABLE_HEAP_MONITOR != 0; }
+        static unsigned long getAllocationCount();      // operator new calls since boot
+        static unsigned long getFreeCount();            // operator delete calls since boot
+        static unsigned long getLateAllocationCount();  // operator new calls after seal()
+        static size_t getLateAllocationBytes();
+        static size_t getFirstLateSize();
+        static void* getFirstLateCaller();              // Return address into the allocating code
+
+    private:
+        bool _sealed;
+        size_t _free;
+        size_t _minFree;
+        size_t _largest;
+        size_t _freeAtSeal;
+        unsigned long _reportedLate;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_HEAP_MONITOR_H
@@ -0,0 +1,219 @@
+#include "I2CQueue.h"
+#include "Logger.h"
+#include "PowerManager.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static_assert((TWIST_I2C_QUEUE_DEPTH & (TWIST_I2C_QUEUE_DEPTH - 1)) == 0,
+              "TWIST_I2C_QUEUE_DEPTH must be a power of two");
+static_assert(TWIST_I2C_QUEUE_DEPTH <= 255, "Depth statistics are 8-bit");
+
+namespace TwiST {
+
+    I2CQueue::I2CQueue(II2CBus& bus)
+        : _bus(bus),
+          _head(0),
+          _exec(0),
+          _tail(0),
+          _task(NULL),
+          _maxDepth(0),
+          _submitted(0),
+          _completed(0),
+          _failed(0),
+          _dropped(0),
+          _lastLatencyUs(0),
+          _maxLatencyUs(0),
+          _latencySumUs(0),
+          _retryCount(0),
+          _windowStartUs(0),
+          _windowBusyUs(0),
+          _utilization(0.0f) {
+    }
+
+    // ===== Producer (loop context) =====
+
+    bool I2CQueue::submit(uint8_t address, const uint8_t* data, uint8_t length,
+                          I2CCompletion callback, void* context) {
+        if (length > TWIST_I2C_MAX_DATA) {
+            Logger::logf(Logger::Level::ERROR, "I2C", "Transaction of %d bytes exceeds %d", length, TWIST_I2C_MAX_DATA);
+            _dropped++;
+            return false;
+        }
+
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t depth = head - _tail.load(std::memory_order_acquire);
+        if (depth >= TWIST_I2C_QUEUE_DEPTH) {
+            _dropped++;  // Bus cannot keep up - caller decides whether to retry
+            return false;
+        }
+
+        Transaction& slot = _slots[head & (TWIST_I2C_QUEUE_DEPTH - 1)];
+        slot.address = address;
+        slot.length = length;
+        memcpy(slot.data, data, length);
+        slot.callback = callback;
+        slot.context = context;
+        slot.submitUs = micros();
+        _head.store(head + 1, std::memory_order_release);  // Publish to worker
+
+        _submitted++;
+        if (depth + 1 > _maxDepth) {
+            _maxDepth = (uint8_t)(depth + 1);
+        }
+        if (_task != NULL) {
+            xTaskNotifyGive((TaskHandle_t)_task);
+        }
+        return true;
+    }
+
+    bool I2CQueue::writeRegister(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length,
+                                 I2CCompletion callback, void* context) {
+        uint8_t buffer[TWIST_I2C_MAX_DATA];
+        if (length + 1 > TWIST_I2C_MAX_DATA) {
+            Logger::logf(Logger::Level::ERROR, "I2C", "Register write of %d bytes exceeds %d", length + 1, TWIST_I2C_MAX_DATA);
+            _dropped++;
+            return false;
+        }
+        buffer[0] = reg;
+        memcpy(buffer + 1, data, length);
+        return submit(address, buffer, length + 1, callback, context);
+    }
+
+    bool I2CQueue::requestRetry(I2CRetry callback, void* context) {
+        for (uint8_t i = 0; i < _retryCount; i++) {
+            if (_retry[i].callback == callback && _retry[i].context == context) return true;
+        }
+        if (_retryCount >= TWIST_I2C_RETRY_SLOTS) {
+            Logger::logf(Logger::Level::ERROR, "I2C", "More than %d producers waiting for space", TWIST_I2C_RETRY_SLOTS);
+            return false;
+        }
+        _retry[_retryCount].callback = callback;
+        _retry[_retryCount].context = context;
+        _retryCount++;
+        return true;
+    }
+
+    // ===== Worker =====
+
+    uint8_t I2CQueue::process(uint8_t maxTransactions) {
+        uint8_t executed = 0;
+        uint32_t exec = _exec.load(std::memory_order_relaxed);
+
+        while (executed < maxTransactions && exec != _head.load(std::memory_order_acquire)) {
+            Transaction& slot = _slots[exec & (TWIST_I2C_QUEUE_DEPTH - 1)];
+            unsigned long start = micros();
+            slot.success = _bus.write(slot.address, slot.data, slot.length);
+            slot.doneUs = micros();
+            slot.busyUs = slot.doneUs - start;
+
+            exec++;
+            _exec.store(exec, std::memory_order_release);  // Hand result to update()
+            executed++;
+        }
+        return executed;
+    }
+
+    bool I2CQueue::startTask(uint32_t stackSize, uint8_t priority) {
+        if (_task != NULL) return true;
+
+        TaskHandle_t handle = NULL;
+        if (xTaskCreate(taskEntry, "twist_i2c", stackSize, this, priority, &handle) != pdPASS) {
+            Logger::error("I2C", "Worker task creation failed - running inline");
+            return false;
+        }
+        _task = handle;
+        Logger::logf(Logger::Level::INFO, "I2C", "Worker task started (priority %d)", priority);
+        return true;
+    }
+
+    void I2CQueue::taskEntry(void* arg) {
+        I2CQueue* queue = static_cast<I2CQueue*>(arg);
+        for (;;) {
+            if (queue->process() == 0) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // Sleep until next submit()
+            } else {
+                PowerManager::wake();  // Results to retire - end the loop's idle wait
+            }
+        }
+    }
+
+    // ===== IService (loop context) =====
+
+    void I2CQueue::update() {
+        if (_task == NULL) {
+            process();  // No worker - same ordering, just on this context
+        }
+
+        // Retire finished transactions and run their callbacks here
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t done = _exec.load(std::memory_order_acquire);
+        while (tail != done) {
+            Transaction& slot = _slots[tail & (TWIST_I2C_QUEUE_DEPTH - 1)];
+
+            unsigned long latency = slot.doneUs - slot.submitUs;
+            _lastLatencyUs = latency;
+            if (latency > _maxLatencyUs) _maxLatencyUs = latency;
+            _latencySumUs += latency;
+            _windowBusyUs += slot.busyUs;
+            _completed++;
+            if (!slot.success) _failed++;
+
+            if (slot.callback != NULL) {
+                slot.callback(slot.address, slot.success, slot.context);
+            }
+
+            tail++;
+            _tail.store(tail, std::memory_order_release);  // Slot free for submit()
+        }
+
+        // Producers that found the queue full - each may re-register if it fills up again
+        if (_retryCount > 0 && !isFull()) {
+            RetryWaiter waiting[TWIST_I2C_RETRY_SLOTS];
+            uint8_t count = _retryCount;
+            memcpy(waiting, _retry, sizeof(RetryWaiter) * count);
+            _retryCount = 0;
+            for (uint8_t i = 0; i < count; i++) {
+                waiting[i].callback(waiting[i].context);
+            }
+        }
+
+        unsigned long now = micros();
+        unsigned long elapsed = now - _windowStartUs;
+        if (elapsed >= TWIST_I2C_STATS_WINDOW_MS * 1000UL) {
+            _utilization = (float)_windowBusyUs / (float)elapsed;
+            if (_utilization > 1.0f) _utilization = 1.0f;
+            _windowBusyUs = 0;
+            _windowStartUs = now;
+        }
+    }
+
+    uint32_t I2CQueue::getTimeUntilUpdate(uint32_t nowUs) const {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (_exec.load(std::memory_order_acquire) != tail) return 0;    // Completions to retire
+        if (_task == NULL && _head.load(std::memory_order_relaxed) != tail) return 0;  // Run inline
+        uint32_t elapsed = nowUs - _windowStartUs;
+        uint32_t window = TWIST_I2C_STATS_WINDOW_MS * 1000UL;
+        return (elapsed >= window) ? 0 : window - elapsed;  // Utilization window rollover
+    }
+
+    uint8_t I2CQueue::getDepth() const {
+        return (uint8_t)(_head.load(std::memory_order_relaxed) - _tail.load(std::memory_order_acquire));
+    }
+
+    unsigned long I2CQueue::getAverageLatencyMicros() const {
+        return (_completed > 0) ? (unsigned long)(_latencySumUs / _completed) : 0;
+    }
+
+    void I2CQueue::resetStatistics() {
+        _maxDepth = getDepth();
+        _submitted = 0;
+        _completed = 0;
+        _failed = 0;
+        _dropped = 0;
+        _lastLatencyUs = 0;
+        _maxLatencyUs = 0;
+        _latencySumUs = 0;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,205 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      I2CQueue.h
+ * @brief     Non-blocking I2C write queue executed by a background task
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService, SERVICE_AFTER_BRIDGES)
+ * - Hardware:     None (uses II2CBus)
+ * - Dependency:   FreeRTOS (worker task, optional)
+ *
+ * PRINCIPLES:
+ * - Drivers submit() and return immediately; bytes are copied into a
+ *   fixed slot ring (zero heap allocation)
+ * - A worker task owns the bus and runs transactions in submit order;
+ *   the control loop never waits on a byte
+ * - Completion callbacks run in update() on the LOOP context, never on
+ *   the worker - callbacks may touch devices and the EventBus freely
+ * - Lock-free: one producer (loop), one worker, one retirer (loop); each
+ *   ring index is written by exactly one side
+ * - No worker task started = update() executes the queue inline
+ * - With a worker the loop may idle while transactions are on the bus;
+ *   the worker ends that wait (PowerManager::wake()) once results are
+ *   ready to retire
+ *
+ * CAPABILITIES:
+ * - Queue depth and high-water mark, dropped submissions
+ * - Bus utilization over TWIST_I2C_STATS_WINDOW_MS
+ * - Per-transaction latency (submit -> bus released): last / max / average
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_I2C_QUEUE_H
+#define TWIST_I2C_QUEUE_H
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/II2CBus.h"
+#include <stddef.h>
+#include <atomic>
+
+// Slots in the ring (power of two)
+#ifndef TWIST_I2C_QUEUE_DEPTH
+#define TWIST_I2C_QUEUE_DEPTH 32
+#endif
+
+// Bytes per transaction (register pointer included)
+#ifndef TWIST_I2C_MAX_DATA
+#define TWIST_I2C_MAX_DATA 16
+#endif
+
+// Producers that may wait for a free slot (requestRetry())
+#ifndef TWIST_I2C_RETRY_SLOTS
+#define TWIST_I2C_RETRY_SLOTS 4
+#endif
+
+// Utilization measurement window
+#ifndef TWIST_I2C_STATS_WINDOW_MS
+#define TWIST_I2C_STATS_WINDOW_MS 1000
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Transaction completion callback (runs in I2CQueue::update())
+     * @param address Device address of the finished transaction
+     * @param success true if the device acknowledged every byte
+     * @param context Pointer given to submit()
+     */
+    typedef void (*I2CCompletion)(uint8_t address, bool success, void* context);
+
+    /**
+     * @brief Free-slot notification (runs in I2CQueue::update())
+     * @param context Pointer given to requestRetry()
+     */
+    typedef void (*I2CRetry)(void* context);
+
+    /**
+     * @brief Asynchronous I2C write queue
+     *
+     * Example usage:
+     * ```cpp
+     * Drivers::WireI2CBus bus(Wire);
+     * I2CQueue i2c(bus);
+     * i2c.startTask();
+     * pca9685.setQueue(&i2c);                  // setPWM() now returns at once
+     * framework.addService(&i2c, SERVICE_AFTER_BRIDGES);
+     * ```
+     */
+    class I2CQueue : public IService {
+    public:
+        explicit I2CQueue(II2CBus& bus);
+
+        /**
+         * @brief Queue a write (loop context only)
+         * @return false if data is too long or the queue is full (dropped)
+         */
+        bool submit(uint8_t address, const uint8_t* data, uint8_t length,
+                    I2CCompletion callback = NULL, void* context = NULL);
+
+        /**
+         * @brief Queue a register write: reg followed by data
+         */
+        bool writeRegister(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length,
+                           I2CCompletion callback = NULL, void* context = NULL);
+
+        /**
+         * @brief true if the next submit() would be dropped (loop context)
+         */
+        bool isFull() const { return getDepth() >= TWIST_I2C_QUEUE_DEPTH; }
+
+        /**
+         * @brief Call back once from update() after retired slots make room
+         *
+         * For producers that hold back a write instead of losing it (see
+         * PCA9685). Registering the same callback/context twice is a no-op.
+         * @return false if TWIST_I2C_RETRY_SLOTS producers are already waiting
+         */
+        bool requestRetry(I2CRetry callback, void* context);
+
+        /**
+         * @brief Run queued transactions on the bus (worker side)
+         * @param maxTransactions Stop after this many
+         * @return Number executed
+         */
+        uint8_t process(uint8_t maxTransactions = 0xFF);
+
+        /**
+         * @brief Start the FreeRTOS worker that calls process()
+         * @return false if task creation failed (queue stays inline)
+         */
+        bool startTask(uint32_t stackSize = 3072, uint8_t priority = 2);
+        bool isTaskRunning() const { return _task != NULL; }
+
+        // ===== IService =====
+        void update() override;
+        const char* getName() const override { return "I2CQueue"; }
+        uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+        // Statistics (loop context)
+        uint8_t getDepth() const;
+        uint8_t getMaxDepth() const { return _maxDepth; }
+        unsigned long getSubmittedCount() const { return _submitted; }
+        unsigned long getCompletedCount() const { return _completed; }
+        unsigned long getFailedCount() const { return _failed; }
+        unsigned long getDroppedCount() const { return _dropped; }
+        unsigned long getLastLatencyMicros() const { return _lastLatencyUs; }
+        unsigned long getMaxLatencyMicros() const { return _maxLatencyUs; }
+        unsigned long getAverageLatencyMicros() const;
+        float getUtilization() const { return _utilization; }   // 0.0-1.0, last window
+        void resetStatistics();
+
+    private:
+        struct Transaction {
+            uint8_t address;
+            uint8_t length;
+            uint8_t data[TWIST_I2C_MAX_DATA];
+            I2CCompletion callback;
+            void* context;
+            unsigned long submitUs;     // Set by producer
+            unsigned long busyUs;       // Set by worker
+            unsigned long doneUs;       // Set by worker
+            bool success;               // Set by worker
+        };
+
+        II2CBus& _bus;
+        Transaction _slots[TWIST_I2C_QUEUE_DEPTH];
+
+        std::atomic<uint32_t> _head;    // Next slot to fill (producer)
+        std::atomic<uint32_t> _exec;    // Next slot to run (worker)
+        std::atomic<uint32_t> _tail;    // Next slot to retire (update)
+
+        void* _task;                    // TaskHandle_t, NULL = inline
+
+        uint8_t _maxDepth;
+        unsigned long _submitted;
+        unsigned long _completed;
+        unsigned long _failed;
+        unsigned long _dropped;
+        unsigned long _lastLatencyUs;
+        unsigned long _maxLatencyUs;
+        unsigned long long _latencySumUs;
+
+        struct RetryWaiter {
+            I2CRetry callback;
+            void* context;
+        };
+        RetryWaiter _retry[TWIST_I2C_RETRY_SLOTS];
+        uint8_t _retryCount;
+
+        unsigned long _windowStartUs;
+        unsigned long _windowBusyUs;
+        float _utilization;
+
+        static void taskEntry(void* arg);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_I2C_QUEUE_H
@@ -0,0 +1,231 @@
+#include "JointConstraints.h"
+#include "Logger.h"
+#include <Arduino.h>
+
+namespace TwiST {
+
+    JointConstraints::JointConstraints()
+        : _jointCount(0),
+          _keepOutCount(0),
+          _lastHit(0),
+          _limitClamps(0),
+          _keepOutClamps(0),
+          _velocityClamps(0),
+          _holds(0),
+          _lastPassUs(0),
+          _maxPassUs(0) {
+    }
+
+    // ===== Configuration =====
+
+    bool JointConstraints::addJoint(IOutputDevice& output, float minValue, float maxValue, float maxSpeed) {
+        DeviceInfo info = output.getInfo();
+        if (find(info.id) >= 0) {
+            Logger::logf(Logger::Level::ERROR, "CONSTRAINT", "Device %u already constrained", info.id);
+            return false;
+        }
+        if (_jointCount >= TWIST_CONSTRAINT_MAX_JOINTS) {
+            Logger::error("CONSTRAINT", "Joint limit reached");
+            return false;
+        }
+        if (minValue > maxValue) {
+            Logger::logf(Logger::Level::ERROR, "CONSTRAINT", "Device %u: min above max", info.id);
+            return false;
+        }
+
+        Joint& joint = _joints[_jointCount++];
+        joint.id = info.id;
+        joint.minValue = minValue;
+        joint.maxValue = maxValue;
+        joint.maxSpeed = (maxSpeed > 0.0f) ? maxSpeed : 0.0f;
+        joint.value = output.getValue();
+        joint.lastWriteUs = micros();
+        joint.keepOutCount = 0;
+        return true;
+    }
+
+    bool JointConstraints::addKeepOut(uint16_t deviceA, float coefA, uint16_t deviceB, float coefB, float limit) {
+        int16_t a = find(deviceA);
+        int16_t b = find(deviceB);
+        if (a < 0 || b < 0 || a == b) {
+            Logger::logf(Logger::Level::ERROR, "CONSTRAINT", "Keep-out %u/%u: unknown joint", deviceA, deviceB);
+            return false;
+        }
+        if (coefA == 0.0f || coefB == 0.0f) {
+            Logger::error("CONSTRAINT", "Keep-out coefficient is zero - use soft limits");
+            return false;
+        }
+        if (_keepOutCount >= TWIST_CONSTRAINT_MAX_KEEPOUTS ||
+            _joints[a].keepOutCount >= TWIST_CONSTRAINT_MAX_PER_JOINT ||
+            _joints[b].keepOutCount >= TWIST_CONSTRAINT_MAX_PER_JOINT) {
+            Logger::error("CONSTRAINT", "Keep-out limit reached");
+            return false;
+        }
+
+        uint8_t index = _keepOutCount++;
+        KeepOut& keepOut = _keepOuts[index];
+        keepOut.jointA = (uint8_t)a;
+        keepOut.jointB = (uint8_t)b;
+        keepOut.coefA = coefA;
+        keepOut.coefB = coefB;
+        keepOut.limit = limit;
+
+        _joints[a].keepOuts[_joints[a].keepOutCount++] = index;
+        _joints[b].keepOuts[_joints[b].keepOutCount++] = index;
+
+        if (coefA * _joints[a].value + coefB * _joints[b].value > limit) {
+            // Next write of either joint walks it out of the zone
+            Logger::logf(Logger::Level::WARNING, "CONSTRAINT", "Keep-out %u/%u violated by current pose", deviceA, deviceB);
+        }
+        return true;
+    }
+
+    bool JointConstraints::setSoftLimits(uint16_t deviceId, float minValue, float maxValue) {
+        int16_t index = find(deviceId);
+        if (index < 0 || minValue > maxValue) return false;
+        _joints[index].minValue = minValue;
+        _joints[index].maxValue = maxValue;
+        return true;
+    }
+
+    bool JointConstraints::setVelocityLimit(uint16_t deviceId, float maxSpeed) {
+        int16_t index = find(deviceId);
+        if (index < 0) return false;
+        _joints[index].maxSpeed = (maxSpeed > 0.0f) ? maxSpeed : 0.0f;
+        return true;
+    }
+
+    // ===== IOutputConstraint =====
+
+    float JointConstraints::constrain(uint16_t deviceId, float requested) {
+        int16_t index = find(deviceId);
+        if (index < 0) return requested;  // Not a constrained joint
+
+        unsigned long now = micros();
+        float allowed = solve((uint8_t)index, requested, NULL, 0, now);
+
+        Joint& joint = _joints[index];
+        joint.value = allowed;
+        joint.lastWriteUs = now;
+        return allowed;
+    }
+
+    // ===== Whole-arm Checks =====
+
+    uint8_t JointConstraints::project(float* values) {
+        unsigned long start = micros();
+        uint8_t changed = 0;
+
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            float allowed = solve(i, values[i], values, i, start);
+            if (allowed != values[i]) {
+                values[i] = allowed;
+                changed++;
+            }
+        }
+
+        _lastPassUs = micros() - start;
+        if (_lastPassUs > _maxPassUs) {
+            _maxPassUs = _lastPassUs;
+        }
+        return changed;
+    }
+
+    bool JointConstraints::isAllowed(const float* values) const {
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            if (values[i] < _joints[i].minValue || values[i] > _joints[i].maxValue) return false;
+        }
+        for (uint8_t k = 0; k < _keepOutCount; k++) {
+            const KeepOut& keepOut = _keepOuts[k];
+            if (keepOut.coefA * values[keepOut.jointA] + keepOut.coefB * values[keepOut.jointB] > keepOut.limit) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void JointConstraints::resetStatistics() {
+        _limitClamps = 0;
+        _keepOutClamps = 0;
+        _velocityClamps = 0;
+        _holds = 0;
+        _lastPassUs = 0;
+        _maxPassUs = 0;
+    }
+
+    // ===== Private =====
+
+    int16_t JointConstraints::find(uint16_t deviceId) {
+        if (_lastHit < _jointCount && _joints[_lastHit].id == deviceId) {
+            return _lastHit;
+        }
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            if (_joints[i].id == deviceId) {
+                _lastHit = i;
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    float JointConstraints::solve(uint8_t index, float requested, const float* pose, uint8_t projected,
+                                  unsigned long nowUs) {
+        const Joint& joint = _joints[index];
+
+        // 1. Soft limits
+        float lo = joint.minValue;
+        float hi = joint.maxValue;
+        float value = requested;
+        if (value < lo) value = lo;
+        if (value > hi) value = hi;
+        if (value != requested) _limitClamps++;
+
+        // 2. Keep-outs: with the partner fixed, each half-plane bounds this joint on one side
+        for (uint8_t k = 0; k < joint.keepOutCount; k++) {
+            const KeepOut& keepOut = _keepOuts[joint.keepOuts[k]];
+            bool isA = (keepOut.jointA == index);
+            uint8_t other = isA ? keepOut.jointB : keepOut.jointA;
+            float own = isA ? keepOut.coefA : keepOut.coefB;
+            float otherCoef = isA ? keepOut.coefB : keepOut.coefA;
+            float otherValue = (pose != NULL && other < projected) ? pose[other] : _joints[other].value;
+
+            float bound = (keepOut.limit - otherCoef * otherValue) / own;
+            if (own > 0.0f) {
+                if (bound < hi) hi = bound;
+            } else {
+                if (bound > lo) lo = bound;
+            }
+        }
+
+        if (lo > hi) {
+            // Partners leave no room - stay put (committed pose is feasible)
+            _holds++;
+            return joint.value;
+        }
+
+        float bounded = value;
+        if (bounded < lo) bounded = lo;
+        if (bounded > hi) bounded = hi;
+        if (bounded != value) _keepOutClamps++;
+
+        // 3. Velocity: at most maxSpeed * dt away from the committed position
+        if (joint.maxSpeed > 0.0f) {
+            unsigned long dtUs = nowUs - joint.lastWriteUs;
+            if (dtUs > TWIST_CONSTRAINT_MAX_DT_MS * 1000UL) {
+                dtUs = TWIST_CONSTRAINT_MAX_DT_MS * 1000UL;
+            }
+            float step = joint.maxSpeed * (float)dtUs * 0.000001f;
+            float slow = bounded;
+            if (slow > joint.value + step) slow = joint.value + step;
+            if (slow < joint.value - step) slow = joint.value - step;
+            if (slow != bounded) {
+                // Between committed and bounded - still inside [lo, hi]
+                _velocityClamps++;
+                bounded = slow;
+            }
+        }
+
+        return bounded;
+    }
+
+}  // namespace TwiST
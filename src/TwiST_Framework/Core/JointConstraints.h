@@ -0,0 +1,188 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      JointConstraints.h
+ * @brief     Soft limits, pairwise keep-out zones and velocity limits
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Output Filter (consulted by Servo before every PWM write)
+ * - Hardware:     None (observes IOutputDevice)
+ * - Implements:   IOutputConstraint
+ *
+ * PRINCIPLES:
+ * - Every joint write is PROJECTED, never rejected: the joint moves to the
+ *   nearest value that satisfies its soft limits, every keep-out it takes
+ *   part in (other joints held at their committed values) and its
+ *   velocity limit
+ * - Each keep-out is a half-plane  a * q[A] + b * q[B] <= limit, so for one
+ *   joint all constraints collapse to a single [lo, hi] interval - exact
+ *   projection, no iteration
+ * - Committed positions stay feasible: a write that cannot be made feasible
+ *   holds the joint where it is
+ * - Per-joint constraint lists: cost of a write = its own constraints only
+ * - project() runs the same check over ALL joints in one ordered pass
+ *   (planners, IK) without touching hardware
+ *
+ * CAPABILITIES:
+ * - Up to TWIST_CONSTRAINT_MAX_JOINTS joints, TWIST_CONSTRAINT_MAX_KEEPOUTS
+ *   keep-outs, TWIST_CONSTRAINT_MAX_PER_JOINT keep-outs per joint
+ * - Clamp / hold statistics and project() pass timing
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_JOINT_CONSTRAINTS_H
+#define TWIST_JOINT_CONSTRAINTS_H
+
+#include "../Interfaces/IOutputConstraint.h"
+#include "../Interfaces/IOutputDevice.h"
+
+// Joints one constraint set can hold
+#ifndef TWIST_CONSTRAINT_MAX_JOINTS
+#define TWIST_CONSTRAINT_MAX_JOINTS 32
+#endif
+
+// Pairwise keep-out half-planes
+#ifndef TWIST_CONSTRAINT_MAX_KEEPOUTS
+#define TWIST_CONSTRAINT_MAX_KEEPOUTS 32
+#endif
+
+// Keep-outs a single joint may take part in
+#ifndef TWIST_CONSTRAINT_MAX_PER_JOINT
+#define TWIST_CONSTRAINT_MAX_PER_JOINT 8
+#endif
+
+// Longest interval credited to a velocity limit (a joint idle for a
+// second must not be allowed a one-second jump)
+#ifndef TWIST_CONSTRAINT_MAX_DT_MS
+#define TWIST_CONSTRAINT_MAX_DT_MS 50
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Joint constraint set
+     *
+     * Example usage (shoulder + elbow must stay >= 60 deg, or the forearm
+     * hits the base):
+     * ```cpp
+     * JointConstraints limits;
+     * limits.addJoint(App::servo("Shoulder"), 10.0f, 170.0f, 120.0f);
+     * limits.addJoint(App::servo("Elbow"), 0.0f, 180.0f, 180.0f);
+     * // -shoulder - elbow <= -60
+     * limits.addKeepOut(SHOULDER_ID, -1.0f, ELBOW_ID, -1.0f, -60.0f);
+     * App::servo("Shoulder").setOutputConstraint(&limits);
+     * App::servo("Elbow").setOutputConstraint(&limits);
+     * ```
+     */
+    class JointConstraints : public IOutputConstraint {
+    public:
+        JointConstraints();
+
+        // ===== Configuration =====
+
+        /**
+         * @brief Constrain an output (its current value becomes the committed position)
+         * @param output Joint output
+         * @param minValue Soft lower limit
+         * @param maxValue Soft upper limit
+         * @param maxSpeed Velocity limit in units/s (0 = unlimited)
+         * @return false if already added, table full or limits inverted
+         */
+        bool addJoint(IOutputDevice& output, float minValue, float maxValue, float maxSpeed = 0.0f);
+
+        /**
+         * @brief Require  coefA * value(A) + coefB * value(B) <= limit
+         * @return false if a joint is unknown, coefficients are zero or tables are full
+         */
+        bool addKeepOut(uint16_t deviceA, float coefA, uint16_t deviceB, float coefB, float limit);
+
+        bool setSoftLimits(uint16_t deviceId, float minValue, float maxValue);
+        bool setVelocityLimit(uint16_t deviceId, float maxSpeed);
+
+        // ===== IOutputConstraint =====
+        float constrain(uint16_t deviceId, float requested) override;
+
+        // ===== Whole-arm Checks =====
+
+        /**
+         * @brief Project requests for ALL joints in one pass (hardware untouched)
+         *
+         * values[i] belongs to the i-th added joint. Joints are visited in
+         * order; earlier joints are seen at their projected values, later
+         * ones at their committed positions, so the result satisfies every
+         * keep-out. Velocity limits use the time since each joint's last write.
+         *
+         * @param values Requested values in, allowed values out
+         * @return Number of joints whose value changed
+         */
+        uint8_t project(float* values);
+
+        /**
+         * @brief Check a full pose against soft limits and keep-outs (no velocity)
+         */
+        bool isAllowed(const float* values) const;
+
+        // Statistics
+        uint8_t getJointCount() const { return _jointCount; }
+        uint8_t getKeepOutCount() const { return _keepOutCount; }
+        float getCommitted(uint8_t index) const { return (index < _jointCount) ? _joints[index].value : 0.0f; }
+        unsigned long getLimitClampCount() const { return _limitClamps; }
+        unsigned long getKeepOutClampCount() const { return _keepOutClamps; }
+        unsigned long getVelocityClampCount() const { return _velocityClamps; }
+        unsigned long getHoldCount() const { return _holds; }
+        unsigned long getLastPassMicros() const { return _lastPassUs; }
+        unsigned long getMaxPassMicros() const { return _maxPassUs; }
+        void resetStatistics();
+
+    private:
+        struct Joint {
+            uint16_t id;
+            float minValue;
+            float maxValue;
+            float maxSpeed;             // units/s, 0 = unlimited
+            float value;                // Committed (last written) position
+            unsigned long lastWriteUs;
+            uint8_t keepOuts[TWIST_CONSTRAINT_MAX_PER_JOINT];
+            uint8_t keepOutCount;
+        };
+
+        struct KeepOut {
+            uint8_t jointA;
+            uint8_t jointB;
+            float coefA;
+            float coefB;
+            float limit;
+        };
+
+        Joint _joints[TWIST_CONSTRAINT_MAX_JOINTS];
+        uint8_t _jointCount;
+        KeepOut _keepOuts[TWIST_CONSTRAINT_MAX_KEEPOUTS];
+        uint8_t _keepOutCount;
+        uint8_t _lastHit;               // Lookup cache - writes come in bursts per joint
+
+        unsigned long _limitClamps;
+        unsigned long _keepOutClamps;
+        unsigned long _velocityClamps;
+        unsigned long _holds;
+        unsigned long _lastPassUs;
+        unsigned long _maxPassUs;
+
+        int16_t find(uint16_t deviceId);
+
+        /**
+         * @brief Nearest allowed value for one joint
+         * @param pose Values of the other joints (NULL = committed positions)
+         * @param projected Joints below this index are read from pose
+         */
+        float solve(uint8_t index, float requested, const float* pose, uint8_t projected, unsigned long nowUs);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_JOINT_CONSTRAINTS_H
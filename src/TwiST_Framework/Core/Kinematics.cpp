@@ -0,0 +1,287 @@
+#include "Kinematics.h"
+#include "Logger.h"
+#include <math.h>
+
+namespace TwiST {
+
+    // ===== PlanarArm =====
+
+    PlanarArm::PlanarArm(float l1, float l2, float l3)
+        : _l1(l1),
+          _l2(l2),
+          _l3(l3),
+          _elbowUp(false),
+          _sumSquares(l1 * l1 + l2 * l2),
+          _twoL1L2(2.0f * l1 * l2),
+          _minReachSq((l1 - l2) * (l1 - l2)),
+          _maxReachSq((l1 + l2) * (l1 + l2)) {
+    }
+
+    bool PlanarArm::solve(float x, float y, float* q) const {
+        float distSq = x * x + y * y;
+        if (distSq > _maxReachSq || distSq < _minReachSq || _twoL1L2 <= 0.0f) {
+            return false;
+        }
+
+        // Law of cosines for the elbow
+        float c2 = (distSq - _sumSquares) / _twoL1L2;
+        if (c2 > 1.0f) c2 = 1.0f;
+        if (c2 < -1.0f) c2 = -1.0f;
+        float s2 = sqrtf(1.0f - c2 * c2);
+        if (_elbowUp) s2 = -s2;
+
+        q[1] = atan2f(s2, c2);
+        q[0] = atan2f(y, x) - atan2f(_l2 * s2, _l1 + _l2 * c2);
+        return true;
+    }
+
+    bool PlanarArm::solve(float x, float y, float phi, float* q) const {
+        // Wrist centre = tool tip pulled back along the tool direction
+        float wx = x - _l3 * cosf(phi);
+        float wy = y - _l3 * sinf(phi);
+        if (!solve(wx, wy, q)) {
+            return false;
+        }
+        q[2] = phi - q[0] - q[1];
+        q[2] = atan2f(sinf(q[2]), cosf(q[2]));  // Wrap to [-pi, pi]
+        return true;
+    }
+
+    void PlanarArm::forward(const float* q, float& x, float& y) const {
+        float a1 = q[0];
+        float a2 = a1 + q[1];
+        x = _l1 * cosf(a1) + _l2 * cosf(a2);
+        y = _l1 * sinf(a1) + _l2 * sinf(a2);
+        if (_l3 > 0.0f) {
+            float a3 = a2 + q[2];
+            x += _l3 * cosf(a3);
+            y += _l3 * sinf(a3);
+        }
+    }
+
+    // ===== KinematicChain =====
+
+    KinematicChain::KinematicChain()
+        : _jointCount(0),
+          _damping(5.0f),
+          _tolerance(0.5f),
+          _maxIterations(32),
+          _maxStep(0.2f),
+          _lastIterations(0),
+          _lastError(0.0f) {
+    }
+
+    bool KinematicChain::addJoint(float a, float alpha, float d, float thetaOffset,
+                                  float minAngle, float maxAngle) {
+        if (_jointCount >= TWIST_IK_MAX_JOINTS) {
+            Logger::error("IK", "Joint limit reached");
+            return false;
+        }
+        Link& link = _links[_jointCount++];
+        link.a = a;
+        link.d = d;
+        link.sinAlpha = sinf(alpha);
+        link.cosAlpha = cosf(alpha);
+        link.thetaOffset = thetaOffset;
+        link.minAngle = minAngle;
+        link.maxAngle = maxAngle;
+        return true;
+    }
+
+    void KinematicChain::setSolverParameters(float damping, float tolerance, uint8_t maxIterations, float maxStep) {
+        _damping = damping;
+        _tolerance = tolerance;
+        _maxIterations = maxIterations;
+        _maxStep = maxStep;
+    }
+
+    void KinematicChain::forward(const float* q, float* position) const {
+        float axes[TWIST_IK_MAX_JOINTS][3];
+        float origins[TWIST_IK_MAX_JOINTS][3];
+        frames(q, axes, origins, position);
+    }
+
+    bool KinematicChain::solve(const float* target, float* q) {
+        float axes[TWIST_IK_MAX_JOINTS][3];
+        float origins[TWIST_IK_MAX_JOINTS][3];
+        float jacobian[TWIST_IK_MAX_JOINTS][3];   // Column per joint
+        float tip[3];
+        float lambdaSq = _damping * _damping;
+
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            if (q[i] < _links[i].minAngle) q[i] = _links[i].minAngle;
+            if (q[i] > _links[i].maxAngle) q[i] = _links[i].maxAngle;
+        }
+
+        uint8_t iteration = 0;
+        while (true) {
+            frames(q, axes, origins, tip);
+            float e0 = target[0] - tip[0];
+            float e1 = target[1] - tip[1];
+            float e2 = target[2] - tip[2];
+            _lastError = sqrtf(e0 * e0 + e1 * e1 + e2 * e2);
+            _lastIterations = iteration;
+            if (_lastError <= _tolerance) return true;
+            if (iteration >= _maxIterations) return false;
+            iteration++;
+
+            // Revolute column: z(i) x (tip - origin(i))
+            for (uint8_t i = 0; i < _jointCount; i++) {
+                float rx = tip[0] - origins[i][0];
+                float ry = tip[1] - origins[i][1];
+                float rz = tip[2] - origins[i][2];
+                jacobian[i][0] = axes[i][1] * rz - axes[i][2] * ry;
+                jacobian[i][1] = axes[i][2] * rx - axes[i][0] * rz;
+                jacobian[i][2] = axes[i][0] * ry - axes[i][1] * rx;
+            }
+
+            // A = J J^T + lambda^2 I (symmetric 3x3)
+            float a00 = lambdaSq, a01 = 0.0f, a02 = 0.0f;
+            float a11 = lambdaSq, a12 = 0.0f, a22 = lambdaSq;
+            for (uint8_t i = 0; i < _jointCount; i++) {
+                const float* c = jacobian[i];
+                a00 += c[0] * c[0]; a01 += c[0] * c[1]; a02 += c[0] * c[2];
+                a11 += c[1] * c[1]; a12 += c[1] * c[2]; a22 += c[2] * c[2];
+            }
+
+            // y = A^-1 e (adjugate; A is positive definite for lambda > 0)
+            float m00 = a11 * a22 - a12 * a12;
+            float m01 = a02 * a12 - a01 * a22;
+            float m02 = a01 * a12 - a02 * a11;
+            float det = a00 * m00 + a01 * m01 + a02 * m02;
+            if (det <= 0.0f) return false;
+            float m11 = a00 * a22 - a02 * a02;
+            float m12 = a01 * a02 - a00 * a12;
+            float m22 = a00 * a11 - a01 * a01;
+            float inv = 1.0f / det;
+            float y0 = (m00 * e0 + m01 * e1 + m02 * e2) * inv;
+            float y1 = (m01 * e0 + m11 * e1 + m12 * e2) * inv;
+            float y2 = (m02 * e0 + m12 * e1 + m22 * e2) * inv;
+
+            // dq = J^T y, scaled so no joint moves more than maxStep
+            float dq[TWIST_IK_MAX_JOINTS];
+            float largest = 0.0f;
+            for (uint8_t i = 0; i < _jointCount; i++) {
+                dq[i] = jacobian[i][0] * y0 + jacobian[i][1] * y1 + jacobian[i][2] * y2;
+                float mag = fabsf(dq[i]);
+                if (mag > largest) largest = mag;
+            }
+            float scale = (largest > _maxStep) ? (_maxStep / largest) : 1.0f;
+
+            for (uint8_t i = 0; i < _jointCount; i++) {
+                q[i] += dq[i] * scale;
+                if (q[i] < _links[i].minAngle) q[i] = _links[i].minAngle;
+                if (q[i] > _links[i].maxAngle) q[i] = _links[i].maxAngle;
+            }
+        }
+    }
+
+    void KinematicChain::frames(const float* q, float axes[][3], float origins[][3], float* tip) const {
+        // Running transform: rotation r (row-major), position p
+        float r[9] = {1.0f, 0.0f, 0.0f,
+                      0.0f, 1.0f, 0.0f,
+                      0.0f, 0.0f, 1.0f};
+        float p[3] = {0.0f, 0.0f, 0.0f};
+
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            const Link& link = _links[i];
+
+            // Joint i rotates about the current z axis
+            axes[i][0] = r[2]; axes[i][1] = r[5]; axes[i][2] = r[8];
+            origins[i][0] = p[0]; origins[i][1] = p[1]; origins[i][2] = p[2];
+
+            float theta = q[i] + link.thetaOffset;
+            float ct = cosf(theta);
+            float st = sinf(theta);
+            float ca = link.cosAlpha;
+            float sa = link.sinAlpha;
+
+            // DH step: translation (a*ct, a*st, d) in the current frame
+            float tx = link.a * ct;
+            float ty = link.a * st;
+            float tz = link.d;
+            p[0] += r[0] * tx + r[1] * ty + r[2] * tz;
+            p[1] += r[3] * tx + r[4] * ty + r[5] * tz;
+            p[2] += r[6] * tx + r[7] * ty + r[8] * tz;
+
+            // r = r * Rz(theta) * Rx(alpha)
+            for (uint8_t row = 0; row < 3; row++) {
+                float c0 = r[row * 3 + 0];
+                float c1 = r[row * 3 + 1];
+                float c2 = r[row * 3 + 2];
+                r[row * 3 + 0] = c0 * ct + c1 * st;
+                r[row * 3 + 1] = -c0 * st * ca + c1 * ct * ca + c2 * sa;
+                r[row * 3 + 2] = c0 * st * sa - c1 * ct * sa + c2 * ca;
+            }
+        }
+
+        tip[0] = p[0];
+        tip[1] = p[1];
+        tip[2] = p[2];
+    }
+
+    // ===== JointMap =====
+
+    JointMap::JointMap()
+        : _jointCount(0),
+          _rejected(0) {
+        for (uint8_t i = 0; i < TWIST_IK_MAX_JOINTS; i++) {
+            _outputs[i] = NULL;
+        }
+    }
+
+    bool JointMap::bind(uint8_t joint, IOutputDevice& output, const JointCalibration& calibration) {
+        if (joint >= TWIST_IK_MAX_JOINTS) {
+            Logger::logf(Logger::Level::ERROR, "IK", "Joint %u out of range", joint);
+            return false;
+        }
+        if (calibration.scale == 0.0f) {
+            Logger::logf(Logger::Level::ERROR, "IK", "Joint %u: zero scale", joint);
+            return false;
+        }
+        _outputs[joint] = &output;
+        _calibration[joint] = calibration;
+        if (joint + 1 > _jointCount) {
+            _jointCount = joint + 1;
+        }
+        return true;
+    }
+
+    bool JointMap::toOutputs(const float* q, float* values) const {
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            if (_outputs[i] == NULL) return false;
+            const JointCalibration& cal = _calibration[i];
+            values[i] = cal.offset + cal.scale * q[i];
+            if (values[i] < cal.minValue || values[i] > cal.maxValue) return false;
+        }
+        return true;
+    }
+
+    bool JointMap::apply(const float* q, unsigned long durationMs) {
+        float values[TWIST_IK_MAX_JOINTS];
+        if (!toOutputs(q, values)) {
+            _rejected++;
+            return false;
+        }
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            if (durationMs == 0) {
+                _outputs[i]->setValue(values[i]);
+            } else {
+                _outputs[i]->moveTo(values[i], durationMs);
+            }
+        }
+        return true;
+    }
+
+    void JointMap::read(float* q) const {
+        for (uint8_t i = 0; i < _jointCount; i++) {
+            if (_outputs[i] == NULL) {
+                q[i] = 0.0f;
+                continue;
+            }
+            const JointCalibration& cal = _calibration[i];
+            q[i] = (_outputs[i]->getValue() - cal.offset) / cal.scale;
+        }
+    }
+
+}  // namespace TwiST
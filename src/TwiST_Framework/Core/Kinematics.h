@@ -0,0 +1,255 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      Kinematics.h
+ * @brief     On-device inverse kinematics for servo arms
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Solver + output mapping (no service, called on demand)
+ * - Hardware:     None (drives IOutputDevice through JointMap)
+ *
+ * PRINCIPLES:
+ * - Solvers work in radians and link-length units (mm), never in servo
+ *   degrees; JointMap converts through per-joint calibration
+ * - Link geometry is fixed at setup and its constant terms precomputed
+ *   (squared lengths, DH alpha sin/cos) - a solve is plain arithmetic
+ * - No allocation, fixed-size arrays, bounded iteration count
+ * - A pose is applied to ALL joints or to none (limits checked first)
+ *
+ * CAPABILITIES:
+ * - PlanarArm: closed-form 2-DOF (x, y) and 3-DOF (x, y, phi) solutions
+ * - KinematicChain: revolute DH chains up to TWIST_IK_MAX_JOINTS joints,
+ *   forward kinematics and damped-least-squares position IK
+ * - JointMap: joint radians <-> output values, timed or immediate apply
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_KINEMATICS_H
+#define TWIST_KINEMATICS_H
+
+#include <stdint.h>
+#include "../Interfaces/IOutputDevice.h"
+
+// Joints in one chain / joint map
+#ifndef TWIST_IK_MAX_JOINTS
+#define TWIST_IK_MAX_JOINTS 6
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Closed-form planar arm (2 or 3 links, all joints parallel)
+     *
+     * Joint 0 at the origin, angles measured counter-clockwise from +X,
+     * each relative to the previous link.
+     *
+     * Example usage:
+     * ```cpp
+     * PlanarArm arm(80.0f, 60.0f);          // Upper arm, forearm (mm)
+     * float q[2];
+     * if (arm.solve(100.0f, 40.0f, q)) { joints.apply(q, 500); }
+     * ```
+     */
+    class PlanarArm {
+    public:
+        /**
+         * @param l1 First link length
+         * @param l2 Second link length
+         * @param l3 Third link (tool) length, 0 = 2-DOF arm
+         */
+        PlanarArm(float l1, float l2, float l3 = 0.0f);
+
+        /**
+         * @brief 2-DOF solve for the tip of link 2
+         * @param q Output joint angles [2] (radians)
+         * @return false if out of reach (q untouched)
+         */
+        bool solve(float x, float y, float* q) const;
+
+        /**
+         * @brief 3-DOF solve for the tool tip at orientation phi (radians)
+         * @param q Output joint angles [3] (radians)
+         */
+        bool solve(float x, float y, float phi, float* q) const;
+
+        /**
+         * @brief Tool tip (or link 2 tip for a 2-DOF arm) from joint angles
+         */
+        void forward(const float* q, float& x, float& y) const;
+
+        /**
+         * @brief Elbow branch: true = q[1] negative ("elbow up" for a
+         *        base-mounted arm reaching forward), false = positive
+         */
+        void setElbowUp(bool elbowUp) { _elbowUp = elbowUp; }
+
+        uint8_t getJointCount() const { return (_l3 > 0.0f) ? 3 : 2; }
+        float getReach() const { return _l1 + _l2 + _l3; }
+
+    private:
+        float _l1;
+        float _l2;
+        float _l3;
+        bool _elbowUp;
+
+        // Precomputed
+        float _sumSquares;      // l1^2 + l2^2
+        float _twoL1L2;         // 2 * l1 * l2
+        float _minReachSq;      // (l1 - l2)^2
+        float _maxReachSq;      // (l1 + l2)^2
+    };
+
+    /**
+     * @brief Revolute serial chain in Denavit-Hartenberg form
+     *
+     * Damped least squares on the 3D tool position:
+     *   dq = J^T (J J^T + lambda^2 I)^-1 e
+     * Only a 3x3 system is inverted regardless of joint count.
+     *
+     * Example usage:
+     * ```cpp
+     * KinematicChain chain;
+     * chain.addJoint(0.0f, M_PI / 2, 60.0f);    // Base yaw
+     * chain.addJoint(80.0f, 0.0f, 0.0f);        // Shoulder
+     * chain.addJoint(60.0f, 0.0f, 0.0f);        // Elbow
+     * joints.read(q);                           // Seed from current pose
+     * if (chain.solve(target, q)) { joints.apply(q, 300); }
+     * ```
+     */
+    class KinematicChain {
+    public:
+        KinematicChain();
+
+        /**
+         * @brief Append a revolute joint (standard DH parameters)
+         * @param a Link length along x
+         * @param alpha Link twist (radians)
+         * @param d Link offset along z
+         * @param thetaOffset Added to the joint variable (radians)
+         * @param minAngle Lower joint limit (radians)
+         * @param maxAngle Upper joint limit (radians)
+         * @return false if chain is full
+         */
+        bool addJoint(float a, float alpha, float d, float thetaOffset = 0.0f,
+                      float minAngle = -3.14159265f, float maxAngle = 3.14159265f);
+
+        /**
+         * @brief Tool position for joint angles q
+         * @param position Output [3] x, y, z
+         */
+        void forward(const float* q, float* position) const;
+
+        /**
+         * @brief Move q until the tool reaches target
+         * @param target Goal position [3]
+         * @param q Seed in, solution out (always within joint limits)
+         * @return true if within tolerance; q holds the closest pose found otherwise
+         */
+        bool solve(const float* target, float* q);
+
+        /**
+         * @param damping lambda - larger = steadier near singularities, slower convergence
+         * @param tolerance Position error accepted as solved (length units)
+         * @param maxIterations Iteration cap per solve
+         * @param maxStep Largest joint change per iteration (radians)
+         */
+        void setSolverParameters(float damping, float tolerance, uint8_t maxIterations, float maxStep);
+
+        uint8_t getJointCount() const { return _jointCount; }
+        uint8_t getLastIterations() const { return _lastIterations; }
+        float getLastError() const { return _lastError; }
+
+    private:
+        struct Link {
+            float a;
+            float d;
+            float sinAlpha;     // Precomputed
+            float cosAlpha;
+            float thetaOffset;
+            float minAngle;
+            float maxAngle;
+        };
+
+        Link _links[TWIST_IK_MAX_JOINTS];
+        uint8_t _jointCount;
+
+        float _damping;
+        float _tolerance;
+        uint8_t _maxIterations;
+        float _maxStep;
+
+        uint8_t _lastIterations;
+        float _lastError;
+
+        /**
+         * @brief Forward pass keeping every joint frame (for the Jacobian)
+         * @param axes Output [jointCount][3] z axis of each joint
+         * @param origins Output [jointCount][3] origin of each joint
+         * @param tip Output [3] tool position
+         */
+        void frames(const float* q, float axes[][3], float origins[][3], float* tip) const;
+    };
+
+    /**
+     * @brief Joint angle <-> output value calibration
+     *
+     * value = offset + scale * radians. Defaults: servo centred at 90 deg,
+     * one output degree per joint degree.
+     */
+    struct JointCalibration {
+        float offset = 90.0f;           // Output value at joint angle 0
+        float scale = 57.2957795f;      // Output units per radian (negative = reversed)
+        float minValue = 0.0f;          // Output range accepted by apply()
+        float maxValue = 180.0f;
+    };
+
+    /**
+     * @brief Maps solver joint angles onto output devices
+     */
+    class JointMap {
+    public:
+        JointMap();
+
+        /**
+         * @brief Assign an output to a joint
+         * @return false if joint index is out of range
+         */
+        bool bind(uint8_t joint, IOutputDevice& output, const JointCalibration& calibration = JointCalibration());
+
+        /**
+         * @brief Output values for joint angles
+         * @param values Output [jointCount]
+         * @return false if any joint is unbound or outside its calibrated range
+         */
+        bool toOutputs(const float* q, float* values) const;
+
+        /**
+         * @brief Drive every bound output to the pose (all or nothing)
+         * @param durationMs 0 = setValue(), otherwise moveTo()
+         */
+        bool apply(const float* q, unsigned long durationMs = 0);
+
+        /**
+         * @brief Current joint angles from output values (IK seed)
+         */
+        void read(float* q) const;
+
+        uint8_t getJointCount() const { return _jointCount; }
+        unsigned long getRejectedCount() const { return _rejected; }
+
+    private:
+        IOutputDevice* _outputs[TWIST_IK_MAX_JOINTS];
+        JointCalibration _calibration[TWIST_IK_MAX_JOINTS];
+        uint8_t _jointCount;            // Highest bound index + 1
+        unsigned long _rejected;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_KINEMATICS_H
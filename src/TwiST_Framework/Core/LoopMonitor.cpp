@@ -0,0 +1,210 @@
+#include "LoopMonitor.h"
+#include "Logger.h"
+#include <Arduino.h>
+#include <esp_task_wdt.h>
+#include <esp_rom_sys.h>
+#include <esp_memory_utils.h>
+#include <stdio.h>
+
+namespace TwiST {
+
+    // ===== LoopHistogram =====
+
+    void LoopHistogram::add(uint32_t us) {
+        uint8_t bucket = (us == 0) ? 0 : (uint8_t)(31 - __builtin_clz(us));
+        _buckets[bucket]++;
+        _count++;
+        _sum += us;
+        if (us < _min) _min = us;
+        if (us > _max) _max = us;
+    }
+
+    void LoopHistogram::reset() {
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            _buckets[i] = 0;
+        }
+        _count = 0;
+        _sum = 0;
+        _min = UINT32_MAX;
+        _max = 0;
+    }
+
+    uint32_t LoopHistogram::getPercentile(uint8_t percent) const {
+        if (_count == 0) return 0;
+        if (percent > 100) percent = 100;
+
+        // Rank of the percentile sample (1-based, rounded up)
+        unsigned long rank = (unsigned long)(((uint64_t)_count * percent + 99) / 100);
+        if (rank == 0) rank = 1;
+
+        unsigned long seen = 0;
+        for (uint8_t b = 0; b < BUCKETS; b++) {
+            seen += _buckets[b];
+            if (seen >= rank) {
+                uint32_t upper = (b >= 31) ? UINT32_MAX : ((1UL << (b + 1)) - 1);
+                return (upper < _max) ? upper : _max;
+            }
+        }
+        return _max;
+    }
+
+    // ===== LoopMonitor =====
+
+    LoopSection LoopMonitor::_current = {SECTION_NONE, 0, NULL, 0};
+
+    LoopMonitor::LoopMonitor()
+        : _budgetUs(TWIST_LOOP_BUDGET_US),
+          _watchdogEnabled(false),
+          _lateCount(0),
+          _passStartUs(0),
+          _hasPreviousPass(false),
+          _sectionStartUs(0),
+          _lastWarningMs(0) {
+        _longest = {SECTION_NONE, 0, NULL, 0};
+        _lastCulprit = _longest;
+        _worstCulprit = _longest;
+    }
+
+    // ===== Watchdog =====
+
+    bool LoopMonitor::enableWatchdog(uint32_t timeoutMs) {
+        esp_task_wdt_config_t config = {};
+        config.timeout_ms = timeoutMs;
+        config.idle_core_mask = 0;      // Only watch tasks that subscribe
+        config.trigger_panic = true;
+
+        // Arduino core usually initializes the TWDT already - reconfigure it
+        esp_err_t err = esp_task_wdt_reconfigure(&config);
+        if (err == ESP_ERR_INVALID_STATE) {
+            err = esp_task_wdt_init(&config);
+        }
+        if (err != ESP_OK) {
+            Logger::logf(Logger::Level::ERROR, "LOOP", "Task watchdog config failed (%d)", (int)err);
+            return false;
+        }
+
+        err = esp_task_wdt_add(NULL);
+        if (err != ESP_OK && err != ESP_ERR_INVALID_ARG) {  // INVALID_ARG: already subscribed
+            Logger::logf(Logger::Level::ERROR, "LOOP", "Task watchdog subscribe failed (%d)", (int)err);
+            return false;
+        }
+
+        esp_task_wdt_reset();
+        _watchdogEnabled = true;
+        Logger::logf(Logger::Level::INFO, "LOOP", "Task watchdog armed (%lu ms)", (unsigned long)timeoutMs);
+        return true;
+    }
+
+    void LoopMonitor::disableWatchdog() {
+        if (!_watchdogEnabled) return;
+        esp_task_wdt_delete(NULL);
+        _watchdogEnabled = false;
+    }
+
+    // ===== Pass Hooks =====
+
+    void LoopMonitor::beginPass(uint32_t nowUs) {
+        if (_hasPreviousPass) {
+            _period.add(nowUs - _passStartUs);
+        }
+        _passStartUs = nowUs;
+        _hasPreviousPass = true;
+        _longest = {SECTION_NONE, 0, NULL, 0};
+    }
+
+    void LoopMonitor::endPass(uint32_t nowUs) {
+        uint32_t workUs = nowUs - _passStartUs;
+        _work.add(workUs);
+
+        if (_watchdogEnabled) {
+            esp_task_wdt_reset();
+        }
+
+        if (_budgetUs == 0 || workUs <= _budgetUs) return;
+
+        _lateCount++;
+        _lastCulprit = _longest;
+        if (_longest.durationUs > _worstCulprit.durationUs) {
+            _worstCulprit = _longest;
+        }
+
+        // At most one warning per second - logging must not cause the next overrun
+        uint32_t nowMs = millis();
+        if (nowMs - _lastWarningMs >= 1000 || _lateCount == 1) {
+            _lastWarningMs = nowMs;
+            char culprit[48];
+            Logger::logf(Logger::Level::WARNING, "LOOP", "Over budget: %lu us (%s: %lu us)",
+                        (unsigned long)workUs, describe(_longest, culprit, sizeof(culprit)),
+                        (unsigned long)_longest.durationUs);
+        }
+    }
+
+    void LoopMonitor::enterSection(LoopSectionKind kind, const char* name, uint8_t index) {
+        _current.kind = kind;
+        _current.index = index;
+        _current.name = name;
+        _sectionStartUs = micros();
+    }
+
+    void LoopMonitor::exitSection() {
+        uint32_t durationUs = micros() - _sectionStartUs;
+        if (durationUs > _longest.durationUs) {
+            _longest.kind = _current.kind;
+            _longest.index = _current.index;
+            _longest.name = _current.name;
+            _longest.durationUs = durationUs;
+        }
+        _current.kind = SECTION_NONE;
+        _current.name = NULL;
+    }
+
+    // ===== Statistics =====
+
+    const char* LoopMonitor::describe(const LoopSection& section, char* buffer, size_t size) {
+        const char* name = section.name ? section.name : "?";
+        switch (section.kind) {
+            case SECTION_EVENTS:  snprintf(buffer, size, "event processing"); break;
+            case SECTION_SERVICE: snprintf(buffer, size, "service '%s'", name); break;
+            case SECTION_DEVICE:  snprintf(buffer, size, "device '%s'", name); break;
+            case SECTION_BRIDGE:  snprintf(buffer, size, "bridge #%u", section.index); break;
+            default:              snprintf(buffer, size, "framework"); break;
+        }
+        return buffer;
+    }
+
+    void LoopMonitor::reset() {
+        _period.reset();
+        _work.reset();
+        _lateCount = 0;
+        _hasPreviousPass = false;
+        _lastCulprit = {SECTION_NONE, 0, NULL, 0};
+        _worstCulprit = _lastCulprit;
+    }
+
+}  // namespace TwiST
+
+// ===== Task Watchdog Hook =====
+
+/**
+ * Called by ESP-IDF from the watchdog interrupt before the panic.
+ * Names the framework section that stopped feeding the watchdog.
+ *
+ * The flash cache may be disabled here: code in IRAM, strings in DRAM, ROM
+ * printf only. Section names are usually literals in flash (or PSRAM) -
+ * those are printed as an address to look up in the ELF, never dereferenced.
+ */
+extern "C" void IRAM_ATTR esp_task_wdt_isr_user_handler(void) {
+    static const char DRAM_ATTR KIND_NAMES[][17] = {"framework", "event processing", "service", "device", "bridge"};
+    static const char DRAM_ATTR EMPTY[] = "";
+    static const char DRAM_ATTR NAMED_FORMAT[] = "[TWDT] TwiST loop blocked in %s '%s' #%u\n";
+    static const char DRAM_ATTR FLASH_FORMAT[] = "[TWDT] TwiST loop blocked in %s @0x%08x #%u\n";
+
+    const TwiST::LoopSection& section = TwiST::LoopMonitor::getCurrentSection();
+    uint8_t kind = (section.kind <= TwiST::SECTION_BRIDGE) ? section.kind : 0;
+    const char* name = section.name;
+    if (name == NULL || esp_ptr_internal(name)) {
+        esp_rom_printf(NAMED_FORMAT, KIND_NAMES[kind], name ? name : EMPTY, (unsigned)section.index);
+    } else {
+        esp_rom_printf(FLASH_FORMAT, KIND_NAMES[kind], (unsigned)(uintptr_t)name, (unsigned)section.index);
+    }
+}
@@ -0,0 +1,186 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      LoopMonitor.h
+ * @brief     Loop period/work statistics, budget overruns and task watchdog
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Diagnostics (owned by TwiSTFramework)
+ * - Hardware:     ESP32 Task Watchdog (optional)
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Fixed log2-bucket histograms (no samples stored, zero heap)
+ * - Sections (events, each device, bridge, service) are named while they run
+ * - A pass over budget records the longest section as the culprit
+ * - Watchdog ISR can name the section that is blocking the loop
+ *
+ * CAPABILITIES:
+ * - min / mean / max / p99 for loop period and work time
+ * - Late-iteration count against TWIST_LOOP_BUDGET_US
+ * - Last and worst culprit (section name + duration)
+ * - Task watchdog registration and feeding
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_LOOP_MONITOR_H
+#define TWIST_LOOP_MONITOR_H
+
+#include "../TwiST_Config.h"
+#include <stdint.h>
+#include <stddef.h>
+
+namespace TwiST {
+
+    // What kind of code a section is running
+    enum LoopSectionKind : uint8_t {
+        SECTION_NONE = 0,
+        SECTION_EVENTS,
+        SECTION_SERVICE,
+        SECTION_DEVICE,
+        SECTION_BRIDGE
+    };
+
+    // Identifies one section of an update() pass
+    struct LoopSection {
+        LoopSectionKind kind;
+        uint8_t index;          // Bridge index (bridges have no name)
+        const char* name;       // Device/service name, NULL for bridges
+        uint32_t durationUs;
+    };
+
+    /**
+     * @brief Log2-bucket histogram of microsecond durations
+     *
+     * Bucket b holds values in [2^b, 2^(b+1)), bucket 0 also holds 0.
+     * Percentiles resolve to the bucket's upper bound (clamped to max).
+     */
+    class LoopHistogram {
+    public:
+        static constexpr uint8_t BUCKETS = 32;
+
+        LoopHistogram() { reset(); }
+
+        void add(uint32_t us);
+        void reset();
+
+        unsigned long getCount() const { return _count; }
+        uint32_t getMin() const { return _count ? _min : 0; }
+        uint32_t getMax() const { return _max; }
+        uint32_t getMean() const { return _count ? (uint32_t)(_sum / _count) : 0; }
+
+        /**
+         * @brief Approximate percentile
+         * @param percent 0-100 (e.g. 99)
+         * @return Upper bound of the bucket holding the percentile (us)
+         */
+        uint32_t getPercentile(uint8_t percent) const;
+
+    private:
+        uint32_t _buckets[BUCKETS];
+        unsigned long _count;
+        uint64_t _sum;
+        uint32_t _min;
+        uint32_t _max;
+    };
+
+    /**
+     * @brief Per-pass timing of TwiSTFramework::update()
+     *
+     * TwiSTFramework drives this automatically; applications only set the
+     * budget, optionally enable the watchdog and read the statistics.
+     *
+     * Example:
+     * ```cpp
+     * framework.loopMonitor().setBudget(5000);        // 5 ms
+     * framework.loopMonitor().enableWatchdog(2000);   // Reset after 2 s stall
+     * ```
+     */
+    class LoopMonitor {
+    public:
+        LoopMonitor();
+
+        // ===== Configuration =====
+
+        void setBudget(uint32_t budgetUs) { _budgetUs = budgetUs; }
+        uint32_t getBudget() const { return _budgetUs; }
+
+        /**
+         * @brief Register the calling task with the ESP32 task watchdog
+         * @param timeoutMs Reset if one update() pass blocks longer than this
+         * @return true if watchdog armed
+         */
+        bool enableWatchdog(uint32_t timeoutMs = TWIST_WATCHDOG_TIMEOUT_MS);
+
+        /**
+         * @brief Unregister from the task watchdog
+         */
+        void disableWatchdog();
+
+        bool isWatchdogEnabled() const { return _watchdogEnabled; }
+
+        // ===== Pass / Section Hooks (called by framework) =====
+
+        void beginPass(uint32_t nowUs);
+        void endPass(uint32_t nowUs);
+
+        void enterSection(LoopSectionKind kind, const char* name, uint8_t index = 0);
+        void exitSection();
+
+        // ===== Statistics =====
+
+        const LoopHistogram& getPeriod() const { return _period; }
+        const LoopHistogram& getWork() const { return _work; }
+        unsigned long getLateCount() const { return _lateCount; }
+
+        const LoopSection& getLastCulprit() const { return _lastCulprit; }
+        const LoopSection& getWorstCulprit() const { return _worstCulprit; }
+
+        /**
+         * @brief Section running right now (safe to read from the watchdog ISR)
+         *
+         * Always inlined - an out-of-line copy would live in flash.
+         */
+        static inline __attribute__((always_inline)) const LoopSection& getCurrentSection() { return _current; }
+
+        /**
+         * @brief Format a section as "device 'Name'" / "bridge #2"
+         * @param section Section to describe
+         * @param buffer Output buffer
+         * @param size Buffer size
+         * @return buffer
+         */
+        static const char* describe(const LoopSection& section, char* buffer, size_t size);
+
+        void reset();
+
+    private:
+        uint32_t _budgetUs;
+        bool _watchdogEnabled;
+
+        LoopHistogram _period;
+        LoopHistogram _work;
+        unsigned long _lateCount;
+
+        uint32_t _passStartUs;
+        bool _hasPreviousPass;
+
+        uint32_t _sectionStartUs;
+        LoopSection _longest;       // Longest section of the current pass
+        LoopSection _lastCulprit;
+        LoopSection _worstCulprit;
+        uint32_t _lastWarningMs;
+
+        // Single framework loop per firmware - shared with the watchdog ISR
+        static LoopSection _current;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_LOOP_MONITOR_H
@@ -0,0 +1,383 @@
+#include "NodeLink.h"
+#include "Logger.h"
+#include "CommandProtocol.h"
+#include <Arduino.h>
+#include <math.h>
+
+namespace TwiST {
+
+    NodeLink::NodeLink(ITransport& transport, DeviceRegistry& registry, uint8_t nodeId, uint16_t rateHz)
+        : _transport(transport),
+          _registry(registry),
+          _commands(transport, registry),
+          _nodeId(nodeId),
+          _exportCount(0),
+          _cursor(0),
+          _periodMs(20),
+          _lastBatchMs(0),
+          _lastSentMs(0),
+          _deltaThreshold(0.01f),
+          _fullInterval(250),
+          _batchesSinceFull(0),
+          _sequence(0),
+          _requestFull(false),
+          _fullPending(false),
+          _proxyCount(0),
+          _pendingCount(0),
+          _peerNode(0),
+          _peerSequence(0),
+          _hasPeer(false),
+          _lastReceiveMs(0),
+          _batchesSent(0),
+          _batchesReceived(0),
+          _statesSent(0),
+          _statesApplied(0),
+          _sequenceGaps(0),
+          _commandFrames(0),
+          _commandsCoalesced(0),
+          _commandsDropped(0),
+          _framesDropped(0) {
+        setRate(rateHz);
+    }
+
+    // ===== Exports =====
+
+    bool NodeLink::exportDevice(uint16_t deviceId) {
+        IDevice* device = _registry.findDevice(deviceId);
+        if (device == NULL) {
+            Logger::logf(Logger::Level::ERROR, "NODE", "Cannot export unknown device %u", deviceId);
+            return false;
+        }
+        if (_exportCount >= TWIST_NODE_MAX_EXPORTS) {
+            Logger::error("NODE", "Export limit reached");
+            return false;
+        }
+
+        for (uint8_t i = 0; i < _exportCount; i++) {
+            if (_exports[i].device == device) return true;
+        }
+
+        Export& entry = _exports[_exportCount++];
+        entry.device = device;
+        entry.lastSent = RemoteState();
+        entry.dirty = true;
+        return true;
+    }
+
+    uint8_t NodeLink::exportAll() {
+        uint8_t exported = 0;
+        for (uint8_t i = 0; i < _registry.getDeviceCount(); i++) {
+            DeviceInfo info = _registry.getDeviceAt(i)->getInfo();
+            if (exportDevice(info.id)) exported++;
+        }
+        return exported;
+    }
+
+    void NodeLink::setRate(uint16_t rateHz) {
+        if (rateHz == 0) rateHz = 1;
+        _periodMs = 1000UL / rateHz;
+        if (_periodMs == 0) _periodMs = 1;
+    }
+
+    void NodeLink::markAllDirty() {
+        for (uint8_t i = 0; i < _exportCount; i++) {
+            _exports[i].dirty = true;
+        }
+        _batchesSinceFull = 0;
+        _fullPending = true;
+    }
+
+    // ===== IDeviceLink =====
+
+    bool NodeLink::attachProxy(IRemoteProxy* proxy) {
+        if (proxy == NULL) {
+            Logger::error("NODE", "Cannot attach NULL proxy");
+            return false;
+        }
+        for (uint8_t i = 0; i < _proxyCount; i++) {
+            if (_proxies[i] == proxy) return true;
+        }
+        if (_proxyCount >= TWIST_NODE_MAX_PROXIES) {
+            Logger::error("NODE", "Proxy limit reached");
+            return false;
+        }
+        _proxies[_proxyCount++] = proxy;
+        _requestFull = true;  // New proxy needs current state now, not on next change
+        return true;
+    }
+
+    void NodeLink::sendValue(uint16_t remoteId, float value) {
+        PendingCommand* command = queueCommand(CMD_SET_VALUE, remoteId, true);
+        if (command) command->value = value;
+    }
+
+    void NodeLink::sendMoveTo(uint16_t remoteId, float target, uint16_t durationMs) {
+        PendingCommand* command = queueCommand(CMD_MOVE_TO, remoteId, true);
+        if (command) {
+            command->value = target;
+            command->durationMs = durationMs;
+        }
+    }
+
+    void NodeLink::sendEnable(uint16_t remoteId, bool enabled) {
+        // Not coalesced - enable/disable ordering relative to motion matters
+        PendingCommand* command = queueCommand(CMD_ENABLE, remoteId, false);
+        if (command) command->enabled = enabled;
+    }
+
+    bool NodeLink::isConnected() const {
+        return _hasPeer && (millis() - _lastReceiveMs) < TWIST_NODE_TIMEOUT_MS;
+    }
+
+    // ===== IService =====
+
+    void NodeLink::update() {
+        unsigned long now = millis();
+
+        receive(now);
+        flushCommands();
+
+        if (now - _lastBatchMs >= _periodMs) {
+            _lastBatchMs = now;
+            sendBatch(now);
+        }
+    }
+
+    // ===== Receive =====
+
+    void NodeLink::receive(unsigned long now) {
+        uint8_t buffer[64];
+        size_t budget = TWIST_COMMAND_MAX_BYTES_PER_TICK;
+
+        while (budget > 0) {
+            size_t chunk = (budget < sizeof(buffer)) ? budget : sizeof(buffer);
+            size_t received = _transport.receive(buffer, chunk);
+            if (received == 0) break;
+            budget -= received;
+
+            for (size_t i = 0; i < received; i++) {
+                if (!_parser.feed(buffer[i])) continue;
+
+                if (_parser.type() == WIRE_REPLICATION) {
+                    handleReplication(_parser.payload(), _parser.length(), now);
+                } else if (_parser.type() == WIRE_COMMAND) {
+                    _commands.execute(_parser.payload(), _parser.length(), NULL, 0);
+                    if (_hasPeer) _lastReceiveMs = now;
+                }
+            }
+        }
+    }
+
+    void NodeLink::handleReplication(const uint8_t* payload, size_t length, unsigned long now) {
+        ReplicationReader reader(payload, length);
+        if (!reader.isValid()) return;
+
+        uint16_t sequence = reader.getSequence();
+        bool inSequence = _hasPeer && isConnected() && reader.getNode() == _peerNode;
+        if (inSequence && sequence != (uint16_t)(_peerSequence + 1)) {
+            _sequenceGaps++;
+            _requestFull = true;  // Lost deltas - current values are only in a full batch
+            inSequence = false;
+        } else if (_hasPeer && !inSequence) {
+            _requestFull = true;  // Back after a timeout or a new peer - resync everything
+        }
+        if (reader.getFlags() & ReplicationCodec::FLAG_REQUEST_FULL) {
+            markAllDirty();
+        }
+
+        _peerNode = reader.getNode();
+        _peerSequence = sequence;
+        _hasPeer = true;
+        _lastReceiveMs = now;
+        _batchesReceived++;
+
+        // Nothing missed: states absent from this batch are unchanged on the owner
+        if (inSequence) {
+            for (uint8_t i = 0; i < _proxyCount; i++) _proxies[i]->confirmRemoteState(now);
+        }
+
+        RemoteState state;
+        while (reader.next(state)) {
+            for (uint8_t i = 0; i < _proxyCount; i++) {
+                if (_proxies[i]->getRemoteId() == state.deviceId) {
+                    _proxies[i]->applyRemoteState(state, now);
+                    _statesApplied++;
+                }
+            }
+        }
+    }
+
+    // ===== Send =====
+
+    void NodeLink::sendBatch(unsigned long now) {
+        bool full = (_fullInterval > 0 && _batchesSinceFull >= _fullInterval);
+        if (full) markAllDirty();
+
+        uint8_t flags = 0;
+        if (_fullPending) flags |= ReplicationCodec::FLAG_FULL;
+        if (_requestFull) flags |= ReplicationCodec::FLAG_REQUEST_FULL;
+
+        uint8_t frame[WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+        ReplicationWriter writer(WireFrame::payload(frame), TWIST_WIRE_MAX_PAYLOAD, _nodeId, _sequence, flags);
+
+        // Sample everything first so a device that does not fit stays pending
+        RemoteState current[TWIST_NODE_MAX_EXPORTS];
+        bool include[TWIST_NODE_MAX_EXPORTS];
+        uint8_t start = _cursor;
+        bool allFit = true;
+
+        for (uint8_t n = 0; n < _exportCount; n++) {
+            uint8_t i = (uint8_t)((start + n) % _exportCount);
+            Export& entry = _exports[i];
+            DeviceInfo info = entry.device->getInfo();
+            sample(entry.device, info.id, current[i]);
+
+            include[i] = entry.dirty || hasChanged(current[i], entry.lastSent);
+            if (!include[i]) continue;
+
+            if (!writer.add(current[i])) {
+                include[i] = false;
+                if (allFit) _cursor = i;  // First one left out goes first next time
+                allFit = false;
+            }
+        }
+        if (allFit) _cursor = 0;
+
+        // Nothing changed - only send a heartbeat when the peer would time out
+        if (writer.getCount() == 0 && flags == 0 && (now - _lastSentMs) < TWIST_NODE_HEARTBEAT_MS) {
+            return;
+        }
+
+        size_t length = WireFrame::finalize(frame, WIRE_REPLICATION, (uint16_t)writer.length());
+        if (!sendFrame(frame, length)) return;  // Deltas stay pending - nothing marked sent
+
+        for (uint8_t i = 0; i < _exportCount; i++) {
+            if (!include[i]) continue;
+            _exports[i].lastSent = current[i];
+            _exports[i].dirty = false;
+        }
+
+        _statesSent += writer.getCount();
+        _batchesSent++;
+        _sequence++;
+        _batchesSinceFull++;
+        _requestFull = false;
+        if (allFit) _fullPending = false;
+        _lastSentMs = now;
+    }
+
+    void NodeLink::flushCommands() {
+        if (_pendingCount == 0) return;
+
+        uint8_t frame[WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+        CommandWriter writer(WireFrame::payload(frame), TWIST_WIRE_MAX_PAYLOAD, 0);  // Fire-and-forget
+
+        uint8_t written = 0;
+        for (; written < _pendingCount; written++) {
+            const PendingCommand& command = _pending[written];
+            bool ok = false;
+            switch (command.opcode) {
+                case CMD_SET_VALUE: ok = writer.setValue(command.deviceId, command.value); break;
+                case CMD_MOVE_TO:   ok = writer.moveTo(command.deviceId, command.value, command.durationMs); break;
+                case CMD_ENABLE:    ok = writer.enable(command.deviceId, command.enabled); break;
+                default:            ok = true; break;
+            }
+            if (!ok) break;
+        }
+
+        size_t length = WireFrame::finalize(frame, WIRE_COMMAND, (uint16_t)writer.length());
+        if (!sendFrame(frame, length)) return;  // Retry whole queue next tick
+        _commandFrames++;
+
+        // Keep what did not fit, in order
+        uint8_t remaining = _pendingCount - written;
+        for (uint8_t i = 0; i < remaining; i++) {
+            _pending[i] = _pending[written + i];
+        }
+        _pendingCount = remaining;
+    }
+
+    bool NodeLink::sendFrame(const uint8_t* frame, size_t length) {
+        // Whole frames only - a torn frame costs the peer a resync
+        if (_transport.writable() < length) {
+            _framesDropped++;
+            return false;
+        }
+        _transport.send(frame, length);
+        _transport.flush();
+        return true;
+    }
+
+    // ===== Private Helpers =====
+
+    void NodeLink::sample(IDevice* device, uint16_t id, RemoteState& out) {
+        out.deviceId = id;
+        out.state = (uint8_t)device->getState();
+        out.flags = device->isEnabled() ? REMOTE_ENABLED : 0;
+        out.axisCount = 0;
+
+        if (device->hasCapability(CAP_OUTPUT)) {
+            IOutputDevice* output = static_cast<IOutputDevice*>(device);
+            out.flags |= REMOTE_OUTPUT;
+            if (output->isMoving()) out.flags |= REMOTE_MOVING;
+            out.values[0] = output->getValue();
+            out.axisCount = 1;
+        } else if (device->hasCapability(CAP_INPUT)) {
+            IInputDevice* input = static_cast<IInputDevice*>(device);
+            uint8_t axes = device->getInfo().channelCount;
+            if (axes > TWIST_REMOTE_MAX_AXES) axes = TWIST_REMOTE_MAX_AXES;
+            out.flags |= REMOTE_INPUT;
+            for (uint8_t a = 0; a < axes; a++) {
+                out.values[a] = input->readAnalog(a);
+            }
+            out.axisCount = axes;
+        }
+    }
+
+    bool NodeLink::hasChanged(const RemoteState& current, const RemoteState& last) const {
+        if (current.state != last.state || current.flags != last.flags || current.axisCount != last.axisCount) {
+            return true;
+        }
+        for (uint8_t a = 0; a < current.axisCount; a++) {
+            if (fabsf(current.values[a] - last.values[a]) > _deltaThreshold) return true;
+        }
+        return false;
+    }
+
+    NodeLink::PendingCommand* NodeLink::queueCommand(uint8_t opcode, uint16_t deviceId, bool coalesce) {
+        if (coalesce) {
+            // Latest target wins - a newer setValue/moveTo replaces an unsent one
+            for (uint8_t i = 0; i < _pendingCount; i++) {
+                PendingCommand& command = _pending[i];
+                if (command.deviceId == deviceId &&
+                    (command.opcode == CMD_SET_VALUE || command.opcode == CMD_MOVE_TO)) {
+                    // Only safe if no enable/disable for this device is queued after it
+                    bool reordered = false;
+                    for (uint8_t j = i + 1; j < _pendingCount; j++) {
+                        if (_pending[j].deviceId == deviceId) reordered = true;
+                    }
+                    if (reordered) break;
+
+                    command.opcode = opcode;
+                    command.durationMs = 0;
+                    _commandsCoalesced++;
+                    return &command;
+                }
+            }
+        }
+
+        if (_pendingCount >= TWIST_NODE_MAX_PENDING) {
+            _commandsDropped++;
+            return NULL;
+        }
+
+        PendingCommand& command = _pending[_pendingCount++];
+        command.opcode = opcode;
+        command.deviceId = deviceId;
+        command.value = 0.0f;
+        command.durationMs = 0;
+        command.enabled = false;
+        return &command;
+    }
+
+}  // namespace TwiST
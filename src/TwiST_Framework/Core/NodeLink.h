@@ -0,0 +1,228 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      NodeLink.h
+ * @brief     Device replication and remote commands between framework nodes
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService, SERVICE_BEFORE_DEVICES)
+ * - Hardware:     None (uses ITransport)
+ * - Implements:   IService, IDeviceLink
+ *
+ * PRINCIPLES:
+ * - Owning node EXPORTS registry devices; peer node registers proxy
+ *   devices (RemoteOutput / RemoteInput) that stand in for them
+ * - State flows owner -> peer as sequence-numbered batches, one frame per
+ *   period, carrying only devices that changed since they were last sent
+ * - Commands flow peer -> owner, coalesced per device and flushed as ONE
+ *   WIRE_COMMAND frame per tick (CommandProtocol, fire-and-forget)
+ * - A sequence gap asks the owner for a full refresh - no retransmission
+ * - Transport-agnostic: UDPTransport, SerialTransport, LoopbackTransport
+ *
+ * CAPABILITIES:
+ * - Delta threshold, replication rate and full-refresh interval
+ * - Liveness from any received frame (empty heartbeat batches keep it up)
+ * - Gap / drop / coalesce statistics
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_NODE_LINK_H
+#define TWIST_NODE_LINK_H
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/ITransport.h"
+#include "../Interfaces/IDeviceLink.h"
+#include "DeviceRegistry.h"
+#include "WireFrame.h"
+#include "ReplicationCodec.h"
+#include "CommandChannel.h"
+
+// Devices this node can export
+#ifndef TWIST_NODE_MAX_EXPORTS
+#define TWIST_NODE_MAX_EXPORTS 16
+#endif
+
+// Proxy devices fed by this link
+#ifndef TWIST_NODE_MAX_PROXIES
+#define TWIST_NODE_MAX_PROXIES 16
+#endif
+
+// Outgoing commands queued between flushes (after coalescing)
+#ifndef TWIST_NODE_MAX_PENDING
+#define TWIST_NODE_MAX_PENDING 16
+#endif
+
+// Peer considered gone after this long without a frame
+#ifndef TWIST_NODE_TIMEOUT_MS
+#define TWIST_NODE_TIMEOUT_MS 1000
+#endif
+
+// Empty batch sent after this long with nothing changed
+#ifndef TWIST_NODE_HEARTBEAT_MS
+#define TWIST_NODE_HEARTBEAT_MS 250
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Node-to-node replication service
+     *
+     * Example usage (owner of the servos):
+     * ```cpp
+     * Drivers::UDPTransport link(4210, peerIp, 4210);
+     * NodeLink node(link, *framework.registry(), 1);
+     * node.exportAll();
+     * framework.addService(&node, SERVICE_BEFORE_DEVICES);
+     * ```
+     *
+     * Peer node (drives them):
+     * ```cpp
+     * NodeLink node(link, *framework.registry(), 2);
+     * Devices::RemoteOutput arm(node, 100, 500, "RemoteArm");
+     * framework.registry()->registerDevice(&arm);
+     * framework.addService(&node, SERVICE_BEFORE_DEVICES);
+     * ```
+     */
+    class NodeLink : public IService, public IDeviceLink {
+    public:
+        /**
+         * @param transport Link to the peer node
+         * @param registry Local registry (exports + incoming commands)
+         * @param nodeId This node's ID (carried in every batch)
+         * @param rateHz Replication batches per second
+         */
+        NodeLink(ITransport& transport, DeviceRegistry& registry, uint8_t nodeId, uint16_t rateHz = 50);
+
+        // ===== Exports (owner side) =====
+
+        /**
+         * @brief Replicate one registry device to the peer
+         * @return false if unknown or export table full
+         */
+        bool exportDevice(uint16_t deviceId);
+
+        /**
+         * @brief Export every registered device
+         * @return Number of devices exported
+         */
+        uint8_t exportAll();
+
+        void setRate(uint16_t rateHz);
+
+        /**
+         * @brief Minimum value change that triggers a delta entry
+         */
+        void setDeltaThreshold(float threshold) { _deltaThreshold = threshold; }
+
+        /**
+         * @brief Force a full refresh every N batches (0 = only on request)
+         */
+        void setFullInterval(uint16_t batches) { _fullInterval = batches; }
+
+        /**
+         * @brief Resend every export on the next batches
+         */
+        void markAllDirty();
+
+        // ===== IDeviceLink (peer side) =====
+        bool attachProxy(IRemoteProxy* proxy) override;
+        void sendValue(uint16_t remoteId, float value) override;
+        void sendMoveTo(uint16_t remoteId, float target, uint16_t durationMs) override;
+        void sendEnable(uint16_t remoteId, bool enabled) override;
+        bool isConnected() const override;
+
+        // ===== IService =====
+        void update() override;
+        const char* getName() const override { return "NodeLink"; }
+
+        // Statistics
+        uint8_t getNodeId() const { return _nodeId; }
+        uint8_t getPeerNodeId() const { return _peerNode; }
+        uint8_t getExportCount() const { return _exportCount; }
+        uint8_t getProxyCount() const { return _proxyCount; }
+        unsigned long getBatchesSent() const { return _batchesSent; }
+        unsigned long getBatchesReceived() const { return _batchesReceived; }
+        unsigned long getStatesSent() const { return _statesSent; }
+        unsigned long getStatesApplied() const { return _statesApplied; }
+        unsigned long getSequenceGapCount() const { return _sequenceGaps; }
+        unsigned long getCommandFramesSent() const { return _commandFrames; }
+        unsigned long getCommandsCoalesced() const { return _commandsCoalesced; }
+        unsigned long getCommandsDropped() const { return _commandsDropped; }
+        unsigned long getFramesDropped() const { return _framesDropped; }
+        const CommandChannel& getCommandChannel() const { return _commands; }
+
+    private:
+        struct Export {
+            IDevice* device;
+            RemoteState lastSent;
+            bool dirty;         // Must be sent regardless of delta
+        };
+
+        struct PendingCommand {
+            uint8_t opcode;     // CommandOpcode
+            uint16_t deviceId;
+            float value;
+            uint16_t durationMs;
+            bool enabled;
+        };
+
+        ITransport& _transport;
+        DeviceRegistry& _registry;
+        CommandChannel _commands;   // Applies incoming WIRE_COMMAND payloads
+        WireFrameParser _parser;
+        uint8_t _nodeId;
+
+        // Owner side
+        Export _exports[TWIST_NODE_MAX_EXPORTS];
+        uint8_t _exportCount;
+        uint8_t _cursor;            // Round-robin start so every export gets room
+        unsigned long _periodMs;
+        unsigned long _lastBatchMs;
+        unsigned long _lastSentMs;
+        float _deltaThreshold;
+        uint16_t _fullInterval;
+        uint16_t _batchesSinceFull;
+        uint16_t _sequence;
+        bool _requestFull;          // Ask peer for a full refresh in next batch
+        bool _fullPending;          // Full refresh in progress (FLAG_FULL)
+
+        // Peer side
+        IRemoteProxy* _proxies[TWIST_NODE_MAX_PROXIES];
+        uint8_t _proxyCount;
+        PendingCommand _pending[TWIST_NODE_MAX_PENDING];
+        uint8_t _pendingCount;
+        uint8_t _peerNode;
+        uint16_t _peerSequence;
+        bool _hasPeer;
+        unsigned long _lastReceiveMs;
+
+        unsigned long _batchesSent;
+        unsigned long _batchesReceived;
+        unsigned long _statesSent;
+        unsigned long _statesApplied;
+        unsigned long _sequenceGaps;
+        unsigned long _commandFrames;
+        unsigned long _commandsCoalesced;
+        unsigned long _commandsDropped;
+        unsigned long _framesDropped;
+
+        void receive(unsigned long now);
+        void handleReplication(const uint8_t* payload, size_t length, unsigned long now);
+        void sendBatch(unsigned long now);
+        void flushCommands();
+        bool sendFrame(const uint8_t* frame, size_t length);
+
+        static void sample(IDevice* device, uint16_t id, RemoteState& out);
+        bool hasChanged(const RemoteState& current, const RemoteState& last) const;
+        PendingCommand* queueCommand(uint8_t opcode, uint16_t deviceId, bool coalesce);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_NODE_LINK_H
@@ -0,0 +1,84 @@
+#include "OutputConditioner.h"
+
+namespace TwiST {
+
+    OutputConditioner::OutputConditioner()
+        : _deadband(0),
+          _slewRate(0.0f),
+          _smoothingUs(0),
+          _request(0),
+          _filtered(0.0f),
+          _position(0.0f),
+          _written(0),
+          _lastUs(0),
+          _settled(true),
+          _writes(0),
+          _suppressed(0) {
+    }
+
+    void OutputConditioner::reset(uint16_t ticks, uint32_t nowUs) {
+        _request = ticks;
+        _filtered = ticks;
+        _position = ticks;
+        _written = ticks;
+        _lastUs = nowUs;
+        _settled = true;
+    }
+
+    bool OutputConditioner::step(uint16_t request, uint32_t nowUs, uint16_t& out) {
+        if (!isActive()) {
+            _request = request;
+            _filtered = request;
+            _position = request;
+            _written = request;
+            _lastUs = nowUs;
+            _settled = true;
+            out = request;
+            _writes++;
+            return true;
+        }
+
+        uint32_t dt = nowUs - _lastUs;
+        if (dt > TWIST_CONDITIONER_MAX_STEP_US) dt = TWIST_CONDITIONER_MAX_STEP_US;
+        _lastUs = nowUs;
+        _request = request;
+
+        // Low-pass: alpha = dt / (tau + dt), exact for any call rate
+        if (_smoothingUs > 0) {
+            _filtered += (request - _filtered) * ((float)dt / (float)(_smoothingUs + dt));
+            if (_filtered - request < 0.5f && request - _filtered < 0.5f) _filtered = request;
+        } else {
+            _filtered = request;
+        }
+
+        // Slew limit
+        float delta = _filtered - _position;
+        float maxStep = _slewRate * (float)dt / 1000000.0f;
+        if (_slewRate > 0.0f && delta > maxStep) {
+            _position += maxStep;
+        } else if (_slewRate > 0.0f && delta < -maxStep) {
+            _position -= maxStep;
+        } else {
+            _position = _filtered;
+        }
+
+        uint16_t candidate = (uint16_t)(_position + 0.5f);
+        int32_t change = (int32_t)candidate - (int32_t)_written;
+        if (change < 0) change = -change;
+
+        // Done when the internal state reached the request and the rest is inside the deadband
+        bool converged = (_position == (float)request);
+        _settled = converged && (uint32_t)change <= _deadband;
+
+        if (change == 0 || (uint32_t)change <= _deadband) {
+            _suppressed++;
+            return false;
+        }
+        _written = candidate;
+        _settled = converged;       // This write delivered the request
+        out = candidate;
+        _writes++;
+        return true;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,121 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      OutputConditioner.h
+ * @brief     Smoothing, slew limit and deadband for PWM tick outputs
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Signal Conditioning (no hardware)
+ * - Hardware:     None
+ * - Dependency:   None
+ *
+ * PRINCIPLES:
+ * - Sits between the requested tick value and the driver write:
+ *   request -> low-pass -> slew limit -> deadband -> write (or suppress)
+ * - Continuous time: smoothing and slew are per second, not per call -
+ *   calling step() twice in one loop does not move twice as far
+ * - Internal position is fractional; the deadband only decides WHEN the
+ *   driver is written, small changes accumulate until they are worth a write
+ * - All stages off = every step() writes (no behavior change)
+ * - Pure C++ - builds on a host for recorded input traces
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_OUTPUT_CONDITIONER_H
+#define TWIST_OUTPUT_CONDITIONER_H
+
+#include <stdint.h>
+
+// Longest time step used by smoothing/slew - one 50 Hz servo frame.
+// A request after a quiet period starts from here instead of jumping.
+#ifndef TWIST_CONDITIONER_MAX_STEP_US
+#define TWIST_CONDITIONER_MAX_STEP_US 20000
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Single-channel output conditioner
+     *
+     * Example usage:
+     * ```cpp
+     * OutputConditioner out;
+     * out.setDeadband(2);                      // Ignore +/-2 tick wiggle
+     * out.setSlewRate(400.0f);                 // Max 400 ticks/s
+     * out.setSmoothing(30000);                 // 30 ms time constant
+     * out.reset(307, micros());
+     * uint16_t ticks;
+     * if (out.step(request, micros(), ticks)) pwm.setPWM(ch, ticks);
+     * ```
+     */
+    class OutputConditioner {
+    public:
+        OutputConditioner();
+
+        /**
+         * @brief Changes of this many ticks or less are not written (0 = write every change)
+         */
+        void setDeadband(uint16_t ticks) { _deadband = ticks; }
+        uint16_t getDeadband() const { return _deadband; }
+
+        /**
+         * @brief Max output speed in ticks per second (0 = off)
+         */
+        void setSlewRate(float ticksPerSecond) { _slewRate = (ticksPerSecond > 0.0f) ? ticksPerSecond : 0.0f; }
+        float getSlewRate() const { return _slewRate; }
+
+        /**
+         * @brief First-order low-pass time constant (0 = off)
+         */
+        void setSmoothing(uint32_t timeConstantUs) { _smoothingUs = timeConstantUs; }
+        uint32_t getSmoothing() const { return _smoothingUs; }
+
+        bool isActive() const { return _deadband > 0 || _slewRate > 0.0f || _smoothingUs > 0; }
+
+        /**
+         * @brief Output is known to be at ticks (after a forced write)
+         */
+        void reset(uint16_t ticks, uint32_t nowUs);
+
+        /**
+         * @brief Advance toward request
+         * @param out Value to write when true is returned
+         * @return true if the driver should be written
+         */
+        bool step(uint16_t request, uint32_t nowUs, uint16_t& out);
+
+        /**
+         * @brief Nothing left to do for the current request (update() may stop calling step())
+         */
+        bool isSettled() const { return _settled; }
+
+        uint16_t getRequest() const { return _request; }
+        uint16_t getOutput() const { return _written; }
+        uint32_t getWriteCount() const { return _writes; }
+        uint32_t getSuppressedCount() const { return _suppressed; }
+        void resetCounters() { _writes = 0; _suppressed = 0; }
+
+    private:
+        uint16_t _deadband;
+        float _slewRate;
+        uint32_t _smoothingUs;
+
+        uint16_t _request;
+        float _filtered;            // Low-pass state
+        float _position;            // Slew-limited state (fractional ticks)
+        uint16_t _written;          // Last value handed to the driver
+        uint32_t _lastUs;
+        bool _settled;
+        uint32_t _writes;
+        uint32_t _suppressed;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_OUTPUT_CONDITIONER_H
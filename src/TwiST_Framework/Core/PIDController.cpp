@@ -0,0 +1,111 @@
+#include "PIDController.h"
+
+namespace TwiST {
+
+    static const int64_t ONE = (int64_t)1 << PIDController::FRAC_BITS;
+
+    static int64_t toFixed(float value) {
+        float scaled = value * (float)ONE;
+        return (int64_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+    }
+
+    PIDController::PIDController(uint32_t periodUs)
+        : _period(periodUs == 0 ? 1 : periodUs),
+          _kp(0.0f), _ki(0.0f), _kd(0.0f), _kv(0.0f),
+          _kpQ(0), _kiQ(0), _kdQ(0), _kvQ(0),
+          _ks(0),
+          _limit(INT32_MAX >> 1),
+          _integral(0),
+          _derivative(0),
+          _lastMeasurement(0),
+          _dShift(0),
+          _output(0),
+          _error(0),
+          _saturated(false) {
+    }
+
+    void PIDController::setPeriod(uint32_t periodUs) {
+        _period = (periodUs == 0) ? 1 : periodUs;
+        scaleGains();
+    }
+
+    void PIDController::setGains(float kp, float ki, float kd) {
+        _kp = kp;
+        _ki = ki;
+        _kd = kd;
+        scaleGains();
+    }
+
+    void PIDController::setFeedForward(float kv, int32_t ks) {
+        _kv = kv;
+        _ks = (ks < 0) ? -ks : ks;
+        scaleGains();
+    }
+
+    void PIDController::setOutputLimit(int32_t limit) {
+        _limit = (limit < 0) ? -limit : limit;
+        int64_t max = (int64_t)_limit * ONE;
+        if (_integral > max) _integral = max;
+        if (_integral < -max) _integral = -max;
+    }
+
+    void PIDController::reset(int32_t measurement) {
+        _integral = 0;
+        _derivative = 0;
+        _lastMeasurement = measurement;
+        _output = 0;
+        _error = 0;
+        _saturated = false;
+    }
+
+    int32_t PIDController::getIntegral() const {
+        return (int32_t)((_integral + ONE / 2) >> FRAC_BITS);
+    }
+
+    int32_t PIDController::step(int32_t setpoint, int32_t measurement, int32_t velocity) {
+        int64_t error = (int64_t)setpoint - measurement;
+        _error = (error > INT32_MAX) ? INT32_MAX : (error < INT32_MIN) ? INT32_MIN : (int32_t)error;
+
+        int64_t p = _kpQ * error;
+
+        // Derivative on measurement: no spike when the setpoint jumps
+        int64_t delta = (int64_t)measurement - _lastMeasurement;
+        _lastMeasurement = measurement;
+        int64_t d = -_kdQ * delta;
+        _derivative += (d - _derivative) >> _dShift;
+
+        int64_t ff = _kvQ * velocity;
+        if (velocity > 0) ff += (int64_t)_ks * ONE;
+        else if (velocity < 0) ff -= (int64_t)_ks * ONE;
+
+        int64_t max = (int64_t)_limit * ONE;
+        int64_t integral = _integral + _kiQ * error;
+        if (integral > max) integral = max;
+        if (integral < -max) integral = -max;
+
+        int64_t u = p + integral + _derivative + ff;
+        _saturated = false;
+        if (u > max) {
+            u = max;
+            _saturated = true;
+            if (error > 0) integral = _integral;    // Would only wind up further
+        } else if (u < -max) {
+            u = -max;
+            _saturated = true;
+            if (error < 0) integral = _integral;
+        }
+        _integral = integral;
+
+        _output = (int32_t)((u + ONE / 2) >> FRAC_BITS);
+        return _output;
+    }
+
+    void PIDController::scaleGains() {
+        float dt = (float)_period * 1.0e-6f;
+        _kpQ = toFixed(_kp);
+        _kiQ = toFixed(_ki * dt);
+        _kdQ = toFixed(_kd / dt);
+        _kvQ = toFixed(_kv);
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,134 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      PIDController.h
+ * @brief     Fixed-rate, fixed-point PID with anti-windup and feed-forward
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Control Math (no hardware)
+ * - Hardware:     None
+ * - Dependency:   None
+ *
+ * PRINCIPLES:
+ * - Fixed sample period: Ki*dt and Kd/dt are folded into the gains when
+ *   they are set - step() is integer multiply/add/shift only (no float,
+ *   no divide), cheap enough for kHz loops on cores without an FPU
+ * - Gains held in Q(FRAC_BITS) fixed point, products in 64 bits
+ * - Derivative on measurement (no kick on setpoint steps), optional
+ *   first-order filter (shift = log2 of the time constant in samples)
+ * - Anti-windup: integral clamped to the output range and frozen while
+ *   the output is saturated in the direction the error is pushing
+ * - Pure C++ - verified on a host against a simulated motor plant
+ *
+ * CAPABILITIES:
+ * - P, I, D terms + velocity feed-forward (kv) + static friction (ks)
+ * - Symmetric output limit (e.g. +/- PWM full scale)
+ * - Bumpless reset to a measurement
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_PID_CONTROLLER_H
+#define TWIST_PID_CONTROLLER_H
+
+#include <stdint.h>
+
+namespace TwiST {
+
+    /**
+     * @brief Integer PID for a fixed sample period
+     *
+     * Units: setpoint and measurement in sensor counts, output in actuator
+     * counts (e.g. PWM ticks), velocity feed-forward in counts/s.
+     *
+     * Example usage:
+     * ```cpp
+     * PIDController pid(1000);                  // 1 kHz
+     * pid.setGains(2.0f, 40.0f, 0.02f);         // out/count, out/(count*s), out/(count/s)
+     * pid.setFeedForward(0.35f, 120);           // out per count/s, friction offset
+     * pid.setOutputLimit(4095);
+     * pid.reset(encoder.readCount());
+     * int32_t out = pid.step(target, encoder.readCount(), targetVelocity);
+     * ```
+     */
+    class PIDController {
+    public:
+        static const uint8_t FRAC_BITS = 20;
+
+        explicit PIDController(uint32_t periodUs = 1000);
+
+        /**
+         * @brief Sample period the gains are scaled for (re-scales current gains)
+         */
+        void setPeriod(uint32_t periodUs);
+        uint32_t getPeriod() const { return _period; }
+
+        /**
+         * @brief Continuous-time gains
+         * @param kp Output per count of error
+         * @param ki Output per count-second of accumulated error
+         * @param kd Output per count/s of measurement rate
+         */
+        void setGains(float kp, float ki, float kd);
+
+        /**
+         * @brief Feed-forward terms added to the output
+         * @param kv Output per count/s of commanded velocity
+         * @param ks Static friction offset, applied in the commanded direction
+         */
+        void setFeedForward(float kv, int32_t ks = 0);
+
+        void setOutputLimit(int32_t limit);
+        int32_t getOutputLimit() const { return _limit; }
+
+        /**
+         * @brief Derivative low-pass: 0 = off, n = time constant 2^n samples
+         */
+        void setDerivativeFilter(uint8_t shift) { _dShift = (shift > 15) ? 15 : shift; }
+
+        /**
+         * @brief Clear integral and derivative history at a measurement
+         */
+        void reset(int32_t measurement);
+
+        /**
+         * @brief Run one sample (call exactly once per period)
+         * @param setpoint Target in counts
+         * @param measurement Measured counts
+         * @param velocity Commanded velocity in counts/s (feed-forward)
+         * @return Output, clamped to +/- output limit
+         */
+        int32_t step(int32_t setpoint, int32_t measurement, int32_t velocity = 0);
+
+        int32_t getOutput() const { return _output; }
+        int32_t getError() const { return _error; }
+        int32_t getIntegral() const;                // Integral term in output units
+        bool isSaturated() const { return _saturated; }
+
+    private:
+        uint32_t _period;
+        float _kp, _ki, _kd, _kv;   // As configured (kept for period changes)
+        int64_t _kpQ, _kiQ, _kdQ, _kvQ;
+        int32_t _ks;
+        int32_t _limit;
+
+        int64_t _integral;          // Q(FRAC_BITS) output units
+        int64_t _derivative;        // Filtered D term, Q(FRAC_BITS)
+        int32_t _lastMeasurement;
+        uint8_t _dShift;
+
+        int32_t _output;
+        int32_t _error;
+        bool _saturated;
+
+        void scaleGains();
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_PID_CONTROLLER_H
@@ -0,0 +1,135 @@
+#include "PolarOccupancy.h"
+#include <math.h>
+
+static_assert(TWIST_OCCUPANCY_MAX_SECTORS <= 64, "Sector masks are 64-bit");
+static_assert(TWIST_OCCUPANCY_MAX_SOURCES <= 16, "Coverage masks are 16-bit");
+
+namespace TwiST {
+
+    // Signed difference a - b folded into -180..180
+    static float angleDiff(float a, float b) {
+        float d = fmodf(a - b, 360.0f);
+        if (d > 180.0f) d -= 360.0f;
+        if (d < -180.0f) d += 360.0f;
+        return d;
+    }
+
+    PolarOccupancy::PolarOccupancy(uint8_t sectors)
+        : _sectorCount(0),
+          _sectorWidth(0.0f),
+          _sourceCount(0),
+          _nearest(UNKNOWN),
+          _nearestSource(-1),
+          _sequence(0) {
+        if (!setSectors(sectors)) {
+            setSectors(12);
+        }
+    }
+
+    bool PolarOccupancy::setSectors(uint8_t sectors) {
+        if (sectors == 0 || sectors > TWIST_OCCUPANCY_MAX_SECTORS) return false;
+        _sectorCount = sectors;
+        _sectorWidth = 360.0f / sectors;
+        _sourceCount = 0;
+        for (uint8_t s = 0; s < TWIST_OCCUPANCY_MAX_SECTORS; s++) {
+            _cover[s] = 0;
+            _sector[s] = UNKNOWN;
+        }
+        _nearest = UNKNOWN;
+        _nearestSource = -1;
+        _sequence++;
+        return true;
+    }
+
+    int8_t PolarOccupancy::addSource(float bearingDeg, float beamDeg, float maxRange) {
+        if (_sourceCount >= TWIST_OCCUPANCY_MAX_SOURCES) return -1;
+
+        uint8_t index = _sourceCount;
+        Source& src = _sources[index];
+        src.bearing = bearingDeg;
+        src.maxRange = maxRange;
+        src.sectors = 0;
+        src.timestampMs = 0;
+
+        // A sector is covered when the beam and the sector overlap (always the own sector)
+        float reach = fabsf(beamDeg) / 2.0f + _sectorWidth / 2.0f;
+        for (uint8_t s = 0; s < _sectorCount; s++) {
+            if (fabsf(angleDiff(sectorBearing(s), bearingDeg)) < reach) {
+                src.sectors |= (uint64_t)1 << s;
+            }
+        }
+        src.sectors |= (uint64_t)1 << sectorOf(bearingDeg);
+
+        for (uint8_t s = 0; s < _sectorCount; s++) {
+            if (src.sectors & ((uint64_t)1 << s)) _cover[s] |= (uint16_t)(1u << index);
+        }
+        _reading[index] = UNKNOWN;
+        _sourceCount++;
+        return (int8_t)index;
+    }
+
+    void PolarOccupancy::update(uint8_t source, float range, uint32_t timestampMs) {
+        if (source >= _sourceCount) return;
+        Source& src = _sources[source];
+        if (range <= 0.0f || range > src.maxRange) range = src.maxRange;  // No echo = clear
+        src.timestampMs = timestampMs;
+        _reading[source] = range;
+        refresh(src.sectors);
+    }
+
+    void PolarOccupancy::expire(uint32_t nowMs, uint32_t maxAgeMs) {
+        uint64_t stale = 0;
+        for (uint8_t i = 0; i < _sourceCount; i++) {
+            if (_reading[i] != UNKNOWN && nowMs - _sources[i].timestampMs > maxAgeMs) {
+                _reading[i] = UNKNOWN;
+                stale |= _sources[i].sectors;
+            }
+        }
+        if (stale) refresh(stale);
+    }
+
+    void PolarOccupancy::clear() {
+        uint64_t all = 0;
+        for (uint8_t i = 0; i < _sourceCount; i++) {
+            _reading[i] = UNKNOWN;
+            all |= _sources[i].sectors;
+        }
+        refresh(all);
+    }
+
+    float PolarOccupancy::getNearestBearing() const {
+        return (_nearestSource >= 0) ? _sources[_nearestSource].bearing : 0.0f;
+    }
+
+    uint8_t PolarOccupancy::sectorOf(float bearingDeg) const {
+        float a = fmodf(bearingDeg + _sectorWidth / 2.0f, 360.0f);
+        if (a < 0.0f) a += 360.0f;
+        uint8_t s = (uint8_t)(a / _sectorWidth);
+        return (s >= _sectorCount) ? 0 : s;
+    }
+
+    void PolarOccupancy::refresh(uint64_t sectors) {
+        // Only sectors under the changed beams - each is a min over its few sources
+        for (uint8_t s = 0; s < _sectorCount; s++) {
+            if (!(sectors & ((uint64_t)1 << s))) continue;
+            float best = UNKNOWN;
+            for (uint16_t mask = _cover[s]; mask; mask &= (uint16_t)(mask - 1)) {
+                float r = _reading[__builtin_ctz(mask)];
+                if (r != UNKNOWN && (best == UNKNOWN || r < best)) best = r;
+            }
+            _sector[s] = best;
+        }
+
+        _nearest = UNKNOWN;
+        _nearestSource = -1;
+        for (uint8_t i = 0; i < _sourceCount; i++) {
+            float r = _reading[i];
+            if (r != UNKNOWN && (_nearest == UNKNOWN || r < _nearest)) {
+                _nearest = r;
+                _nearestSource = (int8_t)i;
+            }
+        }
+        _sequence++;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,131 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      PolarOccupancy.h
+ * @brief     Fused polar obstacle map from several range sensors
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Sensor Fusion (no hardware)
+ * - Hardware:     None
+ * - Dependency:   None
+ *
+ * PRINCIPLES:
+ * - Fixed sectors around the robot; each holds the NEAREST obstacle seen
+ *   by any sensor whose beam overlaps it
+ * - Sensor -> sector coverage is precomputed once (bit masks); a new
+ *   reading only recomputes the sectors under that sensor's beam
+ * - Reads are O(1): sector range, range at a bearing, nearest obstacle
+ * - "No echo" means clear up to the sensor's max range; stale or never
+ *   measured sectors are UNKNOWN, never "clear"
+ * - Pure C++ - builds on a host for simulated sensor rings
+ *
+ * CAPABILITIES:
+ * - TWIST_OCCUPANCY_MAX_SOURCES sensors, TWIST_OCCUPANCY_MAX_SECTORS sectors
+ * - Per-sensor bearing and beam width
+ * - Reading age expiry, update sequence counter
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_POLAR_OCCUPANCY_H
+#define TWIST_POLAR_OCCUPANCY_H
+
+#include <stdint.h>
+
+#ifndef TWIST_OCCUPANCY_MAX_SOURCES
+#define TWIST_OCCUPANCY_MAX_SOURCES 8
+#endif
+
+#ifndef TWIST_OCCUPANCY_MAX_SECTORS
+#define TWIST_OCCUPANCY_MAX_SECTORS 36
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Nearest-obstacle-per-sector map
+     *
+     * Bearings in degrees: 0 = forward, positive = counter-clockwise.
+     * Sector i is centered on i * (360 / sectors).
+     *
+     * Example usage:
+     * ```cpp
+     * PolarOccupancy map(12);                       // 30 degree sectors
+     * map.addSource(0.0f, 30.0f, 400.0f);           // Front sensor, 30 deg beam, 4 m
+     * map.addSource(90.0f, 30.0f, 400.0f);          // Left
+     * map.update(0, 85.0f, millis());               // 85 cm ahead
+     * float ahead = map.rangeAt(10.0f);             // O(1)
+     * ```
+     */
+    class PolarOccupancy {
+    public:
+        static constexpr float UNKNOWN = -1.0f;
+
+        explicit PolarOccupancy(uint8_t sectors = 12);
+
+        /**
+         * @brief Change sector count (clears sources and readings)
+         */
+        bool setSectors(uint8_t sectors);
+        uint8_t getSectorCount() const { return _sectorCount; }
+
+        /**
+         * @brief Register a sensor
+         * @return Source index, -1 if full
+         */
+        int8_t addSource(float bearingDeg, float beamDeg, float maxRange);
+        uint8_t getSourceCount() const { return _sourceCount; }
+
+        /**
+         * @brief New reading from a source
+         * @param range Distance, 0 = no echo (clear up to max range)
+         */
+        void update(uint8_t source, float range, uint32_t timestampMs);
+
+        /**
+         * @brief Forget readings older than maxAgeMs (their sectors become UNKNOWN)
+         */
+        void expire(uint32_t nowMs, uint32_t maxAgeMs);
+
+        void clear();
+
+        // O(1) queries
+        float getSectorRange(uint8_t sector) const { return (sector < _sectorCount) ? _sector[sector] : UNKNOWN; }
+        float rangeAt(float bearingDeg) const { return _sector[sectorOf(bearingDeg)]; }
+        float getNearest() const { return _nearest; }           // UNKNOWN if nothing measured
+        float getNearestBearing() const;
+        uint8_t sectorOf(float bearingDeg) const;
+        float sectorBearing(uint8_t sector) const { return sector * _sectorWidth; }
+        float getSourceRange(uint8_t source) const { return (source < _sourceCount) ? _reading[source] : UNKNOWN; }
+        uint32_t getSequence() const { return _sequence; }     // Bumps on every change
+
+    private:
+        struct Source {
+            float bearing;
+            float maxRange;
+            uint64_t sectors;           // Sectors under the beam
+            uint32_t timestampMs;
+        };
+
+        uint8_t _sectorCount;
+        float _sectorWidth;
+        Source _sources[TWIST_OCCUPANCY_MAX_SOURCES];
+        uint8_t _sourceCount;
+        float _reading[TWIST_OCCUPANCY_MAX_SOURCES];    // Latest range per source, UNKNOWN if none
+        uint16_t _cover[TWIST_OCCUPANCY_MAX_SECTORS];   // Sources over each sector
+        float _sector[TWIST_OCCUPANCY_MAX_SECTORS];
+        float _nearest;
+        int8_t _nearestSource;
+        uint32_t _sequence;
+
+        void refresh(uint64_t sectors);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_POLAR_OCCUPANCY_H
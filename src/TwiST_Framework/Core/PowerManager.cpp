@@ -0,0 +1,157 @@
+#include "PowerManager.h"
+#include "Logger.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+
+namespace TwiST {
+
+    void* volatile PowerManager::_loopTask = NULL;
+
+    PowerManager::PowerManager()
+        : _enabled(false),
+          _lightSleep(false),
+          _minSleepUs(TWIST_POWER_MIN_SLEEP_US),
+          _maxSleepUs(TWIST_POWER_MAX_SLEEP_US),
+          _lightSleepUs(TWIST_POWER_LIGHT_SLEEP_US),
+          _wakePinCount(0),
+          _sleeps(0),
+          _lightSleeps(0),
+          _earlyWakes(0),
+          _lastWaitUs(0),
+          _windowStartUs(0),
+          _windowAwakeUs(0),
+          _windowPasses(0),
+          _wokeUs(0),
+          _started(false),
+          _wakeupsPerSecond(0.0f),
+          _dutyCycle(1.0f) {
+    }
+
+    // ===== Configuration =====
+
+    void PowerManager::setSleepLimits(uint32_t minUs, uint32_t maxUs) {
+        if (maxUs < minUs) {
+            Logger::logf(Logger::Level::ERROR, "POWER", "Invalid sleep limits %lu..%lu us",
+                        (unsigned long)minUs, (unsigned long)maxUs);
+            return;
+        }
+        _minSleepUs = minUs;
+        _maxSleepUs = maxUs;
+    }
+
+    void PowerManager::setLightSleep(bool enabled, uint32_t thresholdUs) {
+        _lightSleep = enabled;
+        _lightSleepUs = thresholdUs;
+    }
+
+    bool PowerManager::addWakePin(uint8_t gpio, bool level) {
+        if (_wakePinCount >= TWIST_POWER_MAX_WAKE_PINS) {
+            Logger::logf(Logger::Level::ERROR, "POWER", "Wake pin limit (%d) reached", TWIST_POWER_MAX_WAKE_PINS);
+            return false;
+        }
+        esp_err_t err = gpio_wakeup_enable((gpio_num_t)gpio, level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+        if (err != ESP_OK) {
+            Logger::logf(Logger::Level::ERROR, "POWER", "GPIO %d cannot wake from light sleep (%d)", gpio, (int)err);
+            return false;
+        }
+        if (_wakePinCount == 0) {
+            esp_sleep_enable_gpio_wakeup();
+        }
+        _wakePinCount++;
+        return true;
+    }
+
+    // ===== Loop Hooks =====
+
+    uint32_t PowerManager::idle(uint32_t waitUs) {
+        uint32_t now = micros();
+        if (!_started) {
+            _started = true;
+            _windowStartUs = now;
+            _wokeUs = now;
+            _loopTask = xTaskGetCurrentTaskHandle();  // ISRs notify the task that idles
+        }
+        uint32_t awake = now - _wokeUs;
+        _lastWaitUs = waitUs;
+
+        uint32_t idleUs = 0;
+        if (_enabled && waitUs >= _minSleepUs) {
+            if (waitUs > _maxSleepUs) waitUs = _maxSleepUs;
+            bool early = (_lightSleep && waitUs >= _lightSleepUs) ? enterLightSleep(waitUs) : waitForNotify(waitUs);
+            if (early) _earlyWakes++;
+            uint32_t after = micros();
+            idleUs = after - now;
+            now = after;
+        }
+
+        _wokeUs = now;
+        account(awake, now);
+        return idleUs;
+    }
+
+    void IRAM_ATTR PowerManager::wakeFromISR() {
+        TaskHandle_t task = (TaskHandle_t)_loopTask;
+        if (task == NULL) return;
+        BaseType_t higherPriorityWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &higherPriorityWoken);
+        portYIELD_FROM_ISR(higherPriorityWoken);
+    }
+
+    void PowerManager::wake() {
+        TaskHandle_t task = (TaskHandle_t)_loopTask;
+        if (task != NULL) {
+            xTaskNotifyGive(task);
+        }
+    }
+
+    // ===== Statistics =====
+
+    void PowerManager::resetStatistics() {
+        _sleeps = 0;
+        _lightSleeps = 0;
+        _earlyWakes = 0;
+        _windowStartUs = micros();
+        _windowAwakeUs = 0;
+        _windowPasses = 0;
+        _wakeupsPerSecond = 0.0f;
+        _dutyCycle = 1.0f;
+    }
+
+    // ===== Helpers =====
+
+    bool PowerManager::waitForNotify(uint32_t waitUs) {
+        // Whole ticks, rounded down - an early wake costs one extra pass, a late one misses a deadline
+        TickType_t ticks = pdMS_TO_TICKS(waitUs / 1000);
+        if (ticks == 0) return false;
+        _sleeps++;
+        return ulTaskNotifyTake(pdTRUE, ticks) > 0;
+    }
+
+    bool PowerManager::enterLightSleep(uint32_t waitUs) {
+        Serial.flush();  // UART stops clocking while asleep - finish pending log output
+        esp_sleep_enable_timer_wakeup(waitUs);
+        _sleeps++;
+        _lightSleeps++;
+        esp_light_sleep_start();
+        return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+    }
+
+    void PowerManager::account(uint32_t awakeUs, uint32_t nowUs) {
+        _windowAwakeUs += awakeUs;
+        _windowPasses++;
+
+        uint32_t elapsed = nowUs - _windowStartUs;
+        if (elapsed < 1000000UL) return;
+
+        _wakeupsPerSecond = _windowPasses * 1000000.0f / (float)elapsed;
+        _dutyCycle = (float)_windowAwakeUs / (float)elapsed;
+        if (_dutyCycle > 1.0f) _dutyCycle = 1.0f;
+        _windowStartUs = nowUs;
+        _windowAwakeUs = 0;
+        _windowPasses = 0;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,157 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      PowerManager.h
+ * @brief     Power-aware idle between loop deadlines, with wake statistics
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (owned by TwiSTFramework)
+ * - Hardware:     FreeRTOS task notification, ESP32 light sleep (optional)
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - The framework asks devices, bridges and services how long they can
+ *   wait (getTimeUntilUpdate) and idles for the shortest answer
+ * - Default idle is a task-notification wait: other tasks keep running,
+ *   FreeRTOS tickless idle may light-sleep on its own, and any ISR can
+ *   end the wait early with wakeFromISR()
+ * - Explicit light sleep is opt-in - it stops every task and most
+ *   peripherals, so only GPIOs registered with addWakePin() can wake it
+ * - Off by default: idle() returns immediately until setEnabled(true)
+ *
+ * CAPABILITIES:
+ * - Min / max idle limits (short waits spin, long waits are capped)
+ * - Loop wakeups per second and awake duty cycle (1 s window)
+ * - Sleep / light sleep / early-wake counters
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_POWER_MANAGER_H
+#define TWIST_POWER_MANAGER_H
+
+#include "../TwiST_Config.h"
+#include <stdint.h>
+
+// GPIOs that can end a light sleep
+#ifndef TWIST_POWER_MAX_WAKE_PINS
+#define TWIST_POWER_MAX_WAKE_PINS 8
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Idles the loop task until the next deadline
+     *
+     * TwiSTFramework computes the deadline; applications enable it and read
+     * the statistics.
+     *
+     * Example:
+     * ```cpp
+     * framework.power().setEnabled(true);
+     * framework.power().addWakePin(9, false);   // Button to GND (light sleep only)
+     *
+     * void loop() {
+     *     framework.update();
+     *     framework.idle();                      // Sleeps until something is due
+     * }
+     * ```
+     */
+    class PowerManager {
+    public:
+        PowerManager();
+
+        // ===== Configuration =====
+
+        void setEnabled(bool enabled) { _enabled = enabled; }
+        bool isEnabled() const { return _enabled; }
+
+        /**
+         * @brief Waits below minUs are skipped, waits above maxUs are capped
+         *        (keep maxUs well under the watchdog timeout)
+         */
+        void setSleepLimits(uint32_t minUs, uint32_t maxUs);
+
+        /**
+         * @brief Use esp_light_sleep_start() for waits of at least thresholdUs
+         */
+        void setLightSleep(bool enabled, uint32_t thresholdUs = TWIST_POWER_LIGHT_SLEEP_US);
+        bool isLightSleepEnabled() const { return _lightSleep; }
+
+        /**
+         * @brief Let a GPIO level end a light sleep
+         * @param gpio Input pin (already configured by its driver)
+         * @param level Level that wakes (true = high)
+         * @return false if full or rejected by the GPIO driver
+         */
+        bool addWakePin(uint8_t gpio, bool level);
+
+        // ===== Loop Hooks (called by framework) =====
+
+        /**
+         * @brief Close the pass and wait up to waitUs
+         * @param waitUs Time until the earliest deadline (0 = none to spare)
+         * @return Microseconds actually spent idle
+         */
+        uint32_t idle(uint32_t waitUs);
+
+        /**
+         * @brief End an idle wait early (ISR context)
+         */
+        static void wakeFromISR();
+
+        /**
+         * @brief End an idle wait early (another task)
+         */
+        static void wake();
+
+        // ===== Statistics =====
+
+        float getWakeupsPerSecond() const { return _wakeupsPerSecond; }  // Loop passes, last window
+        float getDutyCycle() const { return _dutyCycle; }                // Awake fraction, last window (1.0 = never idles)
+        unsigned long getSleepCount() const { return _sleeps; }
+        unsigned long getLightSleepCount() const { return _lightSleeps; }
+        unsigned long getEarlyWakeCount() const { return _earlyWakes; }  // Ended by an interrupt, not the deadline
+        uint32_t getLastWait() const { return _lastWaitUs; }             // Deadline handed to the last idle()
+
+        void resetStatistics();
+
+    private:
+        bool _enabled;
+        bool _lightSleep;
+        uint32_t _minSleepUs;
+        uint32_t _maxSleepUs;
+        uint32_t _lightSleepUs;
+
+        uint8_t _wakePinCount;
+
+        unsigned long _sleeps;
+        unsigned long _lightSleeps;
+        unsigned long _earlyWakes;
+        uint32_t _lastWaitUs;
+
+        // Statistics window
+        uint32_t _windowStartUs;
+        uint32_t _windowAwakeUs;
+        uint32_t _windowPasses;
+        uint32_t _wokeUs;           // End of the last idle (start of the current pass)
+        bool _started;
+        float _wakeupsPerSecond;
+        float _dutyCycle;
+
+        bool waitForNotify(uint32_t waitUs);
+        bool enterLightSleep(uint32_t waitUs);
+        void account(uint32_t awakeUs, uint32_t nowUs);
+
+        // Single framework loop per firmware - shared with ISRs
+        static void* volatile _loopTask;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_POWER_MANAGER_H
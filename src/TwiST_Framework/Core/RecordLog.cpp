@@ -0,0 +1,79 @@
+#include "RecordLog.h"
+
+namespace TwiST {
+
+    // ===== Encoding =====
+
+    void RecordLog::writeHeader(uint8_t* out) {
+        out[0] = 'T';
+        out[1] = 'W';
+        out[2] = 'R';
+        out[3] = 'L';
+        out[4] = (uint8_t)(VERSION & 0xFF);
+        out[5] = (uint8_t)(VERSION >> 8);
+        out[6] = (uint8_t)(RECORD_SIZE & 0xFF);
+        out[7] = (uint8_t)(RECORD_SIZE >> 8);
+    }
+
+    void RecordLog::writeRecord(const RecordEntry& entry, uint8_t* out) {
+        out[0] = (uint8_t)(entry.timestampUs & 0xFF);
+        out[1] = (uint8_t)(entry.timestampUs >> 8);
+        out[2] = (uint8_t)(entry.timestampUs >> 16);
+        out[3] = (uint8_t)(entry.timestampUs >> 24);
+        out[4] = (uint8_t)((entry.kind & 0x0F) | ((entry.channel & 0x0F) << 4));
+        out[5] = entry.stream;
+        out[6] = (uint8_t)(entry.value & 0xFF);
+        out[7] = (uint8_t)(entry.value >> 8);
+    }
+
+    RecordEntry RecordLog::readRecord(const uint8_t* in) {
+        RecordEntry entry;
+        entry.timestampUs = (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+                            ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+        entry.kind = (RecordKind)(in[4] & 0x0F);
+        entry.channel = in[4] >> 4;
+        entry.stream = in[5];
+        entry.value = (uint16_t)in[6] | ((uint16_t)in[7] << 8);
+        return entry;
+    }
+
+    // ===== Reader =====
+
+    RecordLogReader::RecordLogReader(const uint8_t* data, size_t length)
+        : _records(NULL),
+          _count(0),
+          _valid(false) {
+
+        if (data == NULL || length < RecordLog::HEADER_SIZE) {
+            return;
+        }
+
+        uint16_t version = (uint16_t)data[4] | ((uint16_t)data[5] << 8);
+        uint16_t recordSize = (uint16_t)data[6] | ((uint16_t)data[7] << 8);
+
+        if (data[0] != 'T' || data[1] != 'W' || data[2] != 'R' || data[3] != 'L' ||
+            version != RecordLog::VERSION || recordSize != RecordLog::RECORD_SIZE) {
+            return;
+        }
+
+        _records = data + RecordLog::HEADER_SIZE;
+        _count = (length - RecordLog::HEADER_SIZE) / RecordLog::RECORD_SIZE;  // Ignore torn tail
+        _valid = true;
+    }
+
+    RecordEntry RecordLogReader::at(size_t index) const {
+        return RecordLog::readRecord(_records + index * RecordLog::RECORD_SIZE);
+    }
+
+    bool RecordLogReader::findNext(RecordKind kind, uint8_t stream, size_t& position) const {
+        for (size_t i = position; i < _count; i++) {
+            const uint8_t* rec = _records + i * RecordLog::RECORD_SIZE;
+            if ((rec[4] & 0x0F) == kind && rec[5] == stream) {
+                position = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+}  // namespace TwiST
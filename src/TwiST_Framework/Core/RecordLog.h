@@ -0,0 +1,157 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      RecordLog.h
+ * @brief     Compact append-only log format for recorded driver I/O
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Log Format + Reader (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - recordings replay on a host PC unchanged
+ * - Fixed 8-byte records - trivially seekable, no parsing state
+ * - Records identify (kind, stream, channel) - NOT device names
+ * - Reader works on a memory buffer (zero heap allocation)
+ *
+ * FILE LAYOUT (little-endian):
+ *   header  "TWRL" + u16 version + u16 record size          (8 bytes)
+ *   record  u32 timestampUs
+ *           u8  kind (low nibble) | channel (high nibble)
+ *           u8  stream (driver index)
+ *           u16 value (ADC raw, distance in 0.1 cm, PWM ticks)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_RECORD_LOG_H
+#define TWIST_RECORD_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace TwiST {
+
+    // What a record captured
+    enum RecordKind : uint8_t {
+        RECORD_ADC_READ      = 1,   // IADCDriver::readRaw()
+        RECORD_DISTANCE_READ = 2,   // IDistanceDriver::readDistanceCm() (0.1 cm units)
+        RECORD_PWM_SET       = 3    // IPWMDriver::setPWM()
+    };
+
+    // One decoded record
+    struct RecordEntry {
+        uint32_t timestampUs;
+        RecordKind kind;
+        uint8_t channel;    // PWM channel (0-15), 0 for inputs
+        uint8_t stream;     // Driver index within its kind
+        uint16_t value;
+    };
+
+    /**
+     * @brief Destination for recorded driver I/O
+     *
+     * Implemented by DriverRecorder (LittleFS) - recording drivers only
+     * know this interface. The sink adds the timestamp.
+     */
+    class IRecordSink {
+    public:
+        virtual ~IRecordSink() = default;
+
+        /**
+         * @brief Append one record
+         * @param kind Record kind
+         * @param stream Driver index
+         * @param channel PWM channel (0-15), 0 for inputs
+         * @param value Recorded value
+         */
+        virtual void record(RecordKind kind, uint8_t stream, uint8_t channel, uint16_t value) = 0;
+    };
+
+    namespace RecordLog {
+        static constexpr uint16_t VERSION = 1;
+        static constexpr size_t HEADER_SIZE = 8;
+        static constexpr size_t RECORD_SIZE = 8;
+
+        // Distance values are stored in 0.1 cm steps
+        static constexpr float DISTANCE_SCALE = 10.0f;
+
+        /**
+         * @brief Write file header
+         * @param out Buffer (>= HEADER_SIZE bytes)
+         */
+        void writeHeader(uint8_t* out);
+
+        /**
+         * @brief Encode one record
+         * @param entry Record to encode
+         * @param out Buffer (>= RECORD_SIZE bytes)
+         */
+        void writeRecord(const RecordEntry& entry, uint8_t* out);
+
+        /**
+         * @brief Decode one record
+         * @param in Buffer (>= RECORD_SIZE bytes)
+         * @return Decoded record
+         */
+        RecordEntry readRecord(const uint8_t* in);
+    }
+
+    /**
+     * @brief Read-only view over a recording held in memory
+     *
+     * Example (host):
+     * ```cpp
+     * RecordLogReader log(fileBytes, fileSize);
+     * Drivers::ReplayADC x(log, 0), y(log, 1);
+     * Devices::Joystick stick(x, y, 200, "Replay", bus);
+     * ```
+     */
+    class RecordLogReader {
+    public:
+        /**
+         * @param data Complete log file contents (header + records)
+         * @param length Number of bytes
+         */
+        RecordLogReader(const uint8_t* data, size_t length);
+
+        /**
+         * @brief Check header magic/version
+         * @return true if the buffer holds a readable log
+         */
+        bool isValid() const { return _valid; }
+
+        /**
+         * @brief Get number of complete records
+         */
+        size_t getRecordCount() const { return _count; }
+
+        /**
+         * @brief Get record by index (must be < getRecordCount())
+         */
+        RecordEntry at(size_t index) const;
+
+        /**
+         * @brief Find next record of (kind, stream) at or after position
+         * @param kind Record kind
+         * @param stream Driver index
+         * @param position Search start; updated to the match index
+         * @return true if found
+         */
+        bool findNext(RecordKind kind, uint8_t stream, size_t& position) const;
+
+    private:
+        const uint8_t* _records;
+        size_t _count;
+        bool _valid;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_RECORD_LOG_H
@@ -0,0 +1,84 @@
+#include "ReplicationCodec.h"
+#include "CommandProtocol.h"  // Little-endian field helpers
+
+namespace TwiST {
+
+    // ===== ReplicationWriter =====
+
+    ReplicationWriter::ReplicationWriter(uint8_t* payload, size_t capacity, uint8_t node,
+                                         uint16_t sequence, uint8_t flags)
+        : _data(payload),
+          _capacity(capacity),
+          _position(ReplicationCodec::HEADER_SIZE) {
+        _data[0] = node;
+        CommandProtocol::putU16(_data + 1, sequence);
+        _data[3] = flags;
+        _data[4] = 0;   // Reserved
+        _data[5] = 0;   // Count
+    }
+
+    bool ReplicationWriter::add(const RemoteState& state) {
+        uint8_t axes = (state.axisCount > TWIST_REMOTE_MAX_AXES) ? TWIST_REMOTE_MAX_AXES : state.axisCount;
+        size_t size = ReplicationCodec::entrySize(axes);
+        if (_data[5] == 255 || _position + size > _capacity) {
+            return false;
+        }
+
+        uint8_t* p = _data + _position;
+        CommandProtocol::putU16(p, state.deviceId);
+        p[2] = state.state;
+        p[3] = state.flags;
+        p[4] = axes;
+        for (uint8_t i = 0; i < axes; i++) {
+            CommandProtocol::putF32(p + ReplicationCodec::ENTRY_BASE_SIZE + 4 * i, state.values[i]);
+        }
+
+        _position += size;
+        _data[5]++;
+        return true;
+    }
+
+    // ===== ReplicationReader =====
+
+    ReplicationReader::ReplicationReader(const uint8_t* payload, size_t length)
+        : _data(payload),
+          _length(length),
+          _position(ReplicationCodec::HEADER_SIZE),
+          _decoded(0),
+          _valid(payload != NULL && length >= ReplicationCodec::HEADER_SIZE) {
+    }
+
+    uint16_t ReplicationReader::getSequence() const {
+        return CommandProtocol::getU16(_data + 1);
+    }
+
+    bool ReplicationReader::next(RemoteState& out) {
+        if (!_valid || _decoded >= getCount()) return false;
+
+        size_t remaining = _length - _position;
+        if (remaining < ReplicationCodec::ENTRY_BASE_SIZE) {
+            _valid = false;
+            return false;
+        }
+
+        const uint8_t* p = _data + _position;
+        uint8_t axes = p[4];
+        if (axes > TWIST_REMOTE_MAX_AXES || remaining < ReplicationCodec::entrySize(axes)) {
+            _valid = false;
+            return false;
+        }
+
+        out.deviceId = CommandProtocol::getU16(p);
+        out.state = p[2];
+        out.flags = p[3];
+        out.axisCount = axes;
+        for (uint8_t i = 0; i < axes; i++) {
+            out.values[i] = CommandProtocol::getF32(p + ReplicationCodec::ENTRY_BASE_SIZE + 4 * i);
+        }
+
+        _position += ReplicationCodec::entrySize(axes);
+        _decoded++;
+        return true;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,99 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      ReplicationCodec.h
+ * @brief     Sequence-numbered device state batches between framework nodes
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Protocol Codec (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - host tools decode the same frames
+ * - One batch per frame: only changed devices (delta) or all of them (full)
+ * - Sequence numbers let the receiver detect loss and request a full batch
+ * - Bounds-checked decoding, in place
+ *
+ * REPLICATION PAYLOAD (WIRE_REPLICATION frame):
+ *   u8 node, u16 sequence, u8 flags, u8 count, then per device:
+ *   u16 id, u8 state, u8 flags, u8 axisCount, axisCount x f32
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_REPLICATION_CODEC_H
+#define TWIST_REPLICATION_CODEC_H
+
+#include "../Interfaces/IDeviceLink.h"
+#include <stddef.h>
+
+namespace TwiST {
+
+    namespace ReplicationCodec {
+        static constexpr size_t HEADER_SIZE = 6;
+        static constexpr size_t ENTRY_BASE_SIZE = 5;
+
+        static constexpr uint8_t FLAG_FULL = 0x01;          // Batch holds every exported device
+        static constexpr uint8_t FLAG_REQUEST_FULL = 0x02;  // Sender lost data - peer should send full
+
+        inline size_t entrySize(uint8_t axisCount) { return ENTRY_BASE_SIZE + 4 * (size_t)axisCount; }
+    }
+
+    /**
+     * @brief Builds one replication batch
+     */
+    class ReplicationWriter {
+    public:
+        ReplicationWriter(uint8_t* payload, size_t capacity, uint8_t node, uint16_t sequence, uint8_t flags);
+
+        /**
+         * @brief Append one device state
+         * @return false if the batch is full (state not written)
+         */
+        bool add(const RemoteState& state);
+
+        size_t length() const { return _position; }
+        uint8_t getCount() const { return _data[5]; }
+
+    private:
+        uint8_t* _data;
+        size_t _capacity;
+        size_t _position;
+    };
+
+    /**
+     * @brief Iterates a received replication batch
+     */
+    class ReplicationReader {
+    public:
+        ReplicationReader(const uint8_t* payload, size_t length);
+
+        bool isValid() const { return _valid; }
+        uint8_t getNode() const { return _data[0]; }
+        uint16_t getSequence() const;
+        uint8_t getFlags() const { return _data[3]; }
+        uint8_t getCount() const { return _data[5]; }
+
+        /**
+         * @brief Decode next device state
+         * @return false when done or truncated
+         */
+        bool next(RemoteState& out);
+
+    private:
+        const uint8_t* _data;
+        size_t _length;
+        size_t _position;
+        uint8_t _decoded;
+        bool _valid;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_REPLICATION_CODEC_H
@@ -0,0 +1,266 @@
+#include "SafetySupervisor.h"
+#include "Logger.h"
+#include <Arduino.h>
+#include <math.h>
+
+namespace TwiST {
+
+    SafetySupervisor::SafetySupervisor(EventBus& eventBus, float budgetMa)
+        : _eventBus(eventBus),
+          _outputCount(0),
+          _budgetMa(budgetMa),
+          _minThrottle(0.25f),
+          _stallTolerance(15.0f),
+          _stallTimeMs(500),
+          _disableOnStall(true),
+          _lastUpdateMs(0),
+          _estimatedMa(0.0f),
+          _peakMa(0.0f),
+          _overloaded(false),
+          _granted(0),
+          _throttled(0),
+          _deferred(0),
+          _overloads(0),
+          _stalls(0) {
+    }
+
+    // ===== Configuration =====
+
+    bool SafetySupervisor::supervise(IOutputDevice& output, const ServoLoadModel& model) {
+        DeviceInfo info = output.getInfo();
+        if (find(info.id) != NULL) {
+            Logger::logf(Logger::Level::ERROR, "SAFETY", "Device %u already supervised", info.id);
+            return false;
+        }
+        if (_outputCount >= TWIST_SAFETY_MAX_OUTPUTS) {
+            Logger::error("SAFETY", "Output limit reached");
+            return false;
+        }
+
+        Supervised& entry = _outputs[_outputCount++];
+        entry.output = &output;
+        entry.id = info.id;
+        entry.model = model;
+        entry.granted = false;
+        entry.grantStart = 0;
+        entry.grantMs = 0;
+        entry.grantDps = 0.0f;
+        entry.waiting = false;
+        entry.lastValue = output.getValue();
+        entry.observedDps = 0.0f;
+        entry.feedback = NULL;
+        entry.axis = 0;
+        entry.feedbackAtZero = 0.0f;
+        entry.feedbackAtOne = 0.0f;
+        entry.mismatching = false;
+        entry.mismatchSince = 0;
+        entry.stalled = false;
+        return true;
+    }
+
+    bool SafetySupervisor::attachFeedback(uint16_t deviceId, IInputDevice& feedback, uint8_t axis,
+                                          float valueAtZero, float valueAtOne) {
+        Supervised* entry = find(deviceId);
+        if (entry == NULL) {
+            Logger::logf(Logger::Level::ERROR, "SAFETY", "Feedback for unsupervised device %u", deviceId);
+            return false;
+        }
+        entry->feedback = &feedback;
+        entry->axis = axis;
+        entry->feedbackAtZero = valueAtZero;
+        entry->feedbackAtOne = valueAtOne;
+        entry->mismatching = false;
+        entry->stalled = false;
+        return true;
+    }
+
+    void SafetySupervisor::setStallDetection(float tolerance, unsigned long timeMs, bool disableOnStall) {
+        _stallTolerance = tolerance;
+        _stallTimeMs = timeMs;
+        _disableOnStall = disableOnStall;
+    }
+
+    // ===== IMotionSupervisor =====
+
+    bool SafetySupervisor::requestMove(uint16_t deviceId, float from, float to, unsigned long& durationMs) {
+        Supervised* entry = find(deviceId);
+        if (entry == NULL) return true;  // Not supervised - unchanged behavior
+
+        float distance = fabsf(to - from);
+        if (distance <= 0.0f) return true;
+
+        unsigned long now = millis();
+        const ServoLoadModel& model = entry->model;
+
+        // A servo cannot slew faster than its own maximum
+        float dps = (durationMs > 0) ? distance * 1000.0f / (float)durationMs : model.maxSpeedDps;
+        if (dps > model.maxSpeedDps) dps = model.maxSpeedDps;
+
+        float others = 0.0f;
+        bool othersMoving = false;
+        for (uint8_t i = 0; i < _outputCount; i++) {
+            Supervised& other = _outputs[i];
+            if (&other == entry) continue;
+            others += drawOf(other, now);
+            if (other.granted) othersMoving = true;
+        }
+
+        float available = _budgetMa - others;
+        if (model.currentAt(dps) <= available) {
+            grant(*entry, now, distance, dps, durationMs);
+            return true;
+        }
+
+        // Throttle: slowest speed the remaining budget allows
+        float allowedDps = (model.maPerDps > 0.0f) ? (available - model.idleMa) / model.maPerDps : 0.0f;
+        if (allowedDps > 0.0f && (allowedDps >= dps * _minThrottle || !othersMoving)) {
+            durationMs = (unsigned long)ceilf(distance * 1000.0f / allowedDps);
+            grant(*entry, now, distance, allowedDps, durationMs);
+            _throttled++;
+            return true;
+        }
+
+        if (!othersMoving) {
+            // Nothing will free budget by waiting - start anyway, overload is reported
+            grant(*entry, now, distance, dps, durationMs);
+            return true;
+        }
+
+        // Stagger: wait until a running move releases its share
+        if (!entry->waiting) {
+            entry->waiting = true;
+            _deferred++;
+        }
+        return false;
+    }
+
+    void SafetySupervisor::releaseMove(uint16_t deviceId) {
+        Supervised* entry = find(deviceId);
+        if (entry != NULL && entry->granted) {
+            endGrant(*entry);
+        }
+    }
+
+    // ===== IService =====
+
+    void SafetySupervisor::update() {
+        unsigned long now = millis();
+        float dt = (_lastUpdateMs != 0) ? (now - _lastUpdateMs) / 1000.0f : 0.0f;
+        _lastUpdateMs = now;
+
+        float total = 0.0f;
+        for (uint8_t i = 0; i < _outputCount; i++) {
+            Supervised& entry = _outputs[i];
+
+            // Observed speed of whatever drives the output (capped: servo slews at most this fast)
+            float value = entry.output->getValue();
+            if (dt > 0.0f) {
+                float dps = fabsf(value - entry.lastValue) / dt;
+                if (dps > entry.model.maxSpeedDps) dps = entry.model.maxSpeedDps;
+                entry.observedDps = 0.5f * entry.observedDps + 0.5f * dps;
+            }
+            entry.lastValue = value;
+
+            total += drawOf(entry, now);
+            checkStall(entry, now);
+        }
+
+        _estimatedMa = total;
+        if (total > _peakMa) _peakMa = total;
+
+        // Hysteresis - one event per overload episode
+        if (!_overloaded && total > _budgetMa) {
+            _overloaded = true;
+            _overloads++;
+            Logger::logf(Logger::Level::WARNING, "SAFETY", "Estimated load %.0f mA over budget %.0f mA",
+                        total, _budgetMa);
+            publish("safety.overload", 0, now);
+        } else if (_overloaded && total < _budgetMa * 0.9f) {
+            _overloaded = false;
+        }
+    }
+
+    // ===== Private Helpers =====
+
+    SafetySupervisor::Supervised* SafetySupervisor::find(uint16_t deviceId) {
+        for (uint8_t i = 0; i < _outputCount; i++) {
+            if (_outputs[i].id == deviceId) return &_outputs[i];
+        }
+        return NULL;
+    }
+
+    float SafetySupervisor::drawOf(Supervised& entry, unsigned long now) {
+        // Grants expire on their own - a paused or replaced move must not hold budget forever
+        if (entry.granted && (now - entry.grantStart) >= entry.grantMs) {
+            endGrant(entry);
+        }
+        float dps = entry.granted ? entry.grantDps : entry.observedDps;
+        return entry.model.currentAt(dps);
+    }
+
+    void SafetySupervisor::grant(Supervised& entry, unsigned long now, float distance, float dps,
+                                 unsigned long durationMs) {
+        entry.granted = true;
+        entry.waiting = false;
+        entry.grantStart = now;
+        entry.grantDps = dps;
+        // A jump still takes the servo distance / maxSpeed to physically complete
+        entry.grantMs = (durationMs > 0) ? durationMs
+                                         : (unsigned long)ceilf(distance * 1000.0f / entry.model.maxSpeedDps);
+        _granted++;
+    }
+
+    void SafetySupervisor::endGrant(Supervised& entry) {
+        // The motion observed so far was the granted move - it must not linger as load
+        entry.granted = false;
+        entry.observedDps = 0.0f;
+        entry.lastValue = entry.output->getValue();
+    }
+
+    void SafetySupervisor::checkStall(Supervised& entry, unsigned long now) {
+        if (entry.feedback == NULL || !entry.output->isEnabled()) {
+            entry.mismatching = false;
+            entry.stalled = false;  // Re-enabling re-arms detection
+            return;
+        }
+
+        float measured = entry.feedbackAtZero +
+                         entry.feedback->readAnalog(entry.axis) * (entry.feedbackAtOne - entry.feedbackAtZero);
+        float error = fabsf(measured - entry.output->getValue());
+
+        if (error <= _stallTolerance) {
+            entry.mismatching = false;
+            entry.stalled = false;
+            return;
+        }
+
+        if (!entry.mismatching) {
+            entry.mismatching = true;
+            entry.mismatchSince = now;
+            return;
+        }
+
+        if (!entry.stalled && (now - entry.mismatchSince) >= _stallTimeMs) {
+            entry.stalled = true;
+            _stalls++;
+            Logger::logf(Logger::Level::ERROR, "SAFETY", "Stall on %s: commanded %.1f, measured %.1f",
+                        entry.output->getName(), entry.output->getValue(), measured);
+            if (_disableOnStall) {
+                entry.output->disable();
+            }
+            publish("safety.stall", entry.id, now);
+        }
+    }
+
+    void SafetySupervisor::publish(const char* name, uint16_t source, unsigned long now) {
+        Event event = {
+            .name = name,
+            .sourceDeviceId = source,
+            .data = NULL,
+            .priority = PRIORITY_CRITICAL,
+            .timestamp = now
+        };
+        _eventBus.publish(event);
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,202 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      SafetySupervisor.h
+ * @brief     Servo supply budget (move admission) and stall detection
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService, SERVICE_AFTER_BRIDGES)
+ * - Hardware:     None (observes IOutputDevice / IInputDevice)
+ * - Implements:   IService, IMotionSupervisor
+ *
+ * PRINCIPLES:
+ * - Load is ESTIMATED from commanded angular velocity - no current sensor
+ *   (idle + mA per deg/s, capped at stall current, per output)
+ * - Timed moves ask first (Servo -> IMotionSupervisor): a move that would
+ *   push the estimate over budget starts slower or waits for others to end
+ * - Streaming setValue() writes are not gated; their observed speed still
+ *   counts, and an over-budget estimate raises an overload event
+ * - Stall = optional feedback input disagrees with the command for too long
+ * - Problems are published as PRIORITY_CRITICAL events
+ *
+ * EVENTS:
+ * - "safety.overload" (source 0)      - estimate above budget
+ * - "safety.stall"    (source output) - feedback mismatch; output disabled
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_SAFETY_SUPERVISOR_H
+#define TWIST_SAFETY_SUPERVISOR_H
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/IMotionSupervisor.h"
+#include "../Interfaces/IOutputDevice.h"
+#include "../Interfaces/IInputDevice.h"
+#include "EventBus.h"
+
+// Outputs one supervisor can watch
+#ifndef TWIST_SAFETY_MAX_OUTPUTS
+#define TWIST_SAFETY_MAX_OUTPUTS 16
+#endif
+
+namespace TwiST {
+
+    /**
+     * @brief Linear supply-current model of one servo
+     *
+     * draw = idleMa + maPerDps * |speed|, never above stallMa.
+     * Defaults fit SG90/MG90-class servos on 5 V.
+     */
+    struct ServoLoadModel {
+        float idleMa = 10.0f;        // Holding, not moving
+        float maPerDps = 1.5f;       // Extra draw per deg/s
+        float stallMa = 700.0f;      // Upper bound (stall / hard acceleration)
+        float maxSpeedDps = 400.0f;  // Speed of an un-timed jump
+
+        float currentAt(float dps) const {
+            float ma = idleMa + maPerDps * dps;
+            return (ma > stallMa) ? stallMa : ma;
+        }
+    };
+
+    /**
+     * @brief Safety supervisor service
+     *
+     * Example usage:
+     * ```cpp
+     * SafetySupervisor safety(framework.eventBus(), 1500.0f);  // 1.5 A for servos
+     * for (uint8_t i = 0; i < App::getServoCount(); i++) {
+     *     safety.supervise(App::getServo(i));
+     *     App::getServo(i).setMotionSupervisor(&safety);
+     * }
+     * safety.attachFeedback(SERVO_ID, feedbackPot, 0, 0.0f, 180.0f);
+     * framework.addService(&safety, SERVICE_AFTER_BRIDGES);
+     * ```
+     */
+    class SafetySupervisor : public IService, public IMotionSupervisor {
+    public:
+        /**
+         * @param eventBus Bus for CRITICAL safety events
+         * @param budgetMa Supply current available to supervised outputs
+         */
+        SafetySupervisor(EventBus& eventBus, float budgetMa);
+
+        // ===== Configuration =====
+
+        /**
+         * @brief Include an output in the load estimate
+         * @return false if already supervised or table full
+         */
+        bool supervise(IOutputDevice& output, const ServoLoadModel& model = ServoLoadModel());
+
+        /**
+         * @brief Compare an input against a supervised output for stall detection
+         * @param deviceId Supervised output
+         * @param feedback Position feedback (e.g. servo potentiometer tap)
+         * @param axis Feedback axis
+         * @param valueAtZero Output value when feedback reads 0.0
+         * @param valueAtOne Output value when feedback reads 1.0
+         */
+        bool attachFeedback(uint16_t deviceId, IInputDevice& feedback, uint8_t axis,
+                            float valueAtZero, float valueAtOne);
+
+        void setBudget(float budgetMa) { _budgetMa = budgetMa; }
+        float getBudget() const { return _budgetMa; }
+
+        /**
+         * @brief Slowest acceptable throttle as a fraction of requested speed
+         *
+         * Below this a move is deferred instead of crawling (default 0.25).
+         */
+        void setMinThrottle(float fraction) { _minThrottle = fraction; }
+
+        /**
+         * @brief Stall = |feedback - command| > tolerance for timeMs
+         */
+        void setStallDetection(float tolerance, unsigned long timeMs, bool disableOnStall = true);
+
+        // ===== IMotionSupervisor =====
+        bool requestMove(uint16_t deviceId, float from, float to, unsigned long& durationMs) override;
+        void releaseMove(uint16_t deviceId) override;
+
+        // ===== IService =====
+        void update() override;
+        const char* getName() const override { return "SafetySupervisor"; }
+
+        // Statistics
+        float getEstimatedLoad() const { return _estimatedMa; }
+        float getPeakLoad() const { return _peakMa; }
+        bool isOverloaded() const { return _overloaded; }
+        uint8_t getOutputCount() const { return _outputCount; }
+        unsigned long getGrantedCount() const { return _granted; }
+        unsigned long getThrottledCount() const { return _throttled; }
+        unsigned long getDeferredCount() const { return _deferred; }
+        unsigned long getOverloadCount() const { return _overloads; }
+        unsigned long getStallCount() const { return _stalls; }
+        void resetPeak() { _peakMa = _estimatedMa; }
+
+    private:
+        struct Supervised {
+            IOutputDevice* output;
+            uint16_t id;
+            ServoLoadModel model;
+
+            // Active grant
+            bool granted;
+            unsigned long grantStart;
+            unsigned long grantMs;
+            float grantDps;
+            bool waiting;               // Deferred, not yet granted
+
+            // Observed motion (ungated setValue streams)
+            float lastValue;
+            float observedDps;
+
+            // Stall detection
+            IInputDevice* feedback;
+            uint8_t axis;
+            float feedbackAtZero;
+            float feedbackAtOne;
+            bool mismatching;
+            unsigned long mismatchSince;
+            bool stalled;
+        };
+
+        EventBus& _eventBus;
+        Supervised _outputs[TWIST_SAFETY_MAX_OUTPUTS];
+        uint8_t _outputCount;
+
+        float _budgetMa;
+        float _minThrottle;
+        float _stallTolerance;
+        unsigned long _stallTimeMs;
+        bool _disableOnStall;
+
+        unsigned long _lastUpdateMs;
+        float _estimatedMa;
+        float _peakMa;
+        bool _overloaded;
+
+        unsigned long _granted;
+        unsigned long _throttled;
+        unsigned long _deferred;
+        unsigned long _overloads;
+        unsigned long _stalls;
+
+        Supervised* find(uint16_t deviceId);
+        float drawOf(Supervised& entry, unsigned long now);
+        void grant(Supervised& entry, unsigned long now, float distance, float dps, unsigned long durationMs);
+        void endGrant(Supervised& entry);
+        void checkStall(Supervised& entry, unsigned long now);
+        void publish(const char* name, uint16_t source, unsigned long now);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_SAFETY_SUPERVISOR_H
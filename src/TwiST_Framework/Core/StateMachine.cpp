@@ -0,0 +1,391 @@
+#include "StateMachine.h"
+#include "Logger.h"
+#include <Arduino.h>
+#include <string.h>
+
+namespace TwiST {
+
+    static_assert(TWIST_HSM_MAX_STATES > 0 && TWIST_HSM_MAX_STATES < HSM_NO_STATE,
+                  "TWIST_HSM_MAX_STATES must be 1..254");
+    static_assert(TWIST_HSM_MAX_TRANSITIONS < 256, "TWIST_HSM_MAX_TRANSITIONS must be 0..255");
+    static_assert(TWIST_HSM_MAX_EVENTS > 0 && TWIST_HSM_MAX_EVENTS < 256, "TWIST_HSM_MAX_EVENTS must be 1..255");
+
+    StateMachine::StateMachine(EventBus& eventBus, DeviceRegistry* registry,
+                               const StateDef* states, uint8_t stateCount,
+                               const TransitionDef* transitions, uint8_t transitionCount,
+                               void* context)
+        : _eventBus(eventBus),
+          _registry(registry),
+          _states(states),
+          _defs(transitions),
+          _stateCount(stateCount),
+          _defCount(transitionCount),
+          _context(context),
+          _topicCount(0),
+          _current(HSM_NO_STATE),
+          _started(false),
+          _dispatching(false),
+          _deferHead(0),
+          _deferCount(0),
+          _transitionsFired(0),
+          _dispatched(0),
+          _unhandled(0),
+          _deferDropped(0) {
+        memset(_entries, 0, sizeof(_entries));
+        memset(_residencyUs, 0, sizeof(_residencyUs));
+        memset(_enteredAtUs, 0, sizeof(_enteredAtUs));
+        memset(_fired, 0, sizeof(_fired));
+    }
+
+    StateMachine::~StateMachine() {
+        if (!_started) return;
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            _eventBus.unsubscribe(_topics[i].listenerId);
+        }
+    }
+
+    bool StateMachine::begin(uint8_t initialState) {
+        if (_started) {
+            Logger::logf(Logger::Level::WARNING, "HSM", "begin() called twice - ignored");
+            return true;
+        }
+        if (!compile()) {
+            return false;
+        }
+        if (initialState >= _stateCount) {
+            Logger::logf(Logger::Level::ERROR, "HSM", "Initial state %d out of range (%d states)", initialState, _stateCount);
+            return false;
+        }
+
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            _topics[i].listenerId = _eventBus.subscribe(_topics[i].name, onTopicEvent, &_topics[i]);
+            if (_topics[i].listenerId == 0) {
+                Logger::logf(Logger::Level::ERROR, "HSM", "No free event listener for '%s'", _topics[i].name);
+                for (uint8_t j = 0; j < i; j++) _eventBus.unsubscribe(_topics[j].listenerId);
+                return false;
+            }
+        }
+        _started = true;
+
+        // Top-level ancestor first, then down to the initial state and its initial children
+        uint8_t path[TWIST_HSM_MAX_DEPTH];
+        uint8_t depth = 0;
+        for (uint8_t s = initialState; s != HSM_NO_STATE; s = _parent[s]) {
+            path[depth++] = s;
+        }
+        _dispatching = true;  // Entry actions may publish - handled once started
+        while (depth > 0) {
+            enter(path[--depth]);
+        }
+        enterInitial(initialState);
+
+        Logger::logf(Logger::Level::INFO, "HSM", "Started in '%s' (%d states, %d transitions, %d events)",
+                    getStateName(_current), _stateCount, _defCount, _topicCount);
+
+        drainDeferred();
+        _dispatching = false;
+        return true;
+    }
+
+    bool StateMachine::dispatch(const Event& event) {
+        if (!_started) return false;
+        int topic = findTopic(event.name);
+        if (topic < 0) {
+            _dispatched++;
+            _unhandled++;
+            return false;
+        }
+        return handle((uint8_t)topic, event);
+    }
+
+    // ===== State =====
+
+    bool StateMachine::isIn(uint8_t state) const {
+        for (uint8_t s = _current; s != HSM_NO_STATE; s = _parent[s]) {
+            if (s == state) return true;
+        }
+        return false;
+    }
+
+    const char* StateMachine::getStateName(uint8_t state) const {
+        if (state >= _stateCount) return "None";
+        return _states[state].name ? _states[state].name : "?";
+    }
+
+    // ===== Statistics =====
+
+    unsigned long StateMachine::getEntryCount(uint8_t state) const {
+        return (state < _stateCount) ? _entries[state] : 0;
+    }
+
+    uint64_t StateMachine::getResidencyUs(uint8_t state) const {
+        if (state >= _stateCount) return 0;
+        uint64_t total = _residencyUs[state];
+        if (_started && isIn(state)) {
+            total += (uint32_t)(micros() - _enteredAtUs[state]);
+        }
+        return total;
+    }
+
+    unsigned long StateMachine::getFireCount(uint8_t transition) const {
+        return (transition < _defCount) ? _fired[transition] : 0;
+    }
+
+    void StateMachine::logStatistics() const {
+        Logger::logf(Logger::Level::INFO, "HSM", "In '%s': %lu transitions, %lu events, %lu unhandled",
+                    getStateName(_current), _transitionsFired, _dispatched, _unhandled);
+        for (uint8_t s = 0; s < _stateCount; s++) {
+            Logger::logf(Logger::Level::INFO, "HSM", "  %-14s %6lu entries %10lu ms%s",
+                        getStateName(s), _entries[s], (unsigned long)(getResidencyUs(s) / 1000),
+                        isIn(s) ? "  *" : "");
+        }
+        for (uint8_t t = 0; t < _defCount; t++) {
+            Logger::logf(Logger::Level::INFO, "HSM", "  %s --%s--> %s: %lu",
+                        getStateName(_defs[t].from), _defs[t].event,
+                        _defs[t].to == HSM_NO_STATE ? "(internal)" : getStateName(_defs[t].to), _fired[t]);
+        }
+    }
+
+    // ===== Compilation =====
+
+    bool StateMachine::compile() {
+        if (_states == NULL || _stateCount == 0 || _stateCount > TWIST_HSM_MAX_STATES) {
+            Logger::logf(Logger::Level::ERROR, "HSM", "%d states (1..%d supported)", _stateCount, TWIST_HSM_MAX_STATES);
+            return false;
+        }
+        if ((_defs == NULL && _defCount > 0) || _defCount > TWIST_HSM_MAX_TRANSITIONS) {
+            Logger::logf(Logger::Level::ERROR, "HSM", "%d transitions (max %d)", _defCount, TWIST_HSM_MAX_TRANSITIONS);
+            return false;
+        }
+
+        // Hierarchy
+        for (uint8_t s = 0; s < _stateCount; s++) {
+            if (_states[s].parent != HSM_NO_STATE && _states[s].parent >= _stateCount) {
+                Logger::logf(Logger::Level::ERROR, "HSM", "State '%s': parent %d out of range", getStateName(s), _states[s].parent);
+                return false;
+            }
+        }
+        for (uint8_t s = 0; s < _stateCount; s++) {
+            const StateDef& def = _states[s];
+            if (def.initial != HSM_NO_STATE && (def.initial >= _stateCount || _states[def.initial].parent != s)) {
+                Logger::logf(Logger::Level::ERROR, "HSM", "State '%s': initial %d is not a child", getStateName(s), def.initial);
+                return false;
+            }
+            _parent[s] = def.parent;
+            _initial[s] = def.initial;
+
+            uint8_t depth = 0;
+            for (uint8_t p = def.parent; p != HSM_NO_STATE; p = _states[p].parent) {
+                if (++depth >= TWIST_HSM_MAX_DEPTH) {
+                    Logger::logf(Logger::Level::ERROR, "HSM", "State '%s': nesting deeper than %d (or a parent cycle)",
+                                getStateName(s), TWIST_HSM_MAX_DEPTH);
+                    return false;
+                }
+            }
+            _depth[s] = depth;
+
+            _device[s] = NULL;
+            if (def.deviceId != 0) {
+                _device[s] = _registry ? _registry->getOutputDevice(def.deviceId) : NULL;
+                if (_device[s] == NULL) {
+                    Logger::logf(Logger::Level::ERROR, "HSM", "State '%s': device %d is not a registered output",
+                                getStateName(s), def.deviceId);
+                    return false;
+                }
+            }
+        }
+
+        // Transitions, grouped by source state in table order (counting sort)
+        uint8_t count[TWIST_HSM_MAX_STATES];
+        memset(count, 0, sizeof(count));
+        for (uint8_t t = 0; t < _defCount; t++) {
+            const TransitionDef& def = _defs[t];
+            if (def.from >= _stateCount || (def.to != HSM_NO_STATE && def.to >= _stateCount) || def.event == NULL) {
+                Logger::logf(Logger::Level::ERROR, "HSM", "Transition %d: bad source, target or event", t);
+                return false;
+            }
+            count[def.from]++;
+        }
+        _first[0] = 0;
+        for (uint8_t s = 0; s < _stateCount; s++) {
+            _first[s + 1] = (uint8_t)(_first[s] + count[s]);
+            count[s] = _first[s];  // Reused as the fill cursor
+        }
+
+        _topicCount = 0;
+        for (uint8_t t = 0; t < _defCount; t++) {
+            const TransitionDef& def = _defs[t];
+            int topic = internTopic(def.event);
+            if (topic < 0) {
+                return false;
+            }
+            Transition& compiled = _transitions[count[def.from]++];
+            compiled.guard = def.guard;
+            compiled.action = def.action;
+            compiled.topic = (uint8_t)topic;
+            compiled.to = def.to;
+            compiled.def = t;
+        }
+        return true;
+    }
+
+    int StateMachine::internTopic(const char* name) {
+        int topic = findTopic(name);
+        if (topic >= 0) return topic;
+        if (_topicCount >= TWIST_HSM_MAX_EVENTS) {
+            Logger::logf(Logger::Level::ERROR, "HSM", "More than %d event names - raise TWIST_HSM_MAX_EVENTS", TWIST_HSM_MAX_EVENTS);
+            return -1;
+        }
+        Topic& entry = _topics[_topicCount];
+        entry.name = name;
+        entry.owner = this;
+        entry.listenerId = 0;
+        entry.id = _topicCount;
+        return _topicCount++;
+    }
+
+    int StateMachine::findTopic(const char* name) const {
+        if (name == NULL) return -1;
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            if (_topics[i].name == name) return i;  // Same string literal - the usual case
+        }
+        for (uint8_t i = 0; i < _topicCount; i++) {
+            if (strcmp(_topics[i].name, name) == 0) return i;
+        }
+        return -1;
+    }
+
+    // ===== Dispatch =====
+
+    void StateMachine::onTopicEvent(const Event& event, void* context) {
+        Topic* topic = (Topic*)context;
+        topic->owner->handle(topic->id, event);
+    }
+
+    bool StateMachine::handle(uint8_t topic, const Event& event) {
+        if (_dispatching) {
+            // Raised by an action mid-transition - run after it completes
+            if (_deferCount >= TWIST_HSM_DEFER_QUEUE) {
+                _deferDropped++;
+                Logger::logf(Logger::Level::WARNING, "HSM", "Deferred queue full - dropped '%s'", event.name);
+                return false;
+            }
+            uint8_t slot = (uint8_t)((_deferHead + _deferCount) % TWIST_HSM_DEFER_QUEUE);
+            _deferred[slot] = event;
+            _deferred[slot].data = NULL;  // Payload does not outlive dispatch
+            _deferredTopic[slot] = topic;
+            _deferCount++;
+            return false;
+        }
+
+        _dispatching = true;
+        bool fired = process(topic, event);
+        drainDeferred();
+        _dispatching = false;
+        return fired;
+    }
+
+    void StateMachine::drainDeferred() {
+        while (_deferCount > 0) {
+            uint8_t topic = _deferredTopic[_deferHead];
+            Event event = _deferred[_deferHead];
+            _deferHead = (uint8_t)((_deferHead + 1) % TWIST_HSM_DEFER_QUEUE);
+            _deferCount--;
+            process(topic, event);
+        }
+    }
+
+    bool StateMachine::process(uint8_t topic, const Event& event) {
+        _dispatched++;
+
+        // Leaf first, then each ancestor: the innermost handler wins
+        for (uint8_t s = _current; s != HSM_NO_STATE; s = _parent[s]) {
+            for (uint8_t k = _first[s]; k < _first[s + 1]; k++) {
+                const Transition& transition = _transitions[k];
+                if (transition.topic != topic) continue;
+                if (transition.guard && !transition.guard(event, _context)) continue;
+
+                _fired[transition.def]++;
+                _transitionsFired++;
+                if (transition.to != HSM_NO_STATE) {
+                    fire(transition, event);
+                } else if (transition.action) {
+                    transition.action(event, _context);  // Internal - no exit / entry
+                }
+                return true;
+            }
+        }
+        _unhandled++;
+        return false;
+    }
+
+    void StateMachine::fire(const Transition& transition, const Event& event) {
+        uint8_t source = _defs[transition.def].from;
+        uint8_t target = transition.to;
+
+        // Least common proper ancestor: self-transitions exit and re-enter
+        uint8_t a = _parent[source];
+        uint8_t b = _parent[target];
+        int depthA = (a == HSM_NO_STATE) ? -1 : _depth[a];
+        int depthB = (b == HSM_NO_STATE) ? -1 : _depth[b];
+        while (depthA > depthB) { a = _parent[a]; depthA--; }
+        while (depthB > depthA) { b = _parent[b]; depthB--; }
+        while (a != b) { a = _parent[a]; b = _parent[b]; }
+
+        while (_current != a) {
+            exit(_current);
+        }
+
+        if (transition.action) {
+            transition.action(event, _context);
+        }
+
+        uint8_t path[TWIST_HSM_MAX_DEPTH];
+        uint8_t depth = 0;
+        for (uint8_t s = target; s != a; s = _parent[s]) {
+            path[depth++] = s;
+        }
+        while (depth > 0) {
+            enter(path[--depth]);
+        }
+        enterInitial(target);
+
+        Logger::logf(Logger::Level::DEBUG, "HSM", "%s --%s--> %s",
+                    getStateName(source), event.name, getStateName(_current));
+    }
+
+    void StateMachine::enter(uint8_t state) {
+        _current = state;
+        _entries[state]++;
+        _enteredAtUs[state] = micros();
+
+        IOutputDevice* device = _device[state];
+        if (device) {
+            const StateDef& def = _states[state];
+            if (def.durationMs > 0) {
+                device->moveTo(def.target, def.durationMs);
+            } else {
+                device->setValue(def.target);
+            }
+        }
+        if (_states[state].onEntry) {
+            _states[state].onEntry(_context);
+        }
+    }
+
+    void StateMachine::exit(uint8_t state) {
+        if (_states[state].onExit) {
+            _states[state].onExit(_context);
+        }
+        _residencyUs[state] += (uint32_t)(micros() - _enteredAtUs[state]);
+        _current = _parent[state];
+    }
+
+    void StateMachine::enterInitial(uint8_t state) {
+        while (_initial[state] != HSM_NO_STATE) {
+            state = _initial[state];
+            enter(state);
+        }
+    }
+
+}  // namespace TwiST
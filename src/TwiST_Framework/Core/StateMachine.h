@@ -0,0 +1,237 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      StateMachine.h
+ * @brief     Table-driven hierarchical state machine triggered by EventBus events
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Application Logic Engine (event driven, no update())
+ * - Hardware:     None (entry commands go through IOutputDevice)
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Behavior is data: a const StateDef table (hierarchy, entry / exit
+ *   actions, entry device command) and a const TransitionDef table
+ *   (source, event, guard, target, action) replace if/else on sensor values
+ * - begin() compiles the tables once into compact arrays: transitions
+ *   grouped per source state, event names interned to small IDs, device
+ *   IDs resolved to pointers. Dispatch never searches by name and never
+ *   allocates
+ * - One EventBus listener per distinct event name
+ * - Run to completion: events raised by entry / exit actions are queued
+ *   and dispatched after the current transition finishes
+ *
+ * CAPABILITIES:
+ * - Nested states (parent + initial child), inherited transitions: a
+ *   state handles what its children do not
+ * - Guards, transition actions, internal transitions (no exit / entry)
+ * - Entry device command: moveTo(target, durationMs) or setValue(target)
+ * - Per-state entry count and residency time, per-transition fire count
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_STATE_MACHINE_H
+#define TWIST_STATE_MACHINE_H
+
+#include "../TwiST_Config.h"
+#include "../Interfaces/IOutputDevice.h"
+#include "EventBus.h"
+#include "DeviceRegistry.h"
+#include <stdint.h>
+
+// Deepest state nesting (root states are depth 0)
+#ifndef TWIST_HSM_MAX_DEPTH
+#define TWIST_HSM_MAX_DEPTH 8
+#endif
+
+// Events raised during a transition, held until it completes
+#ifndef TWIST_HSM_DEFER_QUEUE
+#define TWIST_HSM_DEFER_QUEUE 4
+#endif
+
+namespace TwiST {
+
+    // StateDef::parent / initial, TransitionDef::to (internal transition)
+    static constexpr uint8_t HSM_NO_STATE = 0xFF;
+
+    typedef void (*StateAction)(void* context);
+    typedef bool (*TransitionGuard)(const Event& event, void* context);
+    typedef void (*TransitionAction)(const Event& event, void* context);
+
+    /**
+     * @brief One state - index in the table is the state ID
+     */
+    struct StateDef {
+        const char* name;
+        uint8_t parent;             // HSM_NO_STATE = top level
+        uint8_t initial;            // Child entered after this state (HSM_NO_STATE = leaf)
+        StateAction onEntry;        // May be NULL
+        StateAction onExit;         // May be NULL
+        uint16_t deviceId;          // Entry command target (0 = none)
+        float target;               // Entry command value
+        uint32_t durationMs;        // Entry command: moveTo(target, durationMs), 0 = setValue(target)
+    };
+
+    /**
+     * @brief One transition - first match wins, searched leaf state first
+     */
+    struct TransitionDef {
+        uint8_t from;
+        const char* event;          // EventBus name (static string)
+        TransitionGuard guard;      // NULL = always
+        uint8_t to;                 // HSM_NO_STATE = internal (action only, no exit / entry)
+        TransitionAction action;    // Runs between exits and entries (may be NULL)
+    };
+
+    /**
+     * @brief Hierarchical state machine compiled from const tables
+     *
+     * Example:
+     * ```cpp
+     * enum { ACTIVE, SCANNING, TRACKING, RESTING };
+     *
+     * static const StateDef states[] = {
+     *     // name        parent        initial       entry  exit  device value  ms
+     *     { "Active",   HSM_NO_STATE, SCANNING,     NULL,  NULL, 0,     0.0f,  0   },
+     *     { "Scanning", ACTIVE,       HSM_NO_STATE, NULL,  NULL, 100,   30.0f, 800 },
+     *     { "Tracking", ACTIVE,       HSM_NO_STATE, NULL,  NULL, 100,   90.0f, 300 },
+     *     { "Resting",  HSM_NO_STATE, HSM_NO_STATE, NULL,  NULL, 100,   0.0f,  0   },
+     * };
+     * static const TransitionDef transitions[] = {
+     *     // from     event                guard     to         action
+     *     { SCANNING, "distance.changed",  isNear,   TRACKING,  NULL },
+     *     { TRACKING, "distance.changed",  isFar,    SCANNING,  NULL },
+     *     { ACTIVE,   "input.pressed",     NULL,     RESTING,   NULL },  // From any child
+     *     { RESTING,  "input.pressed",     NULL,     ACTIVE,    NULL },
+     * };
+     *
+     * StateMachine brain(framework.eventBus(), framework.registry(), states, 4, transitions, 4);
+     * brain.begin(ACTIVE);  // Enters Active, then Scanning
+     * ```
+     */
+    class StateMachine {
+    public:
+        /**
+         * @param registry Resolves StateDef::deviceId in begin() (NULL if no entry commands)
+         * @param context Passed to every action and guard
+         */
+        StateMachine(EventBus& eventBus, DeviceRegistry* registry,
+                     const StateDef* states, uint8_t stateCount,
+                     const TransitionDef* transitions, uint8_t transitionCount,
+                     void* context = NULL);
+        ~StateMachine();
+
+        /**
+         * @brief Compile the tables, subscribe, enter the initial state
+         * @return false if a table is invalid or a limit is exceeded (logged)
+         */
+        bool begin(uint8_t initialState = 0);
+
+        /**
+         * @brief Dispatch an event directly (without the EventBus)
+         * @return true if a transition fired
+         */
+        bool dispatch(const Event& event);
+
+        // ===== State =====
+
+        uint8_t getState() const { return _current; }   // Active leaf state
+        bool isIn(uint8_t state) const;                 // Active leaf or one of its ancestors
+        const char* getStateName(uint8_t state) const;
+        uint8_t getStateCount() const { return _stateCount; }
+        bool isStarted() const { return _started; }
+
+        // ===== Statistics =====
+
+        unsigned long getEntryCount(uint8_t state) const;
+        uint64_t getResidencyUs(uint8_t state) const;   // Total time active, including now
+        unsigned long getFireCount(uint8_t transition) const;
+        unsigned long getTransitionCount() const { return _transitionsFired; }
+        unsigned long getDispatchCount() const { return _dispatched; }
+        unsigned long getUnhandledCount() const { return _unhandled; }  // No transition matched
+        unsigned long getDeferredDropCount() const { return _deferDropped; }
+
+        /**
+         * @brief Log every state's entries / residency and every transition's fire count
+         */
+        void logStatistics() const;
+
+    private:
+        // Dispatch-ready transition (grouped by source state)
+        struct Transition {
+            TransitionGuard guard;
+            TransitionAction action;
+            uint8_t topic;
+            uint8_t to;
+            uint8_t def;            // Index in the TransitionDef table
+        };
+
+        // One EventBus listener per distinct event name
+        struct Topic {
+            const char* name;
+            StateMachine* owner;
+            uint16_t listenerId;
+            uint8_t id;
+        };
+
+        EventBus& _eventBus;
+        DeviceRegistry* _registry;
+        const StateDef* _states;
+        const TransitionDef* _defs;
+        uint8_t _stateCount;
+        uint8_t _defCount;
+        void* _context;
+
+        // Compiled tables
+        uint8_t _parent[TWIST_HSM_MAX_STATES];
+        uint8_t _initial[TWIST_HSM_MAX_STATES];
+        uint8_t _depth[TWIST_HSM_MAX_STATES];
+        uint8_t _first[TWIST_HSM_MAX_STATES + 1];  // _transitions[_first[s] .. _first[s + 1])
+        IOutputDevice* _device[TWIST_HSM_MAX_STATES];
+        Transition _transitions[TWIST_HSM_MAX_TRANSITIONS];
+        Topic _topics[TWIST_HSM_MAX_EVENTS];
+        uint8_t _topicCount;
+
+        uint8_t _current;
+        bool _started;
+        bool _dispatching;
+
+        // Run to completion
+        Event _deferred[TWIST_HSM_DEFER_QUEUE];
+        uint8_t _deferredTopic[TWIST_HSM_DEFER_QUEUE];
+        uint8_t _deferHead;
+        uint8_t _deferCount;
+
+        // Statistics
+        unsigned long _entries[TWIST_HSM_MAX_STATES];
+        uint64_t _residencyUs[TWIST_HSM_MAX_STATES];
+        uint32_t _enteredAtUs[TWIST_HSM_MAX_STATES];
+        unsigned long _fired[TWIST_HSM_MAX_TRANSITIONS];
+        unsigned long _transitionsFired;
+        unsigned long _dispatched;
+        unsigned long _unhandled;
+        unsigned long _deferDropped;
+
+        bool compile();
+        int internTopic(const char* name);
+        int findTopic(const char* name) const;
+
+        static void onTopicEvent(const Event& event, void* context);
+        bool handle(uint8_t topic, const Event& event);
+        bool process(uint8_t topic, const Event& event);
+        void drainDeferred();
+        void fire(const Transition& transition, const Event& event);
+        void enter(uint8_t state);
+        void exit(uint8_t state);
+        void enterInitial(uint8_t state);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_STATE_MACHINE_H
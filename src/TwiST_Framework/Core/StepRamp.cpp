@@ -0,0 +1,189 @@
+#include "StepRamp.h"
+#include <Arduino.h>        // IRAM_ATTR
+#include <math.h>
+
+// Longest interval representable without overflowing 2 * c in the recurrence
+static const uint32_t MAX_INTERVAL = 0x3FFFFFFFUL;
+
+// sqrt(k) - sqrt(k - 1) in Q24: exact intervals of the opening steps, where
+// the recurrence is furthest from the ideal curve. Past 32 steps what is
+// left of its error adds up to under 1e-4 of the first interval.
+static const uint32_t TABLE_STEPS = 32;
+static const uint32_t OPENING[TABLE_STEPS] = {
+    16777216, 6949350, 5332424, 4495441, 3960563, 3580623,
+    3292723, 3064792, 2878515, 2722567, 2589515, 2474251,
+    2373132, 2283482, 2203284, 2130986, 2065370, 2005466,
+    1950490, 1899802, 1852871, 1809256, 1768583, 1730536,
+    1694843, 1661272, 1629620, 1599711, 1571391, 1544523,
+    1518989, 1494680
+};
+
+// gamma(3/4) / (2 gamma(5/4)): the recurrence seed whose intervals converge
+// on the ideal ones (Austin rounds it to 0.676, which drifts on long ramps)
+static const float AUSTIN_SEED = 0.67597824f;
+
+namespace TwiST {
+
+    StepRamp::StepRamp()
+        : _steps(0),
+          _index(0),
+          _accelSteps(0),
+          _decelStart(0),
+          _first(0),
+          _cMin(0),
+          _cruiseFraction(0),
+          _edge(0),
+          _c(0),
+          _shift(0),
+          _n(0),
+          _rest(0),
+          _carry(0) {
+    }
+
+    static uint32_t toInterval(float ticks) {
+        float scaled = ticks * 256.0f;
+        if (scaled >= (float)MAX_INTERVAL) return MAX_INTERVAL;
+        if (scaled < 256.0f) return 256;    // One tick minimum
+        return (uint32_t)scaled;
+    }
+
+    bool StepRamp::plan(uint32_t steps, float maxSpeed, float acceleration, uint32_t tickHz) {
+        _steps = 0;
+        _index = 0;
+        if (maxSpeed <= 0.0f || acceleration <= 0.0f || tickHz == 0) {
+            return false;
+        }
+
+        // Ideal start from rest: step 1 at t = sqrt(2 / a)
+        float first = (float)tickHz * sqrtf(2.0f / acceleration);
+        float cruise = (float)tickHz / maxSpeed;
+        _first = toInterval(first);
+        _cMin = toInterval(cruise);
+        float cruiseFraction = cruise * 256.0f - (float)_cMin;
+        _cruiseFraction = (cruiseFraction > 0.0f) ? (uint32_t)(cruiseFraction * 65536.0f) : 0;
+        _carry = 0;
+
+        // Recurrence takes over after the table, its seed carried past it
+        float seed = first * AUSTIN_SEED;
+        for (uint32_t n = 1; n <= TABLE_STEPS; n++) {
+            seed *= (float)(4 * n - 1) / (float)(4 * n + 1);
+        }
+        // ...and kept with as many extra fraction bits as fit: truncating every
+        // interval to 1/256 tick would bias a 6000-step ramp by tens of ticks
+        _shift = 0;
+        while (_shift < 16 && toInterval(seed) <= (MAX_INTERVAL >> (_shift + 1))) {
+            _shift++;
+        }
+        _c = toInterval(seed * (float)(1UL << _shift));
+        _n = TABLE_STEPS;
+        _rest = 0;
+
+        // Steps to reach cruise speed: v^2 / 2a; short moves become triangles.
+        // Differences of square roots are rationalized - they are small
+        // against the ramp times and would cancel in float.
+        float rampSteps = maxSpeed * maxSpeed / (2.0f * acceleration);
+        uint32_t accel;
+        float edge;
+        if (rampSteps * 2.0f >= (float)steps) {
+            // Odd triangle: one middle step across the peak, 2 (sqrt(d / a) - sqrt(2A / a))
+            accel = steps / 2;
+            edge = 2.0f * (float)tickHz /
+                   (acceleration * (sqrtf((float)steps / acceleration) + sqrtf((float)(2 * accel) / acceleration)));
+        } else {
+            // Entering cruise: ((sqrt(v^2 / 2a) - sqrt(A))^2 + 1) / v, leaving mirrors it
+            accel = (uint32_t)rampSteps;
+            float gap = (rampSteps - (float)accel) / (sqrtf(rampSteps) + sqrtf((float)accel));
+            edge = cruise * (1.0f + gap * gap);
+            if (steps - 2 * accel == 1) {
+                edge = cruise * (1.0f + 2.0f * gap * gap);     // Both boundaries in one step
+            }
+        }
+        _edge = toInterval(edge);
+
+        _accelSteps = accel;
+        _decelStart = steps - accel;
+        _steps = steps;
+        return true;
+    }
+
+    uint32_t IRAM_ATTR StepRamp::rampInterval(uint32_t level) {
+        if (level <= TABLE_STEPS) {
+            uint64_t scaled = (uint64_t)_first * OPENING[level - 1];
+            return carry((uint32_t)(scaled >> 24), (uint32_t)(scaled >> 8) & 0xFFFF);
+        }
+
+        uint32_t n = level - 1;
+        while (_n < n) {
+            _n++;
+            uint32_t num = 2 * _c + _rest;          // Carry the remainder (AVR446) -
+            uint32_t den = 4 * _n + 1;              // truncation would stall the ramp
+            _c -= num / den;
+            _rest = num % den;
+        }
+        while (_n > n) {
+            uint32_t num = 2 * _c + _rest;
+            uint32_t den = 4 * _n - 1;
+            _c += num / den;
+            _rest = num % den;
+            _n--;
+        }
+        return carry(_c >> _shift, (_c & ((1UL << _shift) - 1)) << (16 - _shift));
+    }
+
+    uint32_t IRAM_ATTR StepRamp::carry(uint32_t interval, uint32_t fraction) {
+        // Fractions below 1/256 tick add up to whole units instead of being dropped
+        _carry += fraction;
+        interval += _carry >> 16;
+        _carry &= 0xFFFF;
+        return interval;
+    }
+
+    uint32_t IRAM_ATTR StepRamp::nextInterval() {
+        if (_index >= _steps) return 0;
+
+        uint32_t step = ++_index;   // 1-based step being scheduled
+        uint32_t interval;
+
+        if (step <= _accelSteps) {
+            interval = rampInterval(step);
+        } else if (step <= _decelStart) {
+            // Cruise; the steps entering and leaving it straddle the ramp ends
+            bool edge = (step == _accelSteps + 1 || step == _decelStart);
+            interval = edge ? _edge : carry(_cMin, _cruiseFraction);
+        } else {
+            // Mirror of acceleration: step k from the end uses ramp step k
+            interval = rampInterval(_steps - step + 1);
+        }
+
+        return (interval < _cMin) ? _cMin : interval;
+    }
+
+    void IRAM_ATTR StepRamp::decelerate() {
+        if (_index == 0) {
+            _steps = 0;             // Not started - nothing to slow down from
+            return;
+        }
+        if (_index > _decelStart) return;   // Already decelerating
+
+        // Current speed is the ramp level reached; that many steps bring it to rest
+        uint32_t level = (_index < _accelSteps) ? _index : _accelSteps;
+        uint32_t stopAt = _index + level;
+        if (stopAt < _steps) {
+            _steps = stopAt;
+        }
+        _accelSteps = level;
+        _decelStart = _index;
+    }
+
+    float StepRamp::duration(uint32_t steps, float maxSpeed, float acceleration) {
+        if (maxSpeed <= 0.0f || acceleration <= 0.0f) return 0.0f;
+
+        float distance = (float)steps;
+        float rampDistance = maxSpeed * maxSpeed / acceleration;   // Accel + decel
+        if (distance <= rampDistance) {
+            return 2.0f * sqrtf(distance / acceleration);          // Triangle
+        }
+        return distance / maxSpeed + maxSpeed / acceleration;      // Trapezoid
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,122 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      StepRamp.h
+ * @brief     Trapezoidal step-interval generator for stepper pulse engines
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Motion Math (no hardware)
+ * - Hardware:     None
+ * - Dependency:   None
+ *
+ * PRINCIPLES:
+ * - plan() runs on the loop context and does all float work (sqrt, divide)
+ * - nextInterval() is integer-only, O(1), safe for a timer ISR: one
+ *   division per step (Austin recurrence c_n = c_n-1 - 2c_n-1 / (4n + 1),
+ *   remainder carried so integer truncation never stalls the ramp)
+ * - The opening steps come from an exact table and the recurrence takes
+ *   over with its asymptotically exact seed, so long ramps do not drift
+ * - The steps entering and leaving cruise get the exact time across the
+ *   ramp boundary; the last step lands on duration()
+ * - Intervals in timer ticks x 256 - fractional ticks accumulate in the
+ *   caller's deadline, so average rate is exact at any tick frequency
+ * - Symmetric ramp: deceleration replays acceleration intervals in reverse
+ *
+ * CAPABILITIES:
+ * - Full trapezoid or triangle (short move) profiles
+ * - Smooth stop from any point (decelerate())
+ * - Analytic move duration for time-based moves
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_STEP_RAMP_H
+#define TWIST_STEP_RAMP_H
+
+#include <stdint.h>
+
+namespace TwiST {
+
+    /**
+     * @brief Per-axis step interval generator
+     *
+     * Example usage:
+     * ```cpp
+     * StepRamp ramp;
+     * ramp.plan(3200, 8000.0f, 20000.0f, 1000000);   // steps, steps/s, steps/s^2, tick Hz
+     * uint64_t due = now << 8;
+     * for (uint32_t iv; (iv = ramp.nextInterval()) != 0; ) {
+     *     due += iv;                                   // Step at (due >> 8)
+     * }
+     * ```
+     */
+    class StepRamp {
+    public:
+        StepRamp();
+
+        /**
+         * @brief Plan a move from rest to rest (loop context)
+         * @param steps Step count (direction handled by caller)
+         * @param maxSpeed Cruise rate in steps/s
+         * @param acceleration Ramp rate in steps/s^2 (same for deceleration)
+         * @param tickHz Timer tick frequency the intervals are expressed in
+         * @return false on non-positive speed, acceleration or tick rate
+         */
+        bool plan(uint32_t steps, float maxSpeed, float acceleration, uint32_t tickHz);
+
+        /**
+         * @brief Interval before the next step (ISR safe, integer only)
+         * @return Ticks x 256, 0 once every planned step has been handed out
+         */
+        uint32_t nextInterval();
+
+        /**
+         * @brief Turn the rest of the move into a deceleration from the
+         *        current speed (ISR safe). Never lengthens the move.
+         */
+        void decelerate();
+
+        uint32_t getTotalSteps() const { return _steps; }
+        uint32_t getIssuedSteps() const { return _index; }
+        bool isDone() const { return _index >= _steps; }
+
+        /**
+         * @brief Ideal duration of a rest-to-rest move
+         * @return Seconds (0 for invalid parameters)
+         */
+        static float duration(uint32_t steps, float maxSpeed, float acceleration);
+
+    private:
+        uint32_t _steps;        // Planned step count
+        uint32_t _index;        // Intervals handed out
+        uint32_t _accelSteps;   // Steps in the acceleration ramp
+        uint32_t _decelStart;   // Steps after which deceleration begins
+        uint32_t _first;        // Exact first interval (ticks x 256)
+        uint32_t _cMin;         // Cruise interval (ticks x 256)
+        uint32_t _cruiseFraction; // Cruise interval below 1/256 tick (1/65536)
+        uint32_t _edge;         // Boundary step interval (or the single middle step)
+        uint32_t _c;            // Recurrence state c_n = interval of step n + 1, << _shift
+        uint8_t _shift;         // Extra fraction bits kept in _c
+        uint32_t _n;            // Recurrence index
+        uint32_t _rest;         // Division remainder carried between steps
+        uint32_t _carry;        // Interval fractions not yet handed out (1/65536)
+
+        /**
+         * @brief Interval of acceleration step `level` (1-based, ISR safe)
+         */
+        uint32_t rampInterval(uint32_t level);
+
+        /**
+         * @brief Add a sub-unit fraction to the carry; whole units go out with interval
+         */
+        uint32_t carry(uint32_t interval, uint32_t fraction);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_STEP_RAMP_H
@@ -0,0 +1,186 @@
+#include "Telemetry.h"
+#include "Logger.h"
+#include <Arduino.h>
+
+namespace TwiST {
+
+    Telemetry::Telemetry(ITransport& transport, uint16_t rateHz)
+        : _transport(transport),
+          _channelCount(0),
+          _periodUs(0),
+          _lastFrameUs(0),
+          _keyframeInterval(100),
+          _framesSinceKeyframe(0),
+          _enabled(true),
+          _ringHead(0),
+          _ringSize(0),
+          _framesSent(0),
+          _framesDropped(0),
+          _bytesSent(0) {
+        setRate(rateHz);
+    }
+
+    // ===== Channels =====
+
+    bool Telemetry::addOutputChannel(IOutputDevice& device, float scale) {
+        if (_channelCount >= TWIST_TELEMETRY_MAX_CHANNELS) {
+            Logger::error("TELEMETRY", "Channel limit reached");
+            return false;
+        }
+        _channels[_channelCount++] = {CHANNEL_OUTPUT, 0, scale, &device, NULL};
+        _encoder.forceKeyframe();
+        return true;
+    }
+
+    bool Telemetry::addInputChannel(IInputDevice& device, uint8_t axis, float scale) {
+        if (_channelCount >= TWIST_TELEMETRY_MAX_CHANNELS) {
+            Logger::error("TELEMETRY", "Channel limit reached");
+            return false;
+        }
+        _channels[_channelCount++] = {CHANNEL_INPUT, axis, scale, &device, NULL};
+        _encoder.forceKeyframe();
+        return true;
+    }
+
+    bool Telemetry::addChannel(TelemetrySampler sampler, void* context) {
+        if (sampler == NULL) {
+            Logger::error("TELEMETRY", "Cannot add NULL sampler");
+            return false;
+        }
+        if (_channelCount >= TWIST_TELEMETRY_MAX_CHANNELS) {
+            Logger::error("TELEMETRY", "Channel limit reached");
+            return false;
+        }
+        _channels[_channelCount++] = {CHANNEL_CUSTOM, 0, 1.0f, context, sampler};
+        _encoder.forceKeyframe();
+        return true;
+    }
+
+    void Telemetry::clearChannels() {
+        _channelCount = 0;
+        _encoder.forceKeyframe();
+    }
+
+    // ===== Rate Control =====
+
+    void Telemetry::setRate(uint16_t rateHz) {
+        if (rateHz == 0) rateHz = 1;
+        _periodUs = 1000000UL / rateHz;
+    }
+
+    // ===== IService =====
+
+    uint32_t Telemetry::getTimeUntilUpdate(uint32_t nowUs) const {
+        if (_ringSize > 0) return 0;  // Still draining into the link
+        if (!_enabled || _channelCount == 0) return UINT32_MAX;
+        uint32_t elapsed = nowUs - _lastFrameUs;
+        return (elapsed >= _periodUs) ? 0 : _periodUs - elapsed;
+    }
+
+    void Telemetry::update() {
+        // Always keep draining - a slow link must not stall frame production
+        drain();
+
+        if (!_enabled || _channelCount == 0) return;
+
+        unsigned long now = micros();
+        if (now - _lastFrameUs < _periodUs) return;
+
+        // Catch up without bursting: schedule from the ideal time, resync if far behind
+        _lastFrameUs += _periodUs;
+        if (now - _lastFrameUs >= _periodUs) {
+            _lastFrameUs = now;
+        }
+
+        int32_t values[TWIST_TELEMETRY_MAX_CHANNELS];
+        for (uint8_t i = 0; i < _channelCount; i++) {
+            values[i] = sampleChannel(_channels[i]);
+        }
+
+        bool keyframe = (_framesSinceKeyframe >= _keyframeInterval);
+
+        uint8_t frame[WireFrame::OVERHEAD + TelemetryCodec::MAX_PAYLOAD];
+        size_t payloadLength = _encoder.encode(values, _channelCount, (uint32_t)now, keyframe,
+                                               WireFrame::payload(frame), TelemetryCodec::MAX_PAYLOAD);
+        if (payloadLength == 0) {
+            _framesDropped++;
+            return;
+        }
+
+        size_t frameLength = WireFrame::finalize(frame, WIRE_TELEMETRY, (uint16_t)payloadLength);
+
+        if (!pushFrame(frame, frameLength)) {
+            // Link saturated - the decoder will see the sequence gap
+            _framesDropped++;
+            _encoder.forceKeyframe();
+            _framesSinceKeyframe = 0;
+            return;
+        }
+
+        _framesSent++;
+        // Encoder may have promoted the frame to a keyframe (flags byte)
+        _framesSinceKeyframe = (frame[WireFrame::HEADER_SIZE + 6] & TelemetryCodec::FLAG_KEYFRAME)
+                                   ? 0 : _framesSinceKeyframe + 1;
+
+        drain();
+    }
+
+    // ===== Private Helpers =====
+
+    int32_t Telemetry::sampleChannel(const Channel& channel) {
+        switch (channel.kind) {
+            case CHANNEL_OUTPUT: {
+                IOutputDevice* device = static_cast<IOutputDevice*>(channel.source);
+                return (int32_t)(device->getValue() * channel.scale);
+            }
+            case CHANNEL_INPUT: {
+                IInputDevice* device = static_cast<IInputDevice*>(channel.source);
+                return (int32_t)(device->readAnalog(channel.axis) * channel.scale);
+            }
+            case CHANNEL_CUSTOM:
+                return channel.sampler(channel.source);
+        }
+        return 0;
+    }
+
+    bool Telemetry::pushFrame(const uint8_t* frame, size_t length) {
+        if (length > TWIST_TELEMETRY_BUFFER_SIZE - _ringSize) {
+            return false;  // Whole frames only - never send a torn frame
+        }
+
+        size_t tail = (_ringHead + _ringSize) % TWIST_TELEMETRY_BUFFER_SIZE;
+        for (size_t i = 0; i < length; i++) {
+            _ring[tail] = frame[i];
+            tail = (tail + 1) % TWIST_TELEMETRY_BUFFER_SIZE;
+        }
+        _ringSize += length;
+        return true;
+    }
+
+    void Telemetry::drain() {
+        bool sentAny = false;
+
+        while (_ringSize > 0) {
+            size_t room = _transport.writable();
+            if (room == 0) break;
+
+            // Contiguous chunk up to the end of the ring
+            size_t chunk = TWIST_TELEMETRY_BUFFER_SIZE - _ringHead;
+            if (chunk > _ringSize) chunk = _ringSize;
+            if (chunk > room) chunk = room;
+
+            size_t sent = _transport.send(_ring + _ringHead, chunk);
+            if (sent == 0) break;
+
+            _ringHead = (_ringHead + sent) % TWIST_TELEMETRY_BUFFER_SIZE;
+            _ringSize -= sent;
+            _bytesSent += sent;
+            sentAny = true;
+        }
+
+        if (sentAny) {
+            _transport.flush();
+        }
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,175 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      Telemetry.h
+ * @brief     Fixed-rate binary telemetry streaming of device state
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (IService)
+ * - Hardware:     None (uses ITransport abstraction)
+ * - Implements:   IService
+ *
+ * PRINCIPLES:
+ * - Snapshots selected channels at a fixed rate (default 100 Hz)
+ * - Packed delta frames (TelemetryCodec) inside WireFrame envelopes
+ * - NEVER blocks the control loop: frames go to a ring buffer, the ring
+ *   drains only as much as the transport accepts without blocking
+ * - Drops whole frames when the link is saturated (next frame = keyframe)
+ * - Zero heap allocation
+ *
+ * CAPABILITIES:
+ * - Output device channels (IOutputDevice::getValue)
+ * - Input device channels (IInputDevice::readAnalog)
+ * - Custom sampler channels (target angle, loop timing, anything)
+ * - Throughput statistics (frames sent/dropped, bytes)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TELEMETRY_H
+#define TWIST_TELEMETRY_H
+
+#include "../Interfaces/IService.h"
+#include "../Interfaces/ITransport.h"
+#include "../Interfaces/IInputDevice.h"
+#include "../Interfaces/IOutputDevice.h"
+#include "TelemetryCodec.h"
+#include "WireFrame.h"
+
+// Transmit ring buffer size (bytes)
+#ifndef TWIST_TELEMETRY_BUFFER_SIZE
+#define TWIST_TELEMETRY_BUFFER_SIZE 512
+#endif
+
+namespace TwiST {
+
+    // Custom channel sampler - returns fixed-point value
+    typedef int32_t (*TelemetrySampler)(void* context);
+
+    /**
+     * @brief Telemetry streaming service
+     *
+     * Example usage:
+     * ```cpp
+     * Drivers::SerialTransport link(Serial);
+     * Telemetry telemetry(link, 100);  // 100 Hz
+     *
+     * telemetry.addOutputChannel(App::servo("BaseServo"));             // angle x100
+     * telemetry.addInputChannel(App::joystick("MainJoystick"), 0);     // X x1000
+     * telemetry.addChannel([](void* s) {                               // target angle x100
+     *     return (int32_t)(static_cast<Devices::Servo*>(s)->getTargetAngle() * 100);
+     * }, &App::servo("BaseServo"));
+     * telemetry.addChannel([](void* f) {                               // loop work time (us)
+     *     return (int32_t)static_cast<TwiSTFramework*>(f)->getLastUpdateDuration();
+     * }, &framework);
+     *
+     * framework.addService(&telemetry);
+     * ```
+     */
+    class Telemetry : public IService {
+    public:
+        /**
+         * @param transport Output link (serial, UDP, file, ...)
+         * @param rateHz Frame rate (frames per second)
+         */
+        Telemetry(ITransport& transport, uint16_t rateHz = 100);
+
+        // ===== Channels =====
+
+        /**
+         * @brief Add output device channel (getValue() x scale)
+         * @return true if channel added
+         */
+        bool addOutputChannel(IOutputDevice& device, float scale = 100.0f);
+
+        /**
+         * @brief Add input device channel (readAnalog(axis) x scale)
+         * @return true if channel added
+         */
+        bool addInputChannel(IInputDevice& device, uint8_t axis, float scale = 1000.0f);
+
+        /**
+         * @brief Add custom channel
+         * @param sampler Function returning a fixed-point value
+         * @param context Passed to sampler
+         * @return true if channel added
+         */
+        bool addChannel(TelemetrySampler sampler, void* context);
+
+        /**
+         * @brief Remove all channels (next frame is a keyframe)
+         */
+        void clearChannels();
+
+        uint8_t getChannelCount() const { return _channelCount; }
+
+        // ===== Rate Control =====
+
+        void setRate(uint16_t rateHz);
+        void setKeyframeInterval(uint16_t frames) { _keyframeInterval = frames; }
+        void enable() { _enabled = true; }
+        void disable() { _enabled = false; }
+        bool isEnabled() const { return _enabled; }
+
+        // ===== IService =====
+
+        void update() override;
+        const char* getName() const override { return "Telemetry"; }
+        uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+        // ===== Statistics =====
+
+        unsigned long getFramesSent() const { return _framesSent; }
+        unsigned long getFramesDropped() const { return _framesDropped; }
+        unsigned long getBytesSent() const { return _bytesSent; }
+        size_t getBufferedBytes() const { return _ringSize; }
+
+    private:
+        enum ChannelKind : uint8_t {
+            CHANNEL_OUTPUT,
+            CHANNEL_INPUT,
+            CHANNEL_CUSTOM
+        };
+
+        struct Channel {
+            ChannelKind kind;
+            uint8_t axis;
+            float scale;
+            void* source;               // IOutputDevice*, IInputDevice* or sampler context
+            TelemetrySampler sampler;
+        };
+
+        ITransport& _transport;
+        Channel _channels[TWIST_TELEMETRY_MAX_CHANNELS];
+        uint8_t _channelCount;
+
+        TelemetryEncoder _encoder;
+        unsigned long _periodUs;
+        unsigned long _lastFrameUs;
+        uint16_t _keyframeInterval;
+        uint16_t _framesSinceKeyframe;
+        bool _enabled;
+
+        // Transmit ring
+        uint8_t _ring[TWIST_TELEMETRY_BUFFER_SIZE];
+        size_t _ringHead;   // Next byte to send
+        size_t _ringSize;   // Bytes pending
+
+        // Statistics
+        unsigned long _framesSent;
+        unsigned long _framesDropped;
+        unsigned long _bytesSent;
+
+        int32_t sampleChannel(const Channel& channel);
+        bool pushFrame(const uint8_t* frame, size_t length);
+        void drain();
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_TELEMETRY_H
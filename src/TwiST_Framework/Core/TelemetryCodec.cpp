@@ -0,0 +1,186 @@
+#include "TelemetryCodec.h"
+#include <string.h>
+
+namespace TwiST {
+
+    // ===== Varint Helpers =====
+
+    size_t TelemetryCodec::writeVarint(int32_t value, uint8_t* out, size_t capacity) {
+        // Zigzag: small negative numbers become small positive numbers
+        uint32_t v = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+        size_t n = 0;
+        do {
+            if (n >= capacity) return 0;
+            uint8_t byte = v & 0x7F;
+            v >>= 7;
+            out[n++] = v ? (byte | 0x80) : byte;
+        } while (v);
+        return n;
+    }
+
+    size_t TelemetryCodec::readVarint(const uint8_t* in, size_t length, int32_t& value) {
+        uint32_t v = 0;
+        for (size_t n = 0; n < length && n < 5; n++) {
+            v |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+            if ((in[n] & 0x80) == 0) {
+                value = (int32_t)((v >> 1) ^ (~(v & 1) + 1));
+                return n + 1;
+            }
+        }
+        return 0;
+    }
+
+    // ===== Encoder =====
+
+    TelemetryEncoder::TelemetryEncoder()
+        : _lastCount(0),
+          _sequence(0),
+          _needKeyframe(true) {
+        memset(_last, 0, sizeof(_last));
+    }
+
+    size_t TelemetryEncoder::encode(const int32_t* values, uint8_t count, uint32_t timestampUs,
+                                    bool keyframe, uint8_t* out, size_t capacity) {
+        if (count > TWIST_TELEMETRY_MAX_CHANNELS || capacity < TelemetryCodec::HEADER_SIZE) {
+            return 0;
+        }
+
+        // Channel set changed or a frame was lost - deltas are meaningless
+        if (_needKeyframe || count != _lastCount) {
+            keyframe = true;
+        }
+
+        uint16_t seq = _sequence;
+        out[0] = (uint8_t)(seq & 0xFF);
+        out[1] = (uint8_t)(seq >> 8);
+        out[2] = (uint8_t)(timestampUs & 0xFF);
+        out[3] = (uint8_t)(timestampUs >> 8);
+        out[4] = (uint8_t)(timestampUs >> 16);
+        out[5] = (uint8_t)(timestampUs >> 24);
+        out[6] = keyframe ? TelemetryCodec::FLAG_KEYFRAME : 0;
+        out[7] = count;
+
+        size_t pos = TelemetryCodec::HEADER_SIZE;
+
+        if (keyframe) {
+            for (uint8_t i = 0; i < count; i++) {
+                size_t n = TelemetryCodec::writeVarint(values[i], out + pos, capacity - pos);
+                if (n == 0) return 0;
+                pos += n;
+            }
+        } else {
+            size_t bitmapSize = (count + 7) / 8;
+            if (pos + bitmapSize > capacity) return 0;
+            uint8_t* bitmap = out + pos;
+            memset(bitmap, 0, bitmapSize);
+            pos += bitmapSize;
+
+            for (uint8_t i = 0; i < count; i++) {
+                // Modular difference - full-range jumps wrap instead of overflowing
+                int32_t delta = (int32_t)((uint32_t)values[i] - (uint32_t)_last[i]);
+                if (delta == 0) continue;
+                bitmap[i >> 3] |= (uint8_t)(1 << (i & 7));
+                size_t n = TelemetryCodec::writeVarint(delta, out + pos, capacity - pos);
+                if (n == 0) return 0;
+                pos += n;
+            }
+        }
+
+        // Commit only after the frame fit completely
+        memcpy(_last, values, count * sizeof(int32_t));
+        _lastCount = count;
+        _sequence++;
+        _needKeyframe = false;
+
+        return pos;
+    }
+
+    // ===== Decoder =====
+
+    TelemetryDecoder::TelemetryDecoder()
+        : _count(0),
+          _sequence(0),
+          _timestampUs(0),
+          _synced(false),
+          _haveSequence(false),
+          _frames(0),
+          _lost(0),
+          _malformed(0) {
+        memset(_values, 0, sizeof(_values));
+    }
+
+    void TelemetryDecoder::reset() {
+        _synced = false;
+        _haveSequence = false;
+        _count = 0;
+    }
+
+    bool TelemetryDecoder::decode(const uint8_t* payload, size_t length) {
+        if (length < TelemetryCodec::HEADER_SIZE) {
+            _malformed++;
+            return false;
+        }
+
+        uint16_t seq = (uint16_t)payload[0] | ((uint16_t)payload[1] << 8);
+        uint32_t ts = (uint32_t)payload[2] | ((uint32_t)payload[3] << 8) |
+                      ((uint32_t)payload[4] << 16) | ((uint32_t)payload[5] << 24);
+        bool keyframe = (payload[6] & TelemetryCodec::FLAG_KEYFRAME) != 0;
+        uint8_t count = payload[7];
+
+        if (count > TWIST_TELEMETRY_MAX_CHANNELS) {
+            _malformed++;
+            return false;
+        }
+
+        // Gap detection (sequence wraps at 65536)
+        if (_haveSequence) {
+            uint16_t expected = (uint16_t)(_sequence + 1);
+            if (seq != expected) {
+                _lost += (uint16_t)(seq - expected);
+                _synced = false;
+            }
+        }
+        _sequence = seq;
+        _haveSequence = true;
+
+        if (!keyframe && (!_synced || count != _count)) {
+            return false;  // Cannot apply deltas without a base
+        }
+
+        // Decode into scratch copy so a malformed frame leaves state intact
+        int32_t next[TWIST_TELEMETRY_MAX_CHANNELS];
+        memcpy(next, _values, sizeof(next));
+
+        size_t pos = TelemetryCodec::HEADER_SIZE;
+
+        if (keyframe) {
+            for (uint8_t i = 0; i < count; i++) {
+                size_t n = TelemetryCodec::readVarint(payload + pos, length - pos, next[i]);
+                if (n == 0) { _malformed++; _synced = false; return false; }
+                pos += n;
+            }
+        } else {
+            size_t bitmapSize = (count + 7) / 8;
+            if (pos + bitmapSize > length) { _malformed++; _synced = false; return false; }
+            const uint8_t* bitmap = payload + pos;
+            pos += bitmapSize;
+
+            for (uint8_t i = 0; i < count; i++) {
+                if ((bitmap[i >> 3] & (1 << (i & 7))) == 0) continue;
+                int32_t delta;
+                size_t n = TelemetryCodec::readVarint(payload + pos, length - pos, delta);
+                if (n == 0) { _malformed++; _synced = false; return false; }
+                next[i] = (int32_t)((uint32_t)next[i] + (uint32_t)delta);
+                pos += n;
+            }
+        }
+
+        memcpy(_values, next, sizeof(_values));
+        _count = count;
+        _timestampUs = ts;
+        _synced = true;
+        _frames++;
+        return true;
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,168 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      TelemetryCodec.h
+ * @brief     Packed delta-encoded telemetry frames (encoder + host-side decoder)
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Protocol Codec (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - the SAME decoder compiles on a host PC
+ * - Channel values are fixed-point int32 (scale chosen per channel)
+ * - Keyframes carry absolute values, delta frames carry only changes
+ * - Sequence numbers expose drops; decoder resyncs on next keyframe
+ * - Zero heap allocation
+ *
+ * PAYLOAD LAYOUT (inside a WIRE_TELEMETRY frame, little-endian):
+ *   u16  sequence
+ *   u32  timestamp (microseconds, wraps)
+ *   u8   flags (bit0 = keyframe)
+ *   u8   channel count N
+ *   keyframe: N x varint(zigzag(value))
+ *   delta:    ceil(N/8) change bitmap, then varint(zigzag(value - previous))
+ *             for every channel whose bit is set
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TELEMETRY_CODEC_H
+#define TWIST_TELEMETRY_CODEC_H
+
+#include "WireFrame.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Maximum telemetry channels per frame
+#ifndef TWIST_TELEMETRY_MAX_CHANNELS
+#define TWIST_TELEMETRY_MAX_CHANNELS 32
+#endif
+
+namespace TwiST {
+
+    namespace TelemetryCodec {
+        static constexpr uint8_t FLAG_KEYFRAME = 0x01;
+        static constexpr size_t HEADER_SIZE = 8;
+
+        // Worst case payload: header + bitmap + 5 bytes per channel
+        static constexpr size_t MAX_PAYLOAD =
+            HEADER_SIZE + (TWIST_TELEMETRY_MAX_CHANNELS + 7) / 8 + 5 * TWIST_TELEMETRY_MAX_CHANNELS;
+
+        // A frame the encoder can produce must not be rejected as oversize by the decoder's parser
+        static_assert(MAX_PAYLOAD <= TWIST_WIRE_MAX_PAYLOAD,
+                      "TWIST_TELEMETRY_MAX_CHANNELS too large for TWIST_WIRE_MAX_PAYLOAD");
+
+        /**
+         * @brief Write zigzag varint
+         * @return Bytes written (0 if capacity exceeded)
+         */
+        size_t writeVarint(int32_t value, uint8_t* out, size_t capacity);
+
+        /**
+         * @brief Read zigzag varint
+         * @return Bytes consumed (0 if truncated/malformed)
+         */
+        size_t readVarint(const uint8_t* in, size_t length, int32_t& value);
+    }
+
+    /**
+     * @brief Telemetry frame encoder (device side)
+     *
+     * Keeps the previously sent values so delta frames only carry changes.
+     */
+    class TelemetryEncoder {
+    public:
+        TelemetryEncoder();
+
+        /**
+         * @brief Encode one frame payload
+         * @param values Channel values (fixed-point)
+         * @param count Number of channels (<= TWIST_TELEMETRY_MAX_CHANNELS)
+         * @param timestampUs Sample timestamp in microseconds
+         * @param keyframe Force absolute values
+         * @param out Payload buffer
+         * @param capacity Payload buffer size
+         * @return Payload length (0 if it did not fit - state unchanged)
+         */
+        size_t encode(const int32_t* values, uint8_t count, uint32_t timestampUs,
+                      bool keyframe, uint8_t* out, size_t capacity);
+
+        /**
+         * @brief Make the next frame a keyframe (after a drop)
+         */
+        void forceKeyframe() { _needKeyframe = true; }
+
+        uint16_t getSequence() const { return _sequence; }
+
+    private:
+        int32_t _last[TWIST_TELEMETRY_MAX_CHANNELS];
+        uint8_t _lastCount;
+        uint16_t _sequence;
+        bool _needKeyframe;
+    };
+
+    /**
+     * @brief Telemetry frame decoder (host side, also usable on device)
+     *
+     * Example (host):
+     * ```cpp
+     * WireFrameParser parser;
+     * TelemetryDecoder decoder;
+     * while (int c = fgetc(port); c != EOF) {
+     *     if (parser.feed(c) && parser.type() == WIRE_TELEMETRY &&
+     *         decoder.decode(parser.payload(), parser.length())) {
+     *         printf("%u: servo=%.2f\n", decoder.getTimestampUs(), decoder.getValues()[0] / 100.0);
+     *     }
+     * }
+     * ```
+     */
+    class TelemetryDecoder {
+    public:
+        TelemetryDecoder();
+
+        /**
+         * @brief Decode one frame payload
+         * @return true if values are valid (synced); false on malformed
+         *         payload or while waiting for a keyframe after a drop
+         */
+        bool decode(const uint8_t* payload, size_t length);
+
+        /**
+         * @brief Forget state (wait for next keyframe)
+         */
+        void reset();
+
+        const int32_t* getValues() const { return _values; }
+        uint8_t getChannelCount() const { return _count; }
+        uint16_t getSequence() const { return _sequence; }
+        uint32_t getTimestampUs() const { return _timestampUs; }
+        bool isSynced() const { return _synced; }
+
+        // Statistics
+        unsigned long getFrameCount() const { return _frames; }
+        unsigned long getLostFrameCount() const { return _lost; }
+        unsigned long getMalformedCount() const { return _malformed; }
+
+    private:
+        int32_t _values[TWIST_TELEMETRY_MAX_CHANNELS];
+        uint8_t _count;
+        uint16_t _sequence;
+        uint32_t _timestampUs;
+        bool _synced;
+        bool _haveSequence;
+
+        unsigned long _frames;
+        unsigned long _lost;
+        unsigned long _malformed;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_TELEMETRY_CODEC_H
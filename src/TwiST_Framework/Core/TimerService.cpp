@@ -0,0 +1,290 @@
+#include "TimerService.h"
+#include "Logger.h"
+#include <Arduino.h>
+
+namespace TwiST {
+
+    static_assert(TimerService::CAPACITY > 0 && TimerService::CAPACITY < 0xFFFF,
+                  "TWIST_TIMER_CAPACITY must be 1..65534");
+
+    TimerService::TimerService(EventBus& eventBus)
+        : _eventBus(eventBus),
+          _size(0),
+          _freeCount(CAPACITY),
+          _sequence(0),
+          _clockUs(0),
+          _lastMicros(0),
+          _peak(0),
+          _fired(0),
+          _cancelled(0),
+          _rejected(0),
+          _skipped(0),
+          _maxLatencyUs(0) {
+        for (uint16_t i = 0; i < CAPACITY; i++) {
+            _entries[i].generation = 1;
+            _entries[i].heapIndex = NOT_QUEUED;
+            _entries[i].firing = false;
+            _free[i] = CAPACITY - 1 - i;  // Pop order 0, 1, 2...
+        }
+    }
+
+    // ===== Scheduling =====
+
+    TimerHandle TimerService::setValue(IOutputDevice& device, float value, uint32_t delayUs) {
+        TimerAction action = {};
+        action.type = TIMER_SET_VALUE;
+        action.device = &device;
+        action.value = value;
+        return scheduleAt(now() + delayUs, action);
+    }
+
+    TimerHandle TimerService::moveTo(IOutputDevice& device, float target, uint32_t durationMs, uint32_t delayUs) {
+        TimerAction action = {};
+        action.type = TIMER_MOVE_TO;
+        action.device = &device;
+        action.value = target;
+        action.durationMs = durationMs;
+        return scheduleAt(now() + delayUs, action);
+    }
+
+    TimerHandle TimerService::publish(const char* eventName, uint16_t sourceId, uint32_t delayUs) {
+        TimerAction action = {};
+        action.type = TIMER_PUBLISH;
+        action.eventName = eventName;
+        action.sourceId = sourceId;
+        return scheduleAt(now() + delayUs, action);
+    }
+
+    TimerHandle TimerService::call(TimerCallback callback, void* context, uint32_t delayUs, uint32_t periodUs) {
+        TimerAction action = {};
+        action.type = TIMER_CALLBACK;
+        action.callback = callback;
+        action.context = context;
+        return scheduleAt(now() + delayUs, action, periodUs);
+    }
+
+    TimerHandle TimerService::scheduleAt(uint64_t deadlineUs, const TimerAction& action, uint32_t periodUs) {
+        bool valid = (action.type == TIMER_CALLBACK) ? (action.callback != NULL)
+                   : (action.type == TIMER_PUBLISH) ? (action.eventName != NULL)
+                   : (action.device != NULL);
+        if (!valid) {
+            _rejected++;
+            Logger::logf(Logger::Level::ERROR, "TIMER", "Rejected timer: action %d has no target", action.type);
+            return 0;
+        }
+        if (_freeCount == 0) {
+            _rejected++;
+            Logger::logf(Logger::Level::ERROR, "TIMER", "Timer pool full (%d) - raise TWIST_TIMER_CAPACITY", CAPACITY);
+            return 0;
+        }
+
+        uint16_t index = _free[--_freeCount];
+        Entry& entry = _entries[index];
+        entry.deadlineUs = deadlineUs;
+        entry.sequence = _sequence++;
+        entry.periodUs = periodUs;
+        entry.firing = false;
+        entry.cancelled = false;
+        entry.action = action;
+        push(index);
+        if (_size > _peak) _peak = _size;
+        return handleOf(index);
+    }
+
+    bool TimerService::cancel(TimerHandle handle) {
+        Entry* entry = lookup(handle);
+        if (entry == NULL) return false;
+
+        if (entry->firing) {
+            // Inside its own callback - finish the fire, just don't re-arm
+            if (entry->cancelled || entry->periodUs == 0) return false;
+            entry->cancelled = true;
+            _cancelled++;
+            return true;
+        }
+        if (entry->heapIndex == NOT_QUEUED) return false;
+
+        removeAt(entry->heapIndex);
+        release((uint16_t)(entry - _entries));
+        _cancelled++;
+        return true;
+    }
+
+    void TimerService::cancelAll() {
+        while (_size > 0) {
+            uint16_t index = _heap[0];
+            removeAt(0);
+            release(index);
+            _cancelled++;
+        }
+    }
+
+    bool TimerService::isPending(TimerHandle handle) const {
+        const Entry* entry = lookup(handle);
+        return entry != NULL && entry->heapIndex != NOT_QUEUED;
+    }
+
+    uint64_t TimerService::getRemaining(TimerHandle handle) const {
+        const Entry* entry = lookup(handle);
+        if (entry == NULL || entry->heapIndex == NOT_QUEUED) return UINT64_MAX;
+        uint64_t t = now();
+        return (entry->deadlineUs > t) ? entry->deadlineUs - t : 0;
+    }
+
+    uint64_t TimerService::now() const {
+        uint32_t us = micros();
+        _clockUs += (uint32_t)(us - _lastMicros);  // Called every pass - never a full wrap apart
+        _lastMicros = us;
+        return _clockUs;
+    }
+
+    // ===== IService =====
+
+    void TimerService::update() {
+        uint64_t t = now();
+        while (_size > 0 && _entries[_heap[0]].deadlineUs <= t) {
+            uint16_t index = _heap[0];
+            Entry& entry = _entries[index];
+            removeAt(0);
+
+            uint64_t late = t - entry.deadlineUs;
+            if (late > _maxLatencyUs) _maxLatencyUs = (late > UINT32_MAX) ? UINT32_MAX : (uint32_t)late;
+
+            entry.firing = true;
+            execute(entry.action);  // May schedule or cancel other timers
+            entry.firing = false;
+            _fired++;
+
+            if (entry.periodUs > 0 && !entry.cancelled) {
+                // Fixed rate; if a whole period was missed, resume from now rather than burst
+                entry.deadlineUs += entry.periodUs;
+                if (entry.deadlineUs <= t) {
+                    _skipped++;
+                    entry.deadlineUs = t + entry.periodUs;
+                }
+                entry.sequence = _sequence++;
+                push(index);
+            } else {
+                release(index);
+            }
+        }
+    }
+
+    uint32_t TimerService::getTimeUntilUpdate(uint32_t nowUs) const {
+        if (_size == 0) return UINT32_MAX;
+        uint64_t t = now();
+        uint64_t deadline = _entries[_heap[0]].deadlineUs;
+        if (deadline <= t) return 0;
+        uint64_t wait = deadline - t;
+        return (wait >= UINT32_MAX) ? UINT32_MAX - 1 : (uint32_t)wait;
+    }
+
+    // ===== Helpers =====
+
+    TimerService::Entry* TimerService::lookup(TimerHandle handle) {
+        uint16_t index = (uint16_t)(handle & 0xFFFF);
+        if (handle == 0 || index >= CAPACITY) return NULL;
+        Entry& entry = _entries[index];
+        return (entry.generation == (uint16_t)(handle >> 16)) ? &entry : NULL;
+    }
+
+    const TimerService::Entry* TimerService::lookup(TimerHandle handle) const {
+        return const_cast<TimerService*>(this)->lookup(handle);
+    }
+
+    TimerHandle TimerService::handleOf(uint16_t index) const {
+        return ((uint32_t)_entries[index].generation << 16) | index;
+    }
+
+    void TimerService::release(uint16_t index) {
+        Entry& entry = _entries[index];
+        entry.heapIndex = NOT_QUEUED;
+        entry.generation++;
+        if (entry.generation == 0) entry.generation = 1;  // Keep handles non-zero
+        _free[_freeCount++] = index;
+    }
+
+    void TimerService::execute(const TimerAction& action) {
+        switch (action.type) {
+            case TIMER_SET_VALUE:
+                action.device->setValue(action.value);
+                break;
+            case TIMER_MOVE_TO:
+                action.device->moveTo(action.value, action.durationMs);
+                break;
+            case TIMER_PUBLISH: {
+                Event evt = {
+                    .name = action.eventName,
+                    .sourceDeviceId = action.sourceId,
+                    .data = NULL,
+                    .priority = PRIORITY_NORMAL,
+                    .timestamp = millis()
+                };
+                _eventBus.publish(evt);
+                break;
+            }
+            case TIMER_CALLBACK:
+                action.callback(action.context);
+                break;
+        }
+    }
+
+    // ===== Heap =====
+
+    bool TimerService::earlier(uint16_t a, uint16_t b) const {
+        const Entry& x = _entries[a];
+        const Entry& y = _entries[b];
+        if (x.deadlineUs != y.deadlineUs) return x.deadlineUs < y.deadlineUs;
+        return (int32_t)(x.sequence - y.sequence) < 0;
+    }
+
+    void TimerService::place(uint16_t position, uint16_t index) {
+        _heap[position] = index;
+        _entries[index].heapIndex = position;
+    }
+
+    void TimerService::push(uint16_t index) {
+        place(_size, index);
+        _size++;
+        siftUp(_size - 1);
+    }
+
+    void TimerService::removeAt(uint16_t position) {
+        uint16_t removed = _heap[position];
+        _entries[removed].heapIndex = NOT_QUEUED;
+        _size--;
+        if (position == _size) return;
+
+        place(position, _heap[_size]);
+        if (position > 0 && earlier(_heap[position], _heap[(position - 1) / 2])) {
+            siftUp(position);
+        } else {
+            siftDown(position);
+        }
+    }
+
+    void TimerService::siftUp(uint16_t position) {
+        uint16_t index = _heap[position];
+        while (position > 0) {
+            uint16_t parent = (position - 1) / 2;
+            if (!earlier(index, _heap[parent])) break;
+            place(position, _heap[parent]);
+            position = parent;
+        }
+        place(position, index);
+    }
+
+    void TimerService::siftDown(uint16_t position) {
+        uint16_t index = _heap[position];
+        while (true) {
+            uint32_t child = 2u * position + 1;
+            if (child >= _size) break;
+            if (child + 1 < _size && earlier(_heap[child + 1], _heap[child])) child++;
+            if (!earlier(_heap[child], index)) break;
+            place(position, _heap[child]);
+            position = (uint16_t)child;
+        }
+        place(position, index);
+    }
+
+}  // namespace TwiST
@@ -0,0 +1,208 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      TimerService.h
+ * @brief     Future-dated device actions, events and callbacks fired in update()
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Framework Service (owned by TwiSTFramework, IService)
+ * - Hardware:     None
+ * - Implements:   IService
+ *
+ * PRINCIPLES:
+ * - Replaces millis() bookkeeping in loop(): "open the gripper 500 ms after
+ *   the base arrives" is one schedule call from the arrival event
+ * - Absolute 64-bit microsecond deadlines (micros() extended past its
+ *   71-minute wrap) - no wrap-around arithmetic for callers
+ * - Binary min-heap over a fixed entry pool: schedule, cancel and each
+ *   fire are O(log n); nothing is allocated after construction
+ * - Fires on the loop task only, after event processing and before device
+ *   updates - a scheduled setValue()/moveTo() is applied in the same pass
+ * - Equal deadlines fire in the order they were scheduled
+ *
+ * CAPABILITIES:
+ * - setValue / moveTo on any IOutputDevice, publish an event, call a function
+ * - One-shot or periodic (fixed rate; missed periods are skipped, not burst)
+ * - Cancellation handles (stale handles are rejected, never hit a reused slot)
+ * - Power-aware idle: getTimeUntilUpdate() = time to the earliest deadline
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TIMER_SERVICE_H
+#define TWIST_TIMER_SERVICE_H
+
+#include "../TwiST_Config.h"
+#include "../Interfaces/IService.h"
+#include "../Interfaces/IOutputDevice.h"
+#include "EventBus.h"
+#include <stdint.h>
+
+namespace TwiST {
+
+    // 0 = invalid / not scheduled
+    typedef uint32_t TimerHandle;
+
+    typedef void (*TimerCallback)(void* context);
+
+    enum TimerActionType : uint8_t {
+        TIMER_SET_VALUE,    // device->setValue(value)
+        TIMER_MOVE_TO,      // device->moveTo(value, durationMs)
+        TIMER_PUBLISH,      // eventBus.publish(eventName from sourceId)
+        TIMER_CALLBACK      // callback(context)
+    };
+
+    /**
+     * @brief What a timer does when it fires
+     */
+    struct TimerAction {
+        TimerActionType type;
+        IOutputDevice* device;      // SET_VALUE, MOVE_TO
+        float value;                // SET_VALUE value, MOVE_TO target
+        uint32_t durationMs;        // MOVE_TO
+        const char* eventName;      // PUBLISH (static string)
+        uint16_t sourceId;          // PUBLISH
+        TimerCallback callback;     // CALLBACK
+        void* context;              // CALLBACK
+    };
+
+    /**
+     * @brief Min-heap timer queue driven by TwiSTFramework::update()
+     *
+     * Example:
+     * ```cpp
+     * void onBaseArrived(const Event& evt, void* ctx) {
+     *     framework.timers().setValue(App::servo("Gripper"), 90.0f, 500000);  // +500 ms
+     * }
+     *
+     * TimerHandle blink = framework.timers().call(toggleLed, NULL, 0, 250000);  // Every 250 ms
+     * framework.timers().cancel(blink);
+     * ```
+     */
+    class TimerService : public IService {
+    public:
+        static constexpr uint16_t CAPACITY = TWIST_TIMER_CAPACITY;
+
+        explicit TimerService(EventBus& eventBus);
+
+        // ===== Scheduling (relative to now) =====
+
+        TimerHandle setValue(IOutputDevice& device, float value, uint32_t delayUs);
+        TimerHandle moveTo(IOutputDevice& device, float target, uint32_t durationMs, uint32_t delayUs);
+        TimerHandle publish(const char* eventName, uint16_t sourceId, uint32_t delayUs);
+
+        /**
+         * @brief Call a function after delayUs, then every periodUs (0 = once)
+         */
+        TimerHandle call(TimerCallback callback, void* context, uint32_t delayUs, uint32_t periodUs = 0);
+
+        // ===== Scheduling (absolute) =====
+
+        /**
+         * @brief Schedule any action at an absolute deadline
+         * @param deadlineUs On the now() time base (past deadlines fire next update)
+         * @param action What to do
+         * @param periodUs Re-arm interval (0 = one-shot)
+         * @return Handle, or 0 if the pool is full or the action is invalid (logged)
+         */
+        TimerHandle scheduleAt(uint64_t deadlineUs, const TimerAction& action, uint32_t periodUs = 0);
+
+        /**
+         * @brief Cancel a pending timer (safe from inside a firing callback)
+         * @return false if the handle already fired, was cancelled, or is invalid
+         */
+        bool cancel(TimerHandle handle);
+
+        /**
+         * @brief Cancel every pending timer
+         */
+        void cancelAll();
+
+        bool isPending(TimerHandle handle) const;
+
+        /**
+         * @brief Microseconds until a timer fires (0 = due, UINT64_MAX = not pending)
+         */
+        uint64_t getRemaining(TimerHandle handle) const;
+
+        /**
+         * @brief micros() extended to 64 bits - the time base of deadlines
+         */
+        uint64_t now() const;
+
+        // ===== IService =====
+
+        /**
+         * @brief Fire every due timer (called by TwiSTFramework::update())
+         */
+        void update() override;
+        const char* getName() const override { return "Timers"; }
+        uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+        // ===== Statistics =====
+
+        uint16_t getPendingCount() const { return _size; }
+        uint16_t getPeakPendingCount() const { return _peak; }
+        unsigned long getFiredCount() const { return _fired; }
+        unsigned long getCancelledCount() const { return _cancelled; }
+        unsigned long getRejectedCount() const { return _rejected; }  // Pool full or invalid action
+        unsigned long getSkippedPeriods() const { return _skipped; }  // Periodic timers that fell behind
+        uint32_t getMaxLatency() const { return _maxLatencyUs; }      // Worst fire time past deadline
+
+    private:
+        static constexpr uint16_t NOT_QUEUED = 0xFFFF;
+
+        struct Entry {
+            uint64_t deadlineUs;
+            uint32_t sequence;      // Tie-break: FIFO among equal deadlines
+            uint32_t periodUs;
+            uint16_t generation;    // Bumped on free - invalidates old handles
+            uint16_t heapIndex;     // Position in _heap, NOT_QUEUED if not pending
+            bool firing;
+            bool cancelled;         // Cancelled while firing (do not re-arm)
+            TimerAction action;
+        };
+
+        EventBus& _eventBus;
+
+        Entry _entries[CAPACITY];
+        uint16_t _heap[CAPACITY];   // Entry indices, earliest deadline at [0]
+        uint16_t _free[CAPACITY];   // Stack of unused entry indices
+        uint16_t _size;
+        uint16_t _freeCount;
+        uint32_t _sequence;
+
+        // 64-bit clock
+        mutable uint64_t _clockUs;
+        mutable uint32_t _lastMicros;
+
+        uint16_t _peak;
+        unsigned long _fired;
+        unsigned long _cancelled;
+        unsigned long _rejected;
+        unsigned long _skipped;
+        uint32_t _maxLatencyUs;
+
+        Entry* lookup(TimerHandle handle);
+        const Entry* lookup(TimerHandle handle) const;
+        TimerHandle handleOf(uint16_t index) const;
+        void release(uint16_t index);
+        void execute(const TimerAction& action);
+
+        // Heap
+        bool earlier(uint16_t a, uint16_t b) const;
+        void push(uint16_t index);
+        void removeAt(uint16_t position);
+        void siftUp(uint16_t position);
+        void siftDown(uint16_t position);
+        void place(uint16_t position, uint16_t index);
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_TIMER_SERVICE_H
@@ -0,0 +1,106 @@
+#include "Tracer.h"
+
+namespace TwiST {
+
+    namespace {
+        // Single slot when tracing is compiled out - no RAM cost
+        constexpr size_t TRACE_CAPACITY = TWIST_ENABLE_TRACING ? TWIST_TRACE_BUFFER_SIZE : 1;
+        TraceRecord s_records[TRACE_CAPACITY];
+
+        void printJsonString(Print& out, const char* text) {
+            out.print('"');
+            for (const char* c = text; c && *c; c++) {
+                if (*c == '"' || *c == '\\') out.print('\\');
+                out.print(*c);
+            }
+            out.print('"');
+        }
+    }
+
+    bool Tracer::_enabled = (TWIST_ENABLE_TRACING != 0);
+    size_t Tracer::_head = 0;
+    size_t Tracer::_count = 0;
+    unsigned long Tracer::_overwritten = 0;
+    uint32_t Tracer::_spanCostNs = 0;
+
+    // ===== Recording =====
+
+    void Tracer::setEnabled(bool enabled) {
+        _enabled = enabled && (TWIST_ENABLE_TRACING != 0);
+    }
+
+    void Tracer::record(const char* name, uint32_t startUs, uint32_t durationUs) {
+        if (!_enabled) return;
+
+        size_t index = (_head + _count) % TRACE_CAPACITY;
+        s_records[index].name = name;
+        s_records[index].startUs = startUs;
+        s_records[index].durationUs = durationUs;
+
+        if (_count < TRACE_CAPACITY) {
+            _count++;
+        } else {
+            _head = (_head + 1) % TRACE_CAPACITY;  // Overwrite oldest
+            _overwritten++;
+        }
+    }
+
+    void Tracer::clear() {
+        _head = 0;
+        _count = 0;
+        _overwritten = 0;
+    }
+
+    size_t Tracer::getRecordCount() {
+        return _count;
+    }
+
+    // ===== Export =====
+
+    size_t Tracer::exportChromeJson(Print& out) {
+        bool wasEnabled = _enabled;
+        _enabled = false;
+
+        out.print("{\"traceEvents\":[");
+        for (size_t i = 0; i < _count; i++) {
+            const TraceRecord& rec = s_records[(_head + i) % TRACE_CAPACITY];
+            if (i > 0) out.print(',');
+            out.print("\n{\"name\":");
+            printJsonString(out, rec.name);
+            out.print(",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":");
+            out.print((unsigned long)rec.startUs);
+            out.print(",\"dur\":");
+            out.print((unsigned long)rec.durationUs);
+            out.print('}');
+        }
+        out.print("\n],\"displayTimeUnit\":\"ns\"}\n");
+
+        size_t written = _count;
+        _enabled = wasEnabled;
+        return written;
+    }
+
+    // ===== Calibration =====
+
+    uint32_t Tracer::calibrate(uint16_t iterations) {
+        if (iterations == 0 || TWIST_ENABLE_TRACING == 0) {
+            return 0;
+        }
+
+        bool wasEnabled = _enabled;
+        _enabled = true;
+
+        uint32_t start = micros();
+        for (uint16_t i = 0; i < iterations; i++) {
+            TraceScope scope("Tracer::calibrate");
+        }
+        uint32_t elapsed = micros() - start;
+
+        _enabled = wasEnabled;
+        clear();  // Calibration spans are noise
+
+        _spanCostNs = (uint32_t)(((uint64_t)elapsed * 1000ULL) / iterations);
+        return _spanCostNs;
+    }
+
+}  // namespace TwiST
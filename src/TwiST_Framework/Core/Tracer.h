@@ -0,0 +1,145 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      Tracer.h
+ * @brief     Scoped trace spans with Chrome/Perfetto JSON export
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Static Diagnostics Service (like Logger)
+ * - Hardware:     None (uses micros())
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Compiles out completely when TWIST_ENABLE_TRACING == 0
+ * - Fixed-size records in a static ring buffer (oldest overwritten)
+ * - Span names are stored by pointer - use literals or device names
+ * - Export is offline (between loops) - never from inside a span
+ *
+ * CAPABILITIES:
+ * - TWIST_TRACE_SCOPE("name") RAII spans (nesting via timestamps)
+ * - Chrome trace JSON ("X" complete events) for chrome://tracing / Perfetto
+ * - Per-span overhead calibration
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TRACER_H
+#define TWIST_TRACER_H
+
+#include "../TwiST_Config.h"
+#include <Arduino.h>
+
+// Spans kept in the ring buffer (12 bytes each)
+#ifndef TWIST_TRACE_BUFFER_SIZE
+#define TWIST_TRACE_BUFFER_SIZE 256
+#endif
+
+namespace TwiST {
+
+    // One completed span
+    struct TraceRecord {
+        const char* name;
+        uint32_t startUs;
+        uint32_t durationUs;
+    };
+
+    /**
+     * @brief Static span recorder
+     *
+     * Usage:
+     * ```cpp
+     * void MyDriver::read() {
+     *     TWIST_TRACE_SCOPE("MyDriver::read");
+     *     ...
+     * }
+     *
+     * // Later, outside the loop:
+     * Tracer::exportChromeJson(Serial);  // Paste into ui.perfetto.dev
+     * ```
+     */
+    class Tracer {
+    public:
+        /**
+         * @brief Enable/disable recording at runtime (compiled-in builds only)
+         */
+        static void setEnabled(bool enabled);
+        static bool isEnabled() { return _enabled; }
+
+        /**
+         * @brief Store one completed span (called by TraceScope)
+         */
+        static void record(const char* name, uint32_t startUs, uint32_t durationUs);
+
+        /**
+         * @brief Drop all recorded spans
+         */
+        static void clear();
+
+        /**
+         * @brief Get number of spans currently held
+         */
+        static size_t getRecordCount();
+
+        /**
+         * @brief Get number of spans overwritten by newer ones
+         */
+        static unsigned long getOverwrittenCount() { return _overwritten; }
+
+        /**
+         * @brief Write held spans as Chrome trace JSON
+         * @param out Destination (Serial, File, ...)
+         * @return Number of spans written
+         *
+         * Recording is paused during export.
+         */
+        static size_t exportChromeJson(Print& out);
+
+        /**
+         * @brief Measure the cost of one enabled span
+         * @param iterations Spans to time
+         * @return Nanoseconds per span (also kept for getSpanCostNs())
+         *
+         * Clears the buffer - call at startup, before the spans you care about.
+         */
+        static uint32_t calibrate(uint16_t iterations = 1000);
+
+        static uint32_t getSpanCostNs() { return _spanCostNs; }
+
+    private:
+        static bool _enabled;
+        static size_t _head;
+        static size_t _count;
+        static unsigned long _overwritten;
+        static uint32_t _spanCostNs;
+    };
+
+    /**
+     * @brief RAII span - records [construction, destruction)
+     */
+    class TraceScope {
+    public:
+        explicit TraceScope(const char* name) : _name(name), _startUs((uint32_t)micros()) {}
+        ~TraceScope() { Tracer::record(_name, _startUs, (uint32_t)micros() - _startUs); }
+
+    private:
+        const char* _name;
+        uint32_t _startUs;
+    };
+
+}  // namespace TwiST
+
+#define TWIST_TRACE_CONCAT_INNER(a, b) a##b
+#define TWIST_TRACE_CONCAT(a, b) TWIST_TRACE_CONCAT_INNER(a, b)
+
+#if TWIST_ENABLE_TRACING
+#define TWIST_TRACE_SCOPE(name) TwiST::TraceScope TWIST_TRACE_CONCAT(_twistTrace, __LINE__)(name)
+#else
+#define TWIST_TRACE_SCOPE(name) do {} while (0)
+#endif
+
+#endif // TWIST_TRACER_H
@@ -0,0 +1,120 @@
+#include "WireFrame.h"
+
+namespace TwiST {
+
+    // ===== Encoding =====
+
+    uint16_t WireFrame::crc16(uint16_t crc, const uint8_t* data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            crc ^= (uint16_t)data[i] << 8;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+            }
+        }
+        return crc;
+    }
+
+    size_t WireFrame::finalize(uint8_t* frame, uint8_t type, uint16_t payloadLength) {
+        frame[0] = SYNC0;
+        frame[1] = SYNC1;
+        frame[2] = type;
+        frame[3] = (uint8_t)(payloadLength & 0xFF);
+        frame[4] = (uint8_t)(payloadLength >> 8);
+
+        // CRC covers type + length + payload (sync bytes excluded)
+        uint16_t crc = crc16(0xFFFF, frame + 2, 3 + payloadLength);
+        frame[HEADER_SIZE + payloadLength] = (uint8_t)(crc & 0xFF);
+        frame[HEADER_SIZE + payloadLength + 1] = (uint8_t)(crc >> 8);
+
+        return OVERHEAD + payloadLength;
+    }
+
+    // ===== Parsing =====
+
+    WireFrameParser::WireFrameParser()
+        : _state(WAIT_SYNC0),
+          _type(0),
+          _length(0),
+          _received(0),
+          _crc(0xFFFF),
+          _crcLow(0),
+          _frameCount(0),
+          _crcErrors(0),
+          _oversize(0) {
+    }
+
+    void WireFrameParser::reset() {
+        _state = WAIT_SYNC0;
+        _received = 0;
+        _crc = 0xFFFF;
+    }
+
+    bool WireFrameParser::feed(uint8_t byte) {
+        switch (_state) {
+            case WAIT_SYNC0:
+                if (byte == WireFrame::SYNC0) _state = WAIT_SYNC1;
+                return false;
+
+            case WAIT_SYNC1:
+                if (byte == WireFrame::SYNC1) {
+                    _state = READ_TYPE;
+                    _crc = 0xFFFF;
+                } else if (byte != WireFrame::SYNC0) {
+                    _state = WAIT_SYNC0;
+                }
+                return false;
+
+            case READ_TYPE:
+                _type = byte;
+                _crc = WireFrame::crc16(_crc, &byte, 1);
+                _state = READ_LEN0;
+                return false;
+
+            case READ_LEN0:
+                _length = byte;
+                _crc = WireFrame::crc16(_crc, &byte, 1);
+                _state = READ_LEN1;
+                return false;
+
+            case READ_LEN1:
+                _length |= (uint16_t)byte << 8;
+                _crc = WireFrame::crc16(_crc, &byte, 1);
+                if (_length > TWIST_WIRE_MAX_PAYLOAD) {
+                    _oversize++;
+                    reset();
+                    return false;
+                }
+                _received = 0;
+                _state = (_length > 0) ? READ_PAYLOAD : READ_CRC0;
+                return false;
+
+            case READ_PAYLOAD:
+                _payload[_received++] = byte;
+                if (_received >= _length) {
+                    _crc = WireFrame::crc16(_crc, _payload, _length);
+                    _state = READ_CRC0;
+                }
+                return false;
+
+            case READ_CRC0:
+                _crcLow = byte;
+                _state = READ_CRC1;
+                return false;
+
+            case READ_CRC1: {
+                uint16_t received = (uint16_t)_crcLow | ((uint16_t)byte << 8);
+                _state = WAIT_SYNC0;
+                if (received != _crc) {
+                    _crcErrors++;
+                    return false;
+                }
+                _frameCount++;
+                return true;
+            }
+        }
+
+        reset();
+        return false;
+    }
+
+}  // namespace TwiST
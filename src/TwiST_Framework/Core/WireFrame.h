@@ -0,0 +1,153 @@
+/* ============================================================================
+ * TwiST Framework | Core Framework
+ * ============================================================================
+ * @file      WireFrame.h
+ * @brief     Self-delimiting binary frame envelope shared by all wire protocols
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Core
+ * - Type:         Protocol Codec (pure C++)
+ * - Hardware:     None
+ * - Implements:   None (core infrastructure)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - same code builds on ESP32 and on a host PC
+ * - Payload is written IN PLACE after the header (no copies)
+ * - Resynchronizes on garbage (sync bytes + CRC)
+ * - Zero heap allocation
+ *
+ * FRAME LAYOUT (little-endian):
+ *   [0]   0xA5        sync
+ *   [1]   0x5A        sync
+ *   [2]   type        WireFrameType
+ *   [3-4] length      payload length (u16)
+ *   [5..] payload
+ *   [+2]  crc16       CRC-16/CCITT-FALSE over type, length and payload
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_WIRE_FRAME_H
+#define TWIST_WIRE_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Maximum payload accepted by WireFrameParser
+#ifndef TWIST_WIRE_MAX_PAYLOAD
+#define TWIST_WIRE_MAX_PAYLOAD 256
+#endif
+
+namespace TwiST {
+
+    // Frame types (one byte on the wire)
+    enum WireFrameType : uint8_t {
+        WIRE_TELEMETRY = 0x01,    // TelemetryCodec payload
+        WIRE_COMMAND   = 0x10,    // CommandProtocol request (host -> node)
+        WIRE_RESPONSE  = 0x11,    // CommandProtocol response (node -> host)
+        WIRE_REPLICATION = 0x20,  // ReplicationCodec batch (node <-> node)
+        WIRE_EVENTS    = 0x30     // EventCodec batch (EventBridge)
+    };
+
+    namespace WireFrame {
+        static constexpr uint8_t SYNC0 = 0xA5;
+        static constexpr uint8_t SYNC1 = 0x5A;
+        static constexpr size_t HEADER_SIZE = 5;
+        static constexpr size_t TRAILER_SIZE = 2;
+        static constexpr size_t OVERHEAD = HEADER_SIZE + TRAILER_SIZE;
+
+        /**
+         * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+         * @param crc Running CRC (start with 0xFFFF)
+         * @param data Bytes
+         * @param length Number of bytes
+         * @return Updated CRC
+         */
+        uint16_t crc16(uint16_t crc, const uint8_t* data, size_t length);
+
+        /**
+         * @brief Get pointer where the payload must be written
+         * @param frame Frame buffer (capacity >= OVERHEAD + payload)
+         */
+        inline uint8_t* payload(uint8_t* frame) { return frame + HEADER_SIZE; }
+
+        /**
+         * @brief Finalize a frame whose payload was written in place
+         * @param frame Frame buffer (payload already at payload(frame))
+         * @param type Frame type
+         * @param payloadLength Payload length in bytes
+         * @return Total frame length (header + payload + CRC)
+         */
+        size_t finalize(uint8_t* frame, uint8_t type, uint16_t payloadLength);
+    }
+
+    /**
+     * @brief Incremental frame parser (byte-at-a-time state machine)
+     *
+     * Feed raw transport bytes; a complete, CRC-checked frame becomes
+     * available when feed() returns true. Payload stays valid until the
+     * next feed() call.
+     *
+     * Example:
+     * ```cpp
+     * WireFrameParser parser;
+     * uint8_t buf[64];
+     * size_t n = transport.receive(buf, sizeof(buf));
+     * for (size_t i = 0; i < n; i++) {
+     *     if (parser.feed(buf[i])) {
+     *         handle(parser.type(), parser.payload(), parser.length());
+     *     }
+     * }
+     * ```
+     */
+    class WireFrameParser {
+    public:
+        WireFrameParser();
+
+        /**
+         * @brief Feed one byte
+         * @param byte Received byte
+         * @return true if a complete valid frame is now available
+         */
+        bool feed(uint8_t byte);
+
+        /**
+         * @brief Reset parser state (drop partial frame)
+         */
+        void reset();
+
+        uint8_t type() const { return _type; }
+        const uint8_t* payload() const { return _payload; }
+        uint16_t length() const { return _length; }
+
+        // Statistics
+        unsigned long getFrameCount() const { return _frameCount; }
+        unsigned long getCrcErrorCount() const { return _crcErrors; }
+        unsigned long getOversizeCount() const { return _oversize; }
+
+    private:
+        enum State : uint8_t {
+            WAIT_SYNC0, WAIT_SYNC1, READ_TYPE, READ_LEN0, READ_LEN1,
+            READ_PAYLOAD, READ_CRC0, READ_CRC1
+        };
+
+        State _state;
+        uint8_t _type;
+        uint16_t _length;
+        uint16_t _received;
+        uint16_t _crc;
+        uint8_t _crcLow;
+        uint8_t _payload[TWIST_WIRE_MAX_PAYLOAD];
+
+        unsigned long _frameCount;
+        unsigned long _crcErrors;
+        unsigned long _oversize;
+    };
+
+}  // namespace TwiST
+
+#endif // TWIST_WIRE_FRAME_H
@@ -0,0 +1,261 @@
+#include "AnalogInputArray.h"
+#include "../Core/Logger.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        AnalogInputArray::AnalogInputArray(IADCDriver* const* axes, uint8_t count, uint16_t deviceId,
+                                           const char* name, EventBus& eventBus)
+            : _count(0), _deviceId(deviceId), _name(name), _eventBus(eventBus) {
+            // All dependencies locked at construction - no half-initialized state possible
+            if (count > TWIST_ANALOG_MAX_AXES) count = TWIST_ANALOG_MAX_AXES;  // Reported by initialize()
+            for (uint8_t i = 0; i < count; i++) {
+                _axes[i] = axes[i];
+                _raw[i] = 0;
+                _values[i] = 0.5f;
+                _reported[i] = 0.5f;
+            }
+            _count = count;
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool AnalogInputArray::initialize() {
+            _state = STATE_INITIALIZING;
+            if (_count == 0) {
+                Logger::logf(Logger::Level::ERROR, "ANALOG", "%s: no axes", _name);
+                _state = STATE_ERROR;
+                return false;
+            }
+            for (uint8_t i = 0; i < _count; i++) {
+                if (_axes[i] == NULL) {
+                    Logger::logf(Logger::Level::ERROR, "ANALOG", "%s: axis %d has no driver", _name, i);
+                    _state = STATE_ERROR;
+                    return false;
+                }
+                // Default: centered axis over the driver's full range
+                uint16_t max = _axes[i]->getMaxValue();
+                calibrateAxis(i, 0, (max + 1) / 2, max);
+            }
+            _scanCount = 0;
+            _state = STATE_READY;
+            return true;
+        }
+
+        void AnalogInputArray::shutdown() {
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void AnalogInputArray::update() {
+            if (!_enabled || _state != STATE_READY) return;
+            scan();
+
+            if (_changeThreshold <= 0.0f) return;
+            bool moved = false;
+            for (uint8_t i = 0; i < _count; i++) {
+                float delta = _values[i] - _reported[i];
+                if (delta > _changeThreshold || delta < -_changeThreshold) {
+                    moved = true;
+                    break;
+                }
+            }
+            if (!moved) return;
+
+            for (uint8_t i = 0; i < _count; i++) {
+                _reported[i] = _values[i];
+            }
+            Event evt = {
+                .name = "input.axes.changed",
+                .sourceDeviceId = _deviceId,
+                .data = NULL,
+                .priority = PRIORITY_NORMAL,
+                .timestamp = millis()
+            };
+            _eventBus.publish(evt);
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo AnalogInputArray::getInfo() const {
+            DeviceInfo info;
+            info.type = "AnalogInputArray";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = _count;  // One channel per axis
+            return info;
+        }
+
+        uint16_t AnalogInputArray::getCapabilities() const {
+            return CAP_INPUT | CAP_ANALOG | CAP_CALIBRATABLE | CAP_CONFIGURABLE;
+        }
+
+        bool AnalogInputArray::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState AnalogInputArray::getState() const {
+            return _state;
+        }
+
+        void AnalogInputArray::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                _state = STATE_READY;
+            }
+        }
+
+        void AnalogInputArray::disable() {
+            _enabled = false;
+            _state = STATE_DISABLED;
+        }
+
+        bool AnalogInputArray::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool AnalogInputArray::configure(const JsonDocument& config) {
+            if (config.containsKey("deadzone")) setDeadzone(config["deadzone"]);
+            if (config.containsKey("changeThreshold")) _changeThreshold = config["changeThreshold"];
+            if (config.containsKey("axes")) {
+                for (uint8_t i = 0; i < _count; i++) {
+                    if (!config["axes"][i].containsKey("max")) continue;
+                    calibrateAxis(i, config["axes"][i]["min"], config["axes"][i]["center"], config["axes"][i]["max"]);
+                }
+            }
+            return true;
+        }
+
+        void AnalogInputArray::getConfiguration(JsonDocument& config) const {
+            config["deadzone"] = _deadzone;
+            config["changeThreshold"] = _changeThreshold;
+            for (uint8_t i = 0; i < _count; i++) {
+                config["axes"][i]["min"] = _cal[i].min;
+                config["axes"][i]["center"] = _cal[i].center;
+                config["axes"][i]["max"] = _cal[i].max;
+            }
+        }
+
+        // ===== IDevice Serialization =====
+
+        void AnalogInputArray::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "AnalogInputArray";
+            for (uint8_t i = 0; i < _count; i++) {
+                doc["values"][i] = _values[i];
+            }
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool AnalogInputArray::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("enabled")) {
+                if (doc["enabled"].as<bool>()) enable(); else disable();
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t AnalogInputArray::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+            return TWIST_ANALOG_IDLE_SCAN_US;  // Pots have no interrupt - scan at a human rate
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t AnalogInputArray::captureState(float* values, uint8_t maxValues) const {
+            // Axis values of the last scan, in axis order
+            uint8_t n = 0;
+            while (n < _count && n < maxValues) {
+                values[n] = _values[n];
+                n++;
+            }
+            return n;
+        }
+
+        // ===== IInputDevice Implementation =====
+
+        float AnalogInputArray::readAnalog(uint8_t axis) {
+            return (axis < _count) ? _values[axis] : 0.5f;  // Center for unknown axes (as Joystick)
+        }
+
+        bool AnalogInputArray::readDigital(uint8_t button) {
+            return false;
+        }
+
+        // ===== AnalogInputArray-specific API =====
+
+        void AnalogInputArray::scan() {
+            // Raw pass first: all conversions back to back, then the math
+            for (uint8_t i = 0; i < _count; i++) {
+                _raw[i] = _axes[i]->readRaw();
+            }
+            for (uint8_t i = 0; i < _count; i++) {
+                _values[i] = mapAxis(_cal[i], _raw[i]);
+            }
+            _scanCount++;
+        }
+
+        uint8_t AnalogInputArray::readAll(float* out) const {
+            for (uint8_t i = 0; i < _count; i++) {
+                out[i] = _values[i];
+            }
+            return _count;
+        }
+
+        void AnalogInputArray::calibrateAxis(uint8_t axis, uint16_t min, uint16_t center, uint16_t max) {
+            if (axis >= _count) {
+                Logger::logf(Logger::Level::ERROR, "ANALOG", "%s: no axis %d", _name, axis);
+                return;
+            }
+            if (min >= max || (center != 0 && (center <= min || center >= max))) {
+                Logger::logf(Logger::Level::ERROR, "ANALOG", "%s: axis %d invalid calibration %d/%d/%d",
+                            _name, axis, min, center, max);
+                return;
+            }
+            _cal[axis].min = min;
+            _cal[axis].center = center;
+            _cal[axis].max = max;
+            computeScale(_cal[axis]);
+        }
+
+        void AnalogInputArray::setDeadzone(uint16_t deadzone) {
+            _deadzone = deadzone;
+        }
+
+        // ===== Helper Methods =====
+
+        void AnalogInputArray::computeScale(Axis& axis) {
+            if (axis.center == 0) {
+                axis.lowScale = 1.0f / (float)(axis.max - axis.min);
+                axis.highScale = 0.0f;
+            } else {
+                axis.lowScale = 0.5f / (float)(axis.center - axis.min);
+                axis.highScale = 0.5f / (float)(axis.max - axis.center);
+            }
+        }
+
+        float AnalogInputArray::mapAxis(const Axis& axis, uint16_t raw) const {
+            if (raw < axis.min) raw = axis.min;
+            if (raw > axis.max) raw = axis.max;
+
+            if (axis.center == 0) {
+                return (raw - axis.min) * axis.lowScale;
+            }
+
+            int32_t offset = (int32_t)raw - (int32_t)axis.center;
+            if (offset < _deadzone && offset > -(int32_t)_deadzone) {
+                return 0.5f;
+            }
+            return (offset < 0) ? (raw - axis.min) * axis.lowScale
+                                : 0.5f + offset * axis.highScale;
+        }
+
+    }
+}  // namespace TwiST::Devices
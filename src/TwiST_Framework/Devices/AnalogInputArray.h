@@ -0,0 +1,166 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      AnalogInputArray.h
+ * @brief     N analog axes sampled in one scan into a normalized array
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Native Input Device (multi-axis)
+ * - Hardware:     ADC via IADCDriver abstraction (any mix of drivers)
+ * - Dependency:   EventBus, IADCDriver
+ *
+ * PRINCIPLES:
+ * - No hardware knowledge (NO Drivers includes)
+ * - Constructor Injection only
+ * - One AnalogInputArray = one operator console / gamepad (sticks, sliders, knobs)
+ * - update() scans ALL axes once into a contiguous float array; readers
+ *   get that snapshot - no ADC access and no per-axis virtual call
+ * - Calibration is folded into per-axis scale factors (no divisions per scan)
+ *
+ * CAPABILITIES:
+ * - Up to TWIST_ANALOG_MAX_AXES axes
+ * - Centered axes (stick: 0.5 at rest, deadzone) and linear axes (slider, knob)
+ * - Bulk readAll(float*) / getValues(), raw values, scan counter
+ * - "input.axes.changed" when any axis moves more than the change threshold
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================*/
+
+#ifndef TWIST_DEVICE_ANALOGINPUTARRAY_H
+#define TWIST_DEVICE_ANALOGINPUTARRAY_H
+
+#include "../Interfaces/IInputDevice.h"
+#include "../Interfaces/IADCDriver.h"  // ONLY ABSTRACTION!
+#include "../Core/EventBus.h"
+
+// Axes per array
+#ifndef TWIST_ANALOG_MAX_AXES
+#define TWIST_ANALOG_MAX_AXES 8
+#endif
+
+// Scan period while the loop idles (100 Hz - faster than a hand moves a stick)
+#ifndef TWIST_ANALOG_IDLE_SCAN_US
+#define TWIST_ANALOG_IDLE_SCAN_US 10000
+#endif
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Multi-axis analog input device - implements IInputDevice
+         *
+         * Values are normalized 0.0-1.0 (centered axes rest at 0.5) and refreshed
+         * once per update(); call scan() for an out-of-band refresh.
+         *
+         * Example usage:
+         * ```cpp
+         * IADCDriver* axes[6] = {&lx, &ly, &rx, &ry, &throttle, &knob};
+         * Devices::AnalogInputArray console(axes, 6, 210, "Console", eventBus);
+         * console.initialize();
+         * console.calibrateAxis(4, 120, 0, 3980);   // Throttle: linear (center 0)
+         * float in[6];
+         * console.readAll(in);                      // One copy, whole snapshot
+         * ```
+         */
+        class AnalogInputArray : public IInputDevice {
+        public:
+            /**
+             * @param axes Array of ADC driver pointers (copied, drivers must outlive the device)
+             * @param count Number of axes
+             * @param deviceId Unique device ID
+             * @param name Human-readable device name (e.g., "Console")
+             * @param eventBus Reference to EventBus (ALL dependencies in constructor!)
+             */
+            AnalogInputArray(IADCDriver* const* axes, uint8_t count, uint16_t deviceId,
+                             const char* name, EventBus& eventBus);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IInputDevice interface (cached value from the last scan)
+            float readAnalog(uint8_t axis) override;
+            bool readDigital(uint8_t button) override;     // No buttons - use DigitalInput devices
+            bool isInputReady() override { return _scanCount > 0; }
+
+            // Bulk access
+            void scan();                                    // Sample all axes now
+            uint8_t readAll(float* out) const;              // Copies getAxisCount() values, returns count
+            const float* getValues() const { return _values; }  // Valid until the next scan
+            uint16_t getRaw(uint8_t axis) const { return (axis < _count) ? _raw[axis] : 0; }
+            uint8_t getAxisCount() const { return _count; }
+            uint32_t getScanCount() const { return _scanCount; }
+
+            /**
+             * @brief Calibrate one axis
+             * @param center Rest position, 0 = linear axis (slider, knob)
+             */
+            void calibrateAxis(uint8_t axis, uint16_t min, uint16_t center, uint16_t max);
+            void setDeadzone(uint16_t deadzone);            // Centered axes, raw ADC units
+            void setChangeThreshold(float threshold) { _changeThreshold = threshold; }  // 0 = no events
+
+        private:
+            struct Axis {
+                uint16_t min;
+                uint16_t center;            // 0 = linear
+                uint16_t max;
+                float lowScale;             // 0.5 / (center - min), or 1 / (max - min) if linear
+                float highScale;            // 0.5 / (max - center)
+            };
+
+            IADCDriver* _axes[TWIST_ANALOG_MAX_AXES];
+            Axis _cal[TWIST_ANALOG_MAX_AXES];
+            uint16_t _raw[TWIST_ANALOG_MAX_AXES];
+            float _values[TWIST_ANALOG_MAX_AXES];
+            float _reported[TWIST_ANALOG_MAX_AXES];        // Values at the last change event
+            uint8_t _count;
+            uint16_t _deviceId;
+            const char* _name;
+            EventBus& _eventBus;
+
+            uint16_t _deadzone = 50;
+            float _changeThreshold = 0.0f;
+            uint32_t _scanCount = 0;
+
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            void computeScale(Axis& axis);
+            float mapAxis(const Axis& axis, uint16_t raw) const;
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
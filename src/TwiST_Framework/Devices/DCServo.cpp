@@ -0,0 +1,407 @@
+#include "DCServo.h"
+#include "../Core/Logger.h"
+#include <math.h>
+
+namespace TwiST {
+    namespace Devices {
+
+        static const uint8_t SETPOINT_FRAC = 16;   // Trajectory resolution: 1/65536 count
+
+        DCServo::DCServo(IEncoderDriver& encoder, IPWMDriver& pwm, uint8_t channelA, uint8_t channelB,
+                         uint16_t deviceId, const char* name, EventBus& eventBus, uint16_t rateHz)
+            : _encoder(encoder), _pwm(pwm), _channelA(channelA), _channelB(channelB),
+              _deviceId(deviceId), _name(name), _eventBus(eventBus),
+              _rate(rateHz == 0 ? 1 : rateHz),
+              _period(1000000UL / (rateHz == 0 ? 1 : rateHz)) {
+            // All dependencies locked at construction - no half-initialized state possible
+            _pid.setPeriod(_period);
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool DCServo::initialize() {
+            _state = STATE_INITIALIZING;
+            if (_channelA == _channelB) {
+                Logger::logf(Logger::Level::ERROR, "DCSERVO", "%s: both directions on channel %d", _name, _channelA);
+                _state = STATE_ERROR;
+                return false;
+            }
+
+            _pid.setOutputLimit(_pwm.getMaxPWM());
+            applyGains();
+            _pwm.setPWM(_channelA, 0);
+            _pwm.setPWM(_channelB, 0);
+            _dutyA = 0;
+            _dutyB = 0;
+            hold();
+
+            _lastTickUs = micros();
+            _nextTickUs = _lastTickUs + _period;
+            _state = STATE_READY;
+            return true;
+        }
+
+        void DCServo::shutdown() {
+            writeOutput(0);
+            _trajectory = false;
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void DCServo::update() {
+            if (!_enabled || _state != STATE_READY) return;
+
+            uint32_t now = micros();
+            if ((int32_t)(now - _nextTickUs) < 0) return;
+
+            // Absolute schedule - a late tick does not shift the ones after it
+            uint32_t late = now - _nextTickUs;
+            if (late >= _period) {
+                uint32_t skipped = late / _period;
+                _missedTicks += skipped;
+                _nextTickUs += skipped * _period;
+            }
+            _nextTickUs += _period;
+
+            _lastInterval = now - _lastTickUs;
+            _lastTickUs = now;
+            uint32_t jitter = (_lastInterval > _period) ? _lastInterval - _period : _period - _lastInterval;
+            if (jitter > _maxJitter && _ticks > 0) _maxJitter = jitter;
+            _ticks++;
+
+            controlStep();
+
+            _computeUs = micros() - now;
+            if (_computeUs > _maxComputeUs) _maxComputeUs = _computeUs;
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo DCServo::getInfo() const {
+            DeviceInfo info;
+            info.type = "DCServo";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = 2;  // IN1 + IN2
+            return info;
+        }
+
+        uint16_t DCServo::getCapabilities() const {
+            return CAP_OUTPUT | CAP_POSITION | CAP_VELOCITY | CAP_CONFIGURABLE;
+        }
+
+        bool DCServo::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState DCServo::getState() const {
+            return _state;
+        }
+
+        void DCServo::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                hold();  // Bumpless: hold wherever the motor coasted to
+                _lastTickUs = micros();
+                _nextTickUs = _lastTickUs + _period;
+                _state = STATE_READY;
+            }
+        }
+
+        void DCServo::disable() {
+            _enabled = false;
+            _trajectory = false;
+            writeOutput(0);  // Coast
+            _state = STATE_DISABLED;
+        }
+
+        bool DCServo::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool DCServo::configure(const JsonDocument& config) {
+            if (config.containsKey("countsPerUnit")) setCountsPerUnit(config["countsPerUnit"]);
+            if (config.containsKey("rateHz")) setRate(config["rateHz"]);
+            if (config.containsKey("kp")) _kp = config["kp"];
+            if (config.containsKey("ki")) _ki = config["ki"];
+            if (config.containsKey("kd")) _kd = config["kd"];
+            if (config.containsKey("kv")) _kv = config["kv"];
+            if (config.containsKey("ks")) _ks = config["ks"];
+            applyGains();
+            if (config.containsKey("maxSpeed")) setMaxSpeed(config["maxSpeed"]);
+            if (config.containsKey("tolerance")) setTolerance(config["tolerance"]);
+            if (config.containsKey("minPosition") && config.containsKey("maxPosition")) {
+                setLimits(config["minPosition"], config["maxPosition"]);
+            }
+            return true;
+        }
+
+        void DCServo::getConfiguration(JsonDocument& config) const {
+            config["countsPerUnit"] = _countsPerUnit;
+            config["rateHz"] = _rate;
+            config["kp"] = _kp;
+            config["ki"] = _ki;
+            config["kd"] = _kd;
+            config["kv"] = _kv;
+            config["ks"] = _ks;
+            config["maxSpeed"] = _maxSpeed;
+            config["tolerance"] = _tolerance / _countsPerUnit;
+            if (_hasLimits) {
+                config["minPosition"] = _minPosition;
+                config["maxPosition"] = _maxPosition;
+            }
+        }
+
+        // ===== IDevice Serialization =====
+
+        void DCServo::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "DCServo";
+            doc["position"] = getValue();
+            doc["target"] = _target;
+            doc["error"] = getTrackingError();
+            doc["output"] = getOutput();
+            doc["moving"] = isMoving();
+            doc["jitterUs"] = _maxJitter;
+            doc["missed"] = _missedTicks;
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool DCServo::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("position")) {
+                setValue(doc["position"]);
+            }
+            if (doc.containsKey("enabled")) {
+                if (doc["enabled"].as<bool>()) enable(); else disable();
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t DCServo::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+            int32_t remaining = (int32_t)(_nextTickUs - nowUs);
+            return (remaining > 0) ? (uint32_t)remaining : 0;
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t DCServo::captureState(float* values, uint8_t maxValues) const {
+            // [0] measured position, [1] trajectory setpoint, [2] signed duty
+            uint8_t n = 0;
+            if (n < maxValues) values[n++] = getValue();
+            if (n < maxValues) values[n++] = getSetpoint();
+            if (n < maxValues) values[n++] = getOutput();
+            return n;
+        }
+
+        // ===== IOutputDevice Implementation =====
+
+        void DCServo::setValue(float position) {
+            startMove(position, _maxSpeed);
+        }
+
+        void DCServo::setNormalized(float value) {
+            if (!_hasLimits) {
+                Logger::logf(Logger::Level::ERROR, "DCSERVO", "%s: setNormalized() needs setLimits()", _name);
+                return;
+            }
+            if (value < 0.0f) value = 0.0f;
+            if (value > 1.0f) value = 1.0f;
+            setValue(_minPosition + value * (_maxPosition - _minPosition));
+        }
+
+        void DCServo::moveTo(float target, unsigned long duration) {
+            target = clampPosition(target);
+            float distance = fabsf(target - getSetpoint());
+            float speed = (duration > 0) ? distance * 1000.0f / duration : _maxSpeed;
+            if (speed > _maxSpeed) speed = _maxSpeed;  // Too short - go as fast as allowed
+            startMove(target, speed);
+        }
+
+        float DCServo::getValue() const {
+            return _encoder.readCount() / _countsPerUnit;
+        }
+
+        bool DCServo::isMoving() const {
+            return _trajectory || !_settled;
+        }
+
+        // ===== DCServo-specific API =====
+
+        void DCServo::setCountsPerUnit(float countsPerUnit) {
+            if (countsPerUnit <= 0.0f) {
+                // Direction is fixed by wiring: swap channelA/B if the motor runs away
+                Logger::logf(Logger::Level::ERROR, "DCSERVO", "%s: countsPerUnit must be > 0", _name);
+                return;
+            }
+            float tolerance = _tolerance / _countsPerUnit;
+            _countsPerUnit = countsPerUnit;
+            setTolerance(tolerance);
+            applyGains();
+        }
+
+        void DCServo::setGains(float kp, float ki, float kd) {
+            _kp = kp;
+            _ki = ki;
+            _kd = kd;
+            applyGains();
+        }
+
+        void DCServo::setFeedForward(float kv, float ks) {
+            _kv = kv;
+            _ks = ks;
+            applyGains();
+        }
+
+        void DCServo::setMaxSpeed(float unitsPerSecond) {
+            if (unitsPerSecond <= 0.0f) {
+                Logger::logf(Logger::Level::ERROR, "DCSERVO", "%s: maxSpeed must be > 0", _name);
+                return;
+            }
+            _maxSpeed = unitsPerSecond;
+        }
+
+        void DCServo::setLimits(float minPosition, float maxPosition) {
+            if (minPosition >= maxPosition) {
+                Logger::logf(Logger::Level::ERROR, "DCSERVO", "%s: invalid limits %.2f..%.2f",
+                            _name, minPosition, maxPosition);
+                return;
+            }
+            _minPosition = minPosition;
+            _maxPosition = maxPosition;
+            _hasLimits = true;
+        }
+
+        void DCServo::setTolerance(float units) {
+            int32_t counts = (int32_t)lroundf(fabsf(units) * _countsPerUnit);
+            _tolerance = (counts < 1) ? 1 : counts;
+        }
+
+        void DCServo::setRate(uint16_t rateHz) {
+            if (rateHz == 0) {
+                Logger::logf(Logger::Level::ERROR, "DCSERVO", "%s: rate must be > 0 Hz", _name);
+                return;
+            }
+            _rate = rateHz;
+            _period = 1000000UL / rateHz;
+            _pid.setPeriod(_period);
+            _nextTickUs = micros() + _period;
+        }
+
+        float DCServo::getSetpoint() const {
+            return (float)_setpoint / (float)(1L << SETPOINT_FRAC) / _countsPerUnit;
+        }
+
+        float DCServo::getOutput() const {
+            uint16_t max = _pwm.getMaxPWM();
+            if (max == 0) return 0.0f;
+            return ((float)_dutyA - (float)_dutyB) / max;
+        }
+
+        void DCServo::resetStats() {
+            _maxJitter = 0;
+            _missedTicks = 0;
+            _maxComputeUs = 0;
+            _maxError = 0;
+        }
+
+        // ===== Helper Methods =====
+
+        void DCServo::controlStep() {
+            int32_t measured = _encoder.readCount();
+
+            if (_trajectory) {
+                int64_t remaining = (_targetCounts << SETPOINT_FRAC) - _setpoint;
+                int64_t distance = (remaining < 0) ? -remaining : remaining;
+                if (distance <= _stepPerTick) {
+                    _setpoint = _targetCounts << SETPOINT_FRAC;
+                    _velocity = 0;
+                    _trajectory = false;
+                } else {
+                    _setpoint += (remaining > 0) ? _stepPerTick : -_stepPerTick;
+                }
+            }
+
+            int32_t setpoint = (int32_t)((_setpoint + (1 << (SETPOINT_FRAC - 1))) >> SETPOINT_FRAC);
+            writeOutput(_pid.step(setpoint, measured, _trajectory ? _velocity : 0));
+
+            int32_t error = _pid.getError();
+            if (error < 0) error = -error;
+            if (error > _maxError) _maxError = error;
+
+            if (!_trajectory && !_settled && error <= _tolerance) {
+                _settled = true;
+                Event evt = {
+                    .name = "motor.settled",
+                    .sourceDeviceId = _deviceId,
+                    .data = NULL,
+                    .priority = PRIORITY_NORMAL,
+                    .timestamp = millis()
+                };
+                _eventBus.publish(evt);
+            }
+        }
+
+        void DCServo::startMove(float target, float speed) {
+            if (!_enabled || _state != STATE_READY) return;
+            if (speed <= 0.0f) speed = _maxSpeed;
+
+            // Trajectory continues from the current setpoint - no step in the reference
+            _target = clampPosition(target);
+            _targetCounts = (int64_t)llroundf(_target * _countsPerUnit);
+            float countsPerTick = speed * _countsPerUnit / _rate;
+            _stepPerTick = (int64_t)(countsPerTick * (float)(1L << SETPOINT_FRAC));
+            if (_stepPerTick < 1) _stepPerTick = 1;
+            int64_t remaining = (_targetCounts << SETPOINT_FRAC) - _setpoint;
+            int32_t countsPerSecond = (int32_t)lroundf(speed * _countsPerUnit);
+            _velocity = (remaining >= 0) ? countsPerSecond : -countsPerSecond;
+            _trajectory = true;
+            _settled = false;
+        }
+
+        void DCServo::hold() {
+            int32_t measured = _encoder.readCount();
+            _setpoint = (int64_t)measured << SETPOINT_FRAC;
+            _targetCounts = measured;
+            _target = measured / _countsPerUnit;
+            _trajectory = false;
+            _settled = true;
+            _velocity = 0;
+            _pid.reset(measured);
+        }
+
+        void DCServo::writeOutput(int32_t output) {
+            uint16_t a = (output > 0) ? (uint16_t)output : 0;
+            uint16_t b = (output < 0) ? (uint16_t)(-output) : 0;
+
+            // Release the side being turned off first (never both driven on a reversal)
+            if (a < _dutyA) { _pwm.setPWM(_channelA, a); _dutyA = a; }
+            if (b < _dutyB) { _pwm.setPWM(_channelB, b); _dutyB = b; }
+            if (a != _dutyA) { _pwm.setPWM(_channelA, a); _dutyA = a; }
+            if (b != _dutyB) { _pwm.setPWM(_channelB, b); _dutyB = b; }
+        }
+
+        void DCServo::applyGains() {
+            // User gains are duty fractions per user unit; the PID works in PWM ticks per count
+            float scale = (float)_pwm.getMaxPWM() / _countsPerUnit;
+            _pid.setGains(_kp * scale, _ki * scale, _kd * scale);
+            _pid.setFeedForward(_kv * scale, (int32_t)lroundf(_ks * _pwm.getMaxPWM()));
+        }
+
+        float DCServo::clampPosition(float position) const {
+            if (!_hasLimits) return position;
+            if (position < _minPosition) return _minPosition;
+            if (position > _maxPosition) return _maxPosition;
+            return position;
+        }
+
+    }
+}  // namespace TwiST::Devices
@@ -0,0 +1,204 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      DCServo.h
+ * @brief     Closed-loop DC motor: encoder feedback, fixed-rate PID, PWM H-bridge
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Native Output Device
+ * - Hardware:     IEncoderDriver (feedback) + two IPWMDriver channels (IN1/IN2)
+ * - Dependency:   EventBus, IEncoderDriver, IPWMDriver, PIDController
+ *
+ * PRINCIPLES:
+ * - No hardware knowledge (NO Drivers includes)
+ * - Constructor Injection only
+ * - One DCServo instance = one motor + its encoder
+ * - Fixed-rate loop: update() runs the controller on an absolute tick
+ *   schedule (next = previous + period, never drifts); late ticks are
+ *   counted, not replayed - the PID always integrates the nominal period
+ * - Controller is integer-only (PIDController); float work happens when
+ *   gains or targets are set
+ * - PWM writes only when the duty changes (I2C drivers stay quiet at rest)
+ *
+ * CAPABILITIES:
+ * - Position control in user units (countsPerUnit)
+ * - Constant-speed setpoint trajectory with velocity feed-forward
+ * - Anti-windup (motor stalled against a limit does not overshoot later)
+ * - Tracking error, loop interval/jitter, missed ticks, compute time
+ * - "motor.settled" event when a move ends within tolerance
+ * - JSON configuration & serialization
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================*/
+
+#ifndef TWIST_DEVICE_DCSERVO_H
+#define TWIST_DEVICE_DCSERVO_H
+
+#include "../Interfaces/IOutputDevice.h"
+#include "../Interfaces/IEncoderDriver.h"  // ONLY ABSTRACTION!
+#include "../Interfaces/IPWMDriver.h"      // ONLY ABSTRACTION!
+#include "../Core/EventBus.h"
+#include "../Core/PIDController.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Encoder-feedback DC motor - implements IOutputDevice
+         *
+         * Output: sign-magnitude on two PWM channels (DRV8833/TB6612 IN1/IN2 style):
+         * positive drive = channel A, negative = channel B, zero = both off (coast).
+         *
+         * Example usage:
+         * ```cpp
+         * Devices::DCServo elbow(elbowEnc, pwm, 4, 5, 610, "Elbow", eventBus, 1000);
+         * elbow.setCountsPerUnit(4096.0f / 360.0f);   // Degrees
+         * elbow.setGains(0.04f, 0.2f, 0.0008f);       // Duty per degree, per degree*s, per degree/s
+         * elbow.setFeedForward(0.004f, 0.05f);        // Duty per degree/s, friction duty
+         * elbow.setMaxSpeed(180.0f);
+         * elbow.moveTo(45.0f, 500);
+         * ```
+         */
+        class DCServo : public IOutputDevice {
+        public:
+            /**
+             * @param encoder Reference to IEncoderDriver (NOT ESP32PCNT!)
+             * @param pwm Reference to IPWMDriver (NOT PCA9685!)
+             * @param channelA PWM channel driving forward (count-increasing)
+             * @param channelB PWM channel driving reverse
+             * @param deviceId Unique device ID
+             * @param name Human-readable device name (e.g., "Elbow")
+             * @param eventBus Reference to EventBus (ALL dependencies in constructor!)
+             * @param rateHz Control loop rate
+             */
+            DCServo(IEncoderDriver& encoder, IPWMDriver& pwm, uint8_t channelA, uint8_t channelB,
+                    uint16_t deviceId, const char* name, EventBus& eventBus, uint16_t rateHz = 1000);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IOutputDevice interface
+            void setValue(float position) override;     // Move at max speed
+            void setNormalized(float value) override;   // 0.0-1.0 across setLimits()
+            void moveTo(float target, unsigned long duration) override;
+            float getValue() const override;            // Measured position
+            bool isMoving() const override;
+
+            // DCServo-specific API
+            void setCountsPerUnit(float countsPerUnit);
+            void setGains(float kp, float ki, float kd);    // Duty (0-1) per unit, unit*s, unit/s
+            void setFeedForward(float kv, float ks = 0.0f); // Duty per unit/s, friction duty
+            void setDerivativeFilter(uint8_t shift) { _pid.setDerivativeFilter(shift); }
+            void setMaxSpeed(float unitsPerSecond);
+            void setLimits(float minPosition, float maxPosition);
+            void setTolerance(float units);
+            void setRate(uint16_t rateHz);
+            float getTarget() const { return _target; }
+            float getSetpoint() const;                  // Where the trajectory is now
+            float getOutput() const;                    // Signed duty -1.0..1.0
+
+            // Tracking & loop timing
+            float getTrackingError() const { return _pid.getError() / _countsPerUnit; }
+            float getMaxTrackingError() const { return _maxError / _countsPerUnit; }
+            uint16_t getRate() const { return _rate; }
+            uint32_t getLastIntervalMicros() const { return _lastInterval; }
+            uint32_t getMaxJitterMicros() const { return _maxJitter; }
+            uint32_t getMissedTicks() const { return _missedTicks; }
+            uint32_t getTickCount() const { return _ticks; }
+            uint32_t getComputeMicros() const { return _computeUs; }
+            uint32_t getMaxComputeMicros() const { return _maxComputeUs; }
+            void resetStats();
+
+        private:
+            IEncoderDriver& _encoder;
+            IPWMDriver& _pwm;
+            uint8_t _channelA;
+            uint8_t _channelB;
+            uint16_t _deviceId;
+            const char* _name;
+            EventBus& _eventBus;
+
+            PIDController _pid;
+            uint16_t _rate;
+            uint32_t _period;                   // us
+
+            // User-unit tuning (re-applied when scale or rate changes)
+            float _countsPerUnit = 1.0f;
+            float _kp = 0.0f, _ki = 0.0f, _kd = 0.0f, _kv = 0.0f, _ks = 0.0f;
+            float _maxSpeed = 1.0f;
+            float _minPosition = 0.0f;
+            float _maxPosition = 0.0f;
+            bool _hasLimits = false;
+            int32_t _tolerance = 2;             // Counts
+
+            // Trajectory (counts, Q16)
+            float _target = 0.0f;
+            int64_t _setpoint = 0;
+            int64_t _targetCounts = 0;
+            int64_t _stepPerTick = 0;
+            int32_t _velocity = 0;              // Counts/s feed-forward
+            bool _trajectory = false;
+            bool _settled = true;
+
+            // Output
+            uint16_t _dutyA = 0;
+            uint16_t _dutyB = 0;
+
+            // Loop timing
+            uint32_t _nextTickUs = 0;
+            uint32_t _lastTickUs = 0;
+            uint32_t _lastInterval = 0;
+            uint32_t _maxJitter = 0;
+            uint32_t _missedTicks = 0;
+            uint32_t _ticks = 0;
+            uint32_t _computeUs = 0;
+            uint32_t _maxComputeUs = 0;
+            int32_t _maxError = 0;
+
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            void controlStep();
+            void startMove(float target, float speed);
+            void hold();
+            void writeOutput(int32_t output);
+            void applyGains();
+            float clampPosition(float position) const;
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
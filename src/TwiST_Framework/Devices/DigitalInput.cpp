@@ -0,0 +1,221 @@
+#include "DigitalInput.h"
+#include "../Core/Logger.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        DigitalInput::DigitalInput(IDigitalInputDriver& driver, uint8_t line, uint16_t deviceId,
+                                   const char* name, EventBus& eventBus)
+            : _driver(driver), _line(line), _deviceId(deviceId), _name(name), _eventBus(eventBus) {
+            // All dependencies locked at construction - no half-initialized state possible
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool DigitalInput::initialize() {
+            _state = STATE_INITIALIZING;
+            if (_line >= _driver.getLineCount()) {
+                Logger::logf(Logger::Level::ERROR, "INPUT", "%s: line %d not provided by driver", _name, _line);
+                _state = STATE_ERROR;
+                return false;
+            }
+
+            // Start from the present level - a switch held at boot is not a press
+            DigitalEdge stale;
+            while (_driver.popEdge(_line, stale)) {}
+            _droppedSeen = _driver.getDroppedEdges(_line);
+            _debouncer.reset(_driver.readLine(_line), micros());
+            _longPressSent = _debouncer.getState();
+            _state = STATE_READY;
+            return true;
+        }
+
+        void DigitalInput::shutdown() {
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void DigitalInput::update() {
+            if (!_enabled || _state != STATE_READY) return;
+
+            _driver.poll();  // Polled lines: one port scan shared by all inputs
+
+            DigitalEdge edge;
+            while (_driver.popEdge(_line, edge)) {
+                if (_debouncer.edge(edge.level, edge.timestampUs)) {
+                    publishTransition();
+                }
+            }
+
+            uint32_t nowUs = micros();
+            uint32_t dropped = _driver.getDroppedEdges(_line);
+            if (dropped != _droppedSeen) {
+                // Queue overflowed during heavy bounce - the present level is what matters
+                _droppedSeen = dropped;
+                if (_debouncer.edge(_driver.readLine(_line), nowUs)) {
+                    publishTransition();
+                }
+            }
+
+            if (_debouncer.advance(nowUs)) {
+                publishTransition();
+            }
+
+            if (_debouncer.getState() && !_longPressSent && _longPressMs > 0 &&
+                getPressedDuration() >= _longPressMs) {
+                _longPressSent = true;
+                publish("input.long_press", millis());
+            }
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo DigitalInput::getInfo() const {
+            DeviceInfo info;
+            info.type = "DigitalInput";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = 1;  // One input = one line
+            return info;
+        }
+
+        uint16_t DigitalInput::getCapabilities() const {
+            return CAP_INPUT | CAP_DIGITAL | CAP_CONFIGURABLE;
+        }
+
+        bool DigitalInput::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState DigitalInput::getState() const {
+            return _state;
+        }
+
+        void DigitalInput::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                // Edges queued while disabled are history - resync to the present level
+                DigitalEdge stale;
+                while (_driver.popEdge(_line, stale)) {}
+                _droppedSeen = _driver.getDroppedEdges(_line);
+                _debouncer.reset(_driver.readLine(_line), micros());
+                _longPressSent = _debouncer.getState();
+                _state = STATE_READY;
+            }
+        }
+
+        void DigitalInput::disable() {
+            _enabled = false;
+            _state = STATE_DISABLED;
+        }
+
+        bool DigitalInput::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool DigitalInput::configure(const JsonDocument& config) {
+            if (config.containsKey("debounceMs")) setDebounceMs(config["debounceMs"]);
+            if (config.containsKey("longPressMs")) _longPressMs = config["longPressMs"];
+            return true;
+        }
+
+        void DigitalInput::getConfiguration(JsonDocument& config) const {
+            config["debounceMs"] = _debouncer.getWindow() / 1000;
+            config["longPressMs"] = _longPressMs;
+        }
+
+        // ===== IDevice Serialization =====
+
+        void DigitalInput::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "DigitalInput";
+            doc["line"] = _line;
+            doc["pressed"] = isPressed();
+            doc["presses"] = _pressCount;
+            doc["rejected"] = getRejectedCount();
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool DigitalInput::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("enabled")) {
+                if (doc["enabled"].as<bool>()) enable(); else disable();
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t DigitalInput::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+            uint32_t wait = _driver.getPollInterval(_line);  // UINT32_MAX for interrupt lines - the ISR wakes us
+            uint32_t settle = _debouncer.getPendingMicros(nowUs);
+            if (settle < wait) wait = settle;
+            if (_debouncer.getState() && !_longPressSent && _longPressMs > 0) {
+                uint32_t held = (nowUs - _debouncer.getTransitionMicros()) / 1000;
+                uint32_t left = (held >= _longPressMs) ? 0 : _longPressMs - held;
+                uint32_t remaining = (left > UINT32_MAX / 1000UL) ? UINT32_MAX : left * 1000UL;
+                if (remaining < wait) wait = remaining;
+            }
+            return wait;
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t DigitalInput::captureState(float* values, uint8_t maxValues) const {
+            // [0] pressed (1/0), [1] press count
+            uint8_t n = 0;
+            if (n < maxValues) values[n++] = isPressed() ? 1.0f : 0.0f;
+            if (n < maxValues) values[n++] = (float)_pressCount;
+            return n;
+        }
+
+        // ===== DigitalInput-specific API =====
+
+        uint32_t DigitalInput::getPressedDuration() const {
+            if (!_debouncer.getState()) return 0;
+            return (micros() - _debouncer.getTransitionMicros()) / 1000;
+        }
+
+        void DigitalInput::setDebounceMs(uint16_t ms) {
+            if (ms == 0) {
+                Logger::logf(Logger::Level::ERROR, "INPUT", "%s: debounce must be > 0 ms", _name);
+                return;
+            }
+            _debouncer.setWindow((uint32_t)ms * 1000);
+        }
+
+        // ===== Helper Methods =====
+
+        void DigitalInput::publishTransition() {
+            // Back-date the event to the physical edge (millis() and micros() share a clock)
+            uint32_t lagMs = (micros() - _debouncer.getTransitionMicros()) / 1000;
+            unsigned long at = millis() - lagMs;
+
+            if (_debouncer.getState()) {
+                _pressCount++;
+                _longPressSent = false;
+                publish("input.pressed", at);
+            } else {
+                publish("input.released", at);
+            }
+        }
+
+        void DigitalInput::publish(const char* name, unsigned long timestamp) {
+            Event evt = {
+                .name = name,
+                .sourceDeviceId = _deviceId,
+                .data = NULL,
+                .priority = PRIORITY_NORMAL,
+                .timestamp = timestamp
+            };
+            _eventBus.publish(evt);
+        }
+
+    }
+}  // namespace TwiST::Devices
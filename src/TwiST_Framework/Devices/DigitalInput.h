@@ -0,0 +1,140 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      DigitalInput.h
+ * @brief     Debounced digital input (button, limit switch) with edge events.
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Native Input Device
+ * - Hardware:     One input line via IDigitalInputDriver abstraction
+ * - Dependency:   EventBus, IDigitalInputDriver, Debouncer
+ *
+ * PRINCIPLES:
+ * - No hardware knowledge (NO Drivers includes)
+ * - Constructor Injection only
+ * - One DigitalInput instance = one physical contact (one driver line)
+ * - Edges are captured by the driver with timestamps; update() only
+ *   drains them through the Debouncer - accuracy does not depend on
+ *   how often update() runs
+ *
+ * CAPABILITIES:
+ * - Integrator debouncing (configurable window)
+ * - Events: "input.pressed", "input.released", "input.long_press"
+ *   (timestamp = physical edge time, not detection time)
+ * - Long-press detection (once per press)
+ * - Press counter, pressed duration, rejected-glitch counter
+ * - JSON configuration & serialization
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================*/
+
+#ifndef TWIST_DEVICE_DIGITALINPUT_H
+#define TWIST_DEVICE_DIGITALINPUT_H
+
+#include "../Interfaces/IInputDevice.h"
+#include "../Interfaces/IDigitalInputDriver.h"  // ONLY ABSTRACTION!
+#include "../Core/EventBus.h"
+#include "../Core/Debouncer.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Debounced digital input device - implements IInputDevice
+         *
+         * Uses IDigitalInputDriver abstraction - NEVER knows about GPIO or ISRs.
+         *
+         * Example usage:
+         * ```cpp
+         * Devices::DigitalInput start(inputs, 0, 500, "Start", eventBus);
+         * start.setDebounceMs(10);
+         * start.setLongPressMs(1500);
+         * eventBus.subscribe("input.long_press", onLongPress);
+         * if (start.isPressed()) { ... }
+         * ```
+         */
+        class DigitalInput : public IInputDevice {
+        public:
+            /**
+             * @param driver Reference to IDigitalInputDriver (NOT ESP32DigitalInput!)
+             * @param line Driver line (LOCKED at construction)
+             * @param deviceId Unique device ID
+             * @param name Human-readable device name (e.g., "Start")
+             * @param eventBus Reference to EventBus (ALL dependencies in constructor!)
+             */
+            DigitalInput(IDigitalInputDriver& driver, uint8_t line, uint16_t deviceId,
+                         const char* name, EventBus& eventBus);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IInputDevice interface
+            float readAnalog(uint8_t axis) override { return _debouncer.getState() ? 1.0f : 0.0f; }
+            bool readDigital(uint8_t button) override { return _debouncer.getState(); }
+            bool isInputReady() override { return _state == STATE_READY; }
+
+            // DigitalInput-specific API
+            bool isPressed() const { return _debouncer.getState(); }
+            uint32_t getPressedDuration() const;        // ms since the physical press, 0 if released
+            uint32_t getPressCount() const { return _pressCount; }
+            uint32_t getRejectedCount() const { return _debouncer.getRejectedCount(); }
+            uint32_t getLastEdgeMicros() const { return _debouncer.getTransitionMicros(); }
+            void setDebounceMs(uint16_t ms);
+            void setLongPressMs(uint32_t ms) { _longPressMs = ms; }  // 0 = disabled
+
+        private:
+            IDigitalInputDriver& _driver;
+            uint8_t _line;
+            uint16_t _deviceId;
+            const char* _name;
+            EventBus& _eventBus;
+
+            Debouncer _debouncer;
+            uint32_t _droppedSeen = 0;
+            uint32_t _longPressMs = 1000;
+            bool _longPressSent = false;
+            uint32_t _pressCount = 0;
+
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            void publishTransition();
+            void publish(const char* name, unsigned long timestamp);
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
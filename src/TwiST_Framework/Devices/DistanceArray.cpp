@@ -0,0 +1,244 @@
+#include "DistanceArray.h"
+#include "../Core/Logger.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        static const float ALERT_HYSTERESIS = 1.1f;  // Clear at 110% of the alert distance
+
+        DistanceArray::DistanceArray(IDistanceDriver* const* drivers, const float* bearingsDeg, uint8_t count,
+                                     uint16_t deviceId, const char* name, EventBus& eventBus, uint8_t sectors)
+            : _count(0), _deviceId(deviceId), _name(name), _eventBus(eventBus), _map(sectors) {
+            // All dependencies locked at construction - no half-initialized state possible
+            if (count > TWIST_OCCUPANCY_MAX_SOURCES) count = TWIST_OCCUPANCY_MAX_SOURCES;  // Reported by initialize()
+            for (uint8_t i = 0; i < count; i++) {
+                _drivers[i] = drivers[i];
+                _bearings[i] = bearingsDeg[i];
+            }
+            _count = count;
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool DistanceArray::initialize() {
+            _state = STATE_INITIALIZING;
+            if (_count == 0) {
+                Logger::logf(Logger::Level::ERROR, "ARRAY", "%s: no sensors", _name);
+                _state = STATE_ERROR;
+                return false;
+            }
+            for (uint8_t i = 0; i < _count; i++) {
+                if (_drivers[i] == NULL) {
+                    Logger::logf(Logger::Level::ERROR, "ARRAY", "%s: sensor %d has no driver", _name, i);
+                    _state = STATE_ERROR;
+                    return false;
+                }
+            }
+
+            rebuildMap();
+            _next = 0;
+            _sweeps = 0;
+            _alert = false;
+            _lastFire = millis() - _slotMs;  // First sensor fires on the next update()
+            _state = STATE_READY;
+            return true;
+        }
+
+        void DistanceArray::shutdown() {
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void DistanceArray::update() {
+            if (!_enabled || _state != STATE_READY) return;
+
+            unsigned long now = millis();
+            if (now - _lastFire < _slotMs) return;
+            _lastFire = now;
+
+            // One sensor per slot - the others stay silent while it listens
+            IDistanceDriver& sensor = *_drivers[_next];
+            sensor.triggerMeasurement();
+            float range = sensor.readDistanceCm();
+
+            _last.sensor = _next;
+            _last.bearingDeg = _bearings[_next];
+            _last.rangeCm = range;
+            _last.timestamp = now;
+            _map.update(_next, range, now);
+
+            unsigned long maxAge = (_maxAgeMs > 0) ? _maxAgeMs : 3 * _slotMs * _count;
+            _map.expire(now, maxAge);
+            checkAlert(now);
+
+            if (++_next >= _count) {
+                _next = 0;
+                _sweeps++;
+                publish("distance.array.sweep", now);
+            }
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo DistanceArray::getInfo() const {
+            DeviceInfo info;
+            info.type = "DistanceArray";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = _map.getSectorCount();  // One channel per sector
+            return info;
+        }
+
+        uint16_t DistanceArray::getCapabilities() const {
+            return CAP_INPUT | CAP_ANALOG | CAP_DIGITAL | CAP_CONFIGURABLE;
+        }
+
+        bool DistanceArray::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState DistanceArray::getState() const {
+            return _state;
+        }
+
+        void DistanceArray::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                _map.clear();  // Readings from before are not the world now
+                _lastFire = millis() - _slotMs;
+                _state = STATE_READY;
+            }
+        }
+
+        void DistanceArray::disable() {
+            _enabled = false;
+            _state = STATE_DISABLED;
+        }
+
+        bool DistanceArray::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool DistanceArray::configure(const JsonDocument& config) {
+            if (config.containsKey("slotMs")) setSlotInterval(config["slotMs"]);
+            if (config.containsKey("beamDeg")) setBeamWidth(config["beamDeg"]);
+            if (config.containsKey("alertCm")) _alertCm = config["alertCm"];
+            if (config.containsKey("maxAgeMs")) _maxAgeMs = config["maxAgeMs"];
+            return true;
+        }
+
+        void DistanceArray::getConfiguration(JsonDocument& config) const {
+            config["slotMs"] = _slotMs;
+            config["beamDeg"] = _beamDeg;
+            config["alertCm"] = _alertCm;
+            config["maxAgeMs"] = _maxAgeMs;
+            config["sectors"] = _map.getSectorCount();
+        }
+
+        // ===== IDevice Serialization =====
+
+        void DistanceArray::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "DistanceArray";
+            doc["nearest"] = _map.getNearest();
+            doc["nearestBearing"] = _map.getNearestBearing();
+            for (uint8_t s = 0; s < _map.getSectorCount(); s++) {
+                doc["sectors"][s] = _map.getSectorRange(s);
+            }
+            doc["sweeps"] = _sweeps;
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool DistanceArray::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("enabled")) {
+                if (doc["enabled"].as<bool>()) enable(); else disable();
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t DistanceArray::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+            unsigned long elapsed = millis() - _lastFire;
+            if (elapsed >= _slotMs) return 0;
+            unsigned long remaining = _slotMs - elapsed;
+            return (remaining > UINT32_MAX / 1000UL) ? UINT32_MAX : (uint32_t)(remaining * 1000UL);
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t DistanceArray::captureState(float* values, uint8_t maxValues) const {
+            // [0] nearest obstacle (cm), [1] its bearing (deg)
+            uint8_t n = 0;
+            if (n < maxValues) values[n++] = getNearest();
+            if (n < maxValues) values[n++] = getNearestBearing();
+            return n;
+        }
+
+        // ===== IInputDevice Implementation =====
+
+        float DistanceArray::readAnalog(uint8_t sector) {
+            float range = _map.getSectorRange(sector);
+            if (range == PolarOccupancy::UNKNOWN) return 0.0f;
+            float maxRange = _drivers[0]->getMaxRange();
+            if (maxRange <= 0.0f) return 0.0f;
+            return (range >= maxRange) ? 1.0f : range / maxRange;
+        }
+
+        bool DistanceArray::readDigital(uint8_t sector) {
+            float range = _map.getSectorRange(sector);
+            return range != PolarOccupancy::UNKNOWN && range < _alertCm;
+        }
+
+        // ===== DistanceArray-specific API =====
+
+        void DistanceArray::setBeamWidth(float degrees) {
+            if (degrees <= 0.0f || degrees > 360.0f) {
+                Logger::logf(Logger::Level::ERROR, "ARRAY", "%s: beam width %.1f out of range", _name, degrees);
+                return;
+            }
+            _beamDeg = degrees;
+            if (_state != STATE_UNINITIALIZED) rebuildMap();
+        }
+
+        // ===== Helper Methods =====
+
+        void DistanceArray::rebuildMap() {
+            _map.setSectors(_map.getSectorCount());
+            for (uint8_t i = 0; i < _count; i++) {
+                _map.addSource(_bearings[i], _beamDeg, _drivers[i]->getMaxRange());
+            }
+        }
+
+        void DistanceArray::checkAlert(unsigned long now) {
+            if (_alertCm <= 0.0f) return;
+            float nearest = _map.getNearest();
+            if (!_alert && nearest != PolarOccupancy::UNKNOWN && nearest < _alertCm) {
+                _alert = true;
+                publish("obstacle.detected", now);
+            } else if (_alert && (nearest == PolarOccupancy::UNKNOWN || nearest > _alertCm * ALERT_HYSTERESIS)) {
+                _alert = false;
+                publish("obstacle.cleared", now);
+            }
+        }
+
+        void DistanceArray::publish(const char* name, unsigned long now) {
+            Event evt = {
+                .name = name,
+                .sourceDeviceId = _deviceId,
+                .data = NULL,
+                .priority = PRIORITY_NORMAL,
+                .timestamp = now
+            };
+            _eventBus.publish(evt);
+        }
+
+    }
+}  // namespace TwiST::Devices
@@ -0,0 +1,171 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      DistanceArray.h
+ * @brief     Ring of distance sensors fired in turn and fused into a polar map
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Native Input Device (multi-sensor)
+ * - Hardware:     N distance sensors via IDistanceDriver abstraction
+ * - Dependency:   EventBus, IDistanceDriver, PolarOccupancy
+ *
+ * PRINCIPLES:
+ * - No hardware knowledge (NO Drivers includes)
+ * - Constructor Injection only
+ * - One DistanceArray = one sensor ring; its sensors are NOT separate
+ *   DistanceSensor devices (those fire on independent timers and hear
+ *   each other's pings)
+ * - Round-robin: exactly one sensor fires per slot, slots are long enough
+ *   for the previous ping's echoes to die out
+ * - Every reading is tagged with its sensor's bearing and folded into the
+ *   PolarOccupancy map immediately - consumers read it in O(1)
+ *
+ * CAPABILITIES:
+ * - Up to TWIST_OCCUPANCY_MAX_SOURCES sensors, configurable sectors
+ * - Nearest obstacle (range + bearing), range at any bearing
+ * - Events: "distance.array.sweep" (every sensor fired once),
+ *   "obstacle.detected" / "obstacle.cleared" (alert distance, hysteresis)
+ * - Stale readings expire (sector becomes UNKNOWN)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================*/
+
+#ifndef TWIST_DEVICE_DISTANCEARRAY_H
+#define TWIST_DEVICE_DISTANCEARRAY_H
+
+#include "../Interfaces/IInputDevice.h"
+#include "../Interfaces/IDistanceDriver.h"  // ONLY ABSTRACTION!
+#include "../Core/EventBus.h"
+#include "../Core/PolarOccupancy.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief One tagged reading
+         */
+        struct RangeReading {
+            uint8_t sensor;
+            float bearingDeg;
+            float rangeCm;              // 0 = no echo
+            unsigned long timestamp;    // millis()
+        };
+
+        /**
+         * @brief Distance sensor ring - implements IInputDevice
+         *
+         * IInputDevice mapping: readAnalog(sector) = sector range normalized to
+         * max range (0 if unknown), readDigital(sector) = obstacle within alert distance.
+         *
+         * Example usage:
+         * ```cpp
+         * IDistanceDriver* ring[4] = {&front, &left, &back, &right};
+         * float bearings[4] = {0.0f, 90.0f, 180.0f, 270.0f};
+         * Devices::DistanceArray sonar(ring, bearings, 4, 320, "Sonar", eventBus, 8);
+         * sonar.setAlertDistance(25.0f);
+         * float ahead = sonar.rangeAt(0.0f);
+         * ```
+         */
+        class DistanceArray : public IInputDevice {
+        public:
+            /**
+             * @param drivers Array of driver pointers (copied, drivers must outlive the device)
+             * @param bearingsDeg Sensor bearings, 0 = forward, counter-clockwise positive
+             * @param count Number of sensors
+             * @param deviceId Unique device ID
+             * @param name Human-readable device name (e.g., "Sonar")
+             * @param eventBus Reference to EventBus (ALL dependencies in constructor!)
+             * @param sectors Polar map resolution
+             */
+            DistanceArray(IDistanceDriver* const* drivers, const float* bearingsDeg, uint8_t count,
+                          uint16_t deviceId, const char* name, EventBus& eventBus, uint8_t sectors = 12);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IInputDevice interface
+            float readAnalog(uint8_t sector) override;
+            bool readDigital(uint8_t sector) override;
+            bool isInputReady() override { return _sweeps > 0; }
+
+            // Fused map (O(1))
+            float rangeAt(float bearingDeg) const { return _map.rangeAt(bearingDeg); }
+            float getSectorRange(uint8_t sector) const { return _map.getSectorRange(sector); }
+            float getNearest() const { return _map.getNearest(); }
+            float getNearestBearing() const { return _map.getNearestBearing(); }
+            uint8_t getSectorCount() const { return _map.getSectorCount(); }
+            const PolarOccupancy& getMap() const { return _map; }
+            const RangeReading& getLastReading() const { return _last; }
+            uint32_t getSweepCount() const { return _sweeps; }
+            uint8_t getSensorCount() const { return _count; }
+
+            // DistanceArray-specific configuration
+            void setSlotInterval(unsigned long ms) { _slotMs = (ms == 0) ? 1 : ms; }
+            void setBeamWidth(float degrees);               // Rebuilds the map
+            void setAlertDistance(float cm) { _alertCm = cm; }  // 0 = no obstacle events
+            void setMaxAge(unsigned long ms) { _maxAgeMs = ms; }  // 0 = 3 sweeps
+
+        private:
+            IDistanceDriver* _drivers[TWIST_OCCUPANCY_MAX_SOURCES];
+            float _bearings[TWIST_OCCUPANCY_MAX_SOURCES];
+            uint8_t _count;
+            uint16_t _deviceId;
+            const char* _name;
+            EventBus& _eventBus;
+
+            PolarOccupancy _map;
+            float _beamDeg = 30.0f;         // HC-SR04 effective cone
+            unsigned long _slotMs = 40;     // Trigger-to-trigger (30 ms echo timeout + decay)
+            unsigned long _maxAgeMs = 0;
+            float _alertCm = 0.0f;
+            bool _alert = false;
+
+            uint8_t _next = 0;
+            unsigned long _lastFire = 0;
+            uint32_t _sweeps = 0;
+            RangeReading _last = {0, 0.0f, 0.0f, 0};
+
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            void rebuildMap();
+            void checkAlert(unsigned long now);
+            void publish(const char* name, unsigned long now);
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
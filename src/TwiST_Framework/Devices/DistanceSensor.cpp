@@ -171,6 +171,26 @@ bool DistanceSensor::fromJson(const JsonDocument& doc) {
     return true;
 }
 
+// ===== IDevice Power Management =====
+
+uint32_t DistanceSensor::getTimeUntilUpdate(uint32_t nowUs) const {
+    if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+    unsigned long elapsed = millis() - _lastMeasurementTime;
+    if (elapsed >= _measurementInterval) return 0;
+    unsigned long remaining = _measurementInterval - elapsed;
+    // Intervals past ~71 minutes do not fit in microseconds - sleep the maximum
+    return (remaining > UINT32_MAX / 1000UL) ? UINT32_MAX : (uint32_t)(remaining * 1000UL);
+}
+
+// ===== IDevice Snapshot =====
+
+uint8_t DistanceSensor::captureState(float* values, uint8_t maxValues) const {
+    // [0] filtered distance (cm, 0 = out of range)
+    uint8_t n = 0;
+    if (n < maxValues) values[n++] = _currentDistance;
+    return n;
+}
+
 // ===== IInputDevice Implementation =====
 
 float DistanceSensor::readAnalog(uint8_t axis) {
@@ -91,6 +91,12 @@ namespace TwiST {
             void toJson(JsonDocument& doc) const override;
             bool fromJson(const JsonDocument& doc) override;
 
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
             // IInputDevice interface
             float readAnalog(uint8_t axis) override;
             bool readDigital(uint8_t button) override { return false; }  // No digital inputs
@@ -0,0 +1,208 @@
+#include "Encoder.h"
+#include "../Core/Logger.h"
+#include <math.h>
+
+namespace TwiST {
+    namespace Devices {
+
+        Encoder::Encoder(IEncoderDriver& driver, uint16_t deviceId, const char* name, EventBus& eventBus)
+            : _driver(driver), _deviceId(deviceId), _name(name), _eventBus(eventBus) {
+            // All dependencies locked at construction - no half-initialized state possible
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool Encoder::initialize() {
+            _state = STATE_INITIALIZING;
+            _lastSampleTime = millis();
+            _lastSampleCount = _driver.readCount();
+            _velocity = 0.0f;
+            _lastReported = getPosition();
+            _state = STATE_READY;
+            return true;
+        }
+
+        void Encoder::shutdown() {
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void Encoder::update() {
+            if (!_enabled || _state != STATE_READY) return;
+
+            unsigned long now = millis();
+            unsigned long elapsed = now - _lastSampleTime;
+            if (elapsed < _velocityWindow) return;
+
+            int32_t count = _driver.readCount();
+            _velocity = (float)(count - _lastSampleCount) * 1000.0f / ((float)elapsed * _countsPerUnit);
+            _lastSampleCount = count;
+            _lastSampleTime = now;
+
+            float position = count / _countsPerUnit;
+            if (_reportStep > 0.0f && fabsf(position - _lastReported) >= _reportStep) {
+                Event evt = {
+                    .name = "encoder.changed",
+                    .sourceDeviceId = _deviceId,
+                    .data = NULL,
+                    .priority = PRIORITY_NORMAL,
+                    .timestamp = now
+                };
+                _eventBus.publish(evt);
+                _lastReported = position;
+            }
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo Encoder::getInfo() const {
+            DeviceInfo info;
+            info.type = "Encoder";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = 1;  // One encoder = one axis
+            return info;
+        }
+
+        uint16_t Encoder::getCapabilities() const {
+            return CAP_INPUT | CAP_ANALOG | CAP_POSITION | CAP_VELOCITY | CAP_CONFIGURABLE;
+        }
+
+        bool Encoder::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState Encoder::getState() const {
+            return _state;
+        }
+
+        void Encoder::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                _lastSampleTime = millis();
+                _lastSampleCount = _driver.readCount();
+                _state = STATE_READY;
+            }
+        }
+
+        void Encoder::disable() {
+            _enabled = false;
+            _velocity = 0.0f;
+            _state = STATE_DISABLED;
+        }
+
+        bool Encoder::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool Encoder::configure(const JsonDocument& config) {
+            if (config.containsKey("countsPerUnit")) setCountsPerUnit(config["countsPerUnit"]);
+            if (config.containsKey("velocityWindow")) setVelocityWindow(config["velocityWindow"]);
+            if (config.containsKey("reportStep")) _reportStep = config["reportStep"];
+            if (config.containsKey("minPosition") && config.containsKey("maxPosition")) {
+                setRange(config["minPosition"], config["maxPosition"]);
+            }
+            return true;
+        }
+
+        void Encoder::getConfiguration(JsonDocument& config) const {
+            config["countsPerUnit"] = _countsPerUnit;
+            config["velocityWindow"] = _velocityWindow;
+            config["reportStep"] = _reportStep;
+            if (_hasRange) {
+                config["minPosition"] = _minPosition;
+                config["maxPosition"] = _maxPosition;
+            }
+        }
+
+        // ===== IDevice Serialization =====
+
+        void Encoder::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "Encoder";
+            doc["count"] = _driver.readCount();
+            doc["position"] = getPosition();
+            doc["velocity"] = _velocity;
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool Encoder::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("position")) {
+                setCurrentPosition(doc["position"]);
+            }
+            if (doc.containsKey("enabled")) {
+                if (doc["enabled"].as<bool>()) enable(); else disable();
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t Encoder::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+            unsigned long elapsed = millis() - _lastSampleTime;
+            if (elapsed >= _velocityWindow) return 0;
+            unsigned long remaining = _velocityWindow - elapsed;
+            return (remaining > UINT32_MAX / 1000UL) ? UINT32_MAX : (uint32_t)(remaining * 1000UL);
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t Encoder::captureState(float* values, uint8_t maxValues) const {
+            // [0] position, [1] velocity (units, units/s)
+            uint8_t n = 0;
+            if (n < maxValues) values[n++] = getPosition();
+            if (n < maxValues) values[n++] = _velocity;
+            return n;
+        }
+
+        // ===== IInputDevice Implementation =====
+
+        float Encoder::readAnalog(uint8_t axis) {
+            if (axis != 0 || !_hasRange) return 0.0f;
+            float value = (getPosition() - _minPosition) / (_maxPosition - _minPosition);
+            if (value < 0.0f) return 0.0f;
+            if (value > 1.0f) return 1.0f;
+            return value;
+        }
+
+        // ===== Encoder-specific API =====
+
+        float Encoder::getPosition() const {
+            return _driver.readCount() / _countsPerUnit;
+        }
+
+        void Encoder::setCountsPerUnit(float countsPerUnit) {
+            if (countsPerUnit == 0.0f) {
+                Logger::logf(Logger::Level::ERROR, "ENCODER", "%s: countsPerUnit must be non-zero", _name);
+                return;
+            }
+            _countsPerUnit = countsPerUnit;
+        }
+
+        void Encoder::setCurrentPosition(float position) {
+            int32_t count = (int32_t)lroundf(position * _countsPerUnit);
+            _driver.setCount(count);
+            _lastSampleCount = count;
+            _lastReported = position;
+        }
+
+        void Encoder::setRange(float minPosition, float maxPosition) {
+            if (minPosition >= maxPosition) {
+                Logger::logf(Logger::Level::ERROR, "ENCODER", "%s: invalid range %.2f..%.2f",
+                            _name, minPosition, maxPosition);
+                return;
+            }
+            _minPosition = minPosition;
+            _maxPosition = maxPosition;
+            _hasRange = true;
+        }
+
+    }
+}  // namespace TwiST::Devices
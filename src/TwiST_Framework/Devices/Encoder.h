@@ -0,0 +1,139 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      Encoder.h
+ * @brief     Rotary/linear encoder input device (position + velocity)
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Native Input Device
+ * - Hardware:     Quadrature encoder via IEncoderDriver abstraction
+ * - Dependency:   EventBus, IEncoderDriver
+ *
+ * PRINCIPLES:
+ * - No hardware knowledge (NO Drivers includes)
+ * - Constructor Injection only
+ * - One Encoder instance = one physical encoder
+ * - Counting is done by the driver; update() only samples velocity
+ *
+ * CAPABILITIES:
+ * - Position in user units (countsPerUnit, negative = reversed)
+ * - Velocity from count differences over a fixed sample window
+ * - "encoder.changed" event when position moves by the report step
+ * - Homing (setCurrentPosition), normalized reading over a range
+ * - JSON configuration & serialization
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================*/
+
+#ifndef TWIST_DEVICE_ENCODER_H
+#define TWIST_DEVICE_ENCODER_H
+
+#include "../Interfaces/IInputDevice.h"
+#include "../Interfaces/IEncoderDriver.h"  // ONLY ABSTRACTION!
+#include "../Core/EventBus.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Encoder device - implements IInputDevice
+         *
+         * Uses IEncoderDriver abstraction - NEVER knows about PCNT.
+         *
+         * Example usage:
+         * ```cpp
+         * Devices::Encoder shoulder(shoulderEnc, 600, "ShoulderEnc", eventBus);
+         * shoulder.setCountsPerUnit(4096.0f / 360.0f);   // 1024 CPR x4, degrees
+         * shoulder.setRange(-90.0f, 90.0f);
+         * float deg = shoulder.getPosition();
+         * float dps = shoulder.getVelocity();
+         * ```
+         */
+        class Encoder : public IInputDevice {
+        public:
+            /**
+             * @param driver Reference to IEncoderDriver (NOT ESP32PCNT!)
+             * @param deviceId Unique device ID
+             * @param name Human-readable device name (e.g., "ShoulderEnc")
+             * @param eventBus Reference to EventBus (ALL dependencies in constructor!)
+             */
+            Encoder(IEncoderDriver& driver, uint16_t deviceId, const char* name, EventBus& eventBus);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IInputDevice interface
+            float readAnalog(uint8_t axis) override;    // Axis 0: position normalized over setRange()
+            bool readDigital(uint8_t button) override { return false; }  // No digital inputs
+            bool isInputReady() override { return _state == STATE_READY; }
+
+            // Encoder-specific API
+            float getPosition() const;                  // Units
+            float getVelocity() const { return _velocity; }  // Units/s
+            int32_t getCount() const { return _driver.readCount(); }
+            void setCountsPerUnit(float countsPerUnit);
+            float getCountsPerUnit() const { return _countsPerUnit; }
+            void setCurrentPosition(float position);
+            void setRange(float minPosition, float maxPosition);
+            void setVelocityWindow(uint16_t ms) { _velocityWindow = (ms == 0) ? 1 : ms; }
+            void setReportStep(float units) { _reportStep = units; }  // 0 = no events
+
+        private:
+            IEncoderDriver& _driver;
+            uint16_t _deviceId;
+            const char* _name;
+            EventBus& _eventBus;
+
+            float _countsPerUnit = 1.0f;
+            float _minPosition = 0.0f;
+            float _maxPosition = 0.0f;
+            bool _hasRange = false;
+
+            uint16_t _velocityWindow = 10;  // ms
+            unsigned long _lastSampleTime = 0;
+            int32_t _lastSampleCount = 0;
+            float _velocity = 0.0f;
+
+            float _reportStep = 1.0f;
+            float _lastReported = 0.0f;
+
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
@@ -117,6 +117,12 @@ namespace TwiST {
             return true;
         }
 
+        // ===== IDevice Power Management =====
+
+        uint32_t Joystick::getTimeUntilUpdate(uint32_t nowUs) const {
+            return UINT32_MAX;  // Read on demand - nothing to do in update()
+        }
+
         // ===== IInputDevice Implementation =====
 
         float Joystick::readAnalog(uint8_t axis) {
@@ -83,6 +83,9 @@ namespace TwiST {
             void toJson(JsonDocument& doc) const override;
             bool fromJson(const JsonDocument& doc) override;
 
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
             // IInputDevice interface (for framework compatibility)
             float readAnalog(uint8_t axis) override;       // Internal use - prefer getX()/getY()
             bool readDigital(uint8_t button) override;     // Button state
@@ -0,0 +1,178 @@
+#include "RemoteInput.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        RemoteInput::RemoteInput(IDeviceLink& link, uint16_t remoteId, uint16_t deviceId,
+                                 const char* name, unsigned long staleMs)
+            : _link(link), _remoteId(remoteId), _deviceId(deviceId), _name(name), _staleMs(staleMs) {
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool RemoteInput::initialize() {
+            _state = STATE_INITIALIZING;
+            if (!_link.attachProxy(this)) {
+                _state = STATE_ERROR;
+                return false;
+            }
+            // Stays INITIALIZING until the first replicated state arrives
+            return true;
+        }
+
+        void RemoteInput::shutdown() {
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void RemoteInput::update() {
+            if (!_enabled || _state == STATE_UNINITIALIZED || _state == STATE_DISABLED) return;
+
+            if (!_hasState) {
+                _state = STATE_INITIALIZING;
+            } else if (!_link.isConnected() || getStateAge() > _staleMs) {
+                _state = STATE_ERROR;
+            } else {
+                _state = (_remoteState == STATE_ERROR) ? STATE_ERROR : STATE_READY;
+            }
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo RemoteInput::getInfo() const {
+            DeviceInfo info;
+            info.type = "RemoteInput";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = _axisCount;  // Learned from the owner
+            return info;
+        }
+
+        uint16_t RemoteInput::getCapabilities() const {
+            return CAP_INPUT | CAP_ANALOG | CAP_CONFIGURABLE;
+        }
+
+        bool RemoteInput::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState RemoteInput::getState() const {
+            return _state;
+        }
+
+        void RemoteInput::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                _state = STATE_INITIALIZING;  // Re-validated on next update()
+            }
+            _link.sendEnable(_remoteId, true);
+        }
+
+        void RemoteInput::disable() {
+            _enabled = false;
+            _state = STATE_DISABLED;
+            _link.sendEnable(_remoteId, false);
+        }
+
+        bool RemoteInput::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool RemoteInput::configure(const JsonDocument& config) {
+            if (config.containsKey("staleMs")) _staleMs = config["staleMs"];
+            return true;
+        }
+
+        void RemoteInput::getConfiguration(JsonDocument& config) const {
+            config["remoteId"] = _remoteId;
+            config["staleMs"] = _staleMs;
+        }
+
+        // ===== IDevice Serialization =====
+
+        void RemoteInput::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "RemoteInput";
+            doc["remoteId"] = _remoteId;
+            JsonArray values = doc.createNestedArray("values");
+            for (uint8_t i = 0; i < _axisCount; i++) {
+                values.add(_values[i]);
+            }
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool RemoteInput::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("enabled")) {
+                _enabled = doc["enabled"];
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t RemoteInput::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || !_hasState || _state == STATE_ERROR || _state == STATE_DISABLED) return UINT32_MAX;
+            // Next thing update() can notice by itself is the state going stale
+            unsigned long age = getStateAge();
+            if (age >= _staleMs) return 0;
+            unsigned long remaining = _staleMs - age;
+            return (remaining > UINT32_MAX / 1000UL) ? UINT32_MAX : (uint32_t)(remaining * 1000UL);
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t RemoteInput::captureState(float* values, uint8_t maxValues) const {
+            // Last replicated axis values
+            uint8_t n = 0;
+            while (n < _axisCount && n < maxValues) {
+                values[n] = _values[n];
+                n++;
+            }
+            return n;
+        }
+
+        // ===== IInputDevice Implementation =====
+
+        float RemoteInput::readAnalog(uint8_t axis) {
+            if (axis >= _axisCount) return 0.0f;
+            return _values[axis];
+        }
+
+        bool RemoteInput::readDigital(uint8_t button) {
+            return readAnalog(button) > 0.5f;
+        }
+
+        bool RemoteInput::isInputReady() {
+            return _hasState && _state == STATE_READY;
+        }
+
+        // ===== IRemoteProxy Implementation =====
+
+        void RemoteInput::applyRemoteState(const RemoteState& state, unsigned long nowMs) {
+            _hasState = true;
+            _lastStateMs = nowMs;
+            _remoteState = state.state;
+            _axisCount = state.axisCount;
+            for (uint8_t i = 0; i < _axisCount; i++) {
+                _values[i] = state.values[i];
+            }
+        }
+
+        void RemoteInput::confirmRemoteState(unsigned long nowMs) {
+            if (_hasState) _lastStateMs = nowMs;  // Unchanged on the owner - not stale
+        }
+
+        // ===== RemoteInput-Specific Methods =====
+
+        unsigned long RemoteInput::getStateAge() const {
+            return _hasState ? (millis() - _lastStateMs) : 0;
+        }
+
+    }
+}  // namespace TwiST::Devices
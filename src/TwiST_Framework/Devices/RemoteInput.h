@@ -0,0 +1,123 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      RemoteInput.h
+ * @brief     Proxy for an input device owned by another framework node
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Proxy Device (hardware lives on a peer node)
+ * - Hardware:     None (uses IDeviceLink abstraction)
+ * - Implements:   IInputDevice, IRemoteProxy
+ *
+ * PRINCIPLES:
+ * - Registers in the LOCAL registry like any input - bridges and
+ *   telemetry read it without knowing it is remote
+ * - Axis values are the owner's readAnalog() results, replicated
+ * - Enable/disable go out through IDeviceLink (NEVER includes NodeLink)
+ * - STATE_ERROR while the link is down or replication is stale
+ *
+ * USAGE PATTERN:
+ * - One RemoteInput object = ONE input device on the owning node
+ * - Remote ID and link locked at construction
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DEVICE_REMOTEINPUT_H
+#define TWIST_DEVICE_REMOTEINPUT_H
+
+#include "../Interfaces/IInputDevice.h"
+#include "../Interfaces/IDeviceLink.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Remote input proxy - implements IInputDevice
+         */
+        class RemoteInput : public IInputDevice, public IRemoteProxy {
+        public:
+            /**
+             * @param link Link to the owning node (NOT NodeLink!)
+             * @param remoteId Device ID on the owning node
+             * @param deviceId Local device ID
+             * @param name Human-readable device name
+             * @param staleMs Replication older than this = STATE_ERROR
+             */
+            RemoteInput(IDeviceLink& link, uint16_t remoteId, uint16_t deviceId,
+                        const char* name, unsigned long staleMs = 500);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IInputDevice interface
+            float readAnalog(uint8_t axis) override;
+            bool readDigital(uint8_t button) override;     // Axis value above 0.5
+            bool isInputReady() override;                   // Fresh replicated data
+
+            // IRemoteProxy interface
+            uint16_t getRemoteId() const override { return _remoteId; }
+            void applyRemoteState(const RemoteState& state, unsigned long nowMs) override;
+            void confirmRemoteState(unsigned long nowMs) override;
+
+            // RemoteInput-specific API
+            uint8_t getAxisCount() const { return _axisCount; }
+            bool hasRemoteState() const { return _hasState; }
+            unsigned long getStateAge() const;
+
+        private:
+            IDeviceLink& _link;  // Abstract link, not concrete NodeLink
+            uint16_t _remoteId;
+            uint16_t _deviceId;
+            const char* _name;
+            unsigned long _staleMs;
+
+            // State
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            // Replicated state
+            bool _hasState = false;
+            uint8_t _remoteState = STATE_UNINITIALIZED;
+            unsigned long _lastStateMs = 0;
+            uint8_t _axisCount = 0;
+            float _values[TWIST_REMOTE_MAX_AXES] = {};
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
@@ -0,0 +1,179 @@
+#include "RemoteOutput.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        RemoteOutput::RemoteOutput(IDeviceLink& link, uint16_t remoteId, uint16_t deviceId,
+                                   const char* name, unsigned long staleMs)
+            : _link(link), _remoteId(remoteId), _deviceId(deviceId), _name(name), _staleMs(staleMs) {
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool RemoteOutput::initialize() {
+            _state = STATE_INITIALIZING;
+            if (!_link.attachProxy(this)) {
+                _state = STATE_ERROR;
+                return false;
+            }
+            // Stays INITIALIZING until the first replicated state arrives
+            return true;
+        }
+
+        void RemoteOutput::shutdown() {
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void RemoteOutput::update() {
+            if (!_enabled || _state == STATE_UNINITIALIZED || _state == STATE_DISABLED) return;
+
+            if (!_hasState) {
+                _state = STATE_INITIALIZING;
+            } else if (!_link.isConnected() || getStateAge() > _staleMs) {
+                _state = STATE_ERROR;   // Last known value may be wrong - say so
+                _moving = false;
+            } else {
+                _state = (_remoteState == STATE_ERROR) ? STATE_ERROR : STATE_READY;
+            }
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo RemoteOutput::getInfo() const {
+            DeviceInfo info;
+            info.type = "RemoteOutput";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = 1;
+            return info;
+        }
+
+        uint16_t RemoteOutput::getCapabilities() const {
+            return CAP_OUTPUT | CAP_POSITION | CAP_CONFIGURABLE;
+        }
+
+        bool RemoteOutput::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState RemoteOutput::getState() const {
+            return _state;
+        }
+
+        void RemoteOutput::enable() {
+            _enabled = true;
+            if (_state == STATE_DISABLED) {
+                _state = STATE_INITIALIZING;  // Re-validated on next update()
+            }
+            _link.sendEnable(_remoteId, true);
+        }
+
+        void RemoteOutput::disable() {
+            _enabled = false;
+            _state = STATE_DISABLED;
+            _link.sendEnable(_remoteId, false);
+        }
+
+        bool RemoteOutput::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool RemoteOutput::configure(const JsonDocument& config) {
+            if (config.containsKey("minValue")) _minValue = config["minValue"];
+            if (config.containsKey("maxValue")) _maxValue = config["maxValue"];
+            if (config.containsKey("staleMs")) _staleMs = config["staleMs"];
+            return true;
+        }
+
+        void RemoteOutput::getConfiguration(JsonDocument& config) const {
+            config["remoteId"] = _remoteId;
+            config["minValue"] = _minValue;
+            config["maxValue"] = _maxValue;
+            config["staleMs"] = _staleMs;
+        }
+
+        // ===== IDevice Serialization =====
+
+        void RemoteOutput::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "RemoteOutput";
+            doc["remoteId"] = _remoteId;
+            doc["value"] = _value;
+            doc["moving"] = _moving;
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool RemoteOutput::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("value")) {
+                setValue(doc["value"]);
+            }
+            if (doc.containsKey("enabled")) {
+                _enabled = doc["enabled"];
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t RemoteOutput::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || !_hasState || _state == STATE_ERROR || _state == STATE_DISABLED) return UINT32_MAX;
+            // Next thing update() can notice by itself is the state going stale
+            unsigned long age = getStateAge();
+            if (age >= _staleMs) return 0;
+            unsigned long remaining = _staleMs - age;
+            return (remaining > UINT32_MAX / 1000UL) ? UINT32_MAX : (uint32_t)(remaining * 1000UL);
+        }
+
+        // ===== IOutputDevice Implementation =====
+
+        void RemoteOutput::setValue(float value) {
+            if (!_enabled) return;
+            _link.sendValue(_remoteId, value);
+        }
+
+        void RemoteOutput::setNormalized(float value) {
+            setValue(_minValue + (value * (_maxValue - _minValue)));
+        }
+
+        void RemoteOutput::moveTo(float target, unsigned long duration) {
+            if (!_enabled) return;
+            if (duration > 0xFFFF) duration = 0xFFFF;  // Wire field is 16-bit ms
+            _link.sendMoveTo(_remoteId, target, (uint16_t)duration);
+        }
+
+        // ===== IRemoteProxy Implementation =====
+
+        void RemoteOutput::applyRemoteState(const RemoteState& state, unsigned long nowMs) {
+            _hasState = true;
+            _lastStateMs = nowMs;
+            _remoteState = state.state;
+            _moving = (state.flags & REMOTE_MOVING) != 0;
+            if (state.axisCount > 0) {
+                _value = state.values[0];
+            }
+        }
+
+        void RemoteOutput::confirmRemoteState(unsigned long nowMs) {
+            if (_hasState) _lastStateMs = nowMs;  // Unchanged on the owner - not stale
+        }
+
+        // ===== RemoteOutput-Specific Methods =====
+
+        void RemoteOutput::setRange(float minValue, float maxValue) {
+            _minValue = minValue;
+            _maxValue = maxValue;
+        }
+
+        unsigned long RemoteOutput::getStateAge() const {
+            return _hasState ? (millis() - _lastStateMs) : 0;
+        }
+
+    }
+}  // namespace TwiST::Devices
@@ -0,0 +1,126 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      RemoteOutput.h
+ * @brief     Proxy for an output device owned by another framework node
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Proxy Device (hardware lives on a peer node)
+ * - Hardware:     None (uses IDeviceLink abstraction)
+ * - Implements:   IOutputDevice, IRemoteProxy
+ *
+ * PRINCIPLES:
+ * - Registers in the LOCAL registry like any output - bridges, telemetry
+ *   and command channels drive it without knowing it is remote
+ * - Commands go out through IDeviceLink (NEVER includes NodeLink)
+ * - Reported value/motion come from replicated state, not from commands
+ * - STATE_ERROR while the link is down or replication is stale
+ *
+ * USAGE PATTERN:
+ * - One RemoteOutput object = ONE output device on the owning node
+ * - Remote ID and link locked at construction
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DEVICE_REMOTEOUTPUT_H
+#define TWIST_DEVICE_REMOTEOUTPUT_H
+
+#include "../Interfaces/IOutputDevice.h"
+#include "../Interfaces/IDeviceLink.h"
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Remote output proxy - implements IOutputDevice
+         */
+        class RemoteOutput : public IOutputDevice, public IRemoteProxy {
+        public:
+            /**
+             * @param link Link to the owning node (NOT NodeLink!)
+             * @param remoteId Device ID on the owning node
+             * @param deviceId Local device ID
+             * @param name Human-readable device name
+             * @param staleMs Replication older than this = STATE_ERROR
+             */
+            RemoteOutput(IDeviceLink& link, uint16_t remoteId, uint16_t deviceId,
+                         const char* name, unsigned long staleMs = 500);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IOutputDevice interface
+            void setValue(float value) override;
+            void setNormalized(float value) override;      // Maps onto [minValue, maxValue]
+            void moveTo(float target, unsigned long duration) override;
+            float getValue() const override { return _value; }
+            bool isMoving() const override { return _moving; }
+
+            // IRemoteProxy interface
+            uint16_t getRemoteId() const override { return _remoteId; }
+            void applyRemoteState(const RemoteState& state, unsigned long nowMs) override;
+            void confirmRemoteState(unsigned long nowMs) override;
+
+            // RemoteOutput-specific API
+            void setRange(float minValue, float maxValue);
+            bool hasRemoteState() const { return _hasState; }
+            unsigned long getStateAge() const;
+
+        private:
+            IDeviceLink& _link;  // Abstract link, not concrete NodeLink
+            uint16_t _remoteId;
+            uint16_t _deviceId;
+            const char* _name;
+            unsigned long _staleMs;
+
+            // State
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            // Replicated state
+            bool _hasState = false;
+            uint8_t _remoteState = STATE_UNINITIALIZED;
+            unsigned long _lastStateMs = 0;
+            float _value = 0.0f;
+            bool _moving = false;
+
+            // setNormalized() range (servo degrees by default)
+            float _minValue = 0.0f;
+            float _maxValue = 180.0f;
+        };
+
+    }
+}  // namespace TwiST::Devices
+
+#endif
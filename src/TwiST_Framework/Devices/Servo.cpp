@@ -1,4 +1,5 @@
 #include "Servo.h"
+#include "../Core/Logger.h"
 
 namespace TwiST {
     namespace Devices {
@@ -14,12 +15,15 @@ namespace TwiST {
         bool Servo::initialize() {
             _state = STATE_INITIALIZING;
             // Set to center position
+            _outputKnown = false;
+            _released = false;
             setValue(90);
             _state = STATE_READY;
             return true;
         }
 
         void Servo::shutdown() {
+            if (_holdPolicy != HOLD) release();
             _state = STATE_DISABLED;
             _enabled = false;
         }
@@ -30,6 +34,11 @@ namespace TwiST {
             // Skip if paused
             if (_isPaused) return;
 
+            // Retry a move the supervisor deferred
+            if (_moveDeferred) {
+                startMove(_deferredTarget, _deferredDuration, _deferredEasing);
+            }
+
             // Handle animation if active
             if (_animationDuration > 0) {
                 unsigned long now = millis();
@@ -39,6 +48,7 @@ namespace TwiST {
                     // Animation complete
                     setValue(_targetAngle);
                     _animationDuration = 0;
+                    releaseGrant();
                 } else {
                     // Interpolate with easing
                     float t = (float)elapsed / (float)_animationDuration;
@@ -46,7 +56,17 @@ namespace TwiST {
                     float angle = _startAngle + easedT * (_targetAngle - _startAngle);
                     setValue(angle);
                 }
+            } else if (_outputHeld) {
+                // Constraint cut the last write short (velocity / keep-out) - continue toward it
+                setValue(_heldRequest);
+            } else if (!_conditioner.isSettled() && !_outputStepped) {
+                // Slew / low-pass still catching up, and nobody wrote since the last update()
+                writeOutput(_conditioner.getRequest());
+            } else if (_holdPolicy == RELEASE_WHEN_IDLE && !_released &&
+                       millis() - _lastChangeMs >= _releaseMs) {
+                release();  // At rest long enough - holding torque not needed
             }
+            _outputStepped = false;
         }
 
         // ===== IDevice Identity & Capabilities =====
@@ -80,9 +100,11 @@ namespace TwiST {
             if (_state == STATE_DISABLED) {
                 _state = STATE_READY;
             }
+            if (_holdPolicy == RELEASE_WHEN_DISABLED) attach();
         }
 
         void Servo::disable() {
+            if (_holdPolicy != HOLD) release();
             _enabled = false;
             _state = STATE_DISABLED;
         }
@@ -98,6 +120,13 @@ namespace TwiST {
             if (config.containsKey("maxPulse")) _maxPulse = config["maxPulse"];
             if (config.containsKey("minAngle")) _minAngle = config["minAngle"];
             if (config.containsKey("maxAngle")) _maxAngle = config["maxAngle"];
+            if (config.containsKey("deadband")) setOutputDeadband(config["deadband"]);
+            if (config.containsKey("slewRate")) setOutputSlewRate(config["slewRate"]);
+            if (config.containsKey("smoothingMs")) setOutputSmoothing(config["smoothingMs"]);
+            if (config.containsKey("holdPolicy")) {
+                unsigned long releaseMs = config.containsKey("releaseMs") ? config["releaseMs"].as<unsigned long>() : _releaseMs;
+                setHoldPolicy((HoldPolicy)config["holdPolicy"].as<int>(), releaseMs);
+            }
             return true;
         }
 
@@ -106,6 +135,11 @@ namespace TwiST {
             config["maxPulse"] = _maxPulse;
             config["minAngle"] = _minAngle;
             config["maxAngle"] = _maxAngle;
+            config["deadband"] = _conditioner.getDeadband();
+            config["slewRate"] = _conditioner.getSlewRate();
+            config["smoothingMs"] = _conditioner.getSmoothing() / 1000UL;
+            config["holdPolicy"] = (int)_holdPolicy;
+            config["releaseMs"] = _releaseMs;
         }
 
         // ===== IDevice Serialization =====
@@ -115,6 +149,7 @@ namespace TwiST {
             doc["type"] = "Servo";
             doc["channel"] = _channel;
             doc["angle"] = _currentAngle;
+            doc["released"] = _released;
             doc["enabled"] = _enabled;
             doc["state"] = _state;
         }
@@ -129,6 +164,34 @@ namespace TwiST {
             return true;
         }
 
+        // ===== IDevice Power Management =====
+
+        uint32_t Servo::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY || _isPaused) return UINT32_MAX;
+            // Something still has to reach the PWM: one write per servo frame is all the horn can follow
+            if (_animationDuration > 0 || _moveDeferred || _outputHeld || !_conditioner.isSettled()) {
+                return TWIST_SERVO_FRAME_US;
+            }
+            if (_holdPolicy == RELEASE_WHEN_IDLE && !_released) {
+                unsigned long idle = millis() - _lastChangeMs;
+                if (idle >= _releaseMs) return 0;
+                unsigned long remaining = _releaseMs - idle;
+                // Release delays past ~71 minutes do not fit in microseconds - sleep the maximum
+                return (remaining > UINT32_MAX / 1000UL) ? UINT32_MAX : (uint32_t)(remaining * 1000UL);
+            }
+            return UINT32_MAX;  // Holding position - the PWM peripheral keeps the pulse going
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t Servo::captureState(float* values, uint8_t maxValues) const {
+            // [0] current angle, [1] target angle
+            uint8_t n = 0;
+            if (n < maxValues) values[n++] = _currentAngle;
+            if (n < maxValues) values[n++] = _targetAngle;
+            return n;
+        }
+
         // ===== IOutputDevice Implementation =====
 
         void Servo::setValue(float angle) {
@@ -136,9 +199,16 @@ namespace TwiST {
             if (angle < _minAngle) angle = _minAngle;
             if (angle > _maxAngle) angle = _maxAngle;
 
+            if (_constraint != NULL) {
+                float allowed = _constraint->constrain(_deviceId, angle);
+                _outputHeld = (allowed != angle);
+                _heldRequest = angle;
+                angle = allowed;
+            }
+
             _currentAngle = angle;
             uint16_t pwmValue = mapAngleToPWM(angle);
-            _pwm.setPWM(_channel, pwmValue);  // Uses locked channel
+            writeOutput(pwmValue);
         }
 
         void Servo::setNormalized(float value) {
@@ -148,19 +218,7 @@ namespace TwiST {
         }
 
         void Servo::moveTo(float target, unsigned long duration) {
-            _startAngle = _currentAngle;  // Save start position
-            _targetAngle = target;
-            _animationDuration = duration;
-            _animationStart = millis();
-            _easingType = EASE_LINEAR;  // Default to linear
-            _pausedDuration = 0;
-            _isPaused = false;
-
-            if (duration == 0) {
-                // Immediate movement
-                setValue(target);
-                _animationDuration = 0;
-            }
+            startMove(target, duration, EASE_LINEAR);  // Default to linear
         }
 
         float Servo::getValue() const {
@@ -168,7 +226,7 @@ namespace TwiST {
         }
 
         bool Servo::isMoving() const {
-            return _animationDuration > 0;
+            return _animationDuration > 0 || _moveDeferred;  // Deferred = move still pending
         }
 
         void Servo::setAngle(float angle) {
@@ -196,13 +254,7 @@ namespace TwiST {
         // ===== Advanced Motion Control =====
 
         void Servo::moveToWithEasing(float target, unsigned long duration, EasingType easing) {
-            _startAngle = _currentAngle;  // Save current position as start
-            _targetAngle = target;
-            _animationDuration = duration;
-            _animationStart = millis();
-            _easingType = easing;
-            _pausedDuration = 0;
-            _isPaused = false;
+            startMove(target, duration, easing);
         }
 
         void Servo::moveBySteps(float deltaAngle, unsigned long stepDuration) {
@@ -226,9 +278,13 @@ namespace TwiST {
         }
 
         void Servo::stop() {
+            releaseGrant();
+            _moveDeferred = false;
+            _outputHeld = false;
             _animationDuration = 0;
             _isPaused = false;
             _pausedDuration = 0;
+            _conditioner.reset(_conditioner.getOutput(), micros());  // Slew stops where the output is
         }
 
         void Servo::pause() {
@@ -259,6 +315,36 @@ namespace TwiST {
             return (float)elapsed / (float)_animationDuration;
         }
 
+        // ===== Hold Policy =====
+
+        void Servo::setHoldPolicy(HoldPolicy policy, unsigned long releaseMs) {
+            if (policy > RELEASE_WHEN_DISABLED) {
+                Logger::logf(Logger::Level::ERROR, "SERVO", "%s: unknown hold policy %d", _name, (int)policy);
+                return;
+            }
+            _holdPolicy = policy;
+            _releaseMs = releaseMs;
+            _lastChangeMs = millis();  // Idle timer starts now
+            if (policy == HOLD || (policy == RELEASE_WHEN_DISABLED && _enabled)) {
+                attach();
+            }
+        }
+
+        void Servo::release() {
+            if (_released || !_outputKnown) return;
+            _pwm.setOff(_channel);
+            _released = true;
+            _releases++;
+        }
+
+        void Servo::attach() {
+            if (!_released) return;
+            _pwm.setPWM(_channel, _conditioner.getOutput());  // Same pulse as before the release
+            _released = false;
+            _reattaches++;
+            _lastChangeMs = millis();
+        }
+
         // ===== Helper Methods =====
 
         uint16_t Servo::mapAngleToPWM(float angle) {
@@ -282,6 +368,70 @@ namespace TwiST {
             }
         }
 
+        void Servo::writeOutput(uint16_t ticks) {
+            if (!_outputKnown) {
+                _pwm.setPWM(_channel, ticks);
+                _conditioner.reset(ticks, micros());
+                _outputKnown = true;
+                _lastChangeMs = millis();
+                return;
+            }
+
+            // Released and asked for the same position again (streamed input) - stay limp
+            if (_released && ticks == _conditioner.getOutput() && _conditioner.isSettled()) return;
+
+            _outputStepped = true;
+            uint16_t before = _conditioner.getOutput();
+            uint16_t out;
+            if (_conditioner.step(ticks, micros(), out)) {
+                if (out != before) _lastChangeMs = millis();
+                if (_released) {
+                    _released = false;  // The write below resumes pulses (clears full-OFF)
+                    _reattaches++;
+                }
+                _pwm.setPWM(_channel, out);  // Uses locked channel
+            }
+        }
+
+        void Servo::startMove(float target, unsigned long duration, EasingType easing) {
+            releaseGrant();  // New move replaces the running one
+
+            if (_supervisor != NULL) {
+                if (!_supervisor->requestMove(_deviceId, _currentAngle, target, duration)) {
+                    // Hold position until the supervisor has budget
+                    _moveDeferred = true;
+                    _deferredTarget = target;
+                    _deferredDuration = duration;
+                    _deferredEasing = easing;
+                    _animationDuration = 0;
+                    return;
+                }
+                // duration may have been stretched (throttled)
+                _moveGranted = (duration > 0);  // Jumps expire on the supervisor side
+            }
+            _moveDeferred = false;
+
+            _startAngle = _currentAngle;  // Save current position as start
+            _targetAngle = target;
+            _animationDuration = duration;
+            _animationStart = millis();
+            _easingType = easing;
+            _pausedDuration = 0;
+            _isPaused = false;
+
+            if (duration == 0) {
+                // Immediate movement
+                setValue(target);
+            }
+        }
+
+        void Servo::releaseGrant() {
+            if (_moveGranted && _supervisor != NULL) {
+                _supervisor->releaseMove(_deviceId);
+            }
+            _moveGranted = false;
+        }
+
         float Servo::applyEasing(float t, EasingType type) {
             // Clamp t to [0,1]
             if (t < 0.0f) t = 0.0f;
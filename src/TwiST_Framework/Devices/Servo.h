@@ -24,6 +24,10 @@
  * - Time-based movement (animation)
  * - Calibration (pulse width and angle range)
  * - JSON configuration & serialization
+ * - Optional move admission (IMotionSupervisor) - deferred/throttled starts
+ * - Optional output constraint (IOutputConstraint) - projected before PWM
+ * - Optional output conditioning (deadband, slew limit, low-pass on PWM ticks)
+ * - Hold policy - stop pulses at rest or while disabled, reattach on the next move
  *
  * AUTHOR:    Voldemaras Birskys
  * EMAIL:     voldemaras@gmail.com
@@ -36,7 +40,15 @@
 
 #include "../Interfaces/IOutputDevice.h"
 #include "../Interfaces/IPWMDriver.h"  // ONLY ABSTRACTION!
+#include "../Interfaces/IMotionSupervisor.h"
+#include "../Interfaces/IOutputConstraint.h"
 #include "../Core/EventBus.h"
+#include "../Core/OutputConditioner.h"
+
+// Update period while moving - one PWM frame (50 Hz); writes in between never reach the horn
+#ifndef TWIST_SERVO_FRAME_US
+#define TWIST_SERVO_FRAME_US 20000
+#endif
 
 namespace TwiST {
     namespace Devices {
@@ -90,6 +102,12 @@ namespace TwiST {
             void toJson(JsonDocument& doc) const override;
             bool fromJson(const JsonDocument& doc) override;
 
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
             // IOutputDevice interface (CLEAN - no channel parameter!)
             void setValue(float angle) override;           // Set angle directly
             void setNormalized(float value) override;      // Set normalized (0-1)
@@ -117,10 +135,44 @@ namespace TwiST {
             void moveBySteps(float deltaAngle, unsigned long stepDuration);  // Incremental move
             void setSpeed(float degreesPerSecond);  // Constant speed mode
             void moveWithSpeed(float target);       // Move to target at set speed
-            void stop();                            // Stop current movement immediately
+            void stop();                            // Stop current movement immediately (drops deferred move)
             void pause();                           // Pause movement (can resume)
             void resume();                          // Resume paused movement
 
+            // Move admission - timed moves wait for the supervisor's grant
+            void setMotionSupervisor(IMotionSupervisor* supervisor) { _supervisor = supervisor; }
+            bool isMoveDeferred() const { return _moveDeferred; }
+
+            // Output constraint - every write is projected; held requests are retried in update()
+            void setOutputConstraint(IOutputConstraint* constraint) { _constraint = constraint; }
+            bool isOutputHeld() const { return _outputHeld; }
+
+            // Output conditioning - applied to PWM ticks right before the driver write;
+            // update() keeps writing until the output has caught up with the request
+            void setOutputDeadband(uint16_t ticks) { _conditioner.setDeadband(ticks); }
+            void setOutputSlewRate(float ticksPerSecond) { _conditioner.setSlewRate(ticksPerSecond); }
+            void setOutputSmoothing(unsigned long timeConstantMs) { _conditioner.setSmoothing(timeConstantMs * 1000UL); }
+            uint16_t getOutputTicks() const { return _conditioner.getOutput(); }   // Last value written
+            uint32_t getOutputWrites() const { return _conditioner.getWriteCount(); }
+            uint32_t getSuppressedWrites() const { return _conditioner.getSuppressedCount(); }
+
+            // Hold policy - a released servo gets no pulses (limp, no holding current, no bus
+            // traffic); the next position change resumes pulses from the last output
+            enum HoldPolicy {
+                HOLD,                   // Always pulse (full holding torque)
+                RELEASE_WHEN_IDLE,      // Release after releaseMs at rest (and while disabled)
+                RELEASE_WHEN_DISABLED   // Release only while disabled
+            };
+
+            void setHoldPolicy(HoldPolicy policy, unsigned long releaseMs = 0);
+            HoldPolicy getHoldPolicy() const { return _holdPolicy; }
+            unsigned long getReleaseDelay() const { return _releaseMs; }
+            void release();                         // Stop pulses now
+            void attach();                          // Resume pulses at the last output
+            bool isReleased() const { return _released; }
+            uint32_t getReleaseCount() const { return _releases; }
+            uint32_t getReattachCount() const { return _reattaches; }
+
             // Training Mode Support - Position Recording
             float getCurrentAngle() const { return _currentAngle; }
             float getTargetAngle() const { return _targetAngle; }
@@ -165,9 +217,38 @@ namespace TwiST {
             // Speed control
             float _degreesPerSecond = 0;  // 0 = time-based, >0 = speed-based
 
+            // Move admission (NULL = unsupervised)
+            IMotionSupervisor* _supervisor = NULL;
+            bool _moveGranted = false;    // Supervisor holds a grant for the current animation
+            bool _moveDeferred = false;   // Waiting for a grant - retried in update()
+            float _deferredTarget = 90;
+            unsigned long _deferredDuration = 0;
+            EasingType _deferredEasing = EASE_LINEAR;
+
+            // Output constraint (NULL = unconstrained)
+            IOutputConstraint* _constraint = NULL;
+            bool _outputHeld = false;     // Last write was cut short - keep pushing toward _heldRequest
+            float _heldRequest = 90;
+
+            // Output conditioning (all stages off by default)
+            OutputConditioner _conditioner;
+            bool _outputKnown = false;    // First write is unconditioned - nothing to slew from
+            bool _outputStepped = false;  // Conditioner advanced since the last update()
+
+            // Hold policy
+            HoldPolicy _holdPolicy = HOLD;
+            unsigned long _releaseMs = 0;
+            bool _released = false;
+            unsigned long _lastChangeMs = 0;  // Output ticks last changed (idle timer)
+            uint32_t _releases = 0;
+            uint32_t _reattaches = 0;
+
             // Helper methods
             uint16_t mapAngleToPWM(float angle);
+            void writeOutput(uint16_t ticks);
             float applyEasing(float t, EasingType type);
+            void startMove(float target, unsigned long duration, EasingType easing);
+            void releaseGrant();
         };
     }
 }  // namespace TwiST::Devices
@@ -0,0 +1,284 @@
+#include "Stepper.h"
+#include "../Core/Logger.h"
+#include <math.h>
+
+namespace TwiST {
+    namespace Devices {
+
+        Stepper::Stepper(IStepperDriver& driver, uint8_t axis, uint16_t deviceId,
+                         const char* name, EventBus& eventBus)
+            : _driver(driver), _axis(axis), _deviceId(deviceId), _name(name), _eventBus(eventBus) {
+            // All dependencies locked at construction - no half-initialized state possible
+        }
+
+        // ===== IDevice Lifecycle =====
+
+        bool Stepper::initialize() {
+            _state = STATE_INITIALIZING;
+            if (_axis >= _driver.getAxisCount()) {
+                Logger::logf(Logger::Level::ERROR, "STEPPER", "%s: axis %d not provided by driver", _name, _axis);
+                _state = STATE_ERROR;
+                return false;
+            }
+            _driver.setEnabled(_axis, true);
+            _target = getValue();  // No homing yet - wherever it is, is zero
+            _state = STATE_READY;
+            return true;
+        }
+
+        void Stepper::shutdown() {
+            _pending = false;
+            _driver.setEnabled(_axis, false);
+            _state = STATE_DISABLED;
+            _enabled = false;
+        }
+
+        void Stepper::update() {
+            if (!_enabled || _state != STATE_READY) return;
+
+            // Re-target requested mid-move: start once the old move has come to rest
+            if (_pending && !_driver.isMoving(_axis)) {
+                _pending = false;
+                startMove(_target, _pendingSpeed);
+            }
+        }
+
+        // ===== IDevice Identity & Capabilities =====
+
+        DeviceInfo Stepper::getInfo() const {
+            DeviceInfo info;
+            info.type = "Stepper";
+            info.name = _name;
+            info.id = _deviceId;
+            info.capabilities = getCapabilities();
+            info.channelCount = 1;  // One stepper = one axis
+            return info;
+        }
+
+        uint16_t Stepper::getCapabilities() const {
+            return CAP_OUTPUT | CAP_POSITION | CAP_VELOCITY | CAP_CONFIGURABLE;
+        }
+
+        bool Stepper::hasCapability(DeviceCapability cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
+        // ===== IDevice State Management =====
+
+        DeviceState Stepper::getState() const {
+            return _state;
+        }
+
+        void Stepper::enable() {
+            _enabled = true;
+            _driver.setEnabled(_axis, true);
+            if (_state == STATE_DISABLED) {
+                _state = STATE_READY;
+            }
+        }
+
+        void Stepper::disable() {
+            _enabled = false;
+            _pending = false;
+            _driver.setEnabled(_axis, false);  // Stops pulses and releases the motor
+            _state = STATE_DISABLED;
+        }
+
+        bool Stepper::isEnabled() const {
+            return _enabled;
+        }
+
+        // ===== IDevice Configuration =====
+
+        bool Stepper::configure(const JsonDocument& config) {
+            if (config.containsKey("stepsPerUnit")) setStepsPerUnit(config["stepsPerUnit"]);
+            if (config.containsKey("maxSpeed")) _maxSpeed = config["maxSpeed"];
+            if (config.containsKey("acceleration")) _acceleration = config["acceleration"];
+            if (config.containsKey("minPosition") && config.containsKey("maxPosition")) {
+                setLimits(config["minPosition"], config["maxPosition"]);
+            }
+            return true;
+        }
+
+        void Stepper::getConfiguration(JsonDocument& config) const {
+            config["stepsPerUnit"] = _stepsPerUnit;
+            config["maxSpeed"] = _maxSpeed;
+            config["acceleration"] = _acceleration;
+            if (_hasLimits) {
+                config["minPosition"] = _minPosition;
+                config["maxPosition"] = _maxPosition;
+            }
+        }
+
+        // ===== IDevice Serialization =====
+
+        void Stepper::toJson(JsonDocument& doc) const {
+            doc["id"] = _deviceId;
+            doc["type"] = "Stepper";
+            doc["axis"] = _axis;
+            doc["position"] = getValue();
+            doc["target"] = _target;
+            doc["moving"] = isMoving();
+            doc["enabled"] = _enabled;
+            doc["state"] = _state;
+        }
+
+        bool Stepper::fromJson(const JsonDocument& doc) {
+            if (doc.containsKey("position")) {
+                setValue(doc["position"]);
+            }
+            if (doc.containsKey("enabled")) {
+                if (doc["enabled"].as<bool>()) enable(); else disable();
+            }
+            return true;
+        }
+
+        // ===== IDevice Power Management =====
+
+        uint32_t Stepper::getTimeUntilUpdate(uint32_t nowUs) const {
+            if (!_enabled || _state != STATE_READY) return UINT32_MAX;
+            // Pulses run in the driver; only a queued re-target needs the loop (watch for rest)
+            return _pending ? TWIST_STEPPER_REST_POLL_US : UINT32_MAX;
+        }
+
+        // ===== IDevice Snapshot =====
+
+        uint8_t Stepper::captureState(float* values, uint8_t maxValues) const {
+            // [0] counted position, [1] target (units)
+            uint8_t n = 0;
+            if (n < maxValues) values[n++] = getValue();
+            if (n < maxValues) values[n++] = _target;
+            return n;
+        }
+
+        // ===== IOutputDevice Implementation =====
+
+        void Stepper::setValue(float position) {
+            startMove(position, _maxSpeed);
+        }
+
+        void Stepper::setNormalized(float value) {
+            if (!_hasLimits) {
+                Logger::logf(Logger::Level::ERROR, "STEPPER", "%s: setNormalized() needs setLimits()", _name);
+                return;
+            }
+            if (value < 0.0f) value = 0.0f;
+            if (value > 1.0f) value = 1.0f;
+            setValue(_minPosition + value * (_maxPosition - _minPosition));
+        }
+
+        void Stepper::moveTo(float target, unsigned long duration) {
+            target = clampPosition(target);
+            float distance = fabsf(target - getValue());
+            float seconds = duration / 1000.0f;
+            if (duration == 0 || distance == 0.0f) {
+                startMove(target, _maxSpeed);
+                return;
+            }
+
+            // Trapezoid covering distance in T: v^2 - aTv + aD = 0, smaller root
+            float a = _acceleration;
+            float disc = a * a * seconds * seconds - 4.0f * a * distance;
+            float speed = (disc >= 0.0f) ? (a * seconds - sqrtf(disc)) / 2.0f : _maxSpeed;  // Too short - go as fast as allowed
+            if (speed > _maxSpeed) speed = _maxSpeed;
+            startMove(target, speed);
+        }
+
+        float Stepper::getValue() const {
+            return _driver.getPosition(_axis) / _stepsPerUnit;
+        }
+
+        bool Stepper::isMoving() const {
+            return _driver.isMoving(_axis) || _pending;
+        }
+
+        // ===== Stepper-specific API =====
+
+        void Stepper::setStepsPerUnit(float stepsPerUnit) {
+            if (stepsPerUnit <= 0.0f) {
+                Logger::logf(Logger::Level::ERROR, "STEPPER", "%s: stepsPerUnit must be > 0", _name);
+                return;
+            }
+            _stepsPerUnit = stepsPerUnit;
+        }
+
+        void Stepper::setLimits(float minPosition, float maxPosition) {
+            if (minPosition >= maxPosition) {
+                Logger::logf(Logger::Level::ERROR, "STEPPER", "%s: invalid limits %.2f..%.2f",
+                            _name, minPosition, maxPosition);
+                return;
+            }
+            _minPosition = minPosition;
+            _maxPosition = maxPosition;
+            _hasLimits = true;
+        }
+
+        void Stepper::setVelocity(float unitsPerSecond) {
+            if (unitsPerSecond == 0.0f) {
+                stop();
+                return;
+            }
+
+            float speed = fabsf(unitsPerSecond);
+            if (speed > _maxSpeed) speed = _maxSpeed;
+            float target;
+            if (_hasLimits) {
+                target = (unitsPerSecond > 0.0f) ? _maxPosition : _minPosition;
+            } else {
+                float reach = 1.0e9f / _stepsPerUnit;  // Far enough to never arrive
+                target = getValue() + ((unitsPerSecond > 0.0f) ? reach : -reach);
+            }
+            startMove(target, speed);
+        }
+
+        void Stepper::setCurrentPosition(float position) {
+            if (_driver.isMoving(_axis)) {
+                Logger::logf(Logger::Level::ERROR, "STEPPER", "%s: cannot set position while moving", _name);
+                return;
+            }
+            _driver.setPosition(_axis, (int32_t)lroundf(position * _stepsPerUnit));
+            _target = position;
+        }
+
+        void Stepper::stop() {
+            _pending = false;
+            _driver.stop(_axis, false);
+            _target = getValue();
+        }
+
+        void Stepper::halt() {
+            _pending = false;
+            _driver.stop(_axis, true);
+            _target = getValue();
+        }
+
+        // ===== Helper Methods =====
+
+        void Stepper::startMove(float target, float speed) {
+            if (!_enabled || _state != STATE_READY) return;
+
+            _target = clampPosition(target);
+            if (_driver.isMoving(_axis)) {
+                // Moves are rest-to-rest: bring the motor down, update() starts the new one
+                _driver.stop(_axis, false);
+                _pending = true;
+                _pendingSpeed = speed;
+                return;
+            }
+
+            int32_t delta = (int32_t)lroundf(_target * _stepsPerUnit) - _driver.getPosition(_axis);
+            if (!_driver.move(_axis, delta, speed * _stepsPerUnit, _acceleration * _stepsPerUnit)) {
+                Logger::logf(Logger::Level::WARNING, "STEPPER", "%s: move of %ld steps rejected",
+                            _name, (long)delta);
+            }
+        }
+
+        float Stepper::clampPosition(float position) const {
+            if (!_hasLimits) return position;
+            if (position < _minPosition) return _minPosition;
+            if (position > _maxPosition) return _maxPosition;
+            return position;
+        }
+
+    }
+}  // namespace TwiST::Devices
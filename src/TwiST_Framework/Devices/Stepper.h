@@ -0,0 +1,160 @@
+/* ============================================================================
+ * TwiST Framework | Native Device
+ * ============================================================================
+ * @file      Stepper.h
+ * @brief     Stepper motor output device based on step pulse abstraction.
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Devices
+ * - Type:         Native Output Device
+ * - Hardware:     STEP/DIR driver via IStepperDriver abstraction
+ * - Dependency:   EventBus, IStepperDriver
+ *
+ * PRINCIPLES:
+ * - No hardware knowledge (NO Drivers includes)
+ * - Constructor Injection only
+ * - One Stepper instance = one physical motor (one axis)
+ * - Axis is locked at construction time
+ * - Pulse timing lives in the driver - update() only sequences moves
+ *
+ * CAPABILITIES:
+ * - Position control in user units (steps/mm, steps/degree via stepsPerUnit)
+ * - Trapezoidal moves at configured speed/acceleration
+ * - Time-based moves (speed solved so the move takes the given duration)
+ * - Velocity control (run toward a limit at a given speed)
+ * - Re-targeting while moving: decelerate, then start the new move
+ * - Soft position limits, homing (setCurrentPosition)
+ * - JSON configuration & serialization
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================*/
+
+#ifndef TWIST_DEVICE_STEPPER_H
+#define TWIST_DEVICE_STEPPER_H
+
+#include "../Interfaces/IOutputDevice.h"
+#include "../Interfaces/IStepperDriver.h"  // ONLY ABSTRACTION!
+#include "../Core/EventBus.h"
+
+// How often a queued re-target checks whether the motor has come to rest
+#ifndef TWIST_STEPPER_REST_POLL_US
+#define TWIST_STEPPER_REST_POLL_US 1000
+#endif
+
+namespace TwiST {
+    namespace Devices {
+
+        /**
+         * @brief Native stepper device - implements IOutputDevice
+         *
+         * Uses IStepperDriver abstraction - NEVER knows about timers or GPIO.
+         *
+         * Example usage:
+         * ```cpp
+         * Devices::Stepper slide(steppers, 0, 400, "Slide", eventBus);
+         * slide.setStepsPerUnit(80.0f);            // 80 steps/mm
+         * slide.setSpeed(150.0f);                  // mm/s
+         * slide.setAcceleration(600.0f);           // mm/s^2
+         * slide.setLimits(0.0f, 300.0f);
+         * slide.moveTo(120.0f, 2000);              // 120 mm in 2 s
+         * ```
+         */
+        class Stepper : public IOutputDevice {
+        public:
+            /**
+             * @param driver Reference to IStepperDriver (NOT StepEngine!)
+             * @param axis Driver axis (LOCKED at construction)
+             * @param deviceId Unique device ID
+             * @param name Human-readable device name (e.g., "Slide")
+             * @param eventBus Reference to EventBus (ALL dependencies in constructor!)
+             */
+            Stepper(IStepperDriver& driver, uint8_t axis, uint16_t deviceId,
+                    const char* name, EventBus& eventBus);
+
+            // IDevice interface - Lifecycle
+            bool initialize() override;
+            void shutdown() override;
+            void update() override;
+
+            // IDevice interface - Identity & Capabilities
+            DeviceInfo getInfo() const override;
+            const char* getName() const override { return _name; }
+            uint16_t getCapabilities() const override;
+            bool hasCapability(DeviceCapability cap) const override;
+
+            // IDevice interface - State Management
+            DeviceState getState() const override;
+            void enable() override;
+            void disable() override;
+            bool isEnabled() const override;
+
+            // IDevice interface - Configuration
+            bool configure(const JsonDocument& config) override;
+            void getConfiguration(JsonDocument& config) const override;
+
+            // IDevice interface - Serialization
+            void toJson(JsonDocument& doc) const override;
+            bool fromJson(const JsonDocument& doc) override;
+
+            // IDevice interface - Power Management
+            uint32_t getTimeUntilUpdate(uint32_t nowUs) const override;
+
+            // IDevice interface - Snapshot
+            uint8_t captureState(float* values, uint8_t maxValues) const override;
+
+            // IOutputDevice interface
+            void setValue(float position) override;        // Move at configured speed
+            void setNormalized(float value) override;      // 0-1 across the soft limits
+            void moveTo(float target, unsigned long duration) override;
+            float getValue() const override;               // Counted position (units)
+            bool isMoving() const override;
+
+            // Stepper-specific API
+            void setStepsPerUnit(float stepsPerUnit);
+            void setSpeed(float unitsPerSecond) { _maxSpeed = unitsPerSecond; }
+            void setAcceleration(float unitsPerSecond2) { _acceleration = unitsPerSecond2; }
+            void setLimits(float minPosition, float maxPosition);
+            void setVelocity(float unitsPerSecond);        // Run toward a limit; 0 = stop
+            void setCurrentPosition(float position);       // Homing - motor must be idle
+            void stop();                                   // Decelerate to rest
+            void halt();                                   // No more pulses (emergency)
+
+            float getTargetPosition() const { return _target; }
+            float getStepsPerUnit() const { return _stepsPerUnit; }
+            uint8_t getAxis() const { return _axis; }
+
+        private:
+            IStepperDriver& _driver;  // Abstract interface, not concrete driver
+            uint8_t _axis;            // CONST - known at construction, never changes
+            uint16_t _deviceId;
+            const char* _name;
+            EventBus& _eventBus;
+
+            // State
+            DeviceState _state = STATE_UNINITIALIZED;
+            bool _enabled = true;
+
+            // Calibration
+            float _stepsPerUnit = 1.0f;
+            float _maxSpeed = 1000.0f;       // Units/s
+            float _acceleration = 4000.0f;   // Units/s^2
+            bool _hasLimits = false;
+            float _minPosition = 0.0f;
+            float _maxPosition = 0.0f;
+
+            // Motion
+            float _target = 0.0f;
+            bool _pending = false;           // Waiting for the current move to decelerate
+            float _pendingSpeed = 0.0f;
+
+            // Helper methods
+            void startMove(float target, float speed);
+            float clampPosition(float position) const;
+        };
+    }
+}  // namespace TwiST::Devices
+
+#endif
@@ -28,6 +28,7 @@
  */
 
 #include "ESP32ADC.h"
+#include "../../Core/Tracer.h"
 
 namespace TwiST {
     namespace Drivers {
@@ -48,6 +49,7 @@ namespace TwiST {
         }
 
         uint16_t ESP32ADC::readRaw() {
+            TWIST_TRACE_SCOPE("ESP32ADC::readRaw");
             return analogRead(_pin);
         }
     }
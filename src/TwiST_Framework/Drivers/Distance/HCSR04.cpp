@@ -1,4 +1,5 @@
 #include "HCSR04.h"
+#include "../../Core/Tracer.h"
 
 namespace TwiST {
     namespace Drivers {
@@ -34,6 +35,8 @@ namespace TwiST {
         }
 
         float HCSR04::readDistanceCm() {
+            TWIST_TRACE_SCOPE("HCSR04::readDistanceCm");
+
             // Read ECHO pulse duration (timeout after 30ms)
             unsigned long duration = pulseIn(_echoPin, HIGH, TIMEOUT_US);
 
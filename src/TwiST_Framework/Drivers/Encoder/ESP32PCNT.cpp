@@ -0,0 +1,120 @@
+#include "ESP32PCNT.h"
+#include "../../Core/Logger.h"
+#include <driver/pulse_cnt.h>
+#include <driver/gpio.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        ESP32PCNT::ESP32PCNT(uint8_t pinA, uint8_t pinB, uint16_t glitchFilterNs, bool pullup)
+            : _pinA(pinA),
+              _pinB(pinB),
+              _glitchNs(glitchFilterNs),
+              _pullup(pullup),
+              _unit(nullptr),
+              _channels{nullptr, nullptr},
+              _offset(0) {
+        }
+
+        ESP32PCNT::~ESP32PCNT() {
+            if (_unit == nullptr) return;
+            pcnt_unit_stop(_unit);
+            pcnt_unit_disable(_unit);
+            release(_unit);
+            _unit = nullptr;
+        }
+
+        bool ESP32PCNT::begin() {
+            if (_unit != nullptr) return true;
+            if (_pinA == _pinB) {
+                Logger::logf(Logger::Level::ERROR, "PCNT", "A and B on the same GPIO%d", _pinA);
+                return false;
+            }
+
+            pcnt_unit_config_t unitConfig = {};
+            unitConfig.low_limit = -TWIST_PCNT_LIMIT;
+            unitConfig.high_limit = TWIST_PCNT_LIMIT;
+            unitConfig.flags.accum_count = 1;   // Extend past the 16-bit counter
+            pcnt_unit_handle_t unit = nullptr;
+            if (pcnt_new_unit(&unitConfig, &unit) != ESP_OK) {
+                Logger::error("PCNT", "No free pulse counter unit");
+                return false;
+            }
+
+            if (_glitchNs > 0) {
+                pcnt_glitch_filter_config_t filter = {};
+                filter.max_glitch_ns = _glitchNs;
+                if (pcnt_unit_set_glitch_filter(unit, &filter) != ESP_OK) {
+                    Logger::logf(Logger::Level::WARNING, "PCNT", "Glitch filter %dns rejected - unfiltered", _glitchNs);
+                }
+            }
+
+            // x4 decoding: each channel counts its own edges, direction from the other line
+            pcnt_chan_config_t configA = {};
+            configA.edge_gpio_num = _pinA;
+            configA.level_gpio_num = _pinB;
+            pcnt_chan_config_t configB = {};
+            configB.edge_gpio_num = _pinB;
+            configB.level_gpio_num = _pinA;
+            if (pcnt_new_channel(unit, &configA, &_channels[0]) != ESP_OK ||
+                pcnt_new_channel(unit, &configB, &_channels[1]) != ESP_OK) {
+                Logger::logf(Logger::Level::ERROR, "PCNT", "GPIO%d/%d rejected", _pinA, _pinB);
+                release(unit);
+                return false;
+            }
+            pcnt_channel_handle_t chanA = _channels[0];
+            pcnt_channel_handle_t chanB = _channels[1];
+            pcnt_channel_set_edge_action(chanA, PCNT_CHANNEL_EDGE_ACTION_DECREASE, PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+            pcnt_channel_set_level_action(chanA, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+            pcnt_channel_set_edge_action(chanB, PCNT_CHANNEL_EDGE_ACTION_INCREASE, PCNT_CHANNEL_EDGE_ACTION_DECREASE);
+            pcnt_channel_set_level_action(chanB, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+
+            // Accumulator folds the counter at the limits (watch points required)
+            pcnt_unit_add_watch_point(unit, -TWIST_PCNT_LIMIT);
+            pcnt_unit_add_watch_point(unit, TWIST_PCNT_LIMIT);
+
+            if (_pullup) {
+                gpio_pullup_en((gpio_num_t)_pinA);
+                gpio_pullup_en((gpio_num_t)_pinB);
+            }
+
+            if (pcnt_unit_enable(unit) != ESP_OK ||
+                pcnt_unit_clear_count(unit) != ESP_OK ||
+                pcnt_unit_start(unit) != ESP_OK) {
+                Logger::error("PCNT", "Unit failed to start");
+                release(unit);
+                return false;
+            }
+
+            _unit = unit;
+            Logger::logf(Logger::Level::INFO, "PCNT", "Encoder on GPIO%d/%d (x4, filter %dns)",
+                        _pinA, _pinB, _glitchNs);
+            return true;
+        }
+
+        int32_t ESP32PCNT::readCount() {
+            if (_unit == nullptr) return _offset;
+            int count = 0;
+            pcnt_unit_get_count(_unit, &count);
+            return _offset + (int32_t)count;
+        }
+
+        void ESP32PCNT::setCount(int32_t count) {
+            if (_unit != nullptr) {
+                pcnt_unit_clear_count(_unit);   // Also clears the accumulator
+            }
+            _offset = count;
+        }
+
+        void ESP32PCNT::release(pcnt_unit_handle_t unit) {
+            for (uint8_t i = 0; i < 2; i++) {
+                if (_channels[i] != nullptr) {
+                    pcnt_del_channel(_channels[i]);
+                    _channels[i] = nullptr;
+                }
+            }
+            pcnt_del_unit(unit);
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,88 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      ESP32PCNT.h
+ * @brief     Quadrature encoder on the ESP32 pulse counter implementing IEncoderDriver
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Hardware Driver
+ * - Hardware:     ESP32 PCNT peripheral (one unit per encoder)
+ * - Implements:   IEncoderDriver
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Devices layer NEVER includes this file directly
+ * - x4 decoding in hardware (two channels: A edges gated by B, B by A) -
+ *   no CPU work per edge, no interrupt per count
+ * - 16-bit hardware counter extended to 32 bits by the PCNT driver's
+ *   accumulator (one interrupt per TWIST_PCNT_LIMIT counts)
+ *
+ * CAPABILITIES:
+ * - Glitch filter (rejects pulses shorter than glitchFilterNs)
+ * - Optional internal pull-ups (open-collector encoders)
+ * - SOC_PCNT_UNITS_PER_GROUP encoders per chip (4 on ESP32-C6)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_ESP32PCNT_H
+#define TWIST_DRIVER_ESP32PCNT_H
+
+#include "../../Interfaces/IEncoderDriver.h"
+#include <Arduino.h>
+
+// Hardware counter range before the accumulator folds it into the 32-bit count
+#ifndef TWIST_PCNT_LIMIT
+#define TWIST_PCNT_LIMIT 30000
+#endif
+
+struct pcnt_unit_t;  // ESP-IDF opaque handles (driver/pulse_cnt.h)
+struct pcnt_chan_t;
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief ESP32 PCNT quadrature encoder - implements IEncoderDriver
+         *
+         * Example usage:
+         * ```cpp
+         * Drivers::ESP32PCNT shoulderEnc(20, 21);   // A, B
+         * if (!shoulderEnc.begin()) { ... }
+         * Devices::Encoder shoulder(shoulderEnc, 600, "ShoulderEnc", eventBus);
+         * ```
+         */
+        class ESP32PCNT : public IEncoderDriver {  // Implements abstraction
+        public:
+            ESP32PCNT(uint8_t pinA, uint8_t pinB, uint16_t glitchFilterNs = 1000, bool pullup = true);
+            ~ESP32PCNT();
+
+            bool begin();
+
+            // IEncoderDriver interface implementation
+            int32_t readCount() override;
+            void setCount(int32_t count) override;
+
+            bool isStarted() const { return _unit != nullptr; }
+
+        private:
+            uint8_t _pinA;
+            uint8_t _pinB;
+            uint16_t _glitchNs;
+            bool _pullup;
+            pcnt_unit_t* _unit;
+            pcnt_chan_t* _channels[2];
+            int32_t _offset;        // setCount() origin (hardware count is cleared)
+
+            void release(pcnt_unit_t* unit);
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
@@ -0,0 +1,178 @@
+#include "ESP32DigitalInput.h"
+#include "../../Core/Logger.h"
+#include "../../Core/PowerManager.h"
+#include <soc/soc.h>               // REG_READ
+#include <soc/gpio_reg.h>          // GPIO_IN_REG (GPIO_IN1_REG on chips with > 32 pins)
+
+static_assert((TWIST_INPUT_EDGE_QUEUE & (TWIST_INPUT_EDGE_QUEUE - 1)) == 0,
+              "TWIST_INPUT_EDGE_QUEUE must be a power of two");
+static_assert(TWIST_INPUT_EDGE_QUEUE <= 128, "Queue indices are 8-bit");
+
+namespace TwiST {
+    namespace Drivers {
+
+        ESP32DigitalInput::ESP32DigitalInput(uint32_t scanIntervalUs)
+            : _lineCount(0),
+              _started(false),
+              _scanInterval(scanIntervalUs),
+              _lastScanUs(0),
+              _scanCount(0) {
+        }
+
+        int8_t ESP32DigitalInput::addLine(uint8_t gpio, bool activeLow, bool pullup, bool interrupt) {
+            if (_started) {
+                Logger::error("INPUT", "addLine() after begin()");
+                return -1;
+            }
+            if (_lineCount >= TWIST_INPUT_MAX_LINES) {
+                Logger::logf(Logger::Level::ERROR, "INPUT", "Line limit %d reached", TWIST_INPUT_MAX_LINES);
+                return -1;
+            }
+#ifndef GPIO_IN1_REG
+            if (gpio >= 32) {
+                Logger::logf(Logger::Level::ERROR, "INPUT", "GPIO%d not readable through GPIO_IN_REG", gpio);
+                return -1;
+            }
+#endif
+            for (uint8_t i = 0; i < _lineCount; i++) {
+                if (_lines[i].gpio == gpio) {
+                    Logger::logf(Logger::Level::ERROR, "INPUT", "GPIO%d already used by line %d", gpio, i);
+                    return -1;
+                }
+            }
+
+            Line& line = _lines[_lineCount];
+            line.gpio = gpio;
+            line.activeLow = activeLow;
+            line.pullup = pullup;
+            line.interrupt = interrupt;
+            line.lastLevel = false;
+            line.head.store(0, std::memory_order_relaxed);
+            line.tail.store(0, std::memory_order_relaxed);
+            line.dropped = 0;
+            return (int8_t)_lineCount++;
+        }
+
+        bool ESP32DigitalInput::begin() {
+            if (_started) return true;
+            if (_lineCount == 0) {
+                Logger::error("INPUT", "No lines added");
+                return false;
+            }
+
+            uint8_t interrupts = 0;
+            for (uint8_t i = 0; i < _lineCount; i++) {
+                Line& line = _lines[i];
+                pinMode(line.gpio, line.pullup ? INPUT_PULLUP : INPUT);
+            }
+
+            // Initial levels before any edge can be queued
+            uint32_t low = REG_READ(GPIO_IN_REG);
+            uint32_t high = readHighBank();
+            for (uint8_t i = 0; i < _lineCount; i++) {
+                Line& line = _lines[i];
+                line.lastLevel = levelFrom(line, low, high);
+                if (line.interrupt) {
+                    attachInterruptArg(digitalPinToInterrupt(line.gpio), onEdge, &line, CHANGE);
+                    interrupts++;
+                }
+            }
+
+            _lastScanUs = micros();
+            _started = true;
+            Logger::logf(Logger::Level::INFO, "INPUT", "%d lines (%d interrupt, %d polled every %lu us)",
+                        _lineCount, interrupts, _lineCount - interrupts, (unsigned long)_scanInterval);
+            return true;
+        }
+
+        // ===== IDigitalInputDriver =====
+
+        bool ESP32DigitalInput::readLine(uint8_t line) {
+            if (line >= _lineCount) return false;
+            return levelFrom(_lines[line], REG_READ(GPIO_IN_REG), readHighBank());
+        }
+
+        bool ESP32DigitalInput::popEdge(uint8_t line, DigitalEdge& edge) {
+            if (line >= _lineCount) return false;
+            Line& l = _lines[line];
+
+            uint8_t tail = l.tail.load(std::memory_order_relaxed);
+            if (tail == l.head.load(std::memory_order_acquire)) return false;
+            edge = l.queue[tail & (TWIST_INPUT_EDGE_QUEUE - 1)];
+            l.tail.store((uint8_t)(tail + 1), std::memory_order_release);
+            return true;
+        }
+
+        uint32_t ESP32DigitalInput::getDroppedEdges(uint8_t line) const {
+            return (line < _lineCount) ? _lines[line].dropped : 0;
+        }
+
+        uint32_t ESP32DigitalInput::getPollInterval(uint8_t line) const {
+            if (line >= _lineCount || _lines[line].interrupt) return UINT32_MAX;  // ISR wakes the loop
+            return _scanInterval;
+        }
+
+        void ESP32DigitalInput::poll() {
+            if (!_started) return;
+            uint32_t now = micros();
+            if (now - _lastScanUs < _scanInterval) return;  // Another device already scanned this tick
+            _lastScanUs = now;
+            _scanCount++;
+
+            // One register read covers every polled line
+            uint32_t low = REG_READ(GPIO_IN_REG);
+            uint32_t high = readHighBank();
+            for (uint8_t i = 0; i < _lineCount; i++) {
+                Line& line = _lines[i];
+                if (line.interrupt) continue;  // ISR is the only producer for these
+                bool level = levelFrom(line, low, high);
+                if (level != line.lastLevel) {
+                    push(line, level, now);
+                }
+            }
+        }
+
+        // ===== Helpers =====
+
+        bool ESP32DigitalInput::levelFrom(const Line& line, uint32_t low, uint32_t high) {
+            uint32_t bits = (line.gpio < 32) ? low : high;
+            bool pinHigh = (bits >> (line.gpio & 31)) & 1;
+            return pinHigh != line.activeLow;
+        }
+
+        uint32_t ESP32DigitalInput::readHighBank() {
+#ifdef GPIO_IN1_REG
+            return REG_READ(GPIO_IN1_REG);
+#else
+            return 0;
+#endif
+        }
+
+        void ESP32DigitalInput::push(Line& line, bool level, uint32_t timestampUs) {
+            line.lastLevel = level;
+            uint8_t head = line.head.load(std::memory_order_relaxed);
+            if ((uint8_t)(head - line.tail.load(std::memory_order_acquire)) >= TWIST_INPUT_EDGE_QUEUE) {
+                line.dropped++;  // Consumer resyncs from readLine()
+                return;
+            }
+            DigitalEdge& slot = line.queue[head & (TWIST_INPUT_EDGE_QUEUE - 1)];
+            slot.timestampUs = timestampUs;
+            slot.level = level;
+            line.head.store((uint8_t)(head + 1), std::memory_order_release);
+        }
+
+        // ===== Pin-change ISR =====
+
+        void IRAM_ATTR ESP32DigitalInput::onEdge(void* arg) {
+            Line& line = *static_cast<Line*>(arg);
+            uint32_t now = micros();
+            uint32_t bits = (line.gpio < 32) ? REG_READ(GPIO_IN_REG) : readHighBank();
+            bool level = ((bits >> (line.gpio & 31)) & 1) != line.activeLow;
+            if (level != line.lastLevel) {  // Several edges before the ISR ran - same level twice
+                push(line, level, now);
+                PowerManager::wakeFromISR();  // Loop may be idling until its next deadline
+            }
+        }
+
+    }
+}  // namespace TwiST::Drivers
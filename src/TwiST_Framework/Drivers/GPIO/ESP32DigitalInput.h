@@ -0,0 +1,132 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      ESP32DigitalInput.h
+ * @brief     ESP32 GPIO input lines implementing IDigitalInputDriver
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Hardware Driver
+ * - Hardware:     ESP32 GPIO (input register + pin-change interrupts)
+ * - Implements:   IDigitalInputDriver
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Devices layer NEVER includes this file directly
+ * - Interrupt lines: the pin-change ISR timestamps the level and pushes
+ *   it into the line's lock-free ring (ISR producer, device consumer)
+ * - Polled lines: poll() reads the GPIO input register ONCE for all lines
+ *   and queues changed levels - rate-limited, so every device may call it
+ * - No debouncing here - raw edges only (see Core/Debouncer)
+ *
+ * CAPABILITIES:
+ * - TWIST_INPUT_MAX_LINES lines, active-low/high, internal pull-up
+ * - Per-line edge queue (TWIST_INPUT_EDGE_QUEUE) with drop counter
+ * - Mixed interrupt / polled lines on one driver
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_ESP32_DIGITAL_INPUT_H
+#define TWIST_DRIVER_ESP32_DIGITAL_INPUT_H
+
+#include "../../Interfaces/IDigitalInputDriver.h"
+#include <Arduino.h>
+#include <atomic>
+
+// Lines per driver
+#ifndef TWIST_INPUT_MAX_LINES
+#define TWIST_INPUT_MAX_LINES 16
+#endif
+
+// Queued edges per line (power of two) - a bouncing contact makes dozens
+// of edges, but the debouncer only needs the last level once the queue fills
+#ifndef TWIST_INPUT_EDGE_QUEUE
+#define TWIST_INPUT_EDGE_QUEUE 16
+#endif
+
+// Minimum time between port scans for polled lines
+#ifndef TWIST_INPUT_SCAN_US
+#define TWIST_INPUT_SCAN_US 1000
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief ESP32 GPIO input driver - implements IDigitalInputDriver
+         *
+         * Example usage:
+         * ```cpp
+         * Drivers::ESP32DigitalInput inputs;
+         * int8_t start = inputs.addLine(9);                   // Button to GND, interrupt
+         * int8_t limit = inputs.addLine(18, true, true, false); // Polled limit switch
+         * if (!inputs.begin()) { ... }
+         * Devices::DigitalInput startButton(inputs, start, 500, "Start", eventBus);
+         * ```
+         */
+        class ESP32DigitalInput : public IDigitalInputDriver {  // Implements abstraction
+        public:
+            explicit ESP32DigitalInput(uint32_t scanIntervalUs = TWIST_INPUT_SCAN_US);
+
+            /**
+             * @brief Register a line (before begin())
+             * @param gpio Input pin
+             * @param activeLow true = pressed pulls the pin low
+             * @param pullup Enable the internal pull-up
+             * @param interrupt true = pin-change interrupt, false = polled by poll()
+             * @return Line index, -1 if full, started or pin reused
+             */
+            int8_t addLine(uint8_t gpio, bool activeLow = true, bool pullup = true, bool interrupt = true);
+
+            /**
+             * @brief Configure pins and attach interrupts
+             */
+            bool begin();
+
+            // IDigitalInputDriver interface implementation
+            uint8_t getLineCount() const override { return _lineCount; }
+            bool readLine(uint8_t line) override;
+            bool popEdge(uint8_t line, DigitalEdge& edge) override;
+            uint32_t getDroppedEdges(uint8_t line) const override;
+            void poll() override;
+            uint32_t getPollInterval(uint8_t line) const override;
+
+            // Diagnostics
+            uint32_t getScanCount() const { return _scanCount; }
+            bool isStarted() const { return _started; }
+
+        private:
+            struct Line {
+                uint8_t gpio;
+                bool activeLow;
+                bool pullup;
+                bool interrupt;
+                bool lastLevel;                     // Last level queued (producer side)
+                DigitalEdge queue[TWIST_INPUT_EDGE_QUEUE];
+                std::atomic<uint8_t> head;          // Producer (ISR or poll())
+                std::atomic<uint8_t> tail;          // Consumer (device)
+                volatile uint32_t dropped;
+            };
+
+            Line _lines[TWIST_INPUT_MAX_LINES];
+            uint8_t _lineCount;
+            bool _started;
+            uint32_t _scanInterval;
+            uint32_t _lastScanUs;
+            uint32_t _scanCount;
+
+            static bool levelFrom(const Line& line, uint32_t low, uint32_t high);
+            static uint32_t readHighBank();
+            static void push(Line& line, bool level, uint32_t timestampUs);
+            static void onEdge(void* arg);
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
@@ -0,0 +1,42 @@
+#include "FakeI2CBus.h"
+#include <string.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        FakeI2CBus::FakeI2CBus(uint32_t clockHz)
+            : _next(0),
+              _clockHz(clockHz > 0 ? clockHz : 400000),
+              _nackAddress(0),
+              _count(0),
+              _bytes(0),
+              _busUs(0) {
+            memset(_log, 0, sizeof(_log));
+        }
+
+        bool FakeI2CBus::write(uint8_t address, const uint8_t* data, uint8_t length) {
+            bool acked = (_nackAddress == 0 || address != _nackAddress);
+
+            Record& record = _log[_next];
+            _next = (_next + 1) % TWIST_FAKE_I2C_LOG;
+            record.address = address;
+            record.length = length;
+            record.acked = acked;
+            memcpy(record.data, data, (length < TWIST_FAKE_I2C_MAX_DATA) ? length : TWIST_FAKE_I2C_MAX_DATA);
+
+            // Address byte + data, 9 clocks each; a NACKed address stops after byte one
+            uint32_t clocks = acked ? 9UL * (1 + length) : 9UL;
+            _busUs += (clocks * 1000000UL) / _clockHz;
+            _count++;
+            _bytes += length;
+            return acked;
+        }
+
+        const FakeI2CBus::Record* FakeI2CBus::getRecord(uint16_t back) const {
+            if (back >= TWIST_FAKE_I2C_LOG || back >= _count) return NULL;
+            uint16_t index = (_next + TWIST_FAKE_I2C_LOG - 1 - back) % TWIST_FAKE_I2C_LOG;
+            return &_log[index];
+        }
+
+    }
+}  // namespace TwiST::Drivers
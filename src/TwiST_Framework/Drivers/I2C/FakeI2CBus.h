@@ -0,0 +1,103 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      FakeI2CBus.h
+ * @brief     In-memory I2C bus for host tests and queue self-tests
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Virtual Bus Driver (pure C++)
+ * - Hardware:     None
+ * - Implements:   II2CBus
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - builds unchanged on a Linux host
+ * - Records the last TWIST_FAKE_I2C_LOG transactions in a ring
+ * - Accounts bus time as if the bytes were clocked out (9 bits per byte
+ *   incl. ACK, plus address byte) - nothing actually waits
+ *
+ * CAPABILITIES:
+ * - NACK injection per address
+ * - Register-level inspection for register-pointer protocols (PCA9685)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_FAKE_I2C_BUS_H
+#define TWIST_DRIVER_FAKE_I2C_BUS_H
+
+#include "../../Interfaces/II2CBus.h"
+
+// Transactions kept for inspection
+#ifndef TWIST_FAKE_I2C_LOG
+#define TWIST_FAKE_I2C_LOG 64
+#endif
+
+// Longest transaction kept (longer ones are truncated in the log)
+#ifndef TWIST_FAKE_I2C_MAX_DATA
+#define TWIST_FAKE_I2C_MAX_DATA 16
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief Recording I2C bus
+         *
+         * Example:
+         * ```cpp
+         * FakeI2CBus bus;
+         * I2CQueue queue(bus);                  // No task: update() runs it
+         * queue.writeRegister(0x40, 0x06, data, 4);
+         * queue.update();
+         * bus.getTransactionCount();            // 1
+         * ```
+         */
+        class FakeI2CBus : public II2CBus {
+        public:
+            struct Record {
+                uint8_t address;
+                uint8_t length;
+                uint8_t data[TWIST_FAKE_I2C_MAX_DATA];
+                bool acked;
+            };
+
+            explicit FakeI2CBus(uint32_t clockHz = 400000);
+
+            // II2CBus interface implementation
+            bool write(uint8_t address, const uint8_t* data, uint8_t length) override;
+
+            /**
+             * @brief Devices at this address NACK (0 = none)
+             */
+            void setNackAddress(uint8_t address) { _nackAddress = address; }
+
+            /**
+             * @brief Transaction i back from the newest (0 = last)
+             * @return NULL if not recorded
+             */
+            const Record* getRecord(uint16_t back = 0) const;
+
+            unsigned long getTransactionCount() const { return _count; }
+            unsigned long getByteCount() const { return _bytes; }
+            unsigned long getBusMicros() const { return _busUs; }  // Simulated clock-out time
+
+        private:
+            Record _log[TWIST_FAKE_I2C_LOG];
+            uint16_t _next;
+            uint32_t _clockHz;
+            uint8_t _nackAddress;
+
+            unsigned long _count;
+            unsigned long _bytes;
+            unsigned long _busUs;
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
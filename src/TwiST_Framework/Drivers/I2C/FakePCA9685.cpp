@@ -0,0 +1,65 @@
+#include "FakePCA9685.h"
+#include <string.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        FakePCA9685::FakePCA9685(uint8_t address, uint32_t clockHz)
+            : FakeI2CBus(clockHz),
+              _address(address) {
+            memset(_registers, 0, sizeof(_registers));
+            memset(_channelWrites, 0, sizeof(_channelWrites));
+            for (uint8_t i = 0; i < CHANNELS; i++) {
+                _registers[base(i) + 3] = 0x10;  // Power-on state: every output full-OFF
+            }
+        }
+
+        bool FakePCA9685::write(uint8_t address, const uint8_t* data, uint8_t length) {
+            bool acked = FakeI2CBus::write(address, data, length);
+            if (!acked || address != _address || length < 2) return acked;
+
+            // Register pointer first, then data with auto-increment
+            uint8_t reg = data[0];
+            bool touched[CHANNELS] = {false};
+            for (uint8_t i = 1; i < length; i++, reg++) {
+                _registers[reg] = data[i];
+                if (reg >= LED0_ON_L && reg < LED0_ON_L + 4 * CHANNELS) {
+                    touched[(reg - LED0_ON_L) / 4] = true;
+                }
+            }
+            for (uint8_t i = 0; i < CHANNELS; i++) {
+                if (touched[i]) _channelWrites[i]++;
+            }
+            return acked;
+        }
+
+        uint16_t FakePCA9685::getOn(uint8_t channel) const {
+            uint8_t r = base(channel);
+            return (uint16_t)(_registers[r] | ((_registers[r + 1] & 0x0F) << 8));
+        }
+
+        uint16_t FakePCA9685::getOff(uint8_t channel) const {
+            uint8_t r = base(channel);
+            return (uint16_t)(_registers[r + 2] | ((_registers[r + 3] & 0x0F) << 8));
+        }
+
+        bool FakePCA9685::isFullOn(uint8_t channel) const {
+            return (_registers[base(channel) + 1] & 0x10) != 0;
+        }
+
+        bool FakePCA9685::isFullOff(uint8_t channel) const {
+            return (_registers[base(channel) + 3] & 0x10) != 0;
+        }
+
+        uint16_t FakePCA9685::getDuty(uint8_t channel) const {
+            if (isFullOff(channel)) return 0;
+            if (isFullOn(channel)) return 4096;
+            return (uint16_t)((getOff(channel) - getOn(channel)) & 0x0FFF);
+        }
+
+        unsigned long FakePCA9685::getChannelWrites(uint8_t channel) const {
+            return (channel < CHANNELS) ? _channelWrites[channel] : 0;
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,86 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      FakePCA9685.h
+ * @brief     In-memory PCA9685 register model on a recording I2C bus
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Virtual Bus Driver (pure C++)
+ * - Hardware:     None
+ * - Implements:   II2CBus (extends FakeI2CBus)
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - builds unchanged on a Linux host
+ * - Decodes register-pointer writes to one address into a 256-byte
+ *   register file (auto-increment, as PCA9685::setFrequency() enables)
+ * - Everything FakeI2CBus records (log, bus time, NACKs) still applies
+ *
+ * CAPABILITIES:
+ * - Per-channel ON/OFF counters, full-ON / full-OFF bits, effective duty
+ * - Per-channel write count (transactions touching LEDn registers)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_FAKE_PCA9685_H
+#define TWIST_DRIVER_FAKE_PCA9685_H
+
+#include "FakeI2CBus.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief PCA9685 chip model for host checks of servo output
+         *
+         * Example:
+         * ```cpp
+         * FakePCA9685 chip(0x40);
+         * I2CQueue queue(chip);
+         * PCA9685 pwm(0x40);
+         * pwm.setQueue(&queue);
+         * pwm.setOff(3);
+         * queue.update();
+         * chip.isFullOff(3);                    // true
+         * ```
+         */
+        class FakePCA9685 : public FakeI2CBus {
+        public:
+            static constexpr uint8_t CHANNELS = 16;
+            static constexpr uint8_t LED0_ON_L = 0x06;
+
+            explicit FakePCA9685(uint8_t address = 0x40, uint32_t clockHz = 400000);
+
+            // II2CBus interface implementation
+            bool write(uint8_t address, const uint8_t* data, uint8_t length) override;
+
+            uint8_t getRegister(uint8_t reg) const { return _registers[reg]; }
+            uint16_t getOn(uint8_t channel) const;          // 12-bit ON count
+            uint16_t getOff(uint8_t channel) const;         // 12-bit OFF count
+            bool isFullOn(uint8_t channel) const;
+            bool isFullOff(uint8_t channel) const;          // Wins over full-ON
+
+            /**
+             * @brief High time per period in ticks (0..4096)
+             */
+            uint16_t getDuty(uint8_t channel) const;
+
+            unsigned long getChannelWrites(uint8_t channel) const;
+
+        private:
+            uint8_t _address;
+            uint8_t _registers[256];
+            unsigned long _channelWrites[CHANNELS];
+
+            uint8_t base(uint8_t channel) const { return LED0_ON_L + 4 * (channel & 0x0F); }
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
@@ -0,0 +1,17 @@
+#include "WireI2CBus.h"
+#include "../../Core/Tracer.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+        WireI2CBus::WireI2CBus(TwoWire& wire) : _wire(wire) {}
+
+        bool WireI2CBus::write(uint8_t address, const uint8_t* data, uint8_t length) {
+            TWIST_TRACE_SCOPE("WireI2CBus::write");
+            _wire.beginTransmission(address);
+            _wire.write(data, length);
+            return _wire.endTransmission() == 0;  // 0 = all bytes ACKed
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,51 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      WireI2CBus.h
+ * @brief     Arduino Wire (TwoWire) implementation of II2CBus
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Hardware Driver
+ * - Hardware:     ESP32 I2C controller via Arduino TwoWire
+ * - Implements:   II2CBus
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Bus pins/clock configured by whoever calls Wire.begin() (PCA9685::begin)
+ * - Blocking transaction - run it from I2CQueue's worker, not the loop
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_WIRE_I2C_BUS_H
+#define TWIST_DRIVER_WIRE_I2C_BUS_H
+
+#include "../../Interfaces/II2CBus.h"
+#include <Wire.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief TwoWire-backed I2C bus - implements II2CBus
+         */
+        class WireI2CBus : public II2CBus {
+        public:
+            explicit WireI2CBus(TwoWire& wire);
+
+            // II2CBus interface implementation
+            bool write(uint8_t address, const uint8_t* data, uint8_t length) override;
+
+        private:
+            TwoWire& _wire;
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
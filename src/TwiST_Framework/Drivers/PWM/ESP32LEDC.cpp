@@ -0,0 +1,151 @@
+#include "ESP32LEDC.h"
+#include "../../Core/Logger.h"
+#include "../../Core/Tracer.h"
+#include <driver/ledc.h>
+#include <soc/soc_caps.h>          // SOC_LEDC_CHANNEL_NUM
+
+namespace TwiST {
+    namespace Drivers {
+
+        uint8_t ESP32LEDC::s_nextChannel = 0;
+        uint8_t ESP32LEDC::s_nextTimer = 0;
+
+        ESP32LEDC::ESP32LEDC(uint16_t frequency, uint8_t resolutionBits)
+            : _frequency(frequency),
+              _bits(resolutionBits == 0 ? TWIST_LEDC_DEFAULT_BITS : resolutionBits),
+              _maxDuty(0),
+              _timer(0),
+              _started(false),
+              _attached(0) {
+            // 16 bits is the IPWMDriver ceiling (uint16_t duty)
+            _maxDuty = (_bits >= 1 && _bits <= 16) ? (uint16_t)((1UL << _bits) - 1) : 0;
+            for (uint8_t i = 0; i < TWIST_LEDC_MAX_CHANNELS; i++) {
+                _gpio[i] = UNMAPPED;
+                _hwChannel[i] = UNMAPPED;
+            }
+        }
+
+        bool ESP32LEDC::attach(uint8_t channel, uint8_t gpio) {
+            if (_started) {
+                Logger::error("LEDC", "attach() after begin()");
+                return false;
+            }
+            if (channel >= TWIST_LEDC_MAX_CHANNELS) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "Channel %d out of range (0-%d)",
+                            channel, TWIST_LEDC_MAX_CHANNELS - 1);
+                return false;
+            }
+            if (_gpio[channel] != UNMAPPED) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "Channel %d already on GPIO%d", channel, _gpio[channel]);
+                return false;
+            }
+            for (uint8_t i = 0; i < TWIST_LEDC_MAX_CHANNELS; i++) {
+                if (_gpio[i] == gpio) {
+                    Logger::logf(Logger::Level::ERROR, "LEDC", "GPIO%d already used by channel %d", gpio, i);
+                    return false;
+                }
+            }
+            _gpio[channel] = gpio;
+            _attached++;
+            return true;
+        }
+
+        bool ESP32LEDC::begin() {
+            if (_started) return true;
+            if (!validate()) return false;
+
+            ledc_timer_config_t timerConfig = {};
+            timerConfig.speed_mode = LEDC_LOW_SPEED_MODE;  // Only mode on every ESP32 variant
+            timerConfig.duty_resolution = (ledc_timer_bit_t)_bits;
+            timerConfig.timer_num = (ledc_timer_t)s_nextTimer;
+            timerConfig.freq_hz = _frequency;
+            timerConfig.clk_cfg = LEDC_AUTO_CLK;
+            if (ledc_timer_config(&timerConfig) != ESP_OK) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "Timer %d rejected %dHz/%d-bit",
+                            s_nextTimer, _frequency, _bits);
+                return false;
+            }
+            _timer = s_nextTimer++;
+
+            for (uint8_t i = 0; i < TWIST_LEDC_MAX_CHANNELS; i++) {
+                if (_gpio[i] == UNMAPPED) continue;
+
+                ledc_channel_config_t channelConfig = {};
+                channelConfig.gpio_num = _gpio[i];
+                channelConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+                channelConfig.channel = (ledc_channel_t)s_nextChannel;
+                channelConfig.intr_type = LEDC_INTR_DISABLE;
+                channelConfig.timer_sel = (ledc_timer_t)_timer;
+                channelConfig.duty = 0;         // Output low until the first setPWM()
+                channelConfig.hpoint = 0;
+                if (ledc_channel_config(&channelConfig) != ESP_OK) {
+                    Logger::logf(Logger::Level::ERROR, "LEDC", "GPIO%d rejected for channel %d", _gpio[i], i);
+                    return false;
+                }
+                _hwChannel[i] = s_nextChannel++;
+            }
+
+            _started = true;
+            Logger::logf(Logger::Level::INFO, "LEDC", "%d channels, %dHz, %d-bit (timer %d)",
+                        _attached, _frequency, _bits, _timer);
+            return true;
+        }
+
+        void ESP32LEDC::setPWM(uint8_t channel, uint16_t value) {
+            TWIST_TRACE_SCOPE("ESP32LEDC::setPWM");
+            if (channel >= TWIST_LEDC_MAX_CHANNELS) return;
+            uint8_t hw = _hwChannel[channel];
+            if (hw == UNMAPPED) return;  // Unmapped or not started
+
+            if (value > _maxDuty) value = _maxDuty;
+            ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)hw, value);
+            ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)hw);  // Latch at next period
+        }
+
+        void ESP32LEDC::setFrequency(float freq) {
+            uint16_t hz = (uint16_t)freq;
+            if (hz == 0 || (unsigned long)hz * ((unsigned long)_maxDuty + 1) > TWIST_LEDC_CLOCK_HZ) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "%dHz not reachable at %d-bit", hz, _bits);
+                return;
+            }
+            _frequency = hz;
+            if (_started) {
+                ledc_set_freq(LEDC_LOW_SPEED_MODE, (ledc_timer_t)_timer, _frequency);
+            }
+        }
+
+        int8_t ESP32LEDC::getHardwareChannel(uint8_t channel) const {
+            if (channel >= TWIST_LEDC_MAX_CHANNELS || _hwChannel[channel] == UNMAPPED) return -1;
+            return (int8_t)_hwChannel[channel];
+        }
+
+        bool ESP32LEDC::validate() const {
+            bool valid = true;
+
+            if (_maxDuty == 0) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "Resolution %d-bit unsupported (1-16)", _bits);
+                valid = false;
+            } else if (_frequency == 0 ||
+                       (unsigned long)_frequency * ((unsigned long)_maxDuty + 1) > TWIST_LEDC_CLOCK_HZ) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "%dHz x %d-bit exceeds LEDC clock", _frequency, _bits);
+                valid = false;
+            }
+
+            if (_attached == 0) {
+                Logger::error("LEDC", "No channels attached");
+                valid = false;
+            }
+            if (s_nextChannel + _attached > SOC_LEDC_CHANNEL_NUM) {
+                Logger::logf(Logger::Level::ERROR, "LEDC", "%d channels requested, %d of %d free",
+                            _attached, SOC_LEDC_CHANNEL_NUM - s_nextChannel, SOC_LEDC_CHANNEL_NUM);
+                valid = false;
+            }
+            if (s_nextTimer >= LEDC_TIMER_MAX) {
+                Logger::error("LEDC", "No free LEDC timer");
+                valid = false;
+            }
+            return valid;
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,124 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      ESP32LEDC.h
+ * @brief     ESP32 native LEDC PWM driver implementing IPWMDriver abstraction
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Hardware Driver
+ * - Hardware:     ESP32 LEDC peripheral (on-chip, GPIO outputs)
+ * - Implements:   IPWMDriver
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Devices layer NEVER includes this file directly
+ * - Logical channel (ServoConfig.pwmChannel) -> GPIO mapped with attach()
+ * - Hardware LEDC channels/timers allocated in begin(), validated ONCE -
+ *   setPWM() is a duty register write + latch, no bus transaction
+ * - Hardware access only through ESP-IDF ledc_* calls (host tests link a
+ *   fake ledc_* register shim)
+ *
+ * CAPABILITIES:
+ * - 14-16 bit duty resolution (getMaxPWM() = 2^bits - 1)
+ * - SOC_LEDC_CHANNEL_NUM outputs per chip (6 on ESP32-C6), shared by all
+ *   ESP32LEDC instances; one LEDC timer per instance
+ * - Frequency control (50Hz for servos)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_ESP32LEDC_H
+#define TWIST_DRIVER_ESP32LEDC_H
+
+#include "../../Interfaces/IPWMDriver.h"
+
+// Logical channel numbers accepted by attach() / setPWM()
+#ifndef TWIST_LEDC_MAX_CHANNELS
+#define TWIST_LEDC_MAX_CHANNELS 16
+#endif
+
+// Resolution used when config leaves it 0
+#ifndef TWIST_LEDC_DEFAULT_BITS
+#define TWIST_LEDC_DEFAULT_BITS 14
+#endif
+
+// LEDC source clock (APB) - bounds frequency * 2^bits
+#ifndef TWIST_LEDC_CLOCK_HZ
+#define TWIST_LEDC_CLOCK_HZ 80000000UL
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief ESP32 LEDC PWM driver - implements IPWMDriver
+         *
+         * Example usage:
+         * ```cpp
+         * Drivers::ESP32LEDC ledc(50, 14);
+         * ledc.attach(0, 2);      // Logical channel 0 -> GPIO2
+         * ledc.attach(1, 3);
+         * if (!ledc.begin()) { ... }
+         * Devices::Servo wrist(ledc, 0, 110, "Wrist", eventBus);
+         * ```
+         */
+        class ESP32LEDC : public IPWMDriver {  // Implements abstraction
+        public:
+            /**
+             * @param frequency PWM frequency in Hz
+             * @param resolutionBits Duty resolution (0 = TWIST_LEDC_DEFAULT_BITS)
+             */
+            ESP32LEDC(uint16_t frequency = 50, uint8_t resolutionBits = TWIST_LEDC_DEFAULT_BITS);
+
+            /**
+             * @brief Map a logical channel to an output pin (before begin())
+             * @return false if channel out of range, already mapped or pin reused
+             */
+            bool attach(uint8_t channel, uint8_t gpio);
+
+            /**
+             * @brief Validate resolution/frequency, claim LEDC timer + channels
+             * @return false (nothing configured) on any validation failure
+             */
+            bool begin();
+
+            // IPWMDriver interface implementation
+            void setPWM(uint8_t channel, uint16_t value) override;
+            uint16_t getMaxPWM() const override { return _maxDuty; }
+            bool supportsFrequency() const override { return true; }
+            void setFrequency(float freq) override;
+
+            // Diagnostics
+            uint8_t getResolution() const { return _bits; }
+            uint8_t getAttachedCount() const { return _attached; }
+            int8_t getHardwareChannel(uint8_t channel) const;  // -1 = unmapped / not started
+            bool isStarted() const { return _started; }
+
+        private:
+            static const uint8_t UNMAPPED = 0xFF;
+
+            uint16_t _frequency;
+            uint8_t _bits;
+            uint16_t _maxDuty;
+            uint8_t _timer;
+            bool _started;
+
+            uint8_t _gpio[TWIST_LEDC_MAX_CHANNELS];       // Logical channel -> pin
+            uint8_t _hwChannel[TWIST_LEDC_MAX_CHANNELS];  // Logical channel -> LEDC channel
+            uint8_t _attached;
+
+            static uint8_t s_nextChannel;   // LEDC channels claimed by all instances
+            static uint8_t s_nextTimer;     // LEDC timers claimed by all instances
+
+            bool validate() const;
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
@@ -1,4 +1,5 @@
 #include "PCA9685.h"
+#include "../../Core/Tracer.h"
 #include <Wire.h>
 
 namespace TwiST {
@@ -14,9 +15,68 @@ namespace TwiST {
         }
 
         void PCA9685::setPWM(uint8_t channel, uint16_t value) {
-            if (channel < 16) {  // PCA9685 has 16 channels
-                _pwm.setPWM(channel, 0, value);
+            TWIST_TRACE_SCOPE("PCA9685::setPWM");
+            if (channel >= 16) return;  // PCA9685 has 16 channels
+
+            if (_queue != NULL) {
+                queueWrite(channel, value);
+                return;
+            }
+            _pwm.setPWM(channel, 0, value);
+        }
+
+        void PCA9685::setOff(uint8_t channel) {
+            TWIST_TRACE_SCOPE("PCA9685::setOff");
+            if (channel >= 16) return;
+
+            if (_queue != NULL) {
+                // Full-OFF (bit 4 of LEDn_OFF_H) overrides the counters; setPWM() clears it again
+                queueWrite(channel, 4096);
+                return;
             }
+            _pwm.setPWM(channel, 0, 4096);  // OFF = 4096 sets the full-OFF bit
+        }
+
+        void PCA9685::queueWrite(uint8_t channel, uint16_t off) {
+            uint16_t bit = (uint16_t)(1u << channel);
+            if (_pendingMask & bit) _coalesced++;  // Held value never reaches the chip
+            _pending[channel] = off;
+            _pendingMask |= bit;
+
+            // Older held channels go first; this one waits too if the queue is full
+            if (!flush()) _deferred++;
+        }
+
+        bool PCA9685::flush() {
+            while (_pendingMask != 0) {
+                uint8_t channel = (uint8_t)__builtin_ctz(_pendingMask);
+                uint16_t off = _pending[channel];
+
+                if (_queue == NULL) {
+                    _pwm.setPWM(channel, 0, off);
+                } else {
+                    // Check first: a held write is not an I2CQueue drop
+                    if (_queue->isFull()) {
+                        if (!_retryRequested) {
+                            _retryRequested = _queue->requestRetry(onQueueSpace, this);
+                        }
+                        return false;
+                    }
+                    // LEDn_ON_L..LEDn_OFF_H in one write (ON = 0); setPWMFreq() enabled auto-increment
+                    uint8_t data[4] = {0, 0, (uint8_t)(off & 0xFF), (uint8_t)(off >> 8)};
+                    if (!_queue->writeRegister(_address, PCA9685_LED0_ON_L + 4 * channel, data, 4)) {
+                        return false;
+                    }
+                }
+                _pendingMask &= (uint16_t)~(1u << channel);
+            }
+            return true;
+        }
+
+        void PCA9685::onQueueSpace(void* context) {
+            PCA9685* self = static_cast<PCA9685*>(context);
+            self->_retryRequested = false;
+            self->flush();
         }
 
         void PCA9685::setFrequency(float freq) {
@@ -22,6 +22,9 @@
  * - 12-bit resolution (0-4095 steps)
  * - Adjustable PWM frequency (24Hz-1526Hz)
  * - I2C communication (400kHz)
+ * - Optional async writes through I2CQueue (setPWM() never waits on the bus)
+ * - Full queue: the newest value per channel is held back and sent once
+ *   the queue has room - a channel never keeps a stale pulse
  *
  * AUTHOR:    Voldemaras Birskys
  * EMAIL:     voldemaras@gmail.com
@@ -34,6 +37,7 @@
 #define TWIST_DRIVER_PCA9685_H
 
 #include "../../Interfaces/IPWMDriver.h"
+#include "../../Core/I2CQueue.h"
 #include <Adafruit_PWMServoDriver.h>
 
 namespace TwiST {
@@ -54,12 +58,43 @@ namespace TwiST {
             // IPWMDriver interface implementation
             void setPWM(uint8_t channel, uint16_t value) override;
             uint16_t getMaxPWM() const override { return 4095; }
+            void setOff(uint8_t channel) override;  // LEDn_OFF_H full-OFF bit
             bool supportsFrequency() const override { return true; }  // PCA9685 supports frequency control
             void setFrequency(float freq) override;
 
+            /**
+             * @brief Route setPWM() through an async queue (NULL = blocking Wire)
+             *
+             * begin()/setFrequency() stay blocking - call them before the
+             * queue's worker starts sharing the bus.
+             */
+            void setQueue(I2CQueue* queue) { _queue = queue; }
+
+            /**
+             * @brief Send held-back channel writes (normally automatic)
+             * @return true if nothing is left waiting for queue space
+             */
+            bool flush();
+
+            // Queue-full statistics (separate from I2CQueue::getDroppedCount())
+            uint16_t getPendingMask() const { return _pendingMask; }   // Channels waiting for space
+            unsigned long getDeferredCount() const { return _deferred; }     // Writes that found the queue full
+            unsigned long getCoalescedCount() const { return _coalesced; }   // Held values replaced before sending
+
         private:
             Adafruit_PWMServoDriver _pwm;
             uint8_t _address;
+            I2CQueue* _queue = NULL;
+
+            // Latest OFF count per channel not yet queued (4096 = full-OFF)
+            uint16_t _pending[16];
+            uint16_t _pendingMask = 0;
+            bool _retryRequested = false;
+            unsigned long _deferred = 0;
+            unsigned long _coalesced = 0;
+
+            void queueWrite(uint8_t channel, uint16_t off);
+            static void onQueueSpace(void* context);
         };
 
     }
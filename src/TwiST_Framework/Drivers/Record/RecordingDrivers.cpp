@@ -0,0 +1,51 @@
+#include "RecordingDrivers.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+    // ===== RecordingADC =====
+
+    RecordingADC::RecordingADC(IADCDriver& inner, IRecordSink& sink, uint8_t stream)
+        : _inner(inner), _sink(sink), _stream(stream) {}
+
+    uint16_t RecordingADC::readRaw() {
+        uint16_t value = _inner.readRaw();
+        _sink.record(RECORD_ADC_READ, _stream, 0, value);
+        return value;
+    }
+
+    // ===== RecordingDistance =====
+
+    RecordingDistance::RecordingDistance(IDistanceDriver& inner, IRecordSink& sink, uint8_t stream)
+        : _inner(inner), _sink(sink), _stream(stream) {}
+
+    float RecordingDistance::readDistanceCm() {
+        float distance = _inner.readDistanceCm();
+
+        float scaled = distance * RecordLog::DISTANCE_SCALE + 0.5f;
+        if (scaled < 0.0f) scaled = 0.0f;
+        if (scaled > 65535.0f) scaled = 65535.0f;
+
+        // Hand the device the stored value - replay then feeds it the exact same input
+        uint16_t stored = (uint16_t)scaled;
+        _sink.record(RECORD_DISTANCE_READ, _stream, 0, stored);
+        return stored / RecordLog::DISTANCE_SCALE;
+    }
+
+    // ===== RecordingPWM =====
+
+    RecordingPWM::RecordingPWM(IPWMDriver& inner, IRecordSink& sink, uint8_t stream)
+        : _inner(inner), _sink(sink), _stream(stream) {}
+
+    void RecordingPWM::setPWM(uint8_t channel, uint16_t value) {
+        _inner.setPWM(channel, value);
+        _sink.record(RECORD_PWM_SET, _stream, channel, value);
+    }
+
+    void RecordingPWM::setOff(uint8_t channel) {
+        _inner.setOff(channel);
+        _sink.record(RECORD_PWM_SET, _stream, channel, 0);
+    }
+
+    }
+}  // namespace TwiST::Drivers
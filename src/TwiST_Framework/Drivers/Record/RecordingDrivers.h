@@ -0,0 +1,97 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      RecordingDrivers.h
+ * @brief     Pass-through driver decorators that record every read/write
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Driver Decorators (pure C++)
+ * - Hardware:     None (wrap any real driver)
+ * - Implements:   IADCDriver, IDistanceDriver, IPWMDriver
+ *
+ * PRINCIPLES:
+ * - Devices see the same interface - recording is invisible to them
+ * - Record at the driver boundary (raw values, before device math)
+ * - No timestamps, no I/O here - the IRecordSink owns both
+ * - Stream id = driver index within its kind (stable across runs)
+ *
+ * CAPABILITIES:
+ * - Capture ADC raw reads, distance reads (0.1 cm) and PWM writes
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_RECORDING_DRIVERS_H
+#define TWIST_DRIVER_RECORDING_DRIVERS_H
+
+#include "../../Interfaces/IADCDriver.h"
+#include "../../Interfaces/IDistanceDriver.h"
+#include "../../Interfaces/IPWMDriver.h"
+#include "../../Core/RecordLog.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+    /**
+     * @brief Records every readRaw() of the wrapped ADC driver
+     */
+    class RecordingADC : public IADCDriver {
+        public:
+            RecordingADC(IADCDriver& inner, IRecordSink& sink, uint8_t stream);
+
+            uint16_t readRaw() override;
+            uint16_t getMaxValue() const override { return _inner.getMaxValue(); }
+
+        private:
+            IADCDriver& _inner;
+            IRecordSink& _sink;
+            uint8_t _stream;
+        };
+
+    /**
+     * @brief Records every readDistanceCm() of the wrapped distance driver
+     *
+     * Returns the reading rounded to the stored 0.1 cm, so the recorded run
+     * and its replay see identical input.
+     */
+    class RecordingDistance : public IDistanceDriver {
+        public:
+            RecordingDistance(IDistanceDriver& inner, IRecordSink& sink, uint8_t stream);
+
+            void triggerMeasurement() override { _inner.triggerMeasurement(); }
+            float readDistanceCm() override;
+            bool isMeasurementReady() const override { return _inner.isMeasurementReady(); }
+            float getMaxRange() const override { return _inner.getMaxRange(); }
+
+        private:
+            IDistanceDriver& _inner;
+            IRecordSink& _sink;
+            uint8_t _stream;
+        };
+
+    /**
+     * @brief Records every setPWM() sent to the wrapped PWM driver
+     */
+    class RecordingPWM : public IPWMDriver {
+        public:
+            RecordingPWM(IPWMDriver& inner, IRecordSink& sink, uint8_t stream);
+
+            void setPWM(uint8_t channel, uint16_t value) override;
+            void setOff(uint8_t channel) override;  // Recorded as a write of 0 (ReplayPWM's default setOff)
+            uint16_t getMaxPWM() const override { return _inner.getMaxPWM(); }
+            bool supportsFrequency() const override { return _inner.supportsFrequency(); }
+            void setFrequency(float freq) override { _inner.setFrequency(freq); }
+
+        private:
+            IPWMDriver& _inner;
+            IRecordSink& _sink;
+            uint8_t _stream;
+        };
+    }
+}  // namespace TwiST::Drivers
+#endif
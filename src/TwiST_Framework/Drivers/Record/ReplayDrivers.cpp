@@ -0,0 +1,90 @@
+#include "ReplayDrivers.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+    // ===== ReplayADC =====
+
+    ReplayADC::ReplayADC(const RecordLogReader& log, uint8_t stream, uint16_t maxValue)
+        : _log(log), _stream(stream), _maxValue(maxValue) {
+        rewind();
+    }
+
+    uint16_t ReplayADC::readRaw() {
+        if (!_exhausted && _log.findNext(RECORD_ADC_READ, _stream, _position)) {
+            _lastValue = _log.at(_position).value;
+            _position++;
+        } else {
+            _exhausted = true;
+        }
+        return _lastValue;
+    }
+
+    void ReplayADC::rewind() {
+        _position = 0;
+        _lastValue = _maxValue / 2;  // Centered until the first record
+        _exhausted = false;
+    }
+
+    // ===== ReplayDistance =====
+
+    ReplayDistance::ReplayDistance(const RecordLogReader& log, uint8_t stream, float maxRange)
+        : _log(log), _stream(stream), _maxRange(maxRange) {
+        rewind();
+    }
+
+    float ReplayDistance::readDistanceCm() {
+        if (!_exhausted && _log.findNext(RECORD_DISTANCE_READ, _stream, _position)) {
+            _lastValue = _log.at(_position).value / RecordLog::DISTANCE_SCALE;
+            _position++;
+        } else {
+            _exhausted = true;
+        }
+        return _lastValue;
+    }
+
+    void ReplayDistance::rewind() {
+        _position = 0;
+        _lastValue = 0.0f;  // Same as "no echo" on real hardware
+        _exhausted = false;
+    }
+
+    // ===== ReplayPWM =====
+
+    ReplayPWM::ReplayPWM(const RecordLogReader& log, uint8_t stream, uint16_t maxPWM)
+        : _log(log), _stream(stream), _maxPWM(maxPWM) {
+        rewind();
+    }
+
+    void ReplayPWM::setPWM(uint8_t channel, uint16_t value) {
+        unsigned long index = _writes++;
+
+        if (!_log.findNext(RECORD_PWM_SET, _stream, _position)) {
+            _extraWrites++;
+            return;
+        }
+
+        RecordEntry expected = _log.at(_position);
+        _position++;
+
+        if (expected.channel == (channel & 0x0F) && expected.value == value) {
+            _matches++;
+        } else {
+            _mismatches++;
+            if (_firstMismatch < 0) {
+                _firstMismatch = (long)index;
+            }
+        }
+    }
+
+    void ReplayPWM::rewind() {
+        _position = 0;
+        _writes = 0;
+        _matches = 0;
+        _mismatches = 0;
+        _extraWrites = 0;
+        _firstMismatch = -1;
+    }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,131 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      ReplayDrivers.h
+ * @brief     Drivers that feed recorded values back into unchanged devices
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Replay Drivers (pure C++)
+ * - Hardware:     None (read a RecordLogReader)
+ * - Implements:   IADCDriver, IDistanceDriver, IPWMDriver
+ *
+ * PRINCIPLES:
+ * - Pure C++ - identical behaviour on ESP32 and on a host PC
+ * - Sequence-driven, NOT clock-driven: the Nth read returns the Nth
+ *   recorded value, so replay is deterministic and runs faster than real time
+ * - Exhausted streams hold their last value (devices never see garbage)
+ * - ReplayPWM compares outputs against the recording (regression check)
+ *
+ * CAPABILITIES:
+ * - Reproduce field bugs from a recording
+ * - Verify that device/bridge changes keep identical PWM output
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_REPLAY_DRIVERS_H
+#define TWIST_DRIVER_REPLAY_DRIVERS_H
+
+#include "../../Interfaces/IADCDriver.h"
+#include "../../Interfaces/IDistanceDriver.h"
+#include "../../Interfaces/IPWMDriver.h"
+#include "../../Core/RecordLog.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+    /**
+     * @brief Returns recorded ADC reads of one stream in order
+     */
+    class ReplayADC : public IADCDriver {
+        public:
+            /**
+             * @param log Recording (must outlive the driver)
+             * @param stream Stream id used when recording
+             * @param maxValue Reported ADC range (default 12-bit)
+             */
+            ReplayADC(const RecordLogReader& log, uint8_t stream, uint16_t maxValue = 4095);
+
+            uint16_t readRaw() override;
+            uint16_t getMaxValue() const override { return _maxValue; }
+
+            bool isExhausted() const { return _exhausted; }
+            void rewind();
+
+        private:
+            const RecordLogReader& _log;
+            uint8_t _stream;
+            uint16_t _maxValue;
+            size_t _position;
+            uint16_t _lastValue;
+            bool _exhausted;
+        };
+
+    /**
+     * @brief Returns recorded distance reads of one stream in order
+     */
+    class ReplayDistance : public IDistanceDriver {
+        public:
+            ReplayDistance(const RecordLogReader& log, uint8_t stream, float maxRange = 400.0f);
+
+            void triggerMeasurement() override {}
+            float readDistanceCm() override;
+            bool isMeasurementReady() const override { return true; }
+            float getMaxRange() const override { return _maxRange; }
+
+            bool isExhausted() const { return _exhausted; }
+            void rewind();
+
+        private:
+            const RecordLogReader& _log;
+            uint8_t _stream;
+            float _maxRange;
+            size_t _position;
+            float _lastValue;
+            bool _exhausted;
+        };
+
+    /**
+     * @brief Checks PWM writes against the recorded output sequence
+     *
+     * Example (host):
+     * ```cpp
+     * ReplayPWM pwm(log, 0);
+     * // ... run devices until inputs are exhausted ...
+     * if (pwm.getMismatchCount() > 0) { // behaviour changed }
+     * ```
+     */
+    class ReplayPWM : public IPWMDriver {
+        public:
+            ReplayPWM(const RecordLogReader& log, uint8_t stream, uint16_t maxPWM = 4095);
+
+            void setPWM(uint8_t channel, uint16_t value) override;
+            uint16_t getMaxPWM() const override { return _maxPWM; }
+
+            // Verification results
+            unsigned long getMatchCount() const { return _matches; }
+            unsigned long getMismatchCount() const { return _mismatches; }
+            unsigned long getExtraWriteCount() const { return _extraWrites; }  // Beyond recording end
+            long getFirstMismatchIndex() const { return _firstMismatch; }       // -1 if none
+
+            void rewind();
+
+        private:
+            const RecordLogReader& _log;
+            uint8_t _stream;
+            uint16_t _maxPWM;
+            size_t _position;
+            unsigned long _writes;
+            unsigned long _matches;
+            unsigned long _mismatches;
+            unsigned long _extraWrites;
+            long _firstMismatch;
+        };
+    }
+}  // namespace TwiST::Drivers
+#endif
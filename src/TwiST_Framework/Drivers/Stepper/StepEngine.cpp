@@ -0,0 +1,315 @@
+#include "StepEngine.h"
+#include "../../Core/Logger.h"
+#include <soc/soc.h>               // REG_WRITE
+#include <soc/gpio_reg.h>          // GPIO_OUT_W1TS_REG / GPIO_OUT_W1TC_REG
+
+namespace TwiST {
+    namespace Drivers {
+
+        StepEngine::StepEngine(uint32_t tickHz)
+            : _axisCount(0),
+              _tickHz(tickHz),
+              _timer(NULL),
+              _armed(false),
+              _alarmAt(0),
+              _pulseMask(0),
+              _pulseEnd(0),
+              _maxLateness(0),
+              _stepCount(0) {
+            portMUX_INITIALIZE(&_lock);
+        }
+
+        int8_t StepEngine::addAxis(uint8_t stepPin, uint8_t dirPin, int8_t enablePin, bool invertDirection) {
+            if (_timer != NULL) {
+                Logger::error("STEP", "addAxis() after begin()");
+                return -1;
+            }
+            if (_axisCount >= TWIST_STEP_MAX_AXES) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "Axis limit %d reached", TWIST_STEP_MAX_AXES);
+                return -1;
+            }
+            if (stepPin >= 32) {
+                // STEP edges are written through the GPIO 0-31 set/clear registers
+                Logger::logf(Logger::Level::ERROR, "STEP", "STEP pin GPIO%d out of range (0-31)", stepPin);
+                return -1;
+            }
+            if (stepPin == dirPin || (enablePin >= 0 && (enablePin == stepPin || enablePin == dirPin))) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "Axis %d reuses a pin (STEP %d, DIR %d, EN %d)",
+                            _axisCount, stepPin, dirPin, enablePin);
+                return -1;
+            }
+            for (uint8_t i = 0; i < _axisCount; i++) {
+                if (_axes[i].stepPin == stepPin || _axes[i].dirPin == dirPin ||
+                    _axes[i].stepPin == dirPin || _axes[i].dirPin == stepPin) {
+                    Logger::logf(Logger::Level::ERROR, "STEP", "Axis %d pins collide with axis %d", _axisCount, i);
+                    return -1;
+                }
+            }
+
+            Axis& axis = _axes[_axisCount];
+            axis.stepPin = stepPin;
+            axis.dirPin = dirPin;
+            axis.enablePin = enablePin;
+            axis.invert = invertDirection;
+            axis.stepMask = 1UL << stepPin;
+            axis.due = 0;
+            axis.position = 0;
+            axis.direction = 1;
+            axis.moving = false;
+            axis.enabled = false;
+            return (int8_t)_axisCount++;
+        }
+
+        bool StepEngine::begin() {
+            if (_timer != NULL) return true;
+            if (_axisCount == 0) {
+                Logger::error("STEP", "No axes added");
+                return false;
+            }
+
+            for (uint8_t i = 0; i < _axisCount; i++) {
+                Axis& axis = _axes[i];
+                pinMode(axis.stepPin, OUTPUT);
+                digitalWrite(axis.stepPin, LOW);
+                pinMode(axis.dirPin, OUTPUT);
+                digitalWrite(axis.dirPin, axis.invert ? HIGH : LOW);
+                if (axis.enablePin >= 0) {
+                    pinMode(axis.enablePin, OUTPUT);
+                    digitalWrite(axis.enablePin, LOW);  // Active low - energized
+                }
+                axis.enabled = true;
+            }
+
+            _timer = timerBegin(_tickHz);  // Free-running; alarms are absolute tick values
+            if (_timer == NULL) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "No free timer for %lu Hz", (unsigned long)_tickHz);
+                return false;
+            }
+            timerAttachInterruptArg(_timer, onTimer, this);
+
+            Logger::logf(Logger::Level::INFO, "STEP", "%d axes, %lu Hz tick", _axisCount, (unsigned long)_tickHz);
+            return true;
+        }
+
+        // ===== IStepperDriver (loop context) =====
+
+        bool StepEngine::move(uint8_t axis, int32_t steps, float maxSpeed, float acceleration) {
+            if (!validAxis(axis, "move")) return false;
+            Axis& a = _axes[axis];
+            if (a.moving || !a.enabled) return false;
+            if (steps == 0) return true;
+            if (!prepare(a, steps, maxSpeed, acceleration)) return false;
+
+            portENTER_CRITICAL(&_lock);
+            launch(a, timerRead(_timer));
+            portEXIT_CRITICAL(&_lock);
+            return true;
+        }
+
+        bool StepEngine::moveSynchronized(const uint8_t* axes, const int32_t* steps, uint8_t count,
+                                          float maxSpeed, float acceleration) {
+            uint32_t lead = 0;
+            for (uint8_t i = 0; i < count; i++) {
+                if (!validAxis(axes[i], "moveSynchronized")) return false;
+                const Axis& a = _axes[axes[i]];
+                if (a.moving || !a.enabled) return false;
+                for (uint8_t j = 0; j < i; j++) {
+                    if (axes[j] == axes[i]) {
+                        Logger::logf(Logger::Level::ERROR, "STEP", "Axis %d listed twice", axes[i]);
+                        return false;
+                    }
+                }
+                uint32_t distance = (uint32_t)(steps[i] < 0 ? -steps[i] : steps[i]);
+                if (distance > lead) lead = distance;
+            }
+            if (lead == 0) return true;
+
+            // Same profile shape for every axis: speed and acceleration scale with distance
+            for (uint8_t i = 0; i < count; i++) {
+                if (steps[i] == 0) continue;
+                float ratio = (float)(steps[i] < 0 ? -steps[i] : steps[i]) / (float)lead;
+                if (!prepare(_axes[axes[i]], steps[i], maxSpeed * ratio, acceleration * ratio)) return false;
+            }
+
+            portENTER_CRITICAL(&_lock);
+            uint64_t now = timerRead(_timer);  // One start instant for all
+            for (uint8_t i = 0; i < count; i++) {
+                if (steps[i] != 0) launch(_axes[axes[i]], now);
+            }
+            portEXIT_CRITICAL(&_lock);
+            return true;
+        }
+
+        void StepEngine::stop(uint8_t axis, bool immediate) {
+            if (!validAxis(axis, "stop")) return;
+            Axis& a = _axes[axis];
+
+            portENTER_CRITICAL(&_lock);
+            if (immediate) {
+                a.moving = false;
+            } else {
+                a.ramp.decelerate();
+                if (a.ramp.isDone()) a.moving = false;
+            }
+            portEXIT_CRITICAL(&_lock);
+        }
+
+        bool StepEngine::isMoving(uint8_t axis) const {
+            return axis < _axisCount && _axes[axis].moving;
+        }
+
+        int32_t StepEngine::getPosition(uint8_t axis) const {
+            return (axis < _axisCount) ? _axes[axis].position : 0;
+        }
+
+        void StepEngine::setPosition(uint8_t axis, int32_t position) {
+            if (!validAxis(axis, "setPosition")) return;
+            if (_axes[axis].moving) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "setPosition() on moving axis %d ignored", axis);
+                return;
+            }
+            _axes[axis].position = position;
+        }
+
+        void StepEngine::setEnabled(uint8_t axis, bool enabled) {
+            if (!validAxis(axis, "setEnabled")) return;
+            Axis& a = _axes[axis];
+            if (!enabled) {
+                stop(axis, true);  // Released motor cannot follow pulses
+            }
+            a.enabled = enabled;
+            if (a.enablePin >= 0 && _timer != NULL) {
+                digitalWrite(a.enablePin, enabled ? LOW : HIGH);
+            }
+        }
+
+        void StepEngine::resetStatistics() {
+            _maxLateness = 0;
+            _stepCount = 0;
+        }
+
+        // ===== Helpers =====
+
+        bool StepEngine::validAxis(uint8_t axis, const char* operation) const {
+            if (_timer == NULL) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "%s() before begin()", operation);
+                return false;
+            }
+            if (axis >= _axisCount) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "%s(): axis %d out of range (0-%d)",
+                            operation, axis, _axisCount - 1);
+                return false;
+            }
+            return true;
+        }
+
+        bool StepEngine::prepare(Axis& axis, int32_t steps, float maxSpeed, float acceleration) {
+            uint32_t distance = (uint32_t)(steps < 0 ? -steps : steps);
+            if (!axis.ramp.plan(distance, maxSpeed, acceleration, _tickHz)) {
+                Logger::logf(Logger::Level::ERROR, "STEP", "Invalid profile: %.1f steps/s, %.1f steps/s^2",
+                            maxSpeed, acceleration);
+                return false;
+            }
+
+            // DIR settles during the first interval (ms) - far above driver setup time
+            axis.direction = (steps < 0) ? -1 : 1;
+            bool level = (steps < 0) != axis.invert;
+            digitalWrite(axis.dirPin, level ? HIGH : LOW);
+            return true;
+        }
+
+        void StepEngine::launch(Axis& axis, uint64_t now) {
+            axis.due = (now << 8) + axis.ramp.nextInterval();
+            axis.moving = true;
+
+            // While a pulse is high its falling-edge ISR picks up new deadlines
+            uint64_t tick = axis.due >> 8;
+            if (_pulseMask == 0 && (!_armed || tick < _alarmAt)) {
+                arm(tick);
+            }
+        }
+
+        void IRAM_ATTR StepEngine::arm(uint64_t tick) {
+            uint64_t soonest = timerRead(_timer) + TWIST_STEP_MIN_ARM_TICKS;
+            if (tick < soonest) tick = soonest;
+            timerAlarm(_timer, tick, false, 0);
+            _alarmAt = tick;
+            _armed = true;
+        }
+
+        // ===== Timer ISR =====
+
+        void IRAM_ATTR StepEngine::onTimer(void* arg) {
+            static_cast<StepEngine*>(arg)->service();
+        }
+
+        void IRAM_ATTR StepEngine::service() {
+            portENTER_CRITICAL_ISR(&_lock);
+
+            uint64_t now = timerRead(_timer);
+            if (_armed && now >= _alarmAt) {
+                uint32_t late = (uint32_t)(now - _alarmAt);
+                if (late > _maxLateness) _maxLateness = late;
+            }
+            _armed = false;
+
+            // Falling edges: the pulse raised by the previous alarm has run its width
+            if (_pulseMask != 0) {
+                if (now < _pulseEnd) {
+                    arm(_pulseEnd);
+                    portEXIT_CRITICAL_ISR(&_lock);
+                    return;
+                }
+                REG_WRITE(GPIO_OUT_W1TC_REG, _pulseMask);
+                _pulseMask = 0;
+            }
+
+            // Rising edges of every due axis in one write
+            uint32_t mask = 0;
+            for (uint8_t i = 0; i < _axisCount; i++) {
+                if (_axes[i].moving && (_axes[i].due >> 8) <= now) {
+                    mask |= _axes[i].stepMask;
+                }
+            }
+            if (mask != 0) {
+                REG_WRITE(GPIO_OUT_W1TS_REG, mask);
+                _pulseMask = mask;
+                _pulseEnd = timerRead(_timer) + TWIST_STEP_PULSE_TICKS;
+
+                // Precompute the next interval while STEP is high
+                for (uint8_t i = 0; i < _axisCount; i++) {
+                    Axis& a = _axes[i];
+                    if (!(mask & a.stepMask)) continue;
+                    a.position += a.direction;
+                    _stepCount++;
+                    uint32_t interval = a.ramp.nextInterval();
+                    if (interval == 0) {
+                        a.moving = false;
+                    } else {
+                        a.due += interval;
+                    }
+                }
+                arm(_pulseEnd);
+                portEXIT_CRITICAL_ISR(&_lock);
+                return;
+            }
+
+            // Nothing high: re-arm for the earliest deadline (a missed one runs
+            // TWIST_STEP_MIN_ARM_TICKS from now - the deadlines stay on plan)
+            bool pending = false;
+            uint64_t next = 0;
+            for (uint8_t i = 0; i < _axisCount; i++) {
+                if (!_axes[i].moving) continue;
+                uint64_t tick = _axes[i].due >> 8;
+                if (!pending || tick < next) next = tick;
+                pending = true;
+            }
+            if (pending) {
+                arm(next);
+            }
+
+            portEXIT_CRITICAL_ISR(&_lock);
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,163 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      StepEngine.h
+ * @brief     Timer-interrupt step/direction pulse engine implementing IStepperDriver
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Hardware Driver
+ * - Hardware:     One ESP32 general-purpose timer + GPIO (STEP/DIR/ENABLE)
+ * - Implements:   IStepperDriver
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Devices layer NEVER includes this file directly
+ * - Pulses come from the timer ISR, never from the loop - loop stalls do
+ *   not change step timing
+ * - One one-shot alarm serves every axis: the ISR raises STEP on all axes
+ *   that are due, precomputes their next interval (StepRamp) and re-arms
+ *   for the end of the pulse; that alarm drops STEP and re-arms for the
+ *   earliest deadline
+ * - The ISR never busy-waits - neither for the pulse width nor for a
+ *   deadline; one closer than an alarm round trip is served that late
+ * - Deadlines advance by planned intervals, not by ISR entry time - ISR
+ *   latency never accumulates into the profile
+ * - STEP edges of coincident axes are one GPIO set/clear register write
+ *
+ * CAPABILITIES:
+ * - TWIST_STEP_MAX_AXES axes, 20k+ steps/s each
+ * - Synchronized multi-axis moves (start and finish together)
+ * - Smooth or immediate stop, ENABLE pin control, step counting
+ * - Diagnostics: ISR lateness (jitter) and steps issued
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_STEP_ENGINE_H
+#define TWIST_DRIVER_STEP_ENGINE_H
+
+#include "../../Interfaces/IStepperDriver.h"
+#include "../../Core/StepRamp.h"
+#include <Arduino.h>
+
+// Axes per engine (one timer)
+#ifndef TWIST_STEP_MAX_AXES
+#define TWIST_STEP_MAX_AXES 4
+#endif
+
+// Timer tick rate - 1 tick = 1 us
+#ifndef TWIST_STEP_TICK_HZ
+#define TWIST_STEP_TICK_HZ 1000000UL
+#endif
+
+// Minimum STEP high time in ticks (A4988: 1 us, DRV8825: 1.9 us); the
+// falling edge is its own alarm, so never shorter than TWIST_STEP_MIN_ARM_TICKS
+#ifndef TWIST_STEP_PULSE_TICKS
+#define TWIST_STEP_PULSE_TICKS 2
+#endif
+
+// Soonest alarm after the current tick - an alarm set in the past never fires
+#ifndef TWIST_STEP_MIN_ARM_TICKS
+#define TWIST_STEP_MIN_ARM_TICKS 3
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief Multi-axis step pulse engine - implements IStepperDriver
+         *
+         * Example usage:
+         * ```cpp
+         * Drivers::StepEngine steppers;
+         * int8_t x = steppers.addAxis(4, 5, 6);   // STEP, DIR, ENABLE
+         * int8_t y = steppers.addAxis(7, 15);     // no ENABLE pin
+         * if (!steppers.begin()) { ... }
+         * Devices::Stepper slide(steppers, x, 400, "Slide", eventBus);
+         * ```
+         */
+        class StepEngine : public IStepperDriver {  // Implements abstraction
+        public:
+            explicit StepEngine(uint32_t tickHz = TWIST_STEP_TICK_HZ);
+
+            /**
+             * @brief Register an axis (before begin())
+             * @param stepPin STEP output (GPIO 0-31)
+             * @param dirPin DIR output
+             * @param enablePin Active-low ENABLE output, -1 = none
+             * @param invertDirection Swap DIR polarity
+             * @return Axis index, -1 if full, started or pins invalid
+             */
+            int8_t addAxis(uint8_t stepPin, uint8_t dirPin, int8_t enablePin = -1,
+                           bool invertDirection = false);
+
+            /**
+             * @brief Configure pins, claim the timer
+             * @return false if no axes or the timer could not be allocated
+             */
+            bool begin();
+
+            // IStepperDriver interface implementation
+            uint8_t getAxisCount() const override { return _axisCount; }
+            bool move(uint8_t axis, int32_t steps, float maxSpeed, float acceleration) override;
+            bool moveSynchronized(const uint8_t* axes, const int32_t* steps, uint8_t count,
+                                  float maxSpeed, float acceleration) override;
+            void stop(uint8_t axis, bool immediate) override;
+            bool isMoving(uint8_t axis) const override;
+            int32_t getPosition(uint8_t axis) const override;
+            void setPosition(uint8_t axis, int32_t position) override;
+            void setEnabled(uint8_t axis, bool enabled) override;
+
+            // Diagnostics
+            bool isStarted() const { return _timer != NULL; }
+            uint32_t getTickRate() const { return _tickHz; }
+            uint32_t getMaxLatenessTicks() const { return _maxLateness; }   // Alarm -> ISR entry, worst case
+            uint32_t getStepCount() const { return _stepCount; }
+            void resetStatistics();
+
+        private:
+            struct Axis {
+                uint8_t stepPin;
+                uint8_t dirPin;
+                int8_t enablePin;
+                bool invert;
+                uint32_t stepMask;          // 1 << stepPin
+                StepRamp ramp;
+                uint64_t due;               // Next STEP edge, ticks x 256
+                volatile int32_t position;
+                int8_t direction;           // +1 / -1
+                volatile bool moving;
+                bool enabled;
+            };
+
+            Axis _axes[TWIST_STEP_MAX_AXES];
+            uint8_t _axisCount;
+            uint32_t _tickHz;
+
+            hw_timer_t* _timer;
+            portMUX_TYPE _lock;
+            bool _armed;
+            uint64_t _alarmAt;              // Ticks
+            uint32_t _pulseMask;            // STEP pins currently high
+            uint64_t _pulseEnd;             // Tick they may drop
+
+            volatile uint32_t _maxLateness;
+            volatile uint32_t _stepCount;
+
+            bool validAxis(uint8_t axis, const char* operation) const;
+            bool prepare(Axis& axis, int32_t steps, float maxSpeed, float acceleration);
+            void launch(Axis& axis, uint64_t now);
+            void arm(uint64_t tick);
+            void service();
+            static void onTimer(void* arg);
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
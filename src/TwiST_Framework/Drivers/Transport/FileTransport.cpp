@@ -0,0 +1,56 @@
+#include "FileTransport.h"
+#include <string.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        FileTransport::FileTransport(const char* path, size_t maxBytes)
+            : _path(path),
+              _maxBytes(maxBytes),
+              _open(false),
+              _chunkLength(0),
+              _written(0) {
+        }
+
+        bool FileTransport::begin(bool truncate) {
+            _file = LittleFS.open(_path, truncate ? "w" : "a");
+            _open = (bool)_file;
+            _written = _open ? _file.size() : 0;
+            return _open;
+        }
+
+        void FileTransport::end() {
+            flush();
+            if (_open) {
+                _file.close();
+                _open = false;
+            }
+        }
+
+        size_t FileTransport::writable() {
+            if (!_open) return 0;
+            size_t room = TWIST_FILE_CHUNK_SIZE - _chunkLength;
+            if (_maxBytes > 0) {
+                size_t left = (_written + _chunkLength < _maxBytes)
+                                  ? _maxBytes - _written - _chunkLength : 0;
+                if (left < room) room = left;
+            }
+            return room;
+        }
+
+        size_t FileTransport::send(const uint8_t* data, size_t length) {
+            size_t room = writable();
+            if (length > room) length = room;
+            memcpy(_chunk + _chunkLength, data, length);
+            _chunkLength += length;
+            return length;
+        }
+
+        void FileTransport::flush() {
+            if (!_open || _chunkLength == 0) return;
+            _written += _file.write(_chunk, _chunkLength);
+            _chunkLength = 0;
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,85 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      FileTransport.h
+ * @brief     Append-only file sink implementing ITransport (LittleFS)
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Transport Driver
+ * - Hardware:     ESP32 flash (LittleFS)
+ * - Implements:   ITransport
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Core services NEVER include this file - they use ITransport
+ * - Bounded work per tick: at most TWIST_FILE_CHUNK_SIZE bytes per flush
+ *   so flash writes cannot stall the control loop
+ * - Size-capped - stops accepting bytes when the file limit is reached
+ *
+ * CAPABILITIES:
+ * - Record telemetry to flash for later download
+ * - receive() replays nothing (write-only sink)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_FILE_TRANSPORT_H
+#define TWIST_DRIVER_FILE_TRANSPORT_H
+
+#include "../../Interfaces/ITransport.h"
+#include <LittleFS.h>
+
+// Bytes buffered in RAM before a flash write
+#ifndef TWIST_FILE_CHUNK_SIZE
+#define TWIST_FILE_CHUNK_SIZE 256
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief File transport - implements ITransport (write-only)
+         */
+        class FileTransport : public ITransport {
+        public:
+            /**
+             * @param path File path (e.g., "/telemetry.bin")
+             * @param maxBytes File size limit (0 = unlimited)
+             */
+            FileTransport(const char* path, size_t maxBytes = 0);
+
+            /**
+             * @brief Open file for appending (LittleFS must be mounted)
+             * @param truncate Start a fresh file
+             */
+            bool begin(bool truncate = true);
+            void end();
+
+            // ITransport interface implementation
+            size_t writable() override;
+            size_t send(const uint8_t* data, size_t length) override;
+            size_t receive(uint8_t* buffer, size_t capacity) override { return 0; }
+            void flush() override;
+
+            size_t getBytesWritten() const { return _written; }
+
+        private:
+            const char* _path;
+            size_t _maxBytes;
+            File _file;
+            bool _open;
+
+            uint8_t _chunk[TWIST_FILE_CHUNK_SIZE];
+            size_t _chunkLength;
+            size_t _written;
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
@@ -0,0 +1,63 @@
+#include "LoopbackTransport.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+        LoopbackTransport::LoopbackTransport()
+            : _peer(NULL),
+              _head(0),
+              _size(0),
+              _dropEvery(0),
+              _bytesSent(0) {
+        }
+
+        void LoopbackTransport::connect(LoopbackTransport& a, LoopbackTransport& b) {
+            a._peer = &b;
+            b._peer = &a;
+        }
+
+        size_t LoopbackTransport::writable() {
+            return _peer ? TWIST_LOOPBACK_BUFFER_SIZE - _peer->_size : 0;
+        }
+
+        size_t LoopbackTransport::send(const uint8_t* data, size_t length) {
+            if (_peer == NULL) return 0;
+
+            size_t accepted = 0;
+            for (size_t i = 0; i < length; i++) {
+                _bytesSent++;
+                if (_dropEvery > 0 && (_bytesSent % _dropEvery) == 0) {
+                    accepted++;  // Lost on the "wire" - sender does not know
+                    continue;
+                }
+                if (_peer->accept(data + i, 1) == 0) break;
+                accepted++;
+            }
+            return accepted;
+        }
+
+        size_t LoopbackTransport::receive(uint8_t* buffer, size_t capacity) {
+            size_t count = (capacity < _size) ? capacity : _size;
+            for (size_t i = 0; i < count; i++) {
+                buffer[i] = _rx[_head];
+                _head = (_head + 1) % TWIST_LOOPBACK_BUFFER_SIZE;
+            }
+            _size -= count;
+            return count;
+        }
+
+        size_t LoopbackTransport::accept(const uint8_t* data, size_t length) {
+            size_t count = TWIST_LOOPBACK_BUFFER_SIZE - _size;
+            if (count > length) count = length;
+
+            size_t tail = (_head + _size) % TWIST_LOOPBACK_BUFFER_SIZE;
+            for (size_t i = 0; i < count; i++) {
+                _rx[tail] = data[i];
+                tail = (tail + 1) % TWIST_LOOPBACK_BUFFER_SIZE;
+            }
+            _size += count;
+            return count;
+        }
+
+    }
+}  // namespace TwiST::Drivers
@@ -0,0 +1,91 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      LoopbackTransport.h
+ * @brief     In-memory transport pair for host tests and on-device self-tests
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Virtual Transport Driver (pure C++)
+ * - Hardware:     None
+ * - Implements:   ITransport
+ *
+ * PRINCIPLES:
+ * - Pure C++ (NO Arduino.h) - builds unchanged on a Linux host
+ * - Two endpoints are connected; send() on one is receive() on the other
+ * - Fixed receive ring per endpoint (zero heap allocation)
+ * - writable() reports the peer's free space - send() never blocks
+ *
+ * CAPABILITIES:
+ * - Stand-in for serial/UDP links when testing services end to end
+ * - Byte-level fault injection (drop every Nth byte)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_LOOPBACK_TRANSPORT_H
+#define TWIST_DRIVER_LOOPBACK_TRANSPORT_H
+
+#include "../../Interfaces/ITransport.h"
+
+// Receive ring size per endpoint
+#ifndef TWIST_LOOPBACK_BUFFER_SIZE
+#define TWIST_LOOPBACK_BUFFER_SIZE 2048
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief One end of an in-memory link
+         *
+         * Example:
+         * ```cpp
+         * LoopbackTransport host, device;
+         * LoopbackTransport::connect(host, device);
+         * CommandChannel channel(device, *framework.registry());
+         * host.send(frame, length);   // Arrives at channel on next update()
+         * ```
+         */
+        class LoopbackTransport : public ITransport {
+        public:
+            LoopbackTransport();
+
+            /**
+             * @brief Connect two endpoints to each other
+             */
+            static void connect(LoopbackTransport& a, LoopbackTransport& b);
+
+            // ITransport interface implementation
+            size_t writable() override;
+            size_t send(const uint8_t* data, size_t length) override;
+            size_t receive(uint8_t* buffer, size_t capacity) override;
+
+            /**
+             * @brief Drop every Nth byte sent (0 = lossless)
+             */
+            void setDropEvery(unsigned long n) { _dropEvery = n; }
+
+            size_t getPending() const { return _size; }
+            unsigned long getBytesSent() const { return _bytesSent; }
+
+        private:
+            LoopbackTransport* _peer;
+            uint8_t _rx[TWIST_LOOPBACK_BUFFER_SIZE];
+            size_t _head;
+            size_t _size;
+
+            unsigned long _dropEvery;
+            unsigned long _bytesSent;
+
+            size_t accept(const uint8_t* data, size_t length);
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
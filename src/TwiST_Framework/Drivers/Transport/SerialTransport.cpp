@@ -0,0 +1,31 @@
+#include "SerialTransport.h"
+
+namespace TwiST {
+    namespace Drivers {
+
+        SerialTransport::SerialTransport(Stream& stream) : _stream(stream) {}
+
+        size_t SerialTransport::writable() {
+            int room = _stream.availableForWrite();
+            return room > 0 ? (size_t)room : 0;
+        }
+
+        size_t SerialTransport::send(const uint8_t* data, size_t length) {
+            size_t room = writable();
+            if (length > room) length = room;  // Never block on a full TX FIFO
+            if (length == 0) return 0;
+            return _stream.write(data, length);
+        }
+
+        size_t SerialTransport::receive(uint8_t* buffer, size_t capacity) {
+            size_t count = 0;
+            while (count < capacity && _stream.available() > 0) {
+                int c = _stream.read();
+                if (c < 0) break;
+                buffer[count++] = (uint8_t)c;
+            }
+            return count;
+        }
+
+    }
+}  // namespace TwiST::Drivers
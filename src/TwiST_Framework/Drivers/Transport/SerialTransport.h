@@ -0,0 +1,61 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      SerialTransport.h
+ * @brief     UART/USB serial link implementing ITransport
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Transport Driver
+ * - Hardware:     Any Arduino Stream (HardwareSerial, USB CDC)
+ * - Implements:   ITransport
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Core services NEVER include this file - they use ITransport
+ * - Stream reference locked at construction
+ * - writable() reports the UART TX FIFO space - send() never blocks
+ *
+ * CAPABILITIES:
+ * - Non-blocking write into TX buffer
+ * - Non-blocking read of pending RX bytes
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_SERIAL_TRANSPORT_H
+#define TWIST_DRIVER_SERIAL_TRANSPORT_H
+
+#include "../../Interfaces/ITransport.h"
+#include <Arduino.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief Serial transport - implements ITransport
+         *
+         * NOTE: Do not share the stream with Logger output while streaming
+         * binary frames (use a second UART or USB CDC for the link).
+         */
+        class SerialTransport : public ITransport {
+        public:
+            SerialTransport(Stream& stream);
+
+            // ITransport interface implementation
+            size_t writable() override;
+            size_t send(const uint8_t* data, size_t length) override;
+            size_t receive(uint8_t* buffer, size_t capacity) override;
+
+        private:
+            Stream& _stream;
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
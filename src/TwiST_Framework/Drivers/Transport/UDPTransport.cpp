@@ -0,0 +1,57 @@
+#include "UDPTransport.h"
+#include <string.h>
+
+namespace TwiST {
+    namespace Drivers {
+
+        UDPTransport::UDPTransport(uint16_t localPort, IPAddress remoteIp, uint16_t remotePort)
+            : _localPort(localPort),
+              _remoteIp(remoteIp),
+              _remotePort(remotePort),
+              _packetLength(0) {
+        }
+
+        bool UDPTransport::begin() {
+            return _udp.begin(_localPort) == 1;
+        }
+
+        size_t UDPTransport::writable() {
+            return TWIST_UDP_PACKET_SIZE - _packetLength;
+        }
+
+        size_t UDPTransport::send(const uint8_t* data, size_t length) {
+            size_t room = writable();
+            if (length > room) length = room;
+            memcpy(_packet + _packetLength, data, length);
+            _packetLength += length;
+            return length;
+        }
+
+        size_t UDPTransport::receive(uint8_t* buffer, size_t capacity) {
+            // Continue draining the current datagram before parsing the next one
+            if (_udp.available() <= 0) {
+                if (_udp.parsePacket() <= 0) {
+                    return 0;
+                }
+                // Learn peer address if no fixed remote was configured
+                if (_remotePort == 0 || (uint32_t)_remoteIp == 0) {
+                    _remoteIp = _udp.remoteIP();
+                    _remotePort = _udp.remotePort();
+                }
+            }
+            int n = _udp.read(buffer, capacity);
+            return n > 0 ? (size_t)n : 0;
+        }
+
+        void UDPTransport::flush() {
+            if (_packetLength == 0) return;
+            if (_remotePort != 0) {
+                _udp.beginPacket(_remoteIp, _remotePort);
+                _udp.write(_packet, _packetLength);
+                _udp.endPacket();
+            }
+            _packetLength = 0;  // No peer yet - drop (telemetry is lossy by design)
+        }
+
+    }
+}  // namespace TwiST::Drivers
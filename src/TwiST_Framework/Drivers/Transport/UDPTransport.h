@@ -0,0 +1,82 @@
+/* ============================================================================
+ * TwiST Framework | Hardware Driver
+ * ============================================================================
+ * @file      UDPTransport.h
+ * @brief     WiFi UDP link implementing ITransport
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Drivers
+ * - Type:         Concrete Transport Driver
+ * - Hardware:     ESP32 WiFi (lwIP UDP socket)
+ * - Implements:   ITransport
+ *
+ * PRINCIPLES:
+ * - Hardware-specific implementation only
+ * - Core services NEVER include this file - they use ITransport
+ * - Bytes sent between flush() calls become ONE datagram
+ * - Remote endpoint locked at construction (replies go to last sender
+ *   if no remote is given)
+ *
+ * CAPABILITIES:
+ * - Batched datagram transmit (up to TWIST_UDP_PACKET_SIZE bytes)
+ * - Non-blocking receive (one datagram per call, drained in chunks)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_DRIVER_UDP_TRANSPORT_H
+#define TWIST_DRIVER_UDP_TRANSPORT_H
+
+#include "../../Interfaces/ITransport.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+// Maximum datagram size (stay below typical 1472-byte Ethernet MTU payload)
+#ifndef TWIST_UDP_PACKET_SIZE
+#define TWIST_UDP_PACKET_SIZE 1024
+#endif
+
+namespace TwiST {
+    namespace Drivers {
+
+        /**
+         * @brief UDP transport - implements ITransport
+         *
+         * WiFi must be connected before begin().
+         */
+        class UDPTransport : public ITransport {
+        public:
+            /**
+             * @param localPort Port to listen on
+             * @param remoteIp Destination address (INADDR_NONE = reply to last sender)
+             * @param remotePort Destination port
+             */
+            UDPTransport(uint16_t localPort, IPAddress remoteIp = IPAddress((uint32_t)0),
+                         uint16_t remotePort = 0);
+
+            bool begin();
+
+            // ITransport interface implementation
+            size_t writable() override;
+            size_t send(const uint8_t* data, size_t length) override;
+            size_t receive(uint8_t* buffer, size_t capacity) override;
+            void flush() override;
+
+        private:
+            WiFiUDP _udp;
+            uint16_t _localPort;
+            IPAddress _remoteIp;
+            uint16_t _remotePort;
+
+            uint8_t _packet[TWIST_UDP_PACKET_SIZE];
+            size_t _packetLength;
+        };
+
+    }
+}  // namespace TwiST::Drivers
+
+#endif
@@ -207,6 +207,14 @@ namespace TwiST {
          * @return Millis timestamp of last update() call
          */
         virtual unsigned long getLastUpdateTime() const = 0;
+
+        // ===== Power Management =====
+
+        /**
+         * @brief Time until the bridge next needs update()
+         * @return Microseconds; 0 = every pass (default), UINT32_MAX = nothing scheduled
+         */
+        virtual uint32_t getTimeUntilUpdate(uint32_t nowUs) const { return 0; }
     };
 
 }  // namespace TwiST
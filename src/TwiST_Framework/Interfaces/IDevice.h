@@ -186,6 +186,29 @@ namespace TwiST {
          * @return true if deserialization successful
          */
         virtual bool fromJson(const JsonDocument& doc) = 0;
+
+        // ===== Power Management =====
+
+        /**
+         * @brief Time until this device next needs update() (power-aware idle)
+         * @param nowUs Current micros()
+         * @return Microseconds; 0 = every pass (default), UINT32_MAX = only
+         *         when something else wakes the loop (events, interrupts)
+         */
+        virtual uint32_t getTimeUntilUpdate(uint32_t nowUs) const { return 0; }
+
+        // ===== Snapshot =====
+
+        /**
+         * @brief Copy hot state for DeviceRegistry::snapshot()
+         *
+         * Cached values only - no bus I/O, no allocation, no formatting.
+         *
+         * @param values Destination array
+         * @param maxValues Capacity of values (TWIST_SNAPSHOT_VALUES)
+         * @return Number of values written (default: none)
+         */
+        virtual uint8_t captureState(float* values, uint8_t maxValues) const { return 0; }
     };
 
 }  // namespace TwiST
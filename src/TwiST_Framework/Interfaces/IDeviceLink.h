@@ -0,0 +1,110 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IDeviceLink.h
+ * @brief     Link between proxy devices and the node that owns the real device
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for NodeLink and Remote* devices)
+ *
+ * PRINCIPLES:
+ * - Proxy devices (Devices layer) NEVER include Core link code
+ * - Link pushes replicated state INTO proxies (IRemoteProxy)
+ * - Proxies push commands OUT through the link (IDeviceLink)
+ * - Remote devices are addressed by their ID on the owning node
+ *
+ * CAPABILITIES:
+ * - Output commands: setValue, moveTo, enable
+ * - Replicated state: device state, flags, up to TWIST_REMOTE_MAX_AXES values
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_IDEVICELINK_H
+#define TWIST_IDEVICELINK_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+// Values replicated per device (output value, input axes)
+#ifndef TWIST_REMOTE_MAX_AXES
+#define TWIST_REMOTE_MAX_AXES 4
+#endif
+
+namespace TwiST {
+
+    // Replicated state flags
+    enum RemoteStateFlag : uint8_t {
+        REMOTE_ENABLED = 0x01,
+        REMOTE_MOVING  = 0x02,
+        REMOTE_OUTPUT  = 0x04,
+        REMOTE_INPUT   = 0x08
+    };
+
+    // Latest state of one remote device
+    struct RemoteState {
+        uint16_t deviceId;      // ID on the owning node
+        uint8_t state;          // DeviceState
+        uint8_t flags;          // RemoteStateFlag bits
+        uint8_t axisCount;
+        float values[TWIST_REMOTE_MAX_AXES];
+    };
+
+    /**
+     * @brief Receives replicated state (implemented by proxy devices)
+     */
+    class IRemoteProxy {
+    public:
+        virtual ~IRemoteProxy() = default;
+
+        /**
+         * @brief Get ID of the represented device on the owning node
+         */
+        virtual uint16_t getRemoteId() const = 0;
+
+        /**
+         * @brief Apply replicated state
+         * @param state Latest state
+         * @param nowMs Local receive time
+         */
+        virtual void applyRemoteState(const RemoteState& state, unsigned long nowMs) = 0;
+
+        /**
+         * @brief Last applied state is still current (in-sequence batch without it)
+         * @param nowMs Local receive time
+         */
+        virtual void confirmRemoteState(unsigned long nowMs) = 0;
+    };
+
+    /**
+     * @brief Sends commands to the owning node (implemented by NodeLink)
+     */
+    class IDeviceLink {
+    public:
+        virtual ~IDeviceLink() = default;
+
+        /**
+         * @brief Register a proxy for state updates
+         * @return true if attached
+         */
+        virtual bool attachProxy(IRemoteProxy* proxy) = 0;
+
+        virtual void sendValue(uint16_t remoteId, float value) = 0;
+        virtual void sendMoveTo(uint16_t remoteId, float target, uint16_t durationMs) = 0;
+        virtual void sendEnable(uint16_t remoteId, bool enabled) = 0;
+
+        /**
+         * @brief Check if the peer node is alive
+         */
+        virtual bool isConnected() const = 0;
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,84 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IDigitalInputDriver.h
+ * @brief     Digital input lines with timestamped edge capture
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for ESP32DigitalInput)
+ *
+ * PRINCIPLES:
+ * - Pure C++ interface (NO Arduino.h dependency)
+ * - Levels are logical: true = active (polarity handled by the driver)
+ * - Edges are queued per line with the time they happened - consumers
+ *   may read them late without losing timing
+ * - One consumer per line (the device owning it)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_IDIGITALINPUTDRIVER_H
+#define TWIST_IDIGITALINPUTDRIVER_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    /**
+     * @brief One captured level change
+     */
+    struct DigitalEdge {
+        uint32_t timestampUs;   // micros() when the level changed
+        bool level;             // Logical level after the change
+    };
+
+    /**
+     * @brief Digital input driver interface (many lines per driver)
+     */
+    class IDigitalInputDriver {
+    public:
+        virtual ~IDigitalInputDriver() = default;
+
+        virtual uint8_t getLineCount() const = 0;
+
+        /**
+         * @brief Current logical level of a line
+         */
+        virtual bool readLine(uint8_t line) = 0;
+
+        /**
+         * @brief Take the oldest queued edge of a line
+         * @return false if none queued
+         */
+        virtual bool popEdge(uint8_t line, DigitalEdge& edge) = 0;
+
+        /**
+         * @brief Edges lost because the line's queue was full
+         *        (consumer should resynchronize with readLine())
+         */
+        virtual uint32_t getDroppedEdges(uint8_t line) const = 0;
+
+        /**
+         * @brief Refresh lines without edge interrupts (call every update;
+         *        drivers rate-limit internally so many callers cost one scan)
+         */
+        virtual void poll() {}
+
+        /**
+         * @brief How soon poll() must run again for this line (power-aware idle)
+         * @return Microseconds; 0 = every pass (default), UINT32_MAX = line has
+         *         an interrupt and wakes the loop itself
+         */
+        virtual uint32_t getPollInterval(uint8_t line) const { return 0; }
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,54 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IEncoderDriver.h
+ * @brief     Position counter abstraction (quadrature encoders)
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for ESP32PCNT)
+ *
+ * PRINCIPLES:
+ * - Pure C++ interface (NO Arduino.h dependency)
+ * - Counting happens in hardware - readCount() is a cheap snapshot,
+ *   safe to call from fixed-rate control loops
+ * - 32-bit signed count, never wraps in practice (driver extends the
+ *   hardware counter)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_IENCODERDRIVER_H
+#define TWIST_IENCODERDRIVER_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    /**
+     * @brief Encoder driver interface (one encoder per driver)
+     */
+    class IEncoderDriver {
+    public:
+        virtual ~IEncoderDriver() = default;
+
+        /**
+         * @brief Current position in counts (x4 for quadrature)
+         */
+        virtual int32_t readCount() = 0;
+
+        /**
+         * @brief Redefine the current position (homing)
+         */
+        virtual void setCount(int32_t count) = 0;
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,52 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      II2CBus.h
+ * @brief     Raw I2C write transaction abstraction
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for WireI2CBus, FakeI2CBus)
+ *
+ * PRINCIPLES:
+ * - One call = one complete transaction (START, address, data, STOP)
+ * - Blocking: returns when the bus is released - I2CQueue moves it off the
+ *   control loop
+ * - Called from ONE context at a time (queue worker OR caller, never both)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_II2CBUS_H
+#define TWIST_II2CBUS_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    /**
+     * @brief I2C bus interface
+     */
+    class II2CBus {
+    public:
+        virtual ~II2CBus() = default;
+
+        /**
+         * @brief Write bytes to a device
+         * @param address 7-bit device address
+         * @param data Bytes after the address (register pointer first)
+         * @param length Byte count
+         * @return true if every byte was acknowledged
+         */
+        virtual bool write(uint8_t address, const uint8_t* data, uint8_t length) = 0;
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,59 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IMotionSupervisor.h
+ * @brief     Admission control for timed output moves
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for SafetySupervisor, consulted by Servo)
+ *
+ * PRINCIPLES:
+ * - Devices ask BEFORE starting a move; supervisor never drives outputs
+ * - A move can be granted, granted slower (duration stretched) or deferred
+ * - Deferred moves are retried by the device on its next update()
+ * - No supervisor attached = every move starts immediately (unchanged)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_IMOTIONSUPERVISOR_H
+#define TWIST_IMOTIONSUPERVISOR_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    /**
+     * @brief Move admission interface
+     */
+    class IMotionSupervisor {
+    public:
+        virtual ~IMotionSupervisor() = default;
+
+        /**
+         * @brief Ask to start a move
+         * @param deviceId Requesting device
+         * @param from Current value
+         * @param to Target value
+         * @param durationMs Requested duration (0 = jump); may be lengthened
+         * @return true = start now with durationMs, false = retry later
+         */
+        virtual bool requestMove(uint16_t deviceId, float from, float to, unsigned long& durationMs) = 0;
+
+        /**
+         * @brief Report that a granted move finished or was cancelled
+         * @param deviceId Device that held the grant
+         */
+        virtual void releaseMove(uint16_t deviceId) = 0;
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,53 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IOutputConstraint.h
+ * @brief     Last-stage filter between an output value and the hardware
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for JointConstraints, consulted by Servo)
+ *
+ * PRINCIPLES:
+ * - Called on EVERY output write, after the device's own calibration clamp
+ *   and BEFORE the value reaches the PWM driver
+ * - Returns the nearest allowed value; the constraint remembers it as the
+ *   device's committed position (used by constraints on other devices)
+ * - Must be cheap: no allocation, no I/O, bounded work per call
+ * - No constraint attached = value written unchanged
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_IOUTPUTCONSTRAINT_H
+#define TWIST_IOUTPUTCONSTRAINT_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    /**
+     * @brief Output write filter interface
+     */
+    class IOutputConstraint {
+    public:
+        virtual ~IOutputConstraint() = default;
+
+        /**
+         * @brief Project a requested value onto the allowed set
+         * @param deviceId Writing device
+         * @param requested Value the device wants to output
+         * @return Value to actually output (== requested when allowed)
+         */
+        virtual float constrain(uint16_t deviceId, float requested) = 0;
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -87,6 +87,15 @@ namespace TwiST {
          * @return true if in motion
          */
         virtual bool isMoving() const = 0;
+
+        /**
+         * @brief Snapshot default for outputs: [0] = getValue()
+         */
+        uint8_t captureState(float* values, uint8_t maxValues) const override {
+            if (maxValues == 0) return 0;
+            values[0] = getValue();
+            return 1;
+        }
     };
 
 }  // namespace TwiST
@@ -62,6 +62,15 @@ namespace TwiST {
          */
         virtual uint16_t getMaxPWM() const = 0;
 
+        /**
+         * @brief Stop pulses on a channel (output held low, servo goes limp)
+         * @param channel Channel number
+         *
+         * The next setPWM() on the channel resumes output. Default writes 0;
+         * chips with a dedicated off state override it.
+         */
+        virtual void setOff(uint8_t channel) { setPWM(channel, 0); }
+
         /**
          * @brief Check if driver supports frequency control
          * @return true if setFrequency() is functional
@@ -0,0 +1,83 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IService.h
+ * @brief     Framework service interface for per-tick background work
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (IS the service interface)
+ *
+ * PRINCIPLES:
+ * - Pure C++ interface (NO Arduino.h dependency)
+ * - Services are NOT devices - no ID, no registry entry
+ * - Driven by TwiSTFramework::update() at a fixed phase of the tick
+ * - Non-owning: framework stores pointers, caller keeps the object alive
+ *
+ * CAPABILITIES:
+ * - Startup hook
+ * - Per-tick update
+ * - Human-readable name (diagnostics)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_ISERVICE_H
+#define TWIST_ISERVICE_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    // Where in the tick a service runs
+    enum ServicePhase {
+        SERVICE_BEFORE_DEVICES,   // After event processing, before device updates (command input)
+        SERVICE_AFTER_BRIDGES     // After devices and bridges (output, telemetry)
+    };
+
+    /**
+     * @brief Interface for framework services (telemetry, remote links, schedulers)
+     *
+     * Example:
+     * ```cpp
+     * Telemetry telemetry(serialTransport);
+     * framework.addService(&telemetry);  // Runs every update()
+     * ```
+     */
+    class IService {
+    public:
+        virtual ~IService() = default;
+
+        /**
+         * @brief Called once when the service is added to the framework
+         * @return true if service is ready
+         */
+        virtual bool begin() { return true; }
+
+        /**
+         * @brief Per-tick work (called from TwiSTFramework::update())
+         */
+        virtual void update() = 0;
+
+        /**
+         * @brief Get service name
+         * @return Name for diagnostics (e.g., "Telemetry")
+         */
+        virtual const char* getName() const = 0;
+
+        /**
+         * @brief Time until the service next needs update() (power-aware idle)
+         * @return Microseconds; 0 = every pass (default), UINT32_MAX = nothing scheduled
+         */
+        virtual uint32_t getTimeUntilUpdate(uint32_t nowUs) const { return 0; }
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,89 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      IStepperDriver.h
+ * @brief     Step/direction pulse generator abstraction
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (contract for StepEngine)
+ *
+ * PRINCIPLES:
+ * - Pure C++ interface (NO Arduino.h dependency)
+ * - Units are steps, steps/s and steps/s^2 - devices own unit conversion
+ * - Moves are rest-to-rest; a new move on a busy axis is rejected, the
+ *   caller stops (decelerates) first
+ * - Positions are counted by the pulse generator, not estimated
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_ISTEPPERDRIVER_H
+#define TWIST_ISTEPPERDRIVER_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+
+namespace TwiST {
+
+    /**
+     * @brief Stepper pulse generator interface (one instance, many axes)
+     */
+    class IStepperDriver {
+    public:
+        virtual ~IStepperDriver() = default;
+
+        /**
+         * @brief Number of axes this generator drives
+         */
+        virtual uint8_t getAxisCount() const = 0;
+
+        /**
+         * @brief Start a trapezoidal move
+         * @param axis Axis index
+         * @param steps Relative step count (sign = direction)
+         * @param maxSpeed Cruise rate in steps/s
+         * @param acceleration Ramp rate in steps/s^2
+         * @return false if the axis is busy, disabled or parameters invalid
+         */
+        virtual bool move(uint8_t axis, int32_t steps, float maxSpeed, float acceleration) = 0;
+
+        /**
+         * @brief Start moves on several axes that begin and end together
+         *
+         * The axis with the most steps runs at maxSpeed/acceleration; the
+         * others are scaled so every profile has the same shape in time.
+         *
+         * @return false (nothing started) if any axis is busy or invalid
+         */
+        virtual bool moveSynchronized(const uint8_t* axes, const int32_t* steps, uint8_t count,
+                                      float maxSpeed, float acceleration) = 0;
+
+        /**
+         * @brief Stop an axis
+         * @param immediate true = no more pulses, false = decelerate to rest
+         */
+        virtual void stop(uint8_t axis, bool immediate) = 0;
+
+        virtual bool isMoving(uint8_t axis) const = 0;
+        virtual int32_t getPosition(uint8_t axis) const = 0;
+
+        /**
+         * @brief Redefine the current position (homing) - axis must be idle
+         */
+        virtual void setPosition(uint8_t axis, int32_t position) = 0;
+
+        /**
+         * @brief Energize / release the motor (driver ENABLE pin)
+         */
+        virtual void setEnabled(uint8_t axis, bool enabled) = 0;
+    };
+
+}  // namespace TwiST
+
+#endif
@@ -0,0 +1,84 @@
+/* ============================================================================
+ * TwiST Framework | Interface
+ * ============================================================================
+ * @file      ITransport.h
+ * @brief     Byte transport abstraction for telemetry and remote links
+ *
+ * ARCHITECTURE ROLE:
+ * - Layer:        Interfaces
+ * - Type:         Pure Abstract Interface
+ * - Hardware:     None (pure abstraction)
+ * - Implements:   None (IS the transport interface)
+ *
+ * PRINCIPLES:
+ * - Pure C++ interface (NO Arduino.h dependency)
+ * - Byte-stream semantics for every link (serial, UDP, file, loopback)
+ * - NEVER blocks - writes accept only what fits, reads return what is there
+ * - flush() marks the end of a batch (datagram transports send one packet)
+ * - Framing is NOT the transport's job (see Core/WireFrame.h)
+ *
+ * CAPABILITIES:
+ * - Query free write space
+ * - Non-blocking send and receive
+ * - Batch boundary (flush)
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_ITRANSPORT_H
+#define TWIST_ITRANSPORT_H
+
+#include <stdint.h>  // NO Arduino.h - Pure C++ contract!
+#include <stddef.h>
+
+namespace TwiST {
+
+    /**
+     * @brief Transport abstraction interface
+     *
+     * CRITICAL: Pure C++ interface - NO Arduino dependencies.
+     * Serial ports, UDP sockets, log files and in-memory loopbacks all look
+     * the same to the framework: a non-blocking byte pipe.
+     */
+    class ITransport {
+    public:
+        virtual ~ITransport() = default;
+
+        /**
+         * @brief Get number of bytes that can be sent without blocking
+         * @return Free write space in bytes
+         */
+        virtual size_t writable() = 0;
+
+        /**
+         * @brief Send bytes (non-blocking)
+         * @param data Bytes to send
+         * @param length Number of bytes
+         * @return Number of bytes accepted (may be less than length)
+         */
+        virtual size_t send(const uint8_t* data, size_t length) = 0;
+
+        /**
+         * @brief Receive bytes (non-blocking)
+         * @param buffer Destination buffer
+         * @param capacity Buffer size
+         * @return Number of bytes received (0 if nothing pending)
+         */
+        virtual size_t receive(uint8_t* buffer, size_t capacity) = 0;
+
+        /**
+         * @brief End of batch - push buffered bytes out
+         *
+         * Stream transports: no-op or driver flush.
+         * Datagram transports: everything sent since last flush() becomes ONE packet.
+         */
+        virtual void flush() {}
+    };
+
+}  // namespace TwiST
+
+#endif
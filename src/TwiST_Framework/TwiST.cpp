@@ -1,15 +1,28 @@
 #include "TwiST.h"
 
 TwiSTFramework::TwiSTFramework()
-    : _bridgeCount(0),
+    : _timers(_eventBus),
+      _bridgeCount(0),
+      _serviceCount(0),
       _initialized(false),
+      _autoSnapshot(false),
       _startTime(0),
-      _updateCount(0) {
+      _updateCount(0),
+      _lastUpdateDuration(0) {
+
+    // Registry reports each device update as a monitored section
+    _registry.setLoopMonitor(&_loopMonitor);
 
     // Initialize bridge array
     for (uint8_t i = 0; i < MAX_BRIDGES; i++) {
         _bridges[i] = NULL;
     }
+
+    // Initialize service array
+    for (uint8_t i = 0; i < MAX_SERVICES; i++) {
+        _services[i] = NULL;
+        _servicePhases[i] = SERVICE_AFTER_BRIDGES;
+    }
 }
 
 TwiSTFramework::~TwiSTFramework() {
@@ -43,6 +56,11 @@ bool TwiSTFramework::initialize(bool autoLoadConfig) {
         loadConfigFrom(SOURCE_LITTLEFS);
     }
 
+#if TWIST_ENABLE_TRACING
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Tracing enabled (span cost: %lu ns)",
+                (unsigned long)Tracer::calibrate());
+#endif
+
     _startTime = millis();
     _initialized = true;
 
@@ -80,10 +98,35 @@ void TwiSTFramework::update() {
         return;
     }
 
+    TWIST_TRACE_SCOPE("TwiSTFramework::update");
+
+    // Startup is over once the loop runs - allocations from here on are late
+    if (!_heap.isSealed()) {
+        _heap.seal();
+    }
+
+    unsigned long startUs = micros();
     _updateCount++;
+    _loopMonitor.beginPass(startUs);
 
     // Process event queue
-    _eventBus.processEvents();
+    {
+        TWIST_TRACE_SCOPE("EventBus::processEvents");
+        _loopMonitor.enterSection(SECTION_EVENTS, NULL);
+        _eventBus.processEvents();
+        _loopMonitor.exitSection();
+    }
+
+    // Due timers - scheduled setValue() / moveTo() land in this pass
+    {
+        TWIST_TRACE_SCOPE("TimerService::update");
+        _loopMonitor.enterSection(SECTION_SERVICE, _timers.getName());
+        _timers.update();
+        _loopMonitor.exitSection();
+    }
+
+    // Services that feed devices (remote commands, injected input)
+    updateServices(SERVICE_BEFORE_DEVICES);
 
     // Update all registered devices
     _registry.updateAll();
@@ -91,9 +134,51 @@ void TwiSTFramework::update() {
     // Update all bridges
     for (uint8_t i = 0; i < _bridgeCount; i++) {
         if (_bridges[i] && _bridges[i]->isEnabled()) {
+            TWIST_TRACE_SCOPE("IBridge::update");
+            _loopMonitor.enterSection(SECTION_BRIDGE, NULL, i);
             _bridges[i]->update();
+            _loopMonitor.exitSection();
         }
     }
+
+    // Publish the tick's device state before the observers run
+    if (_autoSnapshot) {
+        _registry.snapshot();
+    }
+
+    // Services that observe the finished tick (telemetry, output links)
+    updateServices(SERVICE_AFTER_BRIDGES);
+
+    unsigned long endUs = micros();
+    _lastUpdateDuration = endUs - startUs;
+    _loopMonitor.endPass(endUs);
+    _heap.check();
+}
+
+uint32_t TwiSTFramework::idle(uint32_t maxWaitUs) {
+    uint32_t wait = getTimeUntilUpdate();
+    if (maxWaitUs < wait) wait = maxWaitUs;
+    return _power.idle(wait);
+}
+
+uint32_t TwiSTFramework::getTimeUntilUpdate() const {
+    if (_eventBus.getPendingEventCount() > 0) return 0;
+
+    uint32_t now = micros();
+    uint32_t wait = _registry.getTimeUntilUpdate(now);
+    uint32_t timer = _timers.getTimeUntilUpdate(now);
+    if (timer < wait) wait = timer;
+    for (uint8_t i = 0; i < _bridgeCount && wait > 0; i++) {
+        if (_bridges[i] && _bridges[i]->isEnabled()) {
+            uint32_t bridge = _bridges[i]->getTimeUntilUpdate(now);
+            if (bridge < wait) wait = bridge;
+        }
+    }
+    for (uint8_t i = 0; i < _serviceCount && wait > 0; i++) {
+        uint32_t service = _services[i]->getTimeUntilUpdate(now);
+        if (service < wait) wait = service;
+    }
+    return wait;
 }
 
 // ===== Configuration =====
@@ -184,6 +269,57 @@ bool TwiSTFramework::removeBridge(IBridge* bridge) {
     return false;
 }
 
+// ===== Service Management =====
+
+bool TwiSTFramework::addService(IService* service, ServicePhase phase) {
+    if (service == NULL) {
+        Logger::error("FRAMEWORK", "Cannot add NULL service");
+        return false;
+    }
+
+    if (_serviceCount >= MAX_SERVICES) {
+        Logger::error("FRAMEWORK", "Service limit reached");
+        return false;
+    }
+
+    if (!service->begin()) {
+        Logger::logf(Logger::Level::ERROR, "FRAMEWORK", "Service '%s' failed to start", service->getName());
+        return false;
+    }
+
+    _services[_serviceCount] = service;
+    _servicePhases[_serviceCount] = phase;
+    _serviceCount++;
+
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Added service '%s' (total: %d)",
+                service->getName(), _serviceCount);
+
+    return true;
+}
+
+bool TwiSTFramework::removeService(IService* service) {
+    if (service == NULL) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < _serviceCount; i++) {
+        if (_services[i] == service) {
+            // Shift remaining services down
+            for (uint8_t j = i; j < _serviceCount - 1; j++) {
+                _services[j] = _services[j + 1];
+                _servicePhases[j] = _servicePhases[j + 1];
+            }
+            _services[_serviceCount - 1] = NULL;
+            _serviceCount--;
+
+            Logger::info("FRAMEWORK", "Removed service");
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // ===== Statistics & Diagnostics =====
 
 void TwiSTFramework::printStatus() {
@@ -197,6 +333,12 @@ void TwiSTFramework::printStatus() {
     Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Total devices: %d", _registry.getDeviceCount());
     Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Input devices: %d", _registry.getInputDeviceCount());
     Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Output devices: %d", _registry.getOutputDeviceCount());
+    if (_registry.getSnapshotGeneration() > 0) {
+        const SnapshotBuffer& snapshots = _registry.getSnapshotBuffer();
+        Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Snapshot: generation %lu%s (reader retries %lu, failed %lu)",
+                    (unsigned long)snapshots.getGeneration(), _autoSnapshot ? ", every update" : "",
+                    (unsigned long)snapshots.getRetryCount(), (unsigned long)snapshots.getFailedReadCount());
+    }
 
     Logger::info("FRAMEWORK", "");
     Logger::info("FRAMEWORK", "--- Event Bus ---");
@@ -208,6 +350,73 @@ void TwiSTFramework::printStatus() {
     Logger::info("FRAMEWORK", "--- Bridges ---");
     Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Active bridges: %d", _bridgeCount);
 
+    Logger::info("FRAMEWORK", "");
+    Logger::info("FRAMEWORK", "--- Services ---");
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Active services: %d", _serviceCount);
+    for (uint8_t i = 0; i < _serviceCount; i++) {
+        Logger::logf(Logger::Level::INFO, "FRAMEWORK", "  - %s", _services[i]->getName());
+    }
+
+    Logger::info("FRAMEWORK", "");
+    Logger::info("FRAMEWORK", "--- Timers ---");
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Pending: %u of %u (peak %u)",
+                _timers.getPendingCount(), TimerService::CAPACITY, _timers.getPeakPendingCount());
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Fired: %lu, cancelled: %lu, rejected: %lu, worst lateness: %lu us",
+                _timers.getFiredCount(), _timers.getCancelledCount(), _timers.getRejectedCount(),
+                (unsigned long)_timers.getMaxLatency());
+
+    Logger::info("FRAMEWORK", "");
+    Logger::info("FRAMEWORK", "--- Loop Timing ---");
+    printLoopHistogram("Period", _loopMonitor.getPeriod());
+    printLoopHistogram("Work", _loopMonitor.getWork());
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Budget: %lu us, late: %lu of %lu",
+                (unsigned long)_loopMonitor.getBudget(), _loopMonitor.getLateCount(),
+                _loopMonitor.getWork().getCount());
+    if (_loopMonitor.getLateCount() > 0) {
+        char culprit[48];
+        const LoopSection& last = _loopMonitor.getLastCulprit();
+        const LoopSection& worst = _loopMonitor.getWorstCulprit();
+        Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Last culprit: %s (%lu us)",
+                    LoopMonitor::describe(last, culprit, sizeof(culprit)), (unsigned long)last.durationUs);
+        Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Worst culprit: %s (%lu us)",
+                    LoopMonitor::describe(worst, culprit, sizeof(culprit)), (unsigned long)worst.durationUs);
+    }
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Watchdog: %s",
+                _loopMonitor.isWatchdogEnabled() ? "armed" : "off");
+
+    Logger::info("FRAMEWORK", "");
+    Logger::info("FRAMEWORK", "--- Power ---");
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Idle: %s%s", _power.isEnabled() ? "on" : "off",
+                _power.isLightSleepEnabled() ? " (light sleep)" : "");
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Wakeups: %.1f /s, awake %.1f%% (idle saves %.1f%%)",
+                _power.getWakeupsPerSecond(), _power.getDutyCycle() * 100.0f,
+                (1.0f - _power.getDutyCycle()) * 100.0f);
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Sleeps: %lu (light %lu, woken early %lu)",
+                _power.getSleepCount(), _power.getLightSleepCount(), _power.getEarlyWakeCount());
+
+    Logger::info("FRAMEWORK", "");
+    Logger::info("FRAMEWORK", "--- Memory ---");
+    _heap.sample();
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Heap free: %u bytes (min %u, largest block %u, fragmentation %.0f%%)",
+                (unsigned)_heap.getFreeHeap(), (unsigned)_heap.getMinFreeHeap(),
+                (unsigned)_heap.getLargestFreeBlock(), _heap.getFragmentation() * 100.0f);
+    if (_heap.isSealed()) {
+        Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Since startup: %ld bytes lost", _heap.getDriftSinceSeal());
+    }
+    if (HeapMonitor::isCounting()) {
+        Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Allocations: %lu (late %lu, %u bytes)",
+                    HeapMonitor::getAllocationCount(), HeapMonitor::getLateAllocationCount(),
+                    (unsigned)HeapMonitor::getLateAllocationBytes());
+    }
+
+#if TWIST_ENABLE_TRACING
+    Logger::info("FRAMEWORK", "");
+    Logger::info("FRAMEWORK", "--- Tracing ---");
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Spans held: %u (overwritten: %lu)",
+                (unsigned)Tracer::getRecordCount(), Tracer::getOverwrittenCount());
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "Span cost: %lu ns", (unsigned long)Tracer::getSpanCostNs());
+#endif
+
     Logger::info("FRAMEWORK", "======================================");
     Logger::info("FRAMEWORK", "");
 }
@@ -221,6 +430,26 @@ unsigned long TwiSTFramework::getUptime() const {
 
 // ===== Private Helpers =====
 
+void TwiSTFramework::printLoopHistogram(const char* label, const LoopHistogram& histogram) {
+    Logger::logf(Logger::Level::INFO, "FRAMEWORK", "%s: min %lu / mean %lu / p99 %lu / max %lu us",
+                label,
+                (unsigned long)histogram.getMin(),
+                (unsigned long)histogram.getMean(),
+                (unsigned long)histogram.getPercentile(99),
+                (unsigned long)histogram.getMax());
+}
+
+void TwiSTFramework::updateServices(ServicePhase phase) {
+    for (uint8_t i = 0; i < _serviceCount; i++) {
+        if (_servicePhases[i] == phase && _services[i]) {
+            TWIST_TRACE_SCOPE(_services[i]->getName());
+            _loopMonitor.enterSection(SECTION_SERVICE, _services[i]->getName());
+            _services[i]->update();
+            _loopMonitor.exitSection();
+        }
+    }
+}
+
 bool TwiSTFramework::initializeDevicesFromConfig() {
     // Phase 1: Not implemented yet
     // Phase 4: Will use PluginManager to create devices from JSON
@@ -11,17 +11,63 @@
 #include "Interfaces/IPWMDriver.h"
 #include "Interfaces/IADCDriver.h"
 #include "Interfaces/IDistanceDriver.h"
+#include "Interfaces/IService.h"
+#include "Interfaces/ITransport.h"
+#include "Interfaces/IDeviceLink.h"
+#include "Interfaces/IMotionSupervisor.h"
+#include "Interfaces/IOutputConstraint.h"
+#include "Interfaces/II2CBus.h"
+#include "Interfaces/IStepperDriver.h"
+#include "Interfaces/IDigitalInputDriver.h"
+#include "Interfaces/IEncoderDriver.h"
 
 // Core framework
 #include "Core/DeviceRegistry.h"
+#include "Core/DeviceSnapshot.h"
 #include "Core/EventBus.h"
+#include "Core/EventCodec.h"
+#include "Core/EventBridge.h"
 #include "Core/ConfigManager.h"
 #include "Core/Logger.h"
+#include "Core/Tracer.h"
+#include "Core/LoopMonitor.h"
+#include "Core/CommandProtocol.h"
+#include "Core/CommandChannel.h"
+#include "Core/WireFrame.h"
+#include "Core/TelemetryCodec.h"
+#include "Core/Telemetry.h"
+#include "Core/RecordLog.h"
+#include "Core/DriverRecorder.h"
+#include "Core/ReplicationCodec.h"
+#include "Core/NodeLink.h"
+#include "Core/SafetySupervisor.h"
+#include "Core/JointConstraints.h"
+#include "Core/Kinematics.h"
+#include "Core/I2CQueue.h"
+#include "Core/StepRamp.h"
+#include "Core/Debouncer.h"
+#include "Core/PIDController.h"
+#include "Core/PolarOccupancy.h"
+#include "Core/OutputConditioner.h"
+#include "Core/PowerManager.h"
+#include "Core/HeapMonitor.h"
+#include "Core/TimerService.h"
+#include "Core/Behavior.h"
+#include "Core/StateMachine.h"
+#include "Core/Arena.h"
 
 // Devices (hardware-independent)
 #include "Devices/Servo.h"
 #include "Devices/Joystick.h"
 #include "Devices/DistanceSensor.h"
+#include "Devices/Stepper.h"
+#include "Devices/DigitalInput.h"
+#include "Devices/Encoder.h"
+#include "Devices/DCServo.h"
+#include "Devices/DistanceArray.h"
+#include "Devices/AnalogInputArray.h"
+#include "Devices/RemoteOutput.h"
+#include "Devices/RemoteInput.h"
 
 // Main sketch includes drivers, NOT framework core!
 
@@ -103,6 +149,21 @@ public:
      */
     void update();
 
+    /**
+     * @brief Idle until something is due (call after update(); no-op unless power().setEnabled(true))
+     * @param maxWaitUs Application's own deadline (UINT32_MAX = none)
+     * @return Microseconds spent idle
+     *
+     * Ends early when an ISR calls PowerManager::wakeFromISR() (interrupt input lines do).
+     */
+    uint32_t idle(uint32_t maxWaitUs = UINT32_MAX);
+
+    /**
+     * @brief Time until the next pass has work (pending events, device/bridge/service deadlines)
+     * @return Microseconds (0 = run now, UINT32_MAX = nothing scheduled)
+     */
+    uint32_t getTimeUntilUpdate() const;
+
     // ===== Component Access =====
 
     /**
@@ -175,6 +236,29 @@ public:
      */
     uint8_t getBridgeCount() const { return _bridgeCount; }
 
+    // ===== Service Management =====
+
+    /**
+     * @brief Add a service (telemetry, remote link, scheduler)
+     * @param service Pointer to service (must remain valid!)
+     * @param phase Where in update() the service runs
+     * @return true if service added and started
+     */
+    bool addService(IService* service, ServicePhase phase = SERVICE_AFTER_BRIDGES);
+
+    /**
+     * @brief Remove a service
+     * @param service Pointer to service to remove
+     * @return true if service removed
+     */
+    bool removeService(IService* service);
+
+    /**
+     * @brief Get number of active services
+     * @return Service count
+     */
+    uint8_t getServiceCount() const { return _serviceCount; }
+
     // ===== Statistics & Diagnostics =====
 
     /**
@@ -194,21 +278,73 @@ public:
      */
     unsigned long getUpdateCount() const { return _updateCount; }
 
+    /**
+     * @brief Get work time of the last update() pass
+     * @return Duration in microseconds
+     */
+    unsigned long getLastUpdateDuration() const { return _lastUpdateDuration; }
+
+    /**
+     * @brief Get loop timing monitor (histograms, budget, watchdog)
+     * @return Reference to LoopMonitor
+     */
+    LoopMonitor& loopMonitor() { return _loopMonitor; }
+
+    /**
+     * @brief Get power manager (idle between deadlines, wakeup statistics)
+     * @return Reference to PowerManager
+     */
+    PowerManager& power() { return _power; }
+
+    /**
+     * @brief Get heap monitor (free / fragmentation, allocations after startup)
+     * @return Reference to HeapMonitor (sealed by the first update())
+     */
+    HeapMonitor& heap() { return _heap; }
+
+    /**
+     * @brief Get timer service (future-dated setValue / moveTo / events / callbacks)
+     * @return Reference to TimerService (fired by update(), before devices)
+     */
+    TimerService& timers() { return _timers; }
+
+    /**
+     * @brief Capture a registry snapshot at the end of every update()
+     * @param enabled true = readers on other tasks always see the last pass
+     *
+     * Read with registry()->readSnapshot(frame) from any task or core.
+     */
+    void setAutoSnapshot(bool enabled) { _autoSnapshot = enabled; }
+    bool isAutoSnapshotEnabled() const { return _autoSnapshot; }
+
 private:
     DeviceRegistry _registry;
     EventBus _eventBus;
     ConfigManager _configManager;
+    LoopMonitor _loopMonitor;
+    PowerManager _power;
+    HeapMonitor _heap;
+    TimerService _timers;
 
     // Bridge management
     IBridge* _bridges[MAX_BRIDGES];
     uint8_t _bridgeCount;
 
+    // Service management
+    IService* _services[MAX_SERVICES];
+    ServicePhase _servicePhases[MAX_SERVICES];
+    uint8_t _serviceCount;
+
     // Framework state
     bool _initialized;
+    bool _autoSnapshot;
     unsigned long _startTime;
     unsigned long _updateCount;
+    unsigned long _lastUpdateDuration;
 
     // Private helpers
+    void updateServices(ServicePhase phase);
+    void printLoopHistogram(const char* label, const LoopHistogram& histogram);
     bool initializeDevicesFromConfig();
     bool initializeBridgesFromConfig();
 };
@@ -57,13 +57,23 @@
  * @brief Maximum number of devices in registry
  *
  * Used by: DeviceRegistry.h/.cpp
- * Memory: 4 bytes per device (pointer)
- * Typical: 8-16 for simple projects, 32 for complex
+ * Memory: 4 bytes per device (pointer) + 2 snapshot records (see below)
+ * Typical: 8-16 for simple projects, 32 for complex (255 at most)
  */
 #ifndef MAX_DEVICES
 #define MAX_DEVICES  32
 #endif
 
+/**
+ * @brief Values per device in DeviceRegistry::snapshot() records
+ *
+ * Used by: Core/DeviceSnapshot.h (IDevice::captureState fills them)
+ * Memory: (8 + 4 * VALUES) bytes per device, twice (double buffer)
+ */
+#ifndef TWIST_SNAPSHOT_VALUES
+#define TWIST_SNAPSHOT_VALUES  4
+#endif
+
 /**
  * @brief Maximum number of bridges
  *
@@ -75,6 +85,176 @@
 #define MAX_BRIDGES  16
 #endif
 
+/**
+ * @brief Maximum number of framework services
+ *
+ * Used by: TwiST.h/.cpp (addService - telemetry, remote links, schedulers)
+ * Memory: 5 bytes per service (pointer + phase)
+ */
+#ifndef MAX_SERVICES
+#define MAX_SERVICES  8
+#endif
+
+/**
+ * @brief Pending timers in framework.timers() (scheduled actions, callbacks)
+ *
+ * Used by: Core/TimerService.h (fixed entry pool + min-heap, max 65534)
+ * Memory: ~60 bytes per timer
+ */
+#ifndef TWIST_TIMER_CAPACITY
+#define TWIST_TIMER_CAPACITY  16
+#endif
+
+/**
+ * @brief Coroutine behaviors - co_await moveTo / sleep / event (0 = off)
+ *
+ * Used by: Core/Behavior.h (BehaviorRunner service + fixed frame pool)
+ * Requires: C++20 coroutines (-std=gnu++2a or newer)
+ * Memory: TWIST_BEHAVIOR_CAPACITY * (TWIST_BEHAVIOR_FRAME_BYTES + ~36) bytes
+ * Tuning: BehaviorRunner::getLargestFrame() = biggest frame requested so far
+ */
+#ifndef TWIST_ENABLE_BEHAVIORS
+#define TWIST_ENABLE_BEHAVIORS  0
+#endif
+
+#ifndef TWIST_BEHAVIOR_CAPACITY
+#define TWIST_BEHAVIOR_CAPACITY  8
+#endif
+
+#ifndef TWIST_BEHAVIOR_FRAME_BYTES
+#define TWIST_BEHAVIOR_FRAME_BYTES  256
+#endif
+
+// Distinct event names behaviors can co_await (one EventBus listener each)
+#ifndef TWIST_BEHAVIOR_TOPICS
+#define TWIST_BEHAVIOR_TOPICS  8
+#endif
+
+/**
+ * @brief Limits of one StateMachine (compiled tables are sized by these)
+ *
+ * Used by: Core/StateMachine.h (per machine: states, transitions and
+ *          distinct event names - one EventBus listener each)
+ * Memory: ~24 bytes per state + ~16 per transition + ~12 per event name
+ */
+#ifndef TWIST_HSM_MAX_STATES
+#define TWIST_HSM_MAX_STATES  16
+#endif
+
+#ifndef TWIST_HSM_MAX_TRANSITIONS
+#define TWIST_HSM_MAX_TRANSITIONS  32
+#endif
+
+#ifndef TWIST_HSM_MAX_EVENTS
+#define TWIST_HSM_MAX_EVENTS  8
+#endif
+
+/**
+ * @brief Record driver I/O to LittleFS for offline replay (0 = off)
+ *
+ * Used by: ApplicationConfig.cpp (wraps ADC/distance/PWM drivers)
+ * Memory: ~1 KB RAM (DriverRecorder double buffer) when enabled
+ * Replay: Drivers/Record/ReplayDrivers.h + Core/RecordLog.h
+ */
+#ifndef TWIST_ENABLE_RECORDING
+#define TWIST_ENABLE_RECORDING  0
+#endif
+
+#ifndef TWIST_RECORDING_PATH
+#define TWIST_RECORDING_PATH  "/twist_rec.twrl"
+#endif
+
+#ifndef TWIST_RECORDING_MAX_BYTES
+#define TWIST_RECORDING_MAX_BYTES  (256UL * 1024UL)
+#endif
+
+/**
+ * @brief Work-time budget for one update() pass (0 = no budget)
+ *
+ * Used by: Core/LoopMonitor.h (late-iteration count, culprit capture)
+ * Runtime: framework.loopMonitor().setBudget(us)
+ */
+#ifndef TWIST_LOOP_BUDGET_US
+#define TWIST_LOOP_BUDGET_US  10000
+#endif
+
+/**
+ * @brief Default task watchdog timeout for LoopMonitor::enableWatchdog()
+ *
+ * Used by: Core/LoopMonitor.h (ESP32 task watchdog, fed once per update())
+ */
+#ifndef TWIST_WATCHDOG_TIMEOUT_MS
+#define TWIST_WATCHDOG_TIMEOUT_MS  3000
+#endif
+
+/**
+ * @brief Idle limits for TwiSTFramework::idle() (power-aware loop)
+ *
+ * Used by: Core/PowerManager.h - waits shorter than MIN are not worth a
+ * context switch; waits are capped at MAX so the watchdog keeps being fed;
+ * light sleep (opt-in) only for waits of at least LIGHT_SLEEP
+ * Runtime: framework.power().setSleepLimits(min, max) / setLightSleep(true)
+ */
+#ifndef TWIST_POWER_MIN_SLEEP_US
+#define TWIST_POWER_MIN_SLEEP_US  1000
+#endif
+
+#ifndef TWIST_POWER_MAX_SLEEP_US
+#define TWIST_POWER_MAX_SLEEP_US  100000
+#endif
+
+#ifndef TWIST_POWER_LIGHT_SLEEP_US
+#define TWIST_POWER_LIGHT_SLEEP_US  5000
+#endif
+
+/**
+ * @brief Count every operator new / delete and flag allocations after startup
+ *
+ * Used by: Core/HeapMonitor.cpp (replaces the global operator new / delete)
+ * Sealed: on the first framework.update() - later allocations are logged
+ * with their size and caller address (0 = heap statistics only)
+ */
+#ifndef TWIST_ENABLE_HEAP_MONITOR
+#define TWIST_ENABLE_HEAP_MONITOR  0
+#endif
+
+/**
+ * @brief Compile in TWIST_TRACE_SCOPE spans (0 = macros expand to nothing)
+ *
+ * Used by: Core/Tracer.h (framework loop, registry, event bus, drivers)
+ * Memory: TWIST_TRACE_BUFFER_SIZE * 12 bytes when enabled
+ * Export: Tracer::exportChromeJson(Serial) -> ui.perfetto.dev
+ */
+#ifndef TWIST_ENABLE_TRACING
+#define TWIST_ENABLE_TRACING  0
+#endif
+
+/**
+ * @brief Supervise servo supply current in App::initializeSystem() (0 = off)
+ *
+ * Used by: ApplicationConfig.cpp (Core/SafetySupervisor - staggers/throttles
+ *          timed servo moves, publishes "safety.overload" / "safety.stall")
+ * Budget: current the servo rail can deliver without browning out the board
+ */
+#ifndef TWIST_ENABLE_SAFETY
+#define TWIST_ENABLE_SAFETY  0
+#endif
+
+#ifndef TWIST_SAFETY_BUDGET_MA
+#define TWIST_SAFETY_BUDGET_MA  2000.0f
+#endif
+
+/**
+ * @brief Queue PCA9685 writes on a background I2C task (0 = blocking Wire)
+ *
+ * Used by: ApplicationConfig.cpp (Core/I2CQueue + Drivers/I2C/WireI2CBus,
+ *          attached to every PCA9685 driver; App::i2c() for statistics)
+ * Memory: TWIST_I2C_QUEUE_DEPTH * ~36 bytes + worker task stack (3 KB)
+ */
+#ifndef TWIST_ENABLE_ASYNC_I2C
+#define TWIST_ENABLE_ASYNC_I2C  0
+#endif
+
 /**
  * @brief Maximum number of event listeners
  *
@@ -127,7 +307,7 @@ namespace TwiST {
 // PWM driver types (hardware abstraction)
 enum class PWMDriverType : uint8_t {
     PCA9685,        // I2C PWM driver (16 channels, Adafruit)
-    ESP32_LEDC      // ESP32 native LED PWM (16 channels, future)
+    ESP32_LEDC      // ESP32 native LED PWM (GPIO outputs, see LEDC_PIN_CONFIGS)
     // Add more driver types here as needed
 };
 
@@ -137,11 +317,26 @@ enum class CalibrationMode : uint8_t {
     MICROSECONDS    // Microsecond pulse width (legacy)
 };
 
+// Servo behaviour at rest (Servo::HoldPolicy)
+enum class ServoHold : uint8_t {
+    HOLD,               // Always pulse (full holding torque)
+    RELEASE_IDLE,       // Stop pulses after releaseMs at rest (and while disabled)
+    RELEASE_DISABLED    // Stop pulses only while disabled
+};
+
 // PWM driver configuration
 struct PWMDriverConfig {
     PWMDriverType type;         // Driver type (PCA9685, ESP32_LEDC, etc.)
     uint8_t i2cAddress;         // I2C address (0x40-0x7F) - only for I2C drivers
     uint16_t frequency;         // PWM frequency in Hz (50 for servos)
+    uint8_t resolutionBits;     // Duty resolution - only for ESP32_LEDC (14-16, 0 = 14)
+};
+
+// LEDC output pin (one entry per channel used on an ESP32_LEDC driver)
+struct LEDCPinConfig {
+    uint8_t pwmDriverIndex;     // Index into PWM_DRIVER_CONFIGS (must be ESP32_LEDC)
+    uint8_t pwmChannel;         // Channel as used in ServoConfig.pwmChannel
+    uint8_t gpio;               // Output GPIO
 };
 
 // Servo configuration
@@ -161,6 +356,15 @@ struct ServoConfig {
     uint16_t maxUs;             // Maximum pulse width (microseconds)
     uint16_t angleMin;          // Minimum angle (degrees)
     uint16_t angleMax;          // Maximum angle (degrees)
+
+    // Output conditioning (optional - omitted fields = off)
+    uint16_t deadbandTicks = 0;     // Skip writes that change the output by this many ticks or less
+    uint16_t slewTicksPerSec = 0;   // Max output speed in PWM ticks per second
+    uint16_t smoothingMs = 0;       // Low-pass time constant
+
+    // Hold policy (optional - omitted fields = always hold)
+    ServoHold hold = ServoHold::HOLD;
+    uint16_t releaseMs = 0;         // RELEASE_IDLE: time at rest before pulses stop
 };
 
 // Joystick configuration
@@ -188,6 +392,96 @@ struct DistanceSensorConfig {
     unsigned long measurementIntervalMs;  // Measurement interval
 };
 
+// Stepper configuration (STEP/DIR driver such as A4988, DRV8825, TMC2209)
+struct StepperConfig {
+    const char* name;           // Human-readable name
+    uint16_t deviceId;          // Device ID (400, 401, ...)
+    uint8_t stepPin;            // GPIO for STEP (0-31)
+    uint8_t dirPin;             // GPIO for DIR
+    int8_t enablePin;           // GPIO for active-low ENABLE, -1 = not wired
+    float stepsPerUnit;         // Steps per user unit (e.g. 80 steps/mm)
+    float maxSpeed;             // Units/s
+    float acceleration;         // Units/s^2
+    float minPosition;          // Soft limit (units)
+    float maxPosition;          // Soft limit (units)
+};
+
+// Digital input configuration (button, limit switch)
+struct DigitalInputConfig {
+    const char* name;           // Human-readable name
+    uint16_t deviceId;          // Device ID (500, 501, ...)
+    uint8_t gpio;               // Input GPIO (0-31)
+    bool activeLow;             // true = pressed pulls the pin to GND
+    bool pullup;                // Enable internal pull-up
+    bool interrupt;             // true = pin-change interrupt, false = polled port scan
+    uint16_t debounceMs;        // Debounce integrator window
+    uint32_t longPressMs;       // "input.long_press" after this hold time, 0 = off
+};
+
+// Quadrature encoder configuration (ESP32 pulse counter, one unit each)
+struct EncoderConfig {
+    const char* name;           // Human-readable name
+    uint16_t deviceId;          // Device ID (600, 601, ...)
+    uint8_t pinA;               // Channel A GPIO
+    uint8_t pinB;               // Channel B GPIO
+    float countsPerUnit;        // x4 counts per user unit (CPR * 4 / 360 for degrees)
+    uint16_t glitchFilterNs;    // Ignore pulses shorter than this (0 = off)
+};
+
+// Closed-loop DC motor (encoder + H-bridge on two PWM channels)
+struct DCServoConfig {
+    const char* name;           // Human-readable name
+    uint16_t deviceId;          // Device ID (610, 611, ...)
+    uint8_t encoderIndex;       // Index into ENCODER_CONFIGS (feedback)
+    uint8_t pwmDriverIndex;     // Index into PWM_DRIVER_CONFIGS
+    uint8_t pwmChannelA;        // Forward (count-increasing) channel
+    uint8_t pwmChannelB;        // Reverse channel
+    uint16_t rateHz;            // Control loop rate
+    float kp;                   // Duty (0-1) per unit of error
+    float ki;                   // Duty per unit*s
+    float kd;                   // Duty per unit/s
+    float kv;                   // Velocity feed-forward, duty per unit/s
+    float ks;                   // Static friction feed-forward, duty
+    float maxSpeed;             // Units/s
+    float minPosition;          // Soft limit (units)
+    float maxPosition;          // Soft limit (units)
+};
+
+// Distance sensor ring (sensors listed in DISTANCE_ARRAY_SENSOR_CONFIGS)
+struct DistanceArrayConfig {
+    const char* name;           // Human-readable name
+    uint16_t deviceId;          // Device ID (320, 321, ...)
+    uint8_t sectors;            // Polar map resolution (1-36)
+    uint16_t slotMs;            // Time per sensor - one fires, the rest stay silent
+    float beamDeg;              // Sensor cone width (HC-SR04 ~30)
+    float alertCm;              // "obstacle.detected" below this (0 = off)
+};
+
+// One sensor of a distance ring
+struct DistanceArraySensorConfig {
+    uint8_t arrayIndex;         // Index into DISTANCE_ARRAY_CONFIGS
+    uint8_t trigPin;            // GPIO pin for TRIG signal
+    uint8_t echoPin;            // GPIO pin for ECHO signal (use voltage divider!)
+    float bearingDeg;           // 0 = forward, counter-clockwise positive
+};
+
+// Multi-axis analog console (axes listed in ANALOG_AXIS_CONFIGS)
+struct AnalogInputArrayConfig {
+    const char* name;           // Human-readable name
+    uint16_t deviceId;          // Device ID (210, 211, ...)
+    uint16_t deadzone;          // Centered axes: deadzone radius (raw ADC units)
+    float changeThreshold;      // "input.axes.changed" above this (normalized, 0 = off)
+};
+
+// One axis of an analog console
+struct AnalogAxisConfig {
+    uint8_t arrayIndex;         // Index into ANALOG_INPUT_ARRAY_CONFIGS
+    uint8_t pin;                // ESP32 ADC pin
+    uint16_t min;               // Raw minimum
+    uint16_t center;            // Raw rest position, 0 = linear axis (slider, knob)
+    uint16_t max;               // Raw maximum
+};
+
 // ============================================================================
 // Device Configuration Arrays - std::array for zero-size safety
 // ============================================================================
@@ -197,8 +491,20 @@ struct DistanceSensorConfig {
 // ============================================================================
 
 static constexpr std::array<PWMDriverConfig, 1> PWM_DRIVER_CONFIGS = {{
-    // type, i2cAddress, frequency
-    {PWMDriverType::PCA9685, 0x40, 50}  // PCA9685 at 0x40, 50Hz for servos
+    // type, i2cAddress, frequency, resolutionBits
+    {PWMDriverType::PCA9685, 0x40, 50, 0}  // PCA9685 at 0x40, 50Hz for servos
+    // {PWMDriverType::ESP32_LEDC, 0, 50, 14}  // On-chip LEDC, 14-bit (pins below)
+}};
+
+// ============================================================================
+// LEDC pin assignments (ESP32_LEDC drivers only)
+// ============================================================================
+
+// Servo on an ESP32_LEDC driver needs an entry for its pwmChannel here
+// ESP32-C6: 6 LEDC channels total across all ESP32_LEDC drivers
+static constexpr std::array<LEDCPinConfig, 0> LEDC_PIN_CONFIGS = {{
+    // pwmDrvIdx, pwmCh, gpio
+    // {1, 0, 2}   // Driver 1, channel 0 -> GPIO2
 }};
 
 // ============================================================================
@@ -209,6 +515,8 @@ static constexpr std::array<PWMDriverConfig, 1> PWM_DRIVER_CONFIGS = {{
 // To remove all servos: Change size to 0, empty initializer
 static constexpr std::array<ServoConfig, 2> SERVO_CONFIGS = {{
     // name, pwmDrvIdx, pwmCh, devID, calMode, minSteps, maxSteps, minUs, maxUs, angleMin, angleMax
+    // [, deadbandTicks, slewTicksPerSec, smoothingMs] - e.g. 2, 800, 30 for a joystick-driven servo
+    // [, hold, releaseMs] - e.g. ServoHold::RELEASE_IDLE, 2000 for a joint with no gravity load
     {"GripperServo", 0, 0, 100, CalibrationMode::STEPS,        110,  540, 0,    0,    0,   0},
     {"BaseServo",    0, 1, 101, CalibrationMode::MICROSECONDS,   0,    0, 500, 2500,  0, 180}
 }};
@@ -232,6 +540,82 @@ static constexpr std::array<DistanceSensorConfig, 1> DISTANCE_SENSOR_CONFIGS = {
     {"ObstacleSensor", 300, 16, 17, 0.3f, 100}
 }};
 
+// ============================================================================
+// Stepper configurations
+// ============================================================================
+
+// All steppers share one step engine (one hardware timer, max 4 axes)
+static constexpr std::array<StepperConfig, 0> STEPPER_CONFIGS = {{
+    // name, devID, stepPin, dirPin, enablePin, stepsPerUnit, maxSpeed, acceleration, minPos, maxPos
+    // {"Slide", 400, 4, 5, 6, 80.0f, 150.0f, 600.0f, 0.0f, 300.0f}   // 80 steps/mm belt axis
+}};
+
+// ============================================================================
+// Digital input configurations
+// ============================================================================
+
+// All inputs share one input driver (polled lines: one port read per scan)
+static constexpr std::array<DigitalInputConfig, 0> DIGITAL_INPUT_CONFIGS = {{
+    // name, devID, gpio, activeLow, pullup, interrupt, debounceMs, longPressMs
+    // {"StartButton", 500, 9, true, true, true, 10, 1500}     // Button to GND
+    // {"HomeSwitch",  501, 18, true, true, false, 5, 0}       // Polled limit switch
+}};
+
+// ============================================================================
+// Encoder configurations
+// ============================================================================
+
+// ESP32-C6: 4 pulse counter units = max 4 encoders
+static constexpr std::array<EncoderConfig, 0> ENCODER_CONFIGS = {{
+    // name, devID, pinA, pinB, countsPerUnit, glitchFilterNs
+    // {"ElbowEnc", 600, 20, 21, 11.378f, 1000}   // 1024 CPR x4, degrees
+}};
+
+// ============================================================================
+// DC servo configurations
+// ============================================================================
+
+static constexpr std::array<DCServoConfig, 0> DC_SERVO_CONFIGS = {{
+    // name, devID, encIdx, pwmDrvIdx, chA, chB, rateHz, kp, ki, kd, kv, ks, maxSpeed, minPos, maxPos
+    // {"Elbow", 610, 0, 0, 4, 5, 1000, 0.05f, 0.3f, 0.0006f, 0.0015f, 0.02f, 180.0f, -90.0f, 90.0f}
+}};
+
+// ============================================================================
+// Distance array configurations
+// ============================================================================
+
+// Sensors of a ring fire one per slot - never list them in DISTANCE_SENSOR_CONFIGS too
+static constexpr std::array<DistanceArrayConfig, 0> DISTANCE_ARRAY_CONFIGS = {{
+    // name, devID, sectors, slotMs, beamDeg, alertCm
+    // {"Sonar", 320, 8, 40, 30.0f, 25.0f}
+}};
+
+// Max 8 sensors per array
+static constexpr std::array<DistanceArraySensorConfig, 0> DISTANCE_ARRAY_SENSOR_CONFIGS = {{
+    // arrayIdx, trigPin, echoPin, bearingDeg
+    // {0, 10, 11, 0.0f},      // Front
+    // {0, 12, 13, 90.0f},     // Left
+    // {0, 14, 15, 180.0f},    // Back
+    // {0, 22, 23, 270.0f}     // Right
+}};
+
+// ============================================================================
+// Analog input array configurations
+// ============================================================================
+
+static constexpr std::array<AnalogInputArrayConfig, 0> ANALOG_INPUT_ARRAY_CONFIGS = {{
+    // name, devID, deadzone, changeThreshold
+    // {"Console", 210, 50, 0.02f}
+}};
+
+// Max 8 axes per array, in axis order
+static constexpr std::array<AnalogAxisConfig, 0> ANALOG_AXIS_CONFIGS = {{
+    // arrayIdx, pin, min, center, max
+    // {0, 2, 3, 1677, 3290},      // Left stick X
+    // {0, 3, 3, 1677, 3290},      // Left stick Y
+    // {0, 4, 120, 0, 3980}        // Throttle slider (linear)
+}};
+
 // ============================================================================
 // Device Counts - Computed from std::array::size()
 // ============================================================================
@@ -239,9 +623,18 @@ static constexpr std::array<DistanceSensorConfig, 1> DISTANCE_SENSOR_CONFIGS = {
 // CRITICAL: Counts computed from array.size(), NOT hardcoded
 // Zero-device safe: std::array<T, 0> is valid C++, .size() returns 0
 static constexpr uint8_t PWM_DRIVER_COUNT = PWM_DRIVER_CONFIGS.size();
+static constexpr uint8_t LEDC_PIN_COUNT = LEDC_PIN_CONFIGS.size();
 static constexpr uint8_t SERVO_COUNT = SERVO_CONFIGS.size();
 static constexpr uint8_t JOYSTICK_COUNT = JOYSTICK_CONFIGS.size();
 static constexpr uint8_t DISTANCE_SENSOR_COUNT = DISTANCE_SENSOR_CONFIGS.size();
+static constexpr uint8_t STEPPER_COUNT = STEPPER_CONFIGS.size();
+static constexpr uint8_t DIGITAL_INPUT_COUNT = DIGITAL_INPUT_CONFIGS.size();
+static constexpr uint8_t ENCODER_COUNT = ENCODER_CONFIGS.size();
+static constexpr uint8_t DC_SERVO_COUNT = DC_SERVO_CONFIGS.size();
+static constexpr uint8_t DISTANCE_ARRAY_COUNT = DISTANCE_ARRAY_CONFIGS.size();
+static constexpr uint8_t DISTANCE_ARRAY_SENSOR_COUNT = DISTANCE_ARRAY_SENSOR_CONFIGS.size();
+static constexpr uint8_t ANALOG_INPUT_ARRAY_COUNT = ANALOG_INPUT_ARRAY_CONFIGS.size();
+static constexpr uint8_t ANALOG_AXIS_COUNT = ANALOG_AXIS_CONFIGS.size();
 
 }  // namespace TwiST
 
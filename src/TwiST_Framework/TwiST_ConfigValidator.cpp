@@ -12,6 +12,8 @@
 #include "TwiST_ConfigValidator.h"
 #include "TwiST_Config.h"
 #include "Core/Logger.h"              // For centralized logging (v1.2.0)
+#include "Core/PolarOccupancy.h"      // TWIST_OCCUPANCY_MAX_SOURCES/SECTORS
+#include "Devices/AnalogInputArray.h"  // TWIST_ANALOG_MAX_AXES
 #include <Arduino.h>
 #include <array>
 #include <cstring>
@@ -27,6 +29,7 @@ namespace TwiST {
 constexpr uint8_t MAX_PWM_DRIVERS = 4;        // Typical: 1-2, maximum reasonable: 4
 constexpr uint8_t MAX_TOTAL_DEVICES = 32;     // Matches MAX_DEVICES from TwiST_Config.h
 constexpr uint8_t MAX_GPIO_PINS = 64;         // Typical ESP32: ~40 pins, buffer for safety
+constexpr uint8_t MAX_PCNT_UNITS = 4;         // ESP32-C6 pulse counter units
 
 bool runSystemConfigSafetyCheck() {
     bool valid = true;
@@ -38,6 +41,9 @@ bool runSystemConfigSafetyCheck() {
     uint8_t pwmAddressCount = 0;
 
     for (uint8_t i = 0; i < PWM_DRIVER_COUNT; i++) {
+        if (PWM_DRIVER_CONFIGS[i].type != PWMDriverType::PCA9685) {
+            continue;  // Not on the I2C bus
+        }
         uint8_t addr = PWM_DRIVER_CONFIGS[i].i2cAddress;
 
         // Check for duplicates in collected addresses
@@ -255,6 +261,445 @@ bool runSystemConfigSafetyCheck() {
         }
     }
 
+    // ========================================================================
+    // Check 7: LEDC Pin Assignments
+    // ========================================================================
+    for (uint8_t i = 0; i < PWM_DRIVER_COUNT; i++) {
+        const auto& cfg = PWM_DRIVER_CONFIGS[i];
+        if (cfg.type == PWMDriverType::ESP32_LEDC && cfg.resolutionBits != 0 &&
+            (cfg.resolutionBits < 14 || cfg.resolutionBits > 16)) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "LEDC driver %d resolution %d-bit (use 14-16)",
+                        i, cfg.resolutionBits);
+            valid = false;
+        }
+    }
+
+    for (uint8_t i = 0; i < LEDC_PIN_COUNT; i++) {
+        const auto& pin = LEDC_PIN_CONFIGS[i];
+        if (pin.pwmDriverIndex >= PWM_DRIVER_COUNT ||
+            PWM_DRIVER_CONFIGS[pin.pwmDriverIndex].type != PWMDriverType::ESP32_LEDC) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "LEDC pin GPIO%d references driver %d which is not ESP32_LEDC",
+                        pin.gpio, pin.pwmDriverIndex);
+            valid = false;
+        }
+
+        for (uint8_t j = 0; j < usedPinCount; j++) {
+            if (usedPins[j] == pin.gpio) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "GPIO pin collision: %d (LEDC channel %d conflicts with earlier pin)",
+                            pin.gpio, pin.pwmChannel);
+                valid = false;
+            }
+        }
+        if (usedPinCount < MAX_GPIO_PINS) {
+            usedPins[usedPinCount++] = pin.gpio;
+        }
+    }
+
+    for (uint8_t i = 0; i < SERVO_COUNT; i++) {
+        const auto& servo = SERVO_CONFIGS[i];
+        if (servo.pwmDriverIndex >= PWM_DRIVER_COUNT ||
+            PWM_DRIVER_CONFIGS[servo.pwmDriverIndex].type != PWMDriverType::ESP32_LEDC) {
+            continue;
+        }
+        bool mapped = false;
+        for (uint8_t j = 0; j < LEDC_PIN_COUNT; j++) {
+            if (LEDC_PIN_CONFIGS[j].pwmDriverIndex == servo.pwmDriverIndex &&
+                LEDC_PIN_CONFIGS[j].pwmChannel == servo.pwmChannel) {
+                mapped = true;
+            }
+        }
+        if (!mapped) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Servo '%s' uses LEDC channel %d with no LEDC_PIN_CONFIGS entry",
+                        servo.name, servo.pwmChannel);
+            valid = false;
+        }
+    }
+
+    // ========================================================================
+    // Check 8: Stepper Configuration
+    // ========================================================================
+    for (uint8_t i = 0; i < STEPPER_COUNT; i++) {
+        const auto& cfg = STEPPER_CONFIGS[i];
+
+        for (uint8_t j = 0; j < deviceIdCount; j++) {
+            if (deviceIds[j] == cfg.deviceId) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device ID collision: %d (stepper '%s' conflicts with earlier device)",
+                            cfg.deviceId, cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceIdCount < MAX_TOTAL_DEVICES) {
+            deviceIds[deviceIdCount++] = cfg.deviceId;
+        }
+
+        for (uint8_t j = 0; j < deviceNameCount; j++) {
+            if (strcmp(deviceNames[j], cfg.name) == 0) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device name collision: '%s' (stepper conflicts with earlier device)", cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceNameCount < MAX_TOTAL_DEVICES) {
+            deviceNames[deviceNameCount++] = cfg.name;
+        }
+
+        if (cfg.stepPin >= 32) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Stepper '%s' STEP pin %d out of range (0-31)", cfg.name, cfg.stepPin);
+            valid = false;
+        }
+
+        int16_t pins[3] = {cfg.stepPin, cfg.dirPin, cfg.enablePin};
+        for (uint8_t p = 0; p < 3; p++) {
+            if (pins[p] < 0) continue;
+            for (uint8_t j = 0; j < usedPinCount; j++) {
+                if (usedPins[j] == pins[p]) {
+                    Logger::logf(Logger::Level::ERROR, "CONFIG", "GPIO pin collision: %d (stepper '%s' conflicts with earlier pin)",
+                                pins[p], cfg.name);
+                    valid = false;
+                }
+            }
+            if (usedPinCount < MAX_GPIO_PINS) {
+                usedPins[usedPinCount++] = (uint8_t)pins[p];
+            }
+        }
+
+        if (cfg.stepsPerUnit <= 0.0f || cfg.maxSpeed <= 0.0f || cfg.acceleration <= 0.0f) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Stepper '%s' needs stepsPerUnit, maxSpeed, acceleration > 0", cfg.name);
+            valid = false;
+        }
+        if (cfg.minPosition >= cfg.maxPosition) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Stepper '%s' minPosition must be below maxPosition", cfg.name);
+            valid = false;
+        }
+    }
+
+    // ========================================================================
+    // Check 9: Digital Input Configuration
+    // ========================================================================
+    for (uint8_t i = 0; i < DIGITAL_INPUT_COUNT; i++) {
+        const auto& cfg = DIGITAL_INPUT_CONFIGS[i];
+
+        for (uint8_t j = 0; j < deviceIdCount; j++) {
+            if (deviceIds[j] == cfg.deviceId) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device ID collision: %d (input '%s' conflicts with earlier device)",
+                            cfg.deviceId, cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceIdCount < MAX_TOTAL_DEVICES) {
+            deviceIds[deviceIdCount++] = cfg.deviceId;
+        }
+
+        for (uint8_t j = 0; j < deviceNameCount; j++) {
+            if (strcmp(deviceNames[j], cfg.name) == 0) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device name collision: '%s' (input conflicts with earlier device)", cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceNameCount < MAX_TOTAL_DEVICES) {
+            deviceNames[deviceNameCount++] = cfg.name;
+        }
+
+        if (cfg.gpio >= 32) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Input '%s' GPIO %d out of range (0-31)", cfg.name, cfg.gpio);
+            valid = false;
+        }
+        for (uint8_t j = 0; j < usedPinCount; j++) {
+            if (usedPins[j] == cfg.gpio) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "GPIO pin collision: %d (input '%s' conflicts with earlier pin)",
+                            cfg.gpio, cfg.name);
+                valid = false;
+            }
+        }
+        if (usedPinCount < MAX_GPIO_PINS) {
+            usedPins[usedPinCount++] = cfg.gpio;
+        }
+
+        if (cfg.debounceMs == 0) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Input '%s' needs debounceMs > 0", cfg.name);
+            valid = false;
+        }
+    }
+
+    // ========================================================================
+    // Check 10: Encoder Configuration
+    // ========================================================================
+    if (ENCODER_COUNT > MAX_PCNT_UNITS) {
+        Logger::logf(Logger::Level::ERROR, "CONFIG", "%d encoders configured, chip has %d pulse counter units",
+                    ENCODER_COUNT, MAX_PCNT_UNITS);
+        valid = false;
+    }
+
+    for (uint8_t i = 0; i < ENCODER_COUNT; i++) {
+        const auto& cfg = ENCODER_CONFIGS[i];
+
+        for (uint8_t j = 0; j < deviceIdCount; j++) {
+            if (deviceIds[j] == cfg.deviceId) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device ID collision: %d (encoder '%s' conflicts with earlier device)",
+                            cfg.deviceId, cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceIdCount < MAX_TOTAL_DEVICES) {
+            deviceIds[deviceIdCount++] = cfg.deviceId;
+        }
+
+        for (uint8_t j = 0; j < deviceNameCount; j++) {
+            if (strcmp(deviceNames[j], cfg.name) == 0) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device name collision: '%s' (encoder conflicts with earlier device)", cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceNameCount < MAX_TOTAL_DEVICES) {
+            deviceNames[deviceNameCount++] = cfg.name;
+        }
+
+        uint8_t pins[2] = {cfg.pinA, cfg.pinB};
+        for (uint8_t p = 0; p < 2; p++) {
+            for (uint8_t j = 0; j < usedPinCount; j++) {
+                if (usedPins[j] == pins[p]) {
+                    Logger::logf(Logger::Level::ERROR, "CONFIG", "GPIO pin collision: %d (encoder '%s' conflicts with earlier pin)",
+                                pins[p], cfg.name);
+                    valid = false;
+                }
+            }
+            if (usedPinCount < MAX_GPIO_PINS) {
+                usedPins[usedPinCount++] = pins[p];
+            }
+        }
+
+        if (cfg.countsPerUnit == 0.0f) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Encoder '%s' needs countsPerUnit != 0", cfg.name);
+            valid = false;
+        }
+    }
+
+    // ========================================================================
+    // Check 11: DC Servo Configuration
+    // ========================================================================
+    for (uint8_t i = 0; i < DC_SERVO_COUNT; i++) {
+        const auto& cfg = DC_SERVO_CONFIGS[i];
+
+        for (uint8_t j = 0; j < deviceIdCount; j++) {
+            if (deviceIds[j] == cfg.deviceId) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device ID collision: %d (DC servo '%s' conflicts with earlier device)",
+                            cfg.deviceId, cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceIdCount < MAX_TOTAL_DEVICES) {
+            deviceIds[deviceIdCount++] = cfg.deviceId;
+        }
+
+        for (uint8_t j = 0; j < deviceNameCount; j++) {
+            if (strcmp(deviceNames[j], cfg.name) == 0) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device name collision: '%s' (DC servo conflicts with earlier device)", cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceNameCount < MAX_TOTAL_DEVICES) {
+            deviceNames[deviceNameCount++] = cfg.name;
+        }
+
+        if (cfg.encoderIndex >= ENCODER_COUNT) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' references encoderIndex %d but only %d encoders configured",
+                        cfg.name, cfg.encoderIndex, ENCODER_COUNT);
+            valid = false;
+        } else if (ENCODER_CONFIGS[cfg.encoderIndex].countsPerUnit <= 0.0f) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' needs a positive countsPerUnit (swap motor channels to reverse)",
+                        cfg.name);
+            valid = false;
+        }
+        for (uint8_t j = 0; j < i; j++) {
+            if (DC_SERVO_CONFIGS[j].encoderIndex == cfg.encoderIndex) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' shares encoder %d with '%s'",
+                            cfg.name, cfg.encoderIndex, DC_SERVO_CONFIGS[j].name);
+                valid = false;
+            }
+        }
+
+        if (cfg.pwmDriverIndex >= PWM_DRIVER_COUNT) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' references pwmDriverIndex %d but only %d drivers configured",
+                        cfg.name, cfg.pwmDriverIndex, PWM_DRIVER_COUNT);
+            valid = false;
+        }
+        if (cfg.pwmChannelA == cfg.pwmChannelB) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' uses channel %d for both directions",
+                        cfg.name, cfg.pwmChannelA);
+            valid = false;
+        }
+
+        // PWM channels must not be shared with servos or other DC servos
+        uint8_t channels[2] = {cfg.pwmChannelA, cfg.pwmChannelB};
+        for (uint8_t c = 0; c < 2; c++) {
+            for (uint8_t j = 0; j < SERVO_COUNT; j++) {
+                if (SERVO_CONFIGS[j].pwmDriverIndex == cfg.pwmDriverIndex && SERVO_CONFIGS[j].pwmChannel == channels[c]) {
+                    Logger::logf(Logger::Level::ERROR, "CONFIG", "PWM channel collision: driver %d channel %d (DC servo '%s' and servo '%s')",
+                                cfg.pwmDriverIndex, channels[c], cfg.name, SERVO_CONFIGS[j].name);
+                    valid = false;
+                }
+            }
+            for (uint8_t j = 0; j < i; j++) {
+                const auto& other = DC_SERVO_CONFIGS[j];
+                if (other.pwmDriverIndex == cfg.pwmDriverIndex &&
+                    (other.pwmChannelA == channels[c] || other.pwmChannelB == channels[c])) {
+                    Logger::logf(Logger::Level::ERROR, "CONFIG", "PWM channel collision: driver %d channel %d (DC servos '%s' and '%s')",
+                                cfg.pwmDriverIndex, channels[c], cfg.name, other.name);
+                    valid = false;
+                }
+            }
+        }
+
+        if (cfg.rateHz == 0 || cfg.maxSpeed <= 0.0f) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' needs rateHz and maxSpeed > 0", cfg.name);
+            valid = false;
+        }
+        if (cfg.minPosition >= cfg.maxPosition) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "DC servo '%s' minPosition must be below maxPosition", cfg.name);
+            valid = false;
+        }
+    }
+
+    // ========================================================================
+    // Check 12: Distance Array Configuration
+    // ========================================================================
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_COUNT; i++) {
+        const auto& cfg = DISTANCE_ARRAY_CONFIGS[i];
+
+        for (uint8_t j = 0; j < deviceIdCount; j++) {
+            if (deviceIds[j] == cfg.deviceId) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device ID collision: %d (distance array '%s' conflicts with earlier device)",
+                            cfg.deviceId, cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceIdCount < MAX_TOTAL_DEVICES) {
+            deviceIds[deviceIdCount++] = cfg.deviceId;
+        }
+
+        for (uint8_t j = 0; j < deviceNameCount; j++) {
+            if (strcmp(deviceNames[j], cfg.name) == 0) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device name collision: '%s' (distance array conflicts with earlier device)", cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceNameCount < MAX_TOTAL_DEVICES) {
+            deviceNames[deviceNameCount++] = cfg.name;
+        }
+
+        if (cfg.sectors == 0 || cfg.sectors > TWIST_OCCUPANCY_MAX_SECTORS) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Distance array '%s' sectors %d out of range (1-%d)",
+                        cfg.name, cfg.sectors, TWIST_OCCUPANCY_MAX_SECTORS);
+            valid = false;
+        }
+        if (cfg.slotMs < 30) {
+            // HC-SR04 echo timeout is 30 ms - a shorter slot lets pings overlap
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Distance array '%s' slotMs %d too short (min 30)", cfg.name, cfg.slotMs);
+            valid = false;
+        }
+        if (cfg.beamDeg <= 0.0f || cfg.beamDeg > 360.0f) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Distance array '%s' beamDeg out of range (0-360]", cfg.name);
+            valid = false;
+        }
+
+        uint8_t sensors = 0;
+        for (uint8_t j = 0; j < DISTANCE_ARRAY_SENSOR_COUNT; j++) {
+            if (DISTANCE_ARRAY_SENSOR_CONFIGS[j].arrayIndex == i) sensors++;
+        }
+        if (sensors == 0 || sensors > TWIST_OCCUPANCY_MAX_SOURCES) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Distance array '%s' has %d sensors (1-%d)",
+                        cfg.name, sensors, TWIST_OCCUPANCY_MAX_SOURCES);
+            valid = false;
+        }
+    }
+
+    for (uint8_t i = 0; i < DISTANCE_ARRAY_SENSOR_COUNT; i++) {
+        const auto& sensor = DISTANCE_ARRAY_SENSOR_CONFIGS[i];
+
+        if (sensor.arrayIndex >= DISTANCE_ARRAY_COUNT) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Distance array sensor %d references arrayIndex %d but only %d arrays configured",
+                        i, sensor.arrayIndex, DISTANCE_ARRAY_COUNT);
+            valid = false;
+        }
+
+        uint8_t pins[2] = {sensor.trigPin, sensor.echoPin};
+        for (uint8_t p = 0; p < 2; p++) {
+            for (uint8_t j = 0; j < usedPinCount; j++) {
+                if (usedPins[j] == pins[p]) {
+                    Logger::logf(Logger::Level::ERROR, "CONFIG", "GPIO pin collision: %d (distance array sensor %d conflicts with earlier pin)",
+                                pins[p], i);
+                    valid = false;
+                }
+            }
+            if (usedPinCount < MAX_GPIO_PINS) {
+                usedPins[usedPinCount++] = pins[p];
+            }
+        }
+    }
+
+    // ========================================================================
+    // Check 13: Analog Input Array Configuration
+    // ========================================================================
+    for (uint8_t i = 0; i < ANALOG_INPUT_ARRAY_COUNT; i++) {
+        const auto& cfg = ANALOG_INPUT_ARRAY_CONFIGS[i];
+
+        for (uint8_t j = 0; j < deviceIdCount; j++) {
+            if (deviceIds[j] == cfg.deviceId) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device ID collision: %d (analog array '%s' conflicts with earlier device)",
+                            cfg.deviceId, cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceIdCount < MAX_TOTAL_DEVICES) {
+            deviceIds[deviceIdCount++] = cfg.deviceId;
+        }
+
+        for (uint8_t j = 0; j < deviceNameCount; j++) {
+            if (strcmp(deviceNames[j], cfg.name) == 0) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "Device name collision: '%s' (analog array conflicts with earlier device)", cfg.name);
+                valid = false;
+            }
+        }
+        if (deviceNameCount < MAX_TOTAL_DEVICES) {
+            deviceNames[deviceNameCount++] = cfg.name;
+        }
+
+        uint8_t axes = 0;
+        for (uint8_t j = 0; j < ANALOG_AXIS_COUNT; j++) {
+            if (ANALOG_AXIS_CONFIGS[j].arrayIndex == i) axes++;
+        }
+        if (axes == 0 || axes > TWIST_ANALOG_MAX_AXES) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Analog array '%s' has %d axes (1-%d)",
+                        cfg.name, axes, TWIST_ANALOG_MAX_AXES);
+            valid = false;
+        }
+    }
+
+    for (uint8_t i = 0; i < ANALOG_AXIS_COUNT; i++) {
+        const auto& axis = ANALOG_AXIS_CONFIGS[i];
+
+        if (axis.arrayIndex >= ANALOG_INPUT_ARRAY_COUNT) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Analog axis %d references arrayIndex %d but only %d arrays configured",
+                        i, axis.arrayIndex, ANALOG_INPUT_ARRAY_COUNT);
+            valid = false;
+        }
+        if (axis.min >= axis.max || (axis.center != 0 && (axis.center <= axis.min || axis.center >= axis.max))) {
+            Logger::logf(Logger::Level::ERROR, "CONFIG", "Analog axis %d invalid calibration %d/%d/%d (need min < center < max, or center 0)",
+                        i, axis.min, axis.center, axis.max);
+            valid = false;
+        }
+
+        for (uint8_t j = 0; j < usedPinCount; j++) {
+            if (usedPins[j] == axis.pin) {
+                Logger::logf(Logger::Level::ERROR, "CONFIG", "GPIO pin collision: %d (analog axis %d conflicts with earlier pin)",
+                            axis.pin, i);
+                valid = false;
+            }
+        }
+        if (usedPinCount < MAX_GPIO_PINS) {
+            usedPins[usedPinCount++] = axis.pin;
+        }
+    }
+
     // ========================================================================
     // Final Result
     // ========================================================================
@@ -29,6 +29,13 @@ namespace TwiST {
  * 4. PWM frequency consistency (50Hz for servos)
  * 5. GPIO pin collision detection (no pin conflicts)
  * 6. Servo pwmDriverIndex range validation (no out-of-bounds)
+ * 7. LEDC pin assignments (driver type, resolution, pin collisions, servo coverage)
+ * 8. Stepper configuration (IDs, names, pin collisions, motion parameters)
+ * 9. Digital input configuration (IDs, names, pin collisions, debounce window)
+ * 10. Encoder configuration (IDs, names, pin collisions, pulse counter units)
+ * 11. DC servo configuration (IDs, names, encoder/PWM references, channel collisions)
+ * 12. Distance array configuration (IDs, names, sensor count/pins, sectors, slot time)
+ * 13. Analog input array configuration (IDs, names, axis count/pins, calibration)
  *
  * @return true if all safety checks pass, false otherwise
  * @note Prints detailed error messages to Serial on failure
@@ -0,0 +1,174 @@
+/* ============================================================================
+ * TwiST Framework | Host Tests
+ * ============================================================================
+ * @file      EventBridgeClient.h
+ * @brief     Reference PC-side peer for EventBridge over UDP
+ *
+ * PRINCIPLES:
+ * - Pure C++ framework code (EventCodec, WireFrame) plus POSIX sockets -
+ *   nothing from the Arduino stubs, so a dashboard can copy this file and
+ *   link the two codec sources
+ * - publish() packs events into WIRE_EVENTS frames; flush() sends every
+ *   frame of the call in one datagram, like the bridge does per tick
+ * - poll() drains every waiting datagram and hands out each event in order
+ * - The first datagram registers the client as the board's peer when the
+ *   board's UDPTransport replies to the last sender (hello())
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TEST_EVENT_BRIDGE_CLIENT_H
+#define TWIST_TEST_EVENT_BRIDGE_CLIENT_H
+
+#include "Core/EventCodec.h"
+#include "Core/WireFrame.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class EventBridgeClient {
+public:
+    typedef void (*Handler)(const TwiST::EventRecord& event, void* context);
+
+    // Datagram budget - keep at or below the board's TWIST_UDP_PACKET_SIZE
+    static const size_t MAX_DATAGRAM = 1024;
+
+    /**
+     * @param boardPort UDP port the board's EventBridge transport listens on
+     * @param boardIp Board address (dotted quad)
+     */
+    explicit EventBridgeClient(uint16_t boardPort, const char* boardIp = "127.0.0.1")
+        : _writer(TwiST::WireFrame::payload(_frame), TWIST_WIRE_MAX_PAYLOAD, 0),
+          _datagramLength(0), _sequence(0), _peerSequence(0), _hasPeerSequence(false),
+          _eventsSent(0), _eventsDropped(0), _eventsReceived(0), _datagramsSent(0), _sequenceGaps(0) {
+        _board = sockaddr_in();
+        _board.sin_family = AF_INET;
+        _board.sin_port = htons(boardPort);
+        inet_pton(AF_INET, boardIp, &_board.sin_addr);
+
+        _fd = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in local = sockaddr_in();
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (_fd >= 0 && bind(_fd, (sockaddr*)&local, sizeof(local)) != 0) {
+            close(_fd);
+            _fd = -1;
+        }
+    }
+
+    ~EventBridgeClient() {
+        if (_fd >= 0) close(_fd);
+    }
+
+    bool isOpen() const { return _fd >= 0; }
+
+    // Empty batch - makes a "reply to last sender" board learn this address
+    bool hello() {
+        appendFrame(true);
+        return flush() > 0;
+    }
+
+    /**
+     * @brief Queue one event for the next flush()
+     * @return false if the event does not fit this datagram (counted as dropped)
+     */
+    bool publish(const char* name, uint16_t sourceDeviceId, uint8_t priority, uint32_t timestamp) {
+        if (_writer.add(name, sourceDeviceId, priority, timestamp)) return true;
+        if (!appendFrame(false) || !_writer.add(name, sourceDeviceId, priority, timestamp)) {
+            _eventsDropped++;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Send every queued event as one datagram
+     * @return Bytes sent (0 = nothing queued or send failed)
+     */
+    size_t flush() {
+        appendFrame(false);
+        if (_datagramLength == 0 || _fd < 0) return 0;
+        ssize_t sent = sendto(_fd, _datagram, _datagramLength, 0, (const sockaddr*)&_board, sizeof(_board));
+        size_t length = _datagramLength;
+        _datagramLength = 0;
+        if (sent != (ssize_t)length) return 0;
+        _datagramsSent++;
+        return length;
+    }
+
+    /**
+     * @brief Receive every waiting datagram
+     * @return Events handed to the handler
+     */
+    size_t poll(Handler handler, void* context) {
+        uint8_t buffer[1500];
+        size_t events = 0;
+        ssize_t n;
+        while (_fd >= 0 && (n = recv(_fd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            for (ssize_t i = 0; i < n; i++) {
+                if (!_parser.feed(buffer[i]) || _parser.type() != TwiST::WIRE_EVENTS) continue;
+
+                TwiST::EventBatchReader reader(_parser.payload(), _parser.length());
+                if (!reader.isValid()) continue;
+                if (_hasPeerSequence && reader.getSequence() != (uint16_t)(_peerSequence + 1)) _sequenceGaps++;
+                _peerSequence = reader.getSequence();
+                _hasPeerSequence = true;
+
+                TwiST::EventRecord record;
+                while (reader.next(record)) {
+                    _eventsReceived++;
+                    events++;
+                    if (handler) handler(record, context);
+                }
+            }
+        }
+        return events;
+    }
+
+    unsigned long getEventsSent() const { return _eventsSent; }
+    unsigned long getEventsDropped() const { return _eventsDropped; }
+    unsigned long getEventsReceived() const { return _eventsReceived; }
+    unsigned long getDatagramsSent() const { return _datagramsSent; }
+    unsigned long getSequenceGapCount() const { return _sequenceGaps; }
+    unsigned long getCrcErrorCount() const { return _parser.getCrcErrorCount(); }
+
+private:
+    int _fd;
+    sockaddr_in _board;
+    uint8_t _frame[TwiST::WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+    TwiST::EventBatchWriter _writer;
+    uint8_t _datagram[MAX_DATAGRAM];
+    size_t _datagramLength;
+    uint16_t _sequence;
+    TwiST::WireFrameParser _parser;
+    uint16_t _peerSequence;
+    bool _hasPeerSequence;
+
+    unsigned long _eventsSent;
+    unsigned long _eventsDropped;
+    unsigned long _eventsReceived;
+    unsigned long _datagramsSent;
+    unsigned long _sequenceGaps;
+
+    // Move the frame being filled into the datagram; false if it does not fit
+    bool appendFrame(bool evenIfEmpty) {
+        uint8_t count = _writer.getCount();
+        if (count == 0 && !evenIfEmpty) return true;
+
+        size_t length = TwiST::WireFrame::finalize(_frame, TwiST::WIRE_EVENTS, (uint16_t)_writer.length());
+        if (_datagramLength + length > sizeof(_datagram)) return false;
+        memcpy(_datagram + _datagramLength, _frame, length);
+        _datagramLength += length;
+        _eventsSent += count;
+        _writer = TwiST::EventBatchWriter(TwiST::WireFrame::payload(_frame), TWIST_WIRE_MAX_PAYLOAD, ++_sequence);
+        return true;
+    }
+};
+
+#endif // TWIST_TEST_EVENT_BRIDGE_CLIENT_H
@@ -0,0 +1,53 @@
+/* ============================================================================
+ * TwiST Framework | Host Tests
+ * ============================================================================
+ * @file      FakeOutputDevice.h
+ * @brief     IOutputDevice that records setValue() / moveTo() calls
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TEST_FAKE_OUTPUT_DEVICE_H
+#define TWIST_TEST_FAKE_OUTPUT_DEVICE_H
+
+#include "Interfaces/IOutputDevice.h"
+
+struct FakeOutputDevice : TwiST::IOutputDevice {
+    uint16_t id;
+    float value = 0.0f;
+    float target = 0.0f;
+    unsigned long duration = 0;
+    int sets = 0;
+    int moves = 0;
+    bool moving = false;
+
+    explicit FakeOutputDevice(uint16_t deviceId = 1) : id(deviceId) {}
+
+    bool initialize() override { return true; }
+    void shutdown() override {}
+    void update() override {}
+    TwiST::DeviceInfo getInfo() const override { return {"Fake", "Fake", id, TwiST::CAP_OUTPUT, 1}; }
+    const char* getName() const override { return "Fake"; }
+    uint16_t getCapabilities() const override { return TwiST::CAP_OUTPUT; }
+    bool hasCapability(TwiST::DeviceCapability cap) const override { return cap == TwiST::CAP_OUTPUT; }
+    TwiST::DeviceState getState() const override { return TwiST::STATE_READY; }
+    void enable() override {}
+    void disable() override {}
+    bool isEnabled() const override { return true; }
+    bool configure(const JsonDocument&) override { return true; }
+    void getConfiguration(JsonDocument&) const override {}
+    void toJson(JsonDocument&) const override {}
+    bool fromJson(const JsonDocument&) override { return true; }
+
+    void setValue(float v) override { value = v; sets++; }
+    void setNormalized(float) override {}
+    void moveTo(float t, unsigned long ms) override { target = t; duration = ms; moves++; }
+    float getValue() const override { return value; }
+    bool isMoving() const override { return moving; }
+};
+
+#endif // TWIST_TEST_FAKE_OUTPUT_DEVICE_H
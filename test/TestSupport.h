@@ -0,0 +1,70 @@
+/* ============================================================================
+ * TwiST Framework | Host Tests
+ * ============================================================================
+ * @file      TestSupport.h
+ * @brief     Minimal assertion macros for the host test binaries
+ *
+ * PRINCIPLES:
+ * - No test framework dependency: each test_*.cpp is one executable whose
+ *   main() runs its cases and returns TEST_RESULT()
+ * - A failed CHECK prints file:line and the expression, then continues -
+ *   one run shows every broken expectation
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TEST_SUPPORT_H
+#define TWIST_TEST_SUPPORT_H
+
+#include "HostStubs.h"
+#include <math.h>
+#include <stdio.h>
+
+namespace TestSupport {
+    inline int& failures() { static int count = 0; return count; }
+    inline int& checks() { static int count = 0; return count; }
+}
+
+#define CHECK(cond) do { \
+        TestSupport::checks()++; \
+        if (!(cond)) { \
+            TestSupport::failures()++; \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+        TestSupport::checks()++; \
+        long long a_ = (long long)(actual), e_ = (long long)(expected); \
+        if (a_ != e_) { \
+            TestSupport::failures()++; \
+            printf("  FAIL %s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance) do { \
+        TestSupport::checks()++; \
+        double a_ = (double)(actual), e_ = (double)(expected); \
+        if (!(fabs(a_ - e_) <= (double)(tolerance))) { \
+            TestSupport::failures()++; \
+            printf("  FAIL %s:%d: %s == %g, expected %g +/- %g\n", __FILE__, __LINE__, #actual, a_, e_, (double)(tolerance)); \
+        } \
+    } while (0)
+
+// Run one case: RUN_TEST(attachRejectsDuplicateChannel);
+#define RUN_TEST(fn) do { \
+        int before_ = TestSupport::failures(); \
+        fn(); \
+        printf("%s %s\n", TestSupport::failures() == before_ ? "  ok  " : "  FAILED", #fn); \
+    } while (0)
+
+// main() return value: 0 if every check passed
+#define TEST_RESULT() ( \
+        printf("%d checks, %d failed\n", TestSupport::checks(), TestSupport::failures()), \
+        TestSupport::failures() == 0 ? 0 : 1)
+
+#endif // TWIST_TEST_SUPPORT_H
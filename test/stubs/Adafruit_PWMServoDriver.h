@@ -0,0 +1,4 @@
+#pragma once
+#include "Wire.h"
+class Adafruit_PWMServoDriver { public: Adafruit_PWMServoDriver(uint8_t = 0x40, TwoWire& = Wire); bool begin(); uint8_t setPWM(uint8_t, uint16_t, uint16_t); void setPWMFreq(float); };
+#define PCA9685_LED0_ON_L 0x06
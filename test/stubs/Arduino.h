@@ -0,0 +1,75 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <cstdlib>
+#include <algorithm>
+using std::abs;
+typedef bool boolean;
+typedef uint8_t byte;
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+#define IRAM_ATTR
+#define DRAM_ATTR
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long);
+void delayMicroseconds(unsigned int);
+void pinMode(uint8_t, uint8_t);
+void digitalWrite(uint8_t, uint8_t);
+int digitalRead(uint8_t);
+uint16_t analogRead(uint8_t);
+void analogReadResolution(uint8_t);
+unsigned long pulseIn(uint8_t, uint8_t, unsigned long);
+void attachInterrupt(uint8_t, void(*)(void), int);
+void attachInterruptArg(uint8_t, void(*)(void*), void*, int);
+void detachInterrupt(uint8_t);
+uint8_t digitalPinToInterrupt(uint8_t);
+void yield();
+void noInterrupts();
+void interrupts();
+class Print {
+public:
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t* b, size_t n) { for (size_t i=0;i<n;i++) write(b[i]); return n; }
+  size_t print(const char*); size_t print(char); size_t print(unsigned long); size_t print(long); size_t print(int); size_t print(float, int=2);
+  size_t println(const char* = ""); size_t println(unsigned long); size_t println(int); size_t println(float, int=2);
+  size_t printf(const char*, ...);
+  virtual void flush() {}
+  virtual int availableForWrite() { return 0; }
+};
+class Stream : public Print {
+public:
+  virtual int available() = 0; virtual int read() = 0; virtual int peek() = 0;
+  size_t readBytes(uint8_t*, size_t);
+};
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long);
+  size_t write(uint8_t) override; int available() override; int read() override; int peek() override;
+  using Print::write;
+};
+extern HardwareSerial Serial;
+class String { public: String(const char* = ""); const char* c_str() const; };
+typedef struct hw_timer_s hw_timer_t;
+hw_timer_t* timerBegin(uint32_t);
+void timerAttachInterruptArg(hw_timer_t*, void(*)(void*), void*);
+void timerAlarm(hw_timer_t*, uint64_t, bool, uint64_t);
+uint64_t timerRead(hw_timer_t*);
+void timerStop(hw_timer_t*);
+void timerStart(hw_timer_t*);
+typedef struct { uint32_t owner; uint32_t count; } portMUX_TYPE;
+#define portMUX_INITIALIZE(m) ((m)->owner = 0, (m)->count = 0)
+void portENTER_CRITICAL(portMUX_TYPE*);
+void portEXIT_CRITICAL(portMUX_TYPE*);
+void portENTER_CRITICAL_ISR(portMUX_TYPE*);
+void portEXIT_CRITICAL_ISR(portMUX_TYPE*);
@@ -0,0 +1,85 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+class JsonArray; class JsonObject;
+class JsonVariant {
+public:
+  JsonVariant() {}
+  template<typename T> operator T() const { return T(); }
+  template<typename T> T as() const { return T(); }
+  template<typename T> bool is() const { return false; }
+  template<typename T> JsonVariant& operator=(const T&) { return *this; }
+  JsonVariant operator[](const char*) const { return JsonVariant(); }
+  JsonVariant operator[](int) const { return JsonVariant(); }
+  bool containsKey(const char*) const { return false; }
+  template<typename T> bool set(const T&) { return true; }
+  template<typename T> bool add(const T&) { return true; }
+  JsonArray createNestedArray(const char* = nullptr);
+  JsonObject createNestedObject(const char* = nullptr);
+  bool isNull() const { return true; }
+  size_t size() const { return 0; }
+};
+class JsonObject : public JsonVariant {};
+class JsonArray : public JsonVariant {
+public:
+  JsonVariant* begin() const { return nullptr; } JsonVariant* end() const { return nullptr; }
+  JsonObject createNestedObject() { return JsonObject(); }
+  JsonArray createNestedArray() { return JsonArray(); }
+};
+inline JsonArray JsonVariant::createNestedArray(const char*) { return JsonArray(); }
+inline JsonObject JsonVariant::createNestedObject(const char*) { return JsonObject(); }
+// ESP32 (32-bit) slot size
+#define JSON_OBJECT_SIZE(n) ((n) * 16)
+// Top-level members are modelled: written numbers are kept for tests, char* keys are
+// copied into the pool like ArduinoJson does, and a write that does not fit sets
+// overflowed() and is dropped. Reads still return T().
+class JsonDocument : public JsonVariant {
+public:
+  struct Member : JsonVariant {
+    JsonDocument* doc; const char* key; bool copyKey;
+    Member(JsonDocument* d, const char* k, bool c) : doc(d), key(k), copyKey(c) {}
+    template<typename T> Member& operator=(const T& value) {
+      if constexpr (std::is_arithmetic<T>::value) doc->hostWrite(key, copyKey, (double)value);
+      return *this;
+    }
+  };
+  using JsonVariant::operator[];
+  Member operator[](const char* key) { return Member(this, key, false); }
+  Member operator[](char* key) { return Member(this, key, true); }
+  void clear() { _members.clear(); _used = 0; _overflowed = false; }
+  size_t memoryUsage() const { return _used; }
+  size_t capacity() const { return _capacity; }
+  bool overflowed() const { return _overflowed; }
+  template<typename T> JsonObject to() { clear(); return JsonObject(); }
+  // Host inspection
+  size_t hostMemberCount() const { return _members.size(); }
+  bool hostMember(const char* key, double& value) const {
+    for (const auto& m : _members) if (m.first == key) { value = m.second; return true; }
+    return false;
+  }
+  void hostWrite(const char* key, bool copyKey, double value) {
+    for (auto& m : _members) if (m.first == key) { m.second = value; return; }
+    size_t need = JSON_OBJECT_SIZE(1) + (copyKey ? strlen(key) + 1 : 0);
+    if (_used + need > _capacity) { _overflowed = true; return; }
+    _used += need;
+    _members.push_back(std::make_pair(std::string(key), value));
+  }
+protected:
+  explicit JsonDocument(size_t capacity = 0) : _capacity(capacity) {}
+private:
+  std::vector<std::pair<std::string, double> > _members;
+  size_t _capacity, _used = 0;
+  bool _overflowed = false;
+};
+template<size_t N> class StaticJsonDocument : public JsonDocument { public: StaticJsonDocument() : JsonDocument(N) {} };
+class DynamicJsonDocument : public JsonDocument { public: DynamicJsonDocument(size_t capacity) : JsonDocument(capacity) {} };
+struct DeserializationError { operator bool() const { return false; } const char* c_str() const { return ""; } };
+template<typename S> DeserializationError deserializeJson(JsonDocument&, S&) { return {}; }
+template<typename S> size_t serializeJson(const JsonDocument&, S&) { return 0; }
+template<typename S> size_t serializeJsonPretty(const JsonDocument&, S&) { return 0; }
+size_t serializeJson(const JsonDocument&, char*, size_t);
@@ -0,0 +1,7 @@
+#pragma once
+#include "Arduino.h"
+class File : public Stream { public:
+  operator bool() const; void close(); size_t size(); bool seek(size_t); size_t position();
+  size_t write(uint8_t) override; size_t write(const uint8_t*, size_t) override; int available() override; int read() override; int peek() override; size_t read(uint8_t*, size_t);
+  using Print::write; };
+namespace fs { class FS { public: File open(const char*, const char* = "r", bool = false); bool exists(const char*); bool remove(const char*); bool mkdir(const char*); }; }
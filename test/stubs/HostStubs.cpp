@@ -0,0 +1,465 @@
+#include "HostStubs.h"
+#include <Adafruit_PWMServoDriver.h>
+#include <LittleFS.h>
+#include <Preferences.h>
+#include <WiFiUdp.h>
+#include <Wire.h>
+#include <ArduinoJson.h>
+#include <driver/gpio.h>
+#include <driver/pulse_cnt.h>
+#include <esp_heap_caps.h>
+#include <esp_rom_sys.h>
+#include <esp_sleep.h>
+#include <esp_task_wdt.h>
+#include <freertos/task.h>
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <mutex>
+
+namespace Host {
+
+    uint64_t clockUs = 1000000ULL;      // Start at 1 s - 0 reads as "never" in several modules
+    bool trapHalt = false;
+
+    std::string serialOutput;
+    bool echoSerial = getenv("TWIST_TEST_VERBOSE") != NULL;
+    std::string romOutput;
+
+    LedcTimer ledcTimers[LEDC_TIMER_MAX];
+    LedcChannel ledcChannels[SOC_LEDC_CHANNEL_NUM];
+
+    void resetLedc() {
+        for (auto& t : ledcTimers) t = LedcTimer{false, 0, 0};
+        for (auto& c : ledcChannels) c = LedcChannel{-1, 0, 0, 0};
+    }
+
+    AdafruitChannel adafruitChannels[16];
+    unsigned long adafruitWrites = 0;
+
+    void resetAdafruit() {
+        for (auto& c : adafruitChannels) c = AdafruitChannel{0, 0, 0};
+        adafruitWrites = 0;
+    }
+
+    size_t heapFree = 200000;
+    size_t heapLargestBlock = 100000;
+
+    bool taskCreateSucceeds = false;
+
+    // Stands in for a single-core critical section when tests use threads
+    static std::recursive_mutex criticalSection;
+
+    static struct LedcInit { LedcInit() { resetLedc(); } } ledcInit;
+
+}  // namespace Host
+
+// ============================================================================
+// Arduino core
+// ============================================================================
+
+unsigned long millis() { return (unsigned long)(Host::clockUs / 1000ULL); }
+unsigned long micros() { return (unsigned long)Host::clockUs; }
+
+void delay(unsigned long ms) {
+    if (Host::trapHalt) throw Host::Halted();
+    Host::advanceMs(ms);
+}
+
+void delayMicroseconds(unsigned int us) { Host::advanceUs(us); }
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return LOW; }
+uint16_t analogRead(uint8_t) { return 0; }
+void analogReadResolution(uint8_t) {}
+unsigned long pulseIn(uint8_t, uint8_t, unsigned long) { return 0; }
+void attachInterrupt(uint8_t, void (*)(void), int) {}
+void attachInterruptArg(uint8_t, void (*)(void*), void*, int) {}
+void detachInterrupt(uint8_t) {}
+uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+void noInterrupts() {}
+void interrupts() {}
+
+void portENTER_CRITICAL(portMUX_TYPE*) { Host::criticalSection.lock(); }
+void portEXIT_CRITICAL(portMUX_TYPE*) { Host::criticalSection.unlock(); }
+void portENTER_CRITICAL_ISR(portMUX_TYPE*) { Host::criticalSection.lock(); }
+void portEXIT_CRITICAL_ISR(portMUX_TYPE*) { Host::criticalSection.unlock(); }
+
+static char hostTimer;
+static void (*timerIsr)(void*) = NULL;
+static void* timerIsrArg = NULL;
+
+namespace Host {
+    bool timerArmed = false;
+    uint64_t timerAlarmAt = 0;
+    unsigned long timerAlarmsInPast = 0;
+
+    bool fireTimer() {
+        if (!timerArmed || timerIsr == NULL) return false;
+        if (clockUs < timerAlarmAt) clockUs = timerAlarmAt;
+        timerArmed = false;
+        timerIsr(timerIsrArg);
+        return true;
+    }
+}
+
+hw_timer_t* timerBegin(uint32_t) { return reinterpret_cast<hw_timer_t*>(&hostTimer); }
+void timerAttachInterruptArg(hw_timer_t*, void (*isr)(void*), void* arg) {
+    timerIsr = isr;
+    timerIsrArg = arg;
+}
+void timerAlarm(hw_timer_t*, uint64_t tick, bool, uint64_t) {
+    if (tick <= Host::clockUs) Host::timerAlarmsInPast++;
+    Host::timerAlarmAt = tick;
+    Host::timerArmed = true;
+}
+uint64_t timerRead(hw_timer_t*) { return Host::clockUs; }
+void timerStop(hw_timer_t*) {}
+void timerStart(hw_timer_t*) {}
+
+// ===== Print / Stream =====
+
+static size_t printText(Print& out, const char* text) {
+    return out.write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+}
+
+size_t Print::print(const char* s) { return printText(*this, s); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(unsigned long v) { return printf("%lu", v); }
+size_t Print::print(long v) { return printf("%ld", v); }
+size_t Print::print(int v) { return printf("%d", v); }
+size_t Print::print(float v, int digits) { return printf("%.*f", digits, (double)v); }
+size_t Print::println(const char* s) { return print(s) + print("\r\n"); }
+size_t Print::println(unsigned long v) { return print(v) + print("\r\n"); }
+size_t Print::println(int v) { return print(v) + print("\r\n"); }
+size_t Print::println(float v, int digits) { return print(v, digits) + print("\r\n"); }
+
+size_t Print::printf(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return printText(*this, buffer);
+}
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = read();
+        if (c < 0) break;
+        buffer[count++] = (uint8_t)c;
+    }
+    return count;
+}
+
+void HardwareSerial::begin(unsigned long) {}
+
+size_t HardwareSerial::write(uint8_t c) {
+    Host::serialOutput.push_back((char)c);
+    if (Host::echoSerial) putchar(c);
+    return 1;
+}
+
+int HardwareSerial::available() { return 0; }
+int HardwareSerial::read() { return -1; }
+int HardwareSerial::peek() { return -1; }
+
+HardwareSerial Serial;
+
+String::String(const char*) {}
+const char* String::c_str() const { return ""; }
+
+// ============================================================================
+// Libraries
+// ============================================================================
+
+size_t serializeJson(const JsonDocument&, char* out, size_t size) {
+    if (size > 0) out[0] = '\0';
+    return 0;
+}
+
+// ===== Wire =====
+
+bool TwoWire::begin(int, int) { return true; }
+void TwoWire::setClock(uint32_t) {}
+void TwoWire::beginTransmission(uint8_t) {}
+uint8_t TwoWire::endTransmission(bool) { return 0; }
+size_t TwoWire::write(uint8_t) { return 1; }
+int TwoWire::available() { return 0; }
+int TwoWire::read() { return -1; }
+int TwoWire::peek() { return -1; }
+uint8_t TwoWire::requestFrom(uint8_t, uint8_t) { return 0; }
+TwoWire Wire;
+
+// ===== Adafruit PCA9685 =====
+
+Adafruit_PWMServoDriver::Adafruit_PWMServoDriver(uint8_t, TwoWire&) {}
+bool Adafruit_PWMServoDriver::begin() { return true; }
+void Adafruit_PWMServoDriver::setPWMFreq(float) {}
+
+uint8_t Adafruit_PWMServoDriver::setPWM(uint8_t channel, uint16_t on, uint16_t off) {
+    if (channel < 16) {
+        Host::adafruitChannels[channel].on = on;
+        Host::adafruitChannels[channel].off = off;
+        Host::adafruitChannels[channel].writes++;
+    }
+    Host::adafruitWrites++;
+    return 0;
+}
+
+// ===== LittleFS / Preferences (no storage) =====
+
+File::operator bool() const { return false; }
+void File::close() {}
+size_t File::size() { return 0; }
+bool File::seek(size_t) { return false; }
+size_t File::position() { return 0; }
+size_t File::write(uint8_t) { return 0; }
+size_t File::write(const uint8_t*, size_t) { return 0; }
+int File::available() { return 0; }
+int File::read() { return -1; }
+int File::peek() { return -1; }
+size_t File::read(uint8_t*, size_t) { return 0; }
+
+File fs::FS::open(const char*, const char*, bool) { return File(); }
+bool fs::FS::exists(const char*) { return false; }
+bool fs::FS::remove(const char*) { return false; }
+bool fs::FS::mkdir(const char*) { return false; }
+
+bool LittleFSFS::begin(bool) { return true; }
+size_t LittleFSFS::totalBytes() { return 0; }
+size_t LittleFSFS::usedBytes() { return 0; }
+LittleFSFS LittleFS;
+
+bool Preferences::begin(const char*, bool) { return true; }
+void Preferences::end() {}
+
+// ===== WiFi (never connected; UDP goes over the host loopback) =====
+
+IPAddress::IPAddress() : _address(0) {}
+IPAddress::IPAddress(uint32_t address) : _address(address) {}
+IPAddress::IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    : _address((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+IPAddress::operator uint32_t() const { return _address; }
+
+IPAddress WiFiClass::localIP() { return IPAddress(127, 0, 0, 1); }
+int WiFiClass::status() { return 0; }
+WiFiClass WiFi;
+
+namespace Host {
+    uint16_t udpBoundPort = 0;
+}
+
+// IPAddress keeps octets in memory order, which is what s_addr holds
+WiFiUDP::WiFiUDP()
+    : _fd(-1), _rxLength(0), _rxPosition(0), _remoteIp(0), _remotePort(0), _txLength(0), _txIp(0), _txPort(0) {}
+WiFiUDP::~WiFiUDP() { stop(); }
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+    stop();
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0) return 0;
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(port);
+    socklen_t size = sizeof(local);
+    if (bind(_fd, (sockaddr*)&local, sizeof(local)) != 0 || getsockname(_fd, (sockaddr*)&local, &size) != 0) {
+        stop();
+        return 0;
+    }
+    Host::udpBoundPort = ntohs(local.sin_port);
+    return 1;
+}
+
+void WiFiUDP::stop() {
+    if (_fd >= 0) close(_fd);
+    _fd = -1;
+    _rxLength = _rxPosition = 0;
+}
+
+int WiFiUDP::parsePacket() {
+    _rxLength = _rxPosition = 0;
+    if (_fd < 0) return 0;
+    sockaddr_in from = {};
+    socklen_t size = sizeof(from);
+    ssize_t n = recvfrom(_fd, _rx, sizeof(_rx), MSG_DONTWAIT, (sockaddr*)&from, &size);
+    if (n <= 0) return 0;
+    _rxLength = (int)n;
+    _remoteIp = from.sin_addr.s_addr;
+    _remotePort = ntohs(from.sin_port);
+    return _rxLength;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t length) {
+    int n = available();
+    if ((size_t)n > length) n = (int)length;
+    memcpy(buffer, _rx + _rxPosition, n);
+    _rxPosition += n;
+    return n;
+}
+
+IPAddress WiFiUDP::remoteIP() { return IPAddress(_remoteIp); }
+uint16_t WiFiUDP::remotePort() { return _remotePort; }
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+    _txIp = (uint32_t)ip;
+    _txPort = port;
+    _txLength = 0;
+    return _fd >= 0 ? 1 : 0;
+}
+
+int WiFiUDP::endPacket() {
+    if (_fd < 0) return 0;
+    sockaddr_in to = {};
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = _txIp;
+    to.sin_port = htons(_txPort);
+    ssize_t sent = sendto(_fd, _tx, _txLength, 0, (sockaddr*)&to, sizeof(to));
+    _txLength = 0;
+    return sent >= 0 ? 1 : 0;
+}
+
+size_t WiFiUDP::write(uint8_t c) { return write(&c, 1); }
+size_t WiFiUDP::write(const uint8_t* data, size_t length) {
+    if (length > sizeof(_tx) - _txLength) length = sizeof(_tx) - _txLength;
+    memcpy(_tx + _txLength, data, length);
+    _txLength += length;
+    return length;
+}
+int WiFiUDP::available() { return _rxLength - _rxPosition; }
+int WiFiUDP::read() { return available() > 0 ? _rx[_rxPosition++] : -1; }
+int WiFiUDP::peek() { return available() > 0 ? _rx[_rxPosition] : -1; }
+
+// ============================================================================
+// ESP-IDF
+// ============================================================================
+
+// ===== LEDC =====
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* config) {
+    if (config->timer_num >= LEDC_TIMER_MAX) return -1;
+    Host::ledcTimers[config->timer_num] =
+        Host::LedcTimer{true, config->freq_hz, (uint8_t)config->duty_resolution};
+    return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* config) {
+    if ((int)config->channel >= SOC_LEDC_CHANNEL_NUM) return -1;
+    Host::LedcChannel& channel = Host::ledcChannels[config->channel];
+    channel.gpio = config->gpio_num;
+    channel.timer = (uint8_t)config->timer_sel;
+    channel.duty = config->duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t, ledc_channel_t channel, uint32_t duty) {
+    if ((int)channel >= SOC_LEDC_CHANNEL_NUM) return -1;
+    Host::ledcChannels[channel].duty = duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t, ledc_channel_t channel) {
+    if ((int)channel >= SOC_LEDC_CHANNEL_NUM) return -1;
+    Host::ledcChannels[channel].updates++;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_freq(ledc_mode_t, ledc_timer_t timer, uint32_t freqHz) {
+    if (timer >= LEDC_TIMER_MAX) return -1;
+    Host::ledcTimers[timer].freqHz = freqHz;
+    return ESP_OK;
+}
+
+esp_err_t ledc_stop(ledc_mode_t, ledc_channel_t channel, uint32_t idleLevel) {
+    if ((int)channel >= SOC_LEDC_CHANNEL_NUM) return -1;
+    Host::ledcChannels[channel].duty = idleLevel ? 1 : 0;
+    return ESP_OK;
+}
+
+// ===== Pulse counter (no units available) =====
+
+esp_err_t pcnt_new_unit(const pcnt_unit_config_t*, pcnt_unit_handle_t*) { return -1; }
+esp_err_t pcnt_del_unit(pcnt_unit_handle_t) { return ESP_OK; }
+esp_err_t pcnt_unit_set_glitch_filter(pcnt_unit_handle_t, const pcnt_glitch_filter_config_t*) { return ESP_OK; }
+esp_err_t pcnt_new_channel(pcnt_unit_handle_t, const pcnt_chan_config_t*, pcnt_channel_handle_t*) { return -1; }
+esp_err_t pcnt_del_channel(pcnt_channel_handle_t) { return ESP_OK; }
+esp_err_t pcnt_channel_set_edge_action(pcnt_channel_handle_t, pcnt_channel_edge_action_t, pcnt_channel_edge_action_t) { return ESP_OK; }
+esp_err_t pcnt_channel_set_level_action(pcnt_channel_handle_t, pcnt_channel_level_action_t, pcnt_channel_level_action_t) { return ESP_OK; }
+esp_err_t pcnt_unit_add_watch_point(pcnt_unit_handle_t, int) { return ESP_OK; }
+esp_err_t pcnt_unit_enable(pcnt_unit_handle_t) { return ESP_OK; }
+esp_err_t pcnt_unit_disable(pcnt_unit_handle_t) { return ESP_OK; }
+esp_err_t pcnt_unit_start(pcnt_unit_handle_t) { return ESP_OK; }
+esp_err_t pcnt_unit_stop(pcnt_unit_handle_t) { return ESP_OK; }
+esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t) { return ESP_OK; }
+esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t, int* count) { *count = 0; return ESP_OK; }
+
+// ===== GPIO / sleep / watchdog / registers =====
+
+esp_err_t gpio_pullup_en(gpio_num_t) { return ESP_OK; }
+esp_err_t gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) { return ESP_OK; }
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) { return ESP_OK; }
+esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+esp_err_t esp_light_sleep_start() { return ESP_OK; }
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return ESP_SLEEP_WAKEUP_TIMER; }
+
+esp_err_t esp_task_wdt_init(const esp_task_wdt_config_t*) { return ESP_OK; }
+esp_err_t esp_task_wdt_reconfigure(const esp_task_wdt_config_t*) { return ESP_OK; }
+esp_err_t esp_task_wdt_add(void*) { return ESP_OK; }
+esp_err_t esp_task_wdt_delete(void*) { return ESP_OK; }
+esp_err_t esp_task_wdt_reset(void) { return ESP_OK; }
+
+namespace Host {
+    uint32_t gpioOut = 0;
+    std::vector<GpioWrite> gpioWrites;
+}
+
+void reg_write(uint32_t reg, uint32_t value) {
+    if (reg == GPIO_OUT_W1TS_REG) Host::gpioOut |= value;
+    else if (reg == GPIO_OUT_W1TC_REG) Host::gpioOut &= ~value;
+    else return;
+    Host::gpioWrites.push_back({Host::clockUs, reg == GPIO_OUT_W1TS_REG, value});
+}
+uint32_t reg_read(uint32_t) { return 0; }
+
+extern "C" int esp_rom_printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    Host::romOutput += buffer;
+    return length;
+}
+
+size_t heap_caps_get_free_size(uint32_t) { return Host::heapFree; }
+size_t heap_caps_get_minimum_free_size(uint32_t) { return Host::heapFree; }
+size_t heap_caps_get_largest_free_block(uint32_t) { return Host::heapLargestBlock; }
+
+// ===== FreeRTOS (no scheduler - workers stay inline) =====
+
+BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t* handle) {
+    if (!Host::taskCreateSucceeds) return pdFALSE;
+    if (handle) *handle = reinterpret_cast<TaskHandle_t>(2);       // Tests call the worker body themselves
+    return pdPASS;
+}
+void vTaskDelete(TaskHandle_t) {}
+void vTaskDelay(TickType_t ticks) { Host::advanceMs(ticks); }
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t ticks) {     // Nobody notifies: bounded waits time out
+    if (ticks != portMAX_DELAY) Host::advanceMs(ticks);
+    return 0;
+}
+BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t*) {}
+TaskHandle_t xTaskGetCurrentTaskHandle() { return reinterpret_cast<TaskHandle_t>(1); }
@@ -0,0 +1,115 @@
+/* ============================================================================
+ * TwiST Framework | Host Tests
+ * ============================================================================
+ * @file      HostStubs.h
+ * @brief     Observable state behind the Arduino / ESP-IDF host stubs
+ *
+ * PRINCIPLES:
+ * - One definition of every stubbed platform symbol (HostStubs.cpp) -
+ *   tests never redefine millis(), Serial or ledc_*()
+ * - Time is simulated: micros() returns Host::clockUs, nothing sleeps
+ * - Hardware that tests must observe (LEDC, Adafruit PCA9685, heap) keeps
+ *   its last state here
+ *
+ * AUTHOR:    Voldemaras Birskys
+ * EMAIL:     voldemaras@gmail.com
+ * PROJECT:   TwiST Framework
+ * VERSION:   1.3.0
+ * ============================================================================
+ */
+
+#ifndef TWIST_TEST_HOST_STUBS_H
+#define TWIST_TEST_HOST_STUBS_H
+
+#include <Arduino.h>
+#include <driver/ledc.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Host {
+
+    // ===== Simulated Clock =====
+
+    extern uint64_t clockUs;                    // micros() / millis() source
+
+    inline void advanceUs(uint64_t us) { clockUs += us; }
+    inline void advanceMs(uint64_t ms) { clockUs += ms * 1000ULL; }
+
+    // ===== Hardware Timer (one tick per clockUs microsecond) =====
+
+    extern bool timerArmed;                     // One-shot alarm pending
+    extern uint64_t timerAlarmAt;               // Its absolute tick
+    extern unsigned long timerAlarmsInPast;     // Armed at or before the current tick - would never fire
+    bool fireTimer();                           // Jump the clock to the alarm and run the ISR; false if none
+
+    // ===== GPIO Set / Clear Registers =====
+
+    struct GpioWrite {
+        uint64_t tick;                          // clockUs at the write
+        bool set;                               // GPIO_OUT_W1TS_REG, else W1TC
+        uint32_t mask;
+    };
+    extern uint32_t gpioOut;                    // GPIO 0-31 levels after REG_WRITE()
+    extern std::vector<GpioWrite> gpioWrites;
+
+    // ===== Halt Trap =====
+
+    // Thrown by delay() while trapHalt is set - turns Logger::fatal()'s
+    // endless halt loop into something a test can catch
+    struct Halted {};
+    extern bool trapHalt;
+
+    // ===== Serial =====
+
+    extern std::string serialOutput;            // Everything printed to Serial
+    extern bool echoSerial;                     // Also copy to stdout (TWIST_TEST_VERBOSE=1)
+    extern std::string romOutput;               // esp_rom_printf() (ISR-safe print)
+
+    // ===== LEDC =====
+
+    struct LedcTimer {
+        bool configured;
+        uint32_t freqHz;
+        uint8_t bits;
+    };
+
+    struct LedcChannel {
+        int gpio;                               // -1 = not configured
+        uint8_t timer;
+        uint32_t duty;                          // Last ledc_set_duty()
+        unsigned long updates;                  // ledc_update_duty() calls
+    };
+
+    extern LedcTimer ledcTimers[LEDC_TIMER_MAX];
+    extern LedcChannel ledcChannels[SOC_LEDC_CHANNEL_NUM];
+    void resetLedc();
+
+    // ===== Adafruit_PWMServoDriver (blocking PCA9685 path) =====
+
+    struct AdafruitChannel {
+        uint16_t on;
+        uint16_t off;
+        unsigned long writes;
+    };
+
+    extern AdafruitChannel adafruitChannels[16];
+    extern unsigned long adafruitWrites;
+    void resetAdafruit();
+
+    // ===== WiFiUDP (real 127.0.0.1 sockets) =====
+
+    extern uint16_t udpBoundPort;               // Port the last WiFiUDP::begin() bound (0 asks the OS)
+
+    // ===== Heap =====
+
+    extern size_t heapFree;                     // heap_caps_get_free_size()
+    extern size_t heapLargestBlock;
+
+    // ===== FreeRTOS =====
+
+    extern bool taskCreateSucceeds;             // xTaskCreate() hands out a handle; the task never runs
+
+}  // namespace Host
+
+#endif // TWIST_TEST_HOST_STUBS_H
@@ -0,0 +1,4 @@
+#pragma once
+#include "FS.h"
+class LittleFSFS : public fs::FS { public: bool begin(bool = false); size_t totalBytes(); size_t usedBytes(); };
+extern LittleFSFS LittleFS;
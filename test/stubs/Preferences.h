@@ -0,0 +1,2 @@
+#pragma once
+class Preferences { public: bool begin(const char*, bool); void end(); };
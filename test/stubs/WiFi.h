@@ -0,0 +1,6 @@
+#pragma once
+#include "Arduino.h"
+class IPAddress { public: IPAddress(); IPAddress(uint32_t); IPAddress(uint8_t,uint8_t,uint8_t,uint8_t); operator uint32_t() const;
+ private: uint32_t _address; };   // Byte 0 = first octet, as on the ESP32
+class WiFiClass { public: IPAddress localIP(); int status(); };
+extern WiFiClass WiFi;
@@ -0,0 +1,9 @@
+#pragma once
+#include "WiFi.h"
+// Real datagram socket on the host (bind INADDR_ANY, non-blocking receive) so UDPTransport
+// can talk to a test client over 127.0.0.1
+class WiFiUDP : public Stream { public: WiFiUDP(); ~WiFiUDP(); uint8_t begin(uint16_t); void stop(); int parsePacket(); int read(uint8_t*, size_t); IPAddress remoteIP(); uint16_t remotePort();
+ int beginPacket(IPAddress, uint16_t); int endPacket(); size_t write(uint8_t) override; size_t write(const uint8_t*, size_t) override; int available() override; int read() override; int peek() override;
+ private: WiFiUDP(const WiFiUDP&) = delete; WiFiUDP& operator=(const WiFiUDP&) = delete;
+ int _fd; uint8_t _rx[1500]; int _rxLength, _rxPosition; uint32_t _remoteIp; uint16_t _remotePort;
+ uint8_t _tx[1500]; size_t _txLength; uint32_t _txIp; uint16_t _txPort; };
@@ -0,0 +1,5 @@
+#pragma once
+#include "Arduino.h"
+class TwoWire : public Stream { public: bool begin(int, int); void setClock(uint32_t); void beginTransmission(uint8_t); uint8_t endTransmission(bool = true);
+ size_t write(uint8_t) override; int available() override; int read() override; int peek() override; uint8_t requestFrom(uint8_t, uint8_t); using Print::write; };
+extern TwoWire Wire;
@@ -0,0 +1,5 @@
+#pragma once
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
@@ -0,0 +1,3 @@
+#pragma once
+// Host memory is all internal RAM
+inline bool esp_ptr_internal(const void*) { return true; }
@@ -0,0 +1,2 @@
+#pragma once
+extern "C" int esp_rom_printf(const char*, ...);
@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+#include <esp_err.h>
+
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+typedef struct { uint32_t timeout_ms; uint32_t idle_core_mask; bool trigger_panic; } esp_task_wdt_config_t;
+esp_err_t esp_task_wdt_init(const esp_task_wdt_config_t*);
+esp_err_t esp_task_wdt_reconfigure(const esp_task_wdt_config_t*);
+esp_err_t esp_task_wdt_add(void*);
+esp_err_t esp_task_wdt_delete(void*);
+esp_err_t esp_task_wdt_reset(void);
@@ -0,0 +1,11 @@
+#pragma once
+#include "FreeRTOS.h"
+typedef void (*TaskFunction_t)(void*);
+BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*);
+void vTaskDelete(TaskHandle_t);
+void vTaskDelay(TickType_t);
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t);
+BaseType_t xTaskNotifyGive(TaskHandle_t);
+void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t*);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+#define portYIELD_FROM_ISR(x) (void)(x)
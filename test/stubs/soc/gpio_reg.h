@@ -0,0 +1,4 @@
+#pragma once
+#define GPIO_OUT_W1TS_REG 1
+#define GPIO_OUT_W1TC_REG 2
+#define GPIO_IN_REG 3
@@ -0,0 +1,6 @@
+#pragma once
+#include <stdint.h>
+void reg_write(uint32_t r, uint32_t v);
+#define REG_WRITE(r, v) reg_write((r), (v))
+uint32_t reg_read(uint32_t r);
+#define REG_READ(r) reg_read((r))
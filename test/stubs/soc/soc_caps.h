@@ -0,0 +1,2 @@
+#pragma once
+#define SOC_LEDC_CHANNEL_NUM 6
@@ -0,0 +1,224 @@
+// AnalogInputArray: one conversion per axis per scan however many readers,
+// axis i always maps to driver i, readers see the last scan's snapshot,
+// centered mapping equal to Joystick over the whole ADC range, linear axes,
+// deadzone, change events; scan + readAll against per-call Joystick reads.
+
+#include "TestSupport.h"
+#include "Core/EventBus.h"
+#include "Core/Logger.h"
+#include "Devices/AnalogInputArray.h"
+#include "Devices/Joystick.h"
+#include <chrono>
+#include <math.h>
+
+using namespace TwiST;
+using Devices::AnalogInputArray;
+
+// 12-bit ADC channel holding a settable value, counting conversions
+struct FakeADC : IADCDriver {
+    uint16_t value = 2048;
+    uint32_t conversions = 0;
+    uint16_t readRaw() override { conversions++; return value; }
+    uint16_t getMaxValue() const override { return 4095; }
+};
+
+struct Console {
+    FakeADC adc[8];
+    IADCDriver* axes[8];
+    Console() { for (int i = 0; i < 8; i++) axes[i] = &adc[i]; }
+    uint32_t conversions() const { uint32_t n = 0; for (const FakeADC& a : adc) n += a.conversions; return n; }
+};
+
+static void oneConversionPerAxisPerScan() {
+    EventBus bus;
+    Console console;
+    AnalogInputArray array(console.axes, 8, 680, "Console", bus);
+    CHECK(array.initialize());
+    CHECK(!array.isInputReady());
+    array.setDeadzone(0);
+
+    // Distinct value per channel: axis i reads driver i
+    for (int i = 0; i < 8; i++) console.adc[i].value = (uint16_t)(i * 500);
+    array.update();
+    CHECK(array.isInputReady());
+    CHECK_EQ(array.getScanCount(), 1);
+    CHECK_EQ(console.conversions(), 8);
+    int mapped = 0;
+    for (uint8_t i = 0; i < 8; i++) {
+        mapped += (array.getRaw(i) == i * 500);
+        float expected = (i * 500 < 2048) ? 0.5f * i * 500 / 2048.0f : 0.5f + 0.5f * (i * 500 - 2048) / 2047.0f;
+        CHECK_NEAR(array.readAnalog(i), expected, 1e-6f);
+    }
+    CHECK_EQ(mapped, 8);
+
+    // Readers never convert: bulk copy, pointer and per-axis reads all see the scan
+    float all[8];
+    for (int reader = 0; reader < 10; reader++) {
+        CHECK_EQ(array.readAll(all), 8);
+        for (uint8_t i = 0; i < 8; i++) array.readAnalog(i);
+    }
+    CHECK_EQ(console.conversions(), 8);
+    CHECK(array.getValues()[3] == all[3]);
+
+    // The ADC moves between scans: readers keep the snapshot until the next one
+    console.adc[3].value = 4095;
+    CHECK(array.readAnalog(3) == all[3]);
+    array.scan();
+    CHECK_EQ(array.readAnalog(3), 1.0f);
+    CHECK_EQ(console.conversions(), 16);
+
+    float snapshot[8];
+    CHECK_EQ(array.captureState(snapshot, 8), 8);
+    CHECK_EQ(array.captureState(snapshot, 3), 3);
+    CHECK_EQ(snapshot[2], array.readAnalog(2));
+    CHECK_EQ(array.readAnalog(8), 0.5f);                     // Unknown axis: center, like Joystick
+    CHECK(!array.readDigital(0));
+    CHECK_EQ(array.getTimeUntilUpdate(0), TWIST_ANALOG_IDLE_SCAN_US);
+}
+
+static void mappingMatchesJoystick() {
+    EventBus bus;
+    FakeADC x, y;
+    Devices::Joystick stick(x, y, 681, "Stick", bus);
+    CHECK(stick.initialize());
+    IADCDriver* axes[2] = {&x, &y};
+    AnalogInputArray array(axes, 2, 682, "Console", bus);
+    CHECK(array.initialize());
+
+    // Default and custom calibration, default deadzone of 50
+    struct Cal { uint16_t min, center, max; } cals[] = {{0, 2048, 4095}, {120, 1900, 3980}};
+    double worst = 0.0;
+    for (const Cal& c : cals) {
+        stick.calibrate(c.min, c.center, c.max, c.min, c.center, c.max);
+        array.calibrateAxis(0, c.min, c.center, c.max);
+        for (uint32_t raw = 0; raw <= 4095; raw++) {
+            x.value = (uint16_t)raw;
+            array.scan();
+            worst = fmax(worst, fabs(array.readAnalog(0) - stick.getX()));
+        }
+    }
+    printf("    centered axes vs Joystick over 0..4095: worst difference %.1e\n", worst);
+    CHECK(worst <= 1e-7);
+
+    // Deadzone: +/- 49 counts around center read exactly 0.5
+    array.setDeadzone(50);
+    x.value = 1900 + 49;
+    array.scan();
+    CHECK_EQ(array.readAnalog(0), 0.5f);
+    x.value = 1900 - 49;
+    array.scan();
+    CHECK_EQ(array.readAnalog(0), 0.5f);
+    x.value = 1900 + 50;
+    array.scan();
+    CHECK(array.readAnalog(0) > 0.5f);
+}
+
+static void linearAxesAndCalibration() {
+    EventBus bus;
+    Console console;
+    AnalogInputArray array(console.axes, 2, 683, "Console", bus);
+    CHECK(array.initialize());
+    array.calibrateAxis(1, 120, 0, 3980);                    // Throttle: linear
+
+    const uint16_t raws[] = {0, 120, 1000, 2050, 3980, 4095};
+    for (uint16_t raw : raws) {
+        console.adc[1].value = raw;
+        array.scan();
+        float clamped = (raw < 120) ? 120.0f : (raw > 3980) ? 3980.0f : raw;
+        CHECK_NEAR(array.readAnalog(1), (clamped - 120.0f) / 3860.0f, 1e-6f);
+    }
+
+    // Invalid calibrations leave the axis as it was
+    array.calibrateAxis(1, 3000, 0, 2000);
+    array.calibrateAxis(1, 100, 100, 4000);
+    array.calibrateAxis(5, 0, 2048, 4095);
+    console.adc[1].value = 2050;
+    array.scan();
+    CHECK_NEAR(array.readAnalog(1), (2050.0f - 120.0f) / 3860.0f, 1e-6f);
+}
+
+static int changes = 0;
+static void onChanged(const Event&) { changes++; }
+
+static void changeEventsPastThreshold() {
+    EventBus bus;
+    bus.subscribe("input.axes.changed", onChanged);
+    changes = 0;
+    Console console;
+    AnalogInputArray array(console.axes, 4, 684, "Console", bus);
+    CHECK(array.initialize());
+    array.setChangeThreshold(0.05f);
+
+    // ADC noise of +/- 60 counts on every axis: under 1.5 % of travel
+    array.setDeadzone(0);
+    for (int i = 0; i < 100; i++) {
+        for (int a = 0; a < 4; a++) console.adc[a].value = (uint16_t)(2048 + ((i * 37 + a * 11) % 121) - 60);
+        array.update();
+        bus.processEvents();
+    }
+    CHECK_EQ(changes, 0);
+
+    // A slow sweep on axis 2: one event per 5 % of travel, measured from the last event
+    for (uint32_t raw = 2048; raw <= 4095; raw += 8) {
+        console.adc[2].value = (uint16_t)raw;
+        array.update();
+        bus.processEvents();
+    }
+    CHECK(changes >= 9 && changes <= 10);                    // 0.5 -> 1.0 in steps just over 0.05
+    CHECK_EQ(array.getScanCount(), 100 + 256);
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void scanVersusPerCallReads() {
+    // 8 axes read by 8 consumers per tick: 4 Joysticks convert on every read,
+    // the array converts once per axis per tick
+    EventBus bus;
+    Console console;
+    Devices::Joystick sticks[4] = {
+        {console.adc[0], console.adc[1], 690, "S0", bus}, {console.adc[2], console.adc[3], 691, "S1", bus},
+        {console.adc[4], console.adc[5], 692, "S2", bus}, {console.adc[6], console.adc[7], 693, "S3", bus}};
+    for (Devices::Joystick& s : sticks) s.initialize();
+    AnalogInputArray array(console.axes, 8, 694, "Console", bus);
+    array.initialize();
+
+    const int TICKS = 200000, READERS = 8;
+    float sink = 0.0f;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int t = 0; t < TICKS; t++) {
+        console.adc[t & 7].value = (uint16_t)(t & 4095);
+        for (int r = 0; r < READERS; r++) {
+            for (uint8_t a = 0; a < 8; a++) sink += sticks[a / 2].readAnalog(a & 1);
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    uint32_t stickConversions = console.conversions();
+    float in[8];
+    for (int t = 0; t < TICKS; t++) {
+        console.adc[t & 7].value = (uint16_t)(t & 4095);
+        array.update();
+        for (int r = 0; r < READERS; r++) {
+            array.readAll(in);
+            sink += in[r];
+        }
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    uint32_t arrayConversions = console.conversions() - stickConversions;
+
+    double stickNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / TICKS;
+    double arrayNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / TICKS;
+    printf("    8 axes x 8 readers per tick: Joystick reads %.0f ns / %u conversions, array %.0f ns / %u\n",
+           stickNs, (unsigned)(stickConversions / TICKS), arrayNs, (unsigned)(arrayConversions / TICKS));
+    CHECK_EQ(stickConversions, (uint32_t)TICKS * READERS * 8);
+    CHECK_EQ(arrayConversions, (uint32_t)TICKS * 8);
+    CHECK(sink == sink);
+}
+
+int main() {
+    RUN_TEST(oneConversionPerAxisPerScan);
+    RUN_TEST(mappingMatchesJoystick);
+    RUN_TEST(linearAxesAndCalibration);
+    RUN_TEST(changeEventsPastThreshold);
+    RUN_TEST(scanVersusPerCallReads);
+    return TEST_RESULT();
+}
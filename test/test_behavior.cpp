@@ -0,0 +1,290 @@
+// BehaviorRunner coroutines on a fake clock that jumps straight to the next
+// timer deadline: a move / sleep / event sequence resumes exactly when each
+// wait completes and costs no passes in between, event timeouts, cancel from
+// outside and from inside, long waits clamped instead of wrapped.
+// Built with -std=gnu++20 and TWIST_ENABLE_BEHAVIORS=1.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/Behavior.h"
+#include "Core/EventBus.h"
+#include "Core/TimerService.h"
+#include "Core/Logger.h"
+#include <string.h>
+#include <vector>
+
+using namespace TwiST;
+
+static EventBus bus;
+static TimerService timers(bus);
+static BehaviorRunner runner(bus, timers);
+
+// Moves take their duration plus a lag, like a servo still easing in
+struct LaggingArm : FakeOutputDevice {
+    uint64_t until = 0;
+    uint32_t lagUs = 5000;
+    void moveTo(float t, unsigned long ms) override {
+        FakeOutputDevice::moveTo(t, ms);
+        until = Host::clockUs + ms * 1000ULL + lagUs;
+    }
+    bool isMoving() const override { return Host::clockUs < until; }
+};
+
+// One framework pass: timers, events, then behaviors
+static void pass() {
+    timers.update();
+    bus.processEvents();
+    runner.update();
+}
+
+static uint32_t nextWait() {
+    uint32_t a = timers.getTimeUntilUpdate(micros());
+    uint32_t b = runner.getTimeUntilUpdate(micros());
+    return a < b ? a : b;
+}
+
+// Idle the way TwiSTFramework::idle() does: jump to the earliest deadline
+static int runUntil(uint64_t endUs) {
+    int passes = 0;
+    while (passes < 100000) {
+        pass();
+        passes++;
+        uint32_t wait = nextWait();
+        if (Host::clockUs + wait >= endUs) break;
+        Host::advanceUs(wait);
+    }
+    Host::clockUs = endUs;
+    pass();
+    return passes + 1;
+}
+
+static void publish(const char* name, uint16_t source) {
+    Event evt = {name, source, NULL, PRIORITY_NORMAL, millis()};
+    bus.publish(evt);
+}
+
+// ===== Await =====
+
+static std::vector<uint64_t> marks;
+static Event received;
+
+static Behavior pickAndPlace(LaggingArm& arm) {
+    marks.push_back(Host::clockUs);
+    co_await Behaviors::moveTo(arm, 90.0f, 800);
+    marks.push_back(Host::clockUs);
+    co_await Behaviors::sleep(500);
+    marks.push_back(Host::clockUs);
+    received = co_await Behaviors::event("part.ready");
+    marks.push_back(Host::clockUs);
+}
+
+static void sequenceResumesOnEachWait() {
+    marks.clear();
+    LaggingArm arm;
+    uint64_t t0 = Host::clockUs;
+    unsigned long resumes = runner.getResumeCount();
+    BehaviorHandle handle = runner.start(pickAndPlace(arm), "PickPlace");
+    CHECK(handle != 0);
+    CHECK(runner.isRunning(handle));
+    CHECK_EQ(marks.size(), 0);                                 // First step runs in update()
+    CHECK_EQ(runner.getTimeUntilUpdate(micros()), 0);
+
+    // 3 s of fake time, the part arrives at 3 s
+    int passes = runUntil(t0 + 3000000);
+    CHECK_EQ(marks.size(), 3);
+    CHECK_EQ(runner.getTimeUntilUpdate(micros()), UINT32_MAX);  // Waiting on the event costs nothing
+    publish("part.ready", 77);
+    pass();
+    passes++;
+
+    CHECK_EQ(marks.size(), 4);
+    CHECK_EQ(arm.moves, 1);
+    CHECK_EQ(arm.target, 90.0f);
+    CHECK_EQ(arm.duration, 800);
+    if (marks.size() == 4) {
+        CHECK_EQ(marks[0], t0);
+        // Arrival estimate at 800 ms, then 2 ms polls until the 5 ms lag is over
+        CHECK_EQ(marks[1], t0 + 806000);
+        CHECK_EQ(marks[2], marks[1] + 500000);
+        CHECK_EQ(marks[3], t0 + 3000000);
+    }
+    CHECK(received.name != NULL && strcmp(received.name, "part.ready") == 0);
+    CHECK_EQ(received.sourceDeviceId, 77);
+    CHECK(received.data == NULL);
+
+    CHECK(!runner.isRunning(handle));
+    CHECK_EQ(runner.getResumeCount() - resumes, 4);
+    CHECK_EQ(BehaviorRunner::getFramesInUse(), 0);
+    CHECK_EQ(timers.getPendingCount(), 0);
+    CHECK(passes < 20);                                        // vs 3000 at a 1 ms loop
+    printf("    move + sleep + event over 3 s: %d passes, largest frame %zu bytes\n",
+           passes, BehaviorRunner::getLargestFrame());
+}
+
+// ===== Timeout =====
+
+static Behavior waitFor(const char* name, uint32_t timeoutMs, Event& out, uint64_t& at) {
+    out = co_await Behaviors::event(name, timeoutMs);
+    at = Host::clockUs;
+}
+
+static void eventTimeouts() {
+    uint64_t t0 = Host::clockUs;
+    Event late, early, forever;
+    uint64_t lateAt = 0, earlyAt = 0, foreverAt = 0;
+    runner.start(waitFor("door.open", 250, late, lateAt), "Late");
+    runner.start(waitFor("door.closed", 250, early, earlyAt), "Early");
+    runner.start(waitFor("door.closed", 0, forever, foreverAt), "Forever");
+
+    // door.closed at 100 ms wakes both of its waiters and drops the timeout
+    runUntil(t0 + 100000);
+    CHECK_EQ(timers.getPendingCount(), 2);
+    publish("door.closed", 5);
+    pass();
+    CHECK_EQ(earlyAt, t0 + 100000);
+    CHECK_EQ(foreverAt, t0 + 100000);
+    CHECK(early.name != NULL && strcmp(early.name, "door.closed") == 0);
+    CHECK(forever.name != NULL && forever.sourceDeviceId == 5);
+    CHECK_EQ(timers.getPendingCount(), 1);
+
+    // door.open never comes: resumed at 250 ms with .name == NULL
+    runUntil(t0 + 1000000);
+    CHECK_EQ(lateAt, t0 + 250000);
+    CHECK(late.name == NULL);
+    CHECK_EQ(runner.getRunningCount(), 0);
+    CHECK_EQ(timers.getPendingCount(), 0);
+
+    // A late door.open finds no waiter
+    publish("door.open", 5);
+    pass();
+    CHECK_EQ(lateAt, t0 + 250000);
+}
+
+// ===== Cancel =====
+
+static int resumedAfterSleep = 0;
+
+static Behavior sleeper(uint32_t ms) {
+    co_await Behaviors::sleep(ms);
+    resumedAfterSleep++;
+}
+
+static BehaviorHandle selfHandle = 0;
+
+static Behavior quitter() {
+    runner.cancel(selfHandle);
+    co_await Behaviors::sleep(10);
+    resumedAfterSleep++;
+}
+
+static void cancelFreesEverything() {
+    uint64_t t0 = Host::clockUs;
+    resumedAfterSleep = 0;
+    unsigned long cancelled = runner.getCancelledCount();
+
+    // Mid-sleep: timer dropped, frame back in the pool, never resumed
+    BehaviorHandle a = runner.start(sleeper(500), "Sleeper");
+    runUntil(t0 + 100000);
+    CHECK_EQ(timers.getPendingCount(), 1);
+    CHECK(runner.cancel(a));
+    CHECK(!runner.isRunning(a));
+    CHECK(!runner.cancel(a));                                  // Stale handle
+    CHECK_EQ(timers.getPendingCount(), 0);
+    CHECK_EQ(BehaviorRunner::getFramesInUse(), 0);
+    runUntil(t0 + 1000000);
+    CHECK_EQ(resumedAfterSleep, 0);
+
+    // Mid-event wait: the topic list stays intact for the next waiter
+    Event out;
+    uint64_t at = 0, at2 = 0;
+    BehaviorHandle b = runner.start(waitFor("lid.open", 0, out, at), "Lid");
+    pass();
+    CHECK(runner.cancel(b));
+    Event out2;
+    runner.start(waitFor("lid.open", 0, out2, at2), "Lid2");
+    pass();
+    publish("lid.open", 9);
+    pass();
+    CHECK_EQ(at, 0);
+    CHECK_EQ(at2, Host::clockUs);
+    CHECK_EQ(out2.sourceDeviceId, 9);
+
+    // Mid-move: the arrival check is dropped, the device keeps its command
+    LaggingArm arm;
+    marks.clear();
+    BehaviorHandle c = runner.start(pickAndPlace(arm), "PickPlace");
+    runUntil(Host::clockUs + 300000);
+    CHECK(arm.isMoving());
+    CHECK(runner.cancel(c));
+    CHECK_EQ(timers.getPendingCount(), 0);
+    runUntil(Host::clockUs + 2000000);
+    CHECK_EQ(marks.size(), 1);
+
+    // From inside itself: finishes once it suspends
+    selfHandle = runner.start(quitter(), "Quitter");
+    pass();
+    CHECK(!runner.isRunning(selfHandle));
+    CHECK_EQ(timers.getPendingCount(), 0);
+    runUntil(Host::clockUs + 100000);
+    CHECK_EQ(resumedAfterSleep, 0);
+
+    // cancelAll with the pool full; a start over capacity is rejected
+    unsigned long rejected = runner.getRejectedCount();
+    for (int i = 0; i < BehaviorRunner::CAPACITY; i++) CHECK(runner.start(sleeper(50), "Many") != 0);
+    {
+        Behavior extra = sleeper(50);
+        CHECK(!extra.isValid());                               // Frame pool shares the capacity
+        CHECK_EQ(runner.start(static_cast<Behavior&&>(extra), "Extra"), 0);
+    }
+    CHECK_EQ(runner.getRejectedCount(), rejected + 1);
+    pass();
+    runner.cancelAll();
+    CHECK_EQ(runner.getRunningCount(), 0);
+    CHECK_EQ(BehaviorRunner::getFramesInUse(), 0);
+    CHECK_EQ(timers.getPendingCount(), 0);
+    CHECK_EQ(runner.getCancelledCount() - cancelled, 4 + BehaviorRunner::CAPACITY);
+}
+
+// ===== Long waits =====
+
+static Behavior longMove(LaggingArm& arm, uint32_t ms) {
+    co_await Behaviors::moveTo(arm, 10.0f, ms);
+    resumedAfterSleep++;
+}
+
+static void longWaitsClamped() {
+    // 83 minutes: clamped to UINT32_MAX us rather than wrapping to ~12 minutes
+    resumedAfterSleep = 0;
+    uint64_t t0 = Host::clockUs;
+    runner.start(sleeper(5000000), "Long");
+    pass();
+    CHECK_EQ(timers.getTimeUntilUpdate(micros()), UINT32_MAX - 1);   // Deadline >= UINT32_MAX us away
+    runUntil(t0 + UINT32_MAX - 1);
+    CHECK_EQ(resumedAfterSleep, 0);
+    Host::advanceUs(1);
+    pass();
+    CHECK_EQ(resumedAfterSleep, 1);
+
+    LaggingArm arm;
+    BehaviorHandle move = runner.start(longMove(arm, 5000000), "LongMove");
+    pass();
+    CHECK_EQ(arm.moves, 1);
+    CHECK_EQ(timers.getTimeUntilUpdate(micros()), UINT32_MAX - 1);   // Arrival check, not a 12-minute one
+    CHECK(runner.cancel(move));
+
+    Event out;
+    uint64_t at = 0;
+    runner.start(waitFor("never", 5000000, out, at), "LongEvent");
+    pass();
+    CHECK_EQ(timers.getTimeUntilUpdate(micros()), UINT32_MAX - 1);
+    runner.cancelAll();
+    CHECK_EQ(BehaviorRunner::getFramesInUse(), 0);
+}
+
+int main() {
+    RUN_TEST(sequenceResumesOnEachWait);
+    RUN_TEST(eventTimeouts);
+    RUN_TEST(cancelFreesEverything);
+    RUN_TEST(longWaitsClamped);
+    return TEST_RESULT();
+}
@@ -0,0 +1,432 @@
+// CommandProtocol / CommandChannel: every opcode decoded in place from the
+// payload, truncated / unknown / garbage payloads stop cleanly, SET_BATCH
+// i16 centi-unit rounding and clamping, CONFIGURE keys against the JSON
+// document size, and a LoopbackTransport round trip with responses.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/CommandChannel.h"
+#include "Core/DeviceRegistry.h"
+#include "Drivers/Transport/LoopbackTransport.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+using Drivers::LoopbackTransport;
+
+// Output that keeps what CommandChannel configured it with
+struct ConfigurableOutput : FakeOutputDevice {
+    const char* name;
+    bool enabled = true;
+    bool acceptConfig = true;
+    int configures = 0;
+    size_t lastMembers = 0;
+    std::string lastKey;
+    double lastValue = 0.0;
+
+    ConfigurableOutput(uint16_t deviceId, const char* deviceName) : FakeOutputDevice(deviceId), name(deviceName) {}
+
+    TwiST::DeviceInfo getInfo() const override { return {"Fake", name, id, TwiST::CAP_OUTPUT, 1}; }
+    void enable() override { enabled = true; }
+    void disable() override { enabled = false; }
+    bool isEnabled() const override { return enabled; }
+    bool configure(const JsonDocument& doc) override {
+        configures++;
+        lastMembers = doc.hostMemberCount();
+        if (!lastKey.empty()) doc.hostMember(lastKey.c_str(), lastValue);
+        return acceptConfig;
+    }
+};
+
+// One of every opcode, and where each command starts in the payload
+struct AllOpcodes {
+    uint8_t payload[128];
+    size_t length;
+    std::vector<size_t> ends;                          // Payload length after each command
+
+    AllOpcodes() {
+        const uint16_t ids[] = {3, 4};
+        const float values[] = {1.5f, -2.25f};
+        CommandWriter writer(payload, sizeof(payload), 9);
+        writer.setValue(3, 45.5f);          ends.push_back(writer.length());
+        writer.moveTo(4, 90.0f, 1500);      ends.push_back(writer.length());
+        writer.setBatch(ids, values, 2);    ends.push_back(writer.length());
+        writer.enable(3, false);            ends.push_back(writer.length());
+        writer.configure(4, "gain", 0.75f); ends.push_back(writer.length());
+        writer.query(3);                    ends.push_back(writer.length());
+        writer.list();                      ends.push_back(writer.length());
+        length = writer.length();
+        CHECK(!writer.isOverflowed());
+        CHECK_EQ(writer.getCommandCount(), 7);
+    }
+};
+
+// ===== Protocol =====
+
+static void decodesInPlace() {
+    AllOpcodes all;
+    CommandReader reader(all.payload, all.length);
+    CHECK_EQ(reader.getSequence(), 9);
+    CHECK_EQ(reader.getCommandCount(), 7);
+
+    Command c;
+    CHECK(reader.next(c) && c.opcode == CMD_SET_VALUE && c.deviceId == 3 && c.value == 45.5f);
+    CHECK(reader.next(c) && c.opcode == CMD_MOVE_TO && c.deviceId == 4 && c.value == 90.0f);
+    CHECK_EQ(c.durationMs, 1500);
+
+    CHECK(reader.next(c) && c.opcode == CMD_SET_BATCH);
+    CHECK_EQ(c.batchCount, 2);
+    CHECK(c.batch == all.payload + all.ends[1] + 2);   // Points into the payload, not a copy
+    uint16_t id;
+    float value;
+    CommandProtocol::batchEntry(c, 1, id, value);
+    CHECK_EQ(id, 4);
+    CHECK_EQ(value, -2.25f);
+
+    CHECK(reader.next(c) && c.opcode == CMD_ENABLE && c.deviceId == 3 && !c.enabled);
+    CHECK(reader.next(c) && c.opcode == CMD_CONFIGURE && c.deviceId == 4 && c.value == 0.75f);
+    CHECK(c.key == (const char*)all.payload + all.ends[3] + 4);
+    CHECK(c.keyLength == 4 && memcmp(c.key, "gain", 4) == 0);
+    CHECK(reader.next(c) && c.opcode == CMD_QUERY && c.deviceId == 3);
+    CHECK(reader.next(c) && c.opcode == CMD_LIST);
+    CHECK(!reader.next(c));
+    CHECK(!reader.isMalformed());
+
+    // The header count is authoritative: trailing bytes are ignored
+    all.payload[1] = 2;
+    CommandReader shorter(all.payload, all.length);
+    int decoded = 0;
+    while (shorter.next(c)) decoded++;
+    CHECK_EQ(decoded, 2);
+    CHECK(!shorter.isMalformed());
+}
+
+static void truncatedPayloadsStopCleanly() {
+    AllOpcodes all;
+    Command c;
+
+    // Every prefix: exactly the complete commands decode, the rest is malformed
+    bool exact = true;
+    for (size_t length = 0; length < all.length; length++) {
+        CommandReader reader(all.payload, length);
+        size_t decoded = 0;
+        while (reader.next(c)) decoded++;
+        size_t complete = 0;
+        while (complete < all.ends.size() && all.ends[complete] <= length) complete++;
+        if (decoded != complete || !reader.isMalformed()) exact = false;
+    }
+    CHECK(exact);
+
+    CommandReader none(NULL, 10);
+    CHECK(none.isMalformed() && !none.next(c));
+
+    // Unknown opcode after the first command
+    all.payload[all.ends[0]] = 0x7F;
+    CommandReader unknown(all.payload, all.length);
+    CHECK(unknown.next(c) && c.opcode == CMD_SET_VALUE);
+    CHECK(!unknown.next(c));
+    CHECK(unknown.isMalformed());
+
+    // SET_BATCH / CONFIGURE whose length byte points past the end
+    uint8_t batch[] = {0, 1, CMD_SET_BATCH, 200, 1, 0, 10, 0};
+    CommandReader badBatch(batch, sizeof(batch));
+    CHECK(!badBatch.next(c) && badBatch.isMalformed());
+    uint8_t config[] = {0, 1, CMD_CONFIGURE, 1, 0, 250, 'k', 0, 0, 0, 0};
+    CommandReader badConfig(config, sizeof(config));
+    CHECK(!badConfig.next(c) && badConfig.isMalformed());
+}
+
+static void randomPayloadsNeverOverrun() {
+    std::mt19937 rng(55);
+    uint8_t buffer[64];
+    unsigned long malformed = 0, commands = 0;
+    for (int round = 0; round < 100000; round++) {
+        size_t length = rng() % sizeof(buffer);
+        for (size_t i = 0; i < length; i++) buffer[i] = (uint8_t)(rng() % 9);  // Mostly valid opcodes
+        // Decode from a heap copy of exactly `length` bytes so ASan sees any overrun
+        std::vector<uint8_t> exact(buffer, buffer + length);
+        CommandReader reader(exact.data(), exact.size());
+        Command c;
+        while (reader.next(c)) commands++;
+        if (reader.isMalformed()) malformed++;
+    }
+    CHECK(malformed > 0 && commands > 0);
+}
+
+static void batchValuesRoundAndClamp() {
+    const float in[] = {0.0f, 1.234f, -1.236f, 0.004f, -0.006f, 327.67f, 327.674f, 400.0f, -400.0f,
+                        -327.68f, INFINITY, -INFINITY, NAN};
+    const float out[] = {0.0f, 1.23f, -1.24f, 0.0f, -0.01f, 327.67f, 327.67f, 327.67f, -327.67f,
+                         -327.67f, 327.67f, -327.67f, 0.0f};
+    const uint8_t N = sizeof(in) / sizeof(in[0]);
+    uint16_t ids[N];
+    for (uint8_t i = 0; i < N; i++) ids[i] = (uint16_t)(100 + i);
+
+    uint8_t payload[128];
+    CommandWriter writer(payload, sizeof(payload), 0);
+    CHECK(writer.setBatch(ids, in, N));
+    CommandReader reader(payload, writer.length());
+    Command c;
+    CHECK(reader.next(c));
+    CHECK_EQ(c.batchCount, N);
+    for (uint8_t i = 0; i < N; i++) {
+        uint16_t id;
+        float value;
+        CommandProtocol::batchEntry(c, i, id, value);
+        CHECK_EQ(id, 100 + i);
+        CHECK_NEAR(value, out[i], 1e-4);
+    }
+
+    // A frame for a foreign client's -32768 still decodes
+    payload[2 + 2 + 2] = 0x00;
+    payload[2 + 2 + 3] = 0x80;
+    uint16_t id;
+    float value;
+    CommandProtocol::batchEntry(c, 0, id, value);
+    CHECK_NEAR(value, -327.68f, 1e-4);
+}
+
+// ===== Channel =====
+
+struct Bench {
+    LoopbackTransport client, device;
+    DeviceRegistry registry;
+    CommandChannel channel;
+    WireFrameParser parser;
+    std::vector<std::vector<uint8_t> > responses;
+
+    Bench() : channel(device, registry) { LoopbackTransport::connect(client, device); }
+
+    void send(const uint8_t* payload, size_t length, uint8_t type = WIRE_COMMAND) {
+        uint8_t frame[WireFrame::OVERHEAD + TWIST_WIRE_MAX_PAYLOAD];
+        memcpy(WireFrame::payload(frame), payload, length);
+        size_t total = WireFrame::finalize(frame, type, (uint16_t)length);
+        CHECK_EQ(client.send(frame, total), total);
+    }
+
+    void collect() {
+        uint8_t buffer[256];
+        size_t n;
+        while ((n = client.receive(buffer, sizeof(buffer))) > 0) {
+            for (size_t i = 0; i < n; i++) {
+                if (parser.feed(buffer[i]) && parser.type() == WIRE_RESPONSE) {
+                    responses.push_back(std::vector<uint8_t>(parser.payload(), parser.payload() + parser.length()));
+                }
+            }
+        }
+    }
+};
+
+static void appliesCommandsOverLoopback() {
+    Bench b;
+    ConfigurableOutput arm(3, "Arm"), wrist(4, "Wrist");
+    b.registry.registerDevice(&arm);
+    b.registry.registerDevice(&wrist);
+    wrist.lastKey = "gain";
+    arm.moving = true;
+
+    AllOpcodes all;
+    b.send(all.payload, all.length);
+    b.channel.update();
+    b.collect();
+
+    CHECK_EQ(arm.value, 1.5f);                         // setValue 45.5 then batch 1.5
+    CHECK_EQ(arm.sets, 2);
+    CHECK(!arm.enabled);
+    CHECK_EQ(wrist.target, 90.0f);
+    CHECK_EQ(wrist.duration, 1500);
+    CHECK_EQ(wrist.value, -2.25f);
+    CHECK_EQ(wrist.configures, 1);
+    CHECK_EQ(wrist.lastMembers, 1);
+    CHECK_EQ(wrist.lastValue, 0.75);
+    CHECK_EQ(b.channel.getAppliedCount(), 7);
+    CHECK_EQ(b.channel.getFrameCount(), 1);
+
+    CHECK_EQ(b.responses.size(), 1);
+    CommandResponseReader response(b.responses[0].data(), b.responses[0].size());
+    CHECK(response.isValid());
+    CHECK_EQ(response.getSequence(), 9);
+    CHECK_EQ(response.getAppliedCount(), 7);
+    CHECK_EQ(response.getFailedCount(), 0);
+    CHECK_EQ(response.getEntryCount(), 3);             // Query + two list entries
+
+    CommandResponseEntry e;
+    CHECK(response.next(e) && e.tag == CMD_QUERY && e.deviceId == 3);
+    CHECK_EQ(e.flags, QUERY_OUTPUT | QUERY_MOVING);    // Disabled by the ENABLE before it
+    CHECK_EQ(e.value, 1.5f);
+    CHECK(response.next(e) && e.tag == CMD_LIST && e.deviceId == 3);
+    CHECK(e.nameLength == 3 && memcmp(e.name, "Arm", 3) == 0);
+    CHECK(response.next(e) && e.tag == CMD_LIST && e.deviceId == 4);
+    CHECK(!response.next(e));
+}
+
+static void failuresAreReported() {
+    Bench b;
+    ConfigurableOutput arm(3, "Arm");
+    b.registry.registerDevice(&arm);
+
+    // Unknown device, batch with one unknown id, truncated tail
+    uint8_t payload[64];
+    const uint16_t ids[] = {77, 3};
+    const float values[] = {1.0f, 2.0f};
+    CommandWriter writer(payload, sizeof(payload), 5);
+    writer.setValue(42, 1.0f);
+    writer.setBatch(ids, values, 2);
+    writer.moveTo(3, 10.0f, 100);
+    b.send(payload, writer.length() - 1);
+    b.channel.update();
+    b.collect();
+
+    CHECK_EQ(arm.value, 2.0f);                         // Rest of the batch still applied
+    CHECK_EQ(arm.moves, 0);                            // Truncated command never runs
+    CHECK_EQ(b.channel.getMalformedCount(), 1);
+    CHECK_EQ(b.responses.size(), 1);
+    CommandResponseReader response(b.responses[0].data(), b.responses[0].size());
+    CHECK_EQ(response.getAppliedCount(), 0);
+    CHECK_EQ(response.getFailedCount(), 3);            // Two unknown device + malformed
+    CHECK_EQ(response.getFirstError(), CMD_ERR_UNKNOWN_DEVICE);
+
+    // Sequence 0: applied, no response
+    CommandWriter quiet(payload, sizeof(payload), 0);
+    quiet.setValue(3, 7.0f);
+    quiet.query(3);
+    b.send(payload, quiet.length());
+    b.channel.update();
+    b.collect();
+    CHECK_EQ(arm.value, 7.0f);
+    CHECK_EQ(b.responses.size(), 1);
+
+    // Line noise and a corrupted frame before a good one: parser resyncs
+    uint8_t noise[300];
+    for (size_t i = 0; i < sizeof(noise); i++) noise[i] = (uint8_t)(i * 37 + 11);
+    b.client.send(noise, sizeof(noise));
+    CommandWriter good(payload, sizeof(payload), 6);
+    good.setValue(3, 8.0f);
+    b.send(payload, good.length());
+    b.channel.update();
+    b.channel.update();
+    b.collect();
+    CHECK_EQ(arm.value, 8.0f);
+    CHECK_EQ(b.responses.size(), 2);
+    CHECK_EQ(b.responses.back()[0], 6);
+}
+
+static void configureKeysFitTheDocument() {
+    Bench b;
+    ConfigurableOutput arm(3, "Arm");
+    b.registry.registerDevice(&arm);
+    uint8_t payload[TWIST_WIRE_MAX_PAYLOAD];
+
+    // Every accepted key length reaches the device as a one-member document
+    bool delivered = true;
+    for (size_t n = 1; n <= TWIST_COMMAND_MAX_KEY_LENGTH; n++) {
+        std::string key(n, 'k');
+        arm.lastKey = key;
+        arm.lastMembers = 0;
+        arm.lastValue = 0.0;
+        CommandWriter writer(payload, sizeof(payload), 0);
+        writer.configure(3, key.c_str(), (float)n);
+        b.channel.execute(payload, writer.length(), NULL, 0);
+        if (arm.lastMembers != 1 || arm.lastValue != (double)n) delivered = false;
+    }
+    CHECK(delivered);
+    CHECK_EQ(arm.configures, TWIST_COMMAND_MAX_KEY_LENGTH);
+
+    // Longer keys would overflow the document: refused before the device sees them
+    uint8_t response[32];
+    const size_t tooLong[] = {TWIST_COMMAND_MAX_KEY_LENGTH + 1, 63, 64, 200};
+    for (size_t n : tooLong) {
+        std::string key(n, 'x');
+        CommandWriter writer(payload, sizeof(payload), 1);
+        CHECK(writer.configure(3, key.c_str(), 1.0f));
+        size_t length = b.channel.execute(payload, writer.length(), response, sizeof(response));
+        CommandResponseReader reader(response, length);
+        CHECK_EQ(reader.getFailedCount(), 1);
+        CHECK_EQ(reader.getFirstError(), CMD_ERR_MALFORMED);
+    }
+    CHECK_EQ(arm.configures, TWIST_COMMAND_MAX_KEY_LENGTH);
+
+    // Empty key, and a device that refuses the value
+    CommandWriter empty(payload, sizeof(payload), 1);
+    empty.configure(3, "", 1.0f);
+    size_t length = b.channel.execute(payload, empty.length(), response, sizeof(response));
+    CHECK_EQ(CommandResponseReader(response, length).getFirstError(), CMD_ERR_MALFORMED);
+    arm.acceptConfig = false;
+    CommandWriter refused(payload, sizeof(payload), 1);
+    refused.configure(3, "gain", 1.0f);
+    length = b.channel.execute(payload, refused.length(), response, sizeof(response));
+    CHECK_EQ(CommandResponseReader(response, length).getFirstError(), CMD_ERR_REJECTED);
+}
+
+static void responsesRespectTransportAndPayload() {
+    Bench b;
+    static char names[20][24];
+    std::vector<ConfigurableOutput*> devices;
+    for (int i = 0; i < 20; i++) {
+        snprintf(names[i], sizeof(names[i]), "LongDeviceName%02d", i);
+        devices.push_back(new ConfigurableOutput((uint16_t)(10 + i), names[i]));
+        b.registry.registerDevice(devices.back());
+    }
+
+    // LIST of 20 x 22-byte entries does not fit one payload: truncated, NO_ROOM
+    uint8_t payload[8];
+    CommandWriter list(payload, sizeof(payload), 3);
+    list.list();
+    b.send(payload, list.length());
+    b.channel.update();
+    b.collect();
+    CHECK_EQ(b.responses.size(), 1);
+    CommandResponseReader response(b.responses[0].data(), b.responses[0].size());
+    CHECK_EQ(response.getFirstError(), CMD_ERR_NO_ROOM);
+    CHECK_EQ(response.getEntryCount(), (TWIST_WIRE_MAX_PAYLOAD - CommandProtocol::RESPONSE_HEADER_SIZE) / 22);
+
+    // Client stops reading: responses that do not fit whole are dropped, not torn
+    CommandWriter query(payload, sizeof(payload), 4);
+    query.query(10);
+    for (int i = 0; i < 200; i++) {
+        b.send(payload, query.length());
+        b.channel.update();
+    }
+    CHECK(b.channel.getResponseDroppedCount() > 0);
+    CHECK_EQ(b.channel.getFrameCount(), 201);
+    b.collect();
+    CHECK_EQ(b.responses.size(), 1 + 200 - b.channel.getResponseDroppedCount());
+    CHECK_EQ(b.parser.getCrcErrorCount(), 0);
+
+    for (ConfigurableOutput* d : devices) delete d;
+}
+
+static void receiveBudgetSpreadsWork() {
+    Bench b;
+    ConfigurableOutput arm(3, "Arm");
+    b.registry.registerDevice(&arm);
+
+    // 100 fire-and-forget frames of 16 bytes = 1600 bytes, more than one tick's budget
+    uint8_t payload[16];
+    for (int i = 0; i < 100; i++) {
+        CommandWriter writer(payload, sizeof(payload), 0);
+        writer.setValue(3, (float)i);
+        b.send(payload, writer.length());
+    }
+    b.channel.update();
+    unsigned long first = b.channel.getFrameCount();
+    CHECK(first > 0 && first < 100);
+    CHECK(first * 16 <= TWIST_COMMAND_MAX_BYTES_PER_TICK);
+    b.channel.update();
+    CHECK_EQ(b.channel.getFrameCount(), 100);
+    CHECK_EQ(arm.value, 99.0f);
+}
+
+int main() {
+    RUN_TEST(decodesInPlace);
+    RUN_TEST(truncatedPayloadsStopCleanly);
+    RUN_TEST(randomPayloadsNeverOverrun);
+    RUN_TEST(batchValuesRoundAndClamp);
+    RUN_TEST(appliesCommandsOverLoopback);
+    RUN_TEST(failuresAreReported);
+    RUN_TEST(configureKeysFitTheDocument);
+    RUN_TEST(responsesRespectTransportAndPayload);
+    RUN_TEST(receiveBudgetSpreadsWork);
+    return TEST_RESULT();
+}
@@ -0,0 +1,211 @@
+// SnapshotBuffer seqlock double buffer: a reader thread copying while the
+// writer publishes never sees a torn frame (every field of a frame is
+// derived from its generation); registry capture end to end; timing.
+
+#include "TestSupport.h"
+#include "Core/DeviceRegistry.h"
+#include "Core/DeviceSnapshot.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace TwiST;
+
+// Every field the writer fills is a function of the generation
+static uint8_t countFor(uint32_t generation) { return (uint8_t)(1 + generation % MAX_DEVICES); }
+static float valueFor(uint32_t generation) { return (float)(generation & 0xFFFFF); }
+
+static void fillFrame(RegistrySnapshot& frame, uint32_t generation) {
+    frame.count = countFor(generation);
+    for (uint8_t i = 0; i < frame.count; i++) {
+        DeviceSnapshot& d = frame.devices[i];
+        d.id = (uint16_t)(generation + i);
+        d.state = (uint8_t)generation;
+        d.flags = (uint8_t)(generation >> 8);
+        d.valueCount = TWIST_SNAPSHOT_VALUES;
+        for (uint8_t v = 0; v < TWIST_SNAPSHOT_VALUES; v++) d.values[v] = valueFor(generation);
+    }
+}
+
+static bool frameIsConsistent(const RegistrySnapshot& frame) {
+    uint32_t g = frame.generation;
+    if (frame.count != countFor(g) || frame.timestampUs != g * 10) return false;
+    for (uint8_t i = 0; i < frame.count; i++) {
+        const DeviceSnapshot& d = frame.devices[i];
+        if (d.id != (uint16_t)(g + i) || d.state != (uint8_t)g || d.flags != (uint8_t)(g >> 8)) return false;
+        if (d.valueCount != TWIST_SNAPSHOT_VALUES) return false;
+        for (uint8_t v = 0; v < TWIST_SNAPSHOT_VALUES; v++) {
+            if (d.values[v] != valueFor(g)) return false;
+        }
+    }
+    return true;
+}
+
+static void publishesInOrder() {
+    SnapshotBuffer buffer;
+    static RegistrySnapshot out;
+    CHECK(!buffer.read(out));                          // Nothing published
+    CHECK_EQ(buffer.getGeneration(), 0);
+
+    for (uint32_t g = 1; g <= 5; g++) {
+        fillFrame(buffer.beginWrite(), g);
+        CHECK_EQ(buffer.publish(g * 10), g);
+        CHECK(buffer.read(out));
+        CHECK_EQ(out.generation, g);
+        CHECK(frameIsConsistent(out));
+    }
+
+    // A frame being written stays invisible until publish()
+    fillFrame(buffer.beginWrite(), 6);
+    CHECK(buffer.read(out));
+    CHECK_EQ(out.generation, 5);
+    CHECK(frameIsConsistent(out));
+    CHECK_EQ(buffer.getRetryCount(), 0);
+}
+
+static void concurrentReaderNeverSeesTornFrame() {
+    static SnapshotBuffer buffer;
+    std::atomic<bool> stop(false);
+    unsigned long reads = 0, distinct = 0, torn = 0, backwards = 0, failed = 0;
+
+    // read() returns false (uncounted) until the first publish - start the reader after it
+    fillFrame(buffer.beginWrite(), 1);
+    buffer.publish(10);
+
+    std::thread reader([&]() {
+        static RegistrySnapshot frame;
+        uint32_t last = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (!buffer.read(frame)) {
+                failed++;
+                continue;
+            }
+            reads++;
+            if (!frameIsConsistent(frame)) torn++;
+            if (frame.generation < last) backwards++;
+            if (frame.generation != last) distinct++;
+            last = frame.generation;
+        }
+    });
+
+    const uint32_t PASSES = 500000;
+    for (uint32_t g = 2; g <= PASSES; g++) {
+        fillFrame(buffer.beginWrite(), g);
+        buffer.publish(g * 10);
+        if ((g & 0xFF) == 0) std::this_thread::yield();      // Let the reader in on one core
+    }
+    stop.store(true);
+    reader.join();
+
+    printf("    %lu reads (%lu distinct frames), %u retries, %lu gave up\n",
+           reads, distinct, buffer.getRetryCount(), failed);
+    CHECK(reads > 0);
+    CHECK_EQ(torn, 0);
+    CHECK_EQ(backwards, 0);
+    CHECK_EQ(failed, buffer.getFailedReadCount());
+}
+
+// ===== Registry end to end =====
+
+static std::atomic<uint32_t> pass(0);
+
+// Reports the writer's pass number in every value - a consistent frame holds one value
+struct PassDevice : IDevice {
+    uint16_t id;
+    explicit PassDevice(uint16_t deviceId) : id(deviceId) {}
+    bool initialize() override { return true; }
+    void shutdown() override {}
+    void update() override {}
+    DeviceInfo getInfo() const override { return {"Pass", "Pass", id, 0, 1}; }
+    const char* getName() const override { return "Pass"; }
+    uint16_t getCapabilities() const override { return 0; }
+    bool hasCapability(DeviceCapability) const override { return false; }
+    DeviceState getState() const override { return STATE_READY; }
+    void enable() override {}
+    void disable() override {}
+    bool isEnabled() const override { return true; }
+    bool configure(const JsonDocument&) override { return true; }
+    void getConfiguration(JsonDocument&) const override {}
+    void toJson(JsonDocument&) const override {}
+    bool fromJson(const JsonDocument&) override { return true; }
+    uint8_t captureState(float* values, uint8_t maxValues) const override {
+        float p = (float)pass.load(std::memory_order_relaxed);
+        for (uint8_t i = 0; i < maxValues; i++) values[i] = p;
+        return maxValues;
+    }
+};
+
+static void registryCaptureUnderConcurrentReads() {
+    DeviceRegistry registry;
+    static PassDevice* devices[MAX_DEVICES];
+    for (uint16_t i = 0; i < MAX_DEVICES; i++) {
+        devices[i] = new PassDevice(i + 1);
+        registry.registerDevice(devices[i]);
+    }
+
+    std::atomic<bool> stop(false);
+    unsigned long frames = 0, torn = 0;
+    std::thread reader([&]() {
+        static RegistrySnapshot frame;
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (!registry.readSnapshot(frame)) continue;
+            frames++;
+            if (frame.count != MAX_DEVICES) { torn++; continue; }
+            float first = frame.devices[0].values[0];
+            for (uint8_t i = 0; i < frame.count; i++) {
+                if (frame.devices[i].id != i + 1 || frame.devices[i].values[TWIST_SNAPSHOT_VALUES - 1] != first) {
+                    torn++;
+                    break;
+                }
+            }
+        }
+    });
+
+    for (uint32_t p = 1; p <= 300000; p++) {
+        pass.store(p, std::memory_order_relaxed);
+        registry.snapshot();
+        if ((p & 0xFF) == 0) std::this_thread::yield();
+    }
+    stop.store(true);
+    reader.join();
+
+    CHECK(frames > 0);
+    CHECK_EQ(torn, 0);
+    CHECK_EQ(registry.getSnapshotGeneration(), 300000);
+    for (uint16_t i = 0; i < MAX_DEVICES; i++) delete devices[i];
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void benchmark() {
+    typedef std::chrono::steady_clock Clock;
+    DeviceRegistry registry;
+    static PassDevice* devices[MAX_DEVICES];
+    for (uint16_t i = 0; i < MAX_DEVICES; i++) {
+        devices[i] = new PassDevice(i + 1);
+        registry.registerDevice(devices[i]);
+    }
+
+    const int ITERATIONS = 200000;
+    static RegistrySnapshot frame;
+    Clock::time_point t0 = Clock::now();
+    for (int i = 0; i < ITERATIONS; i++) registry.snapshot();
+    double captureNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / ITERATIONS;
+
+    t0 = Clock::now();
+    for (int i = 0; i < ITERATIONS; i++) registry.readSnapshot(frame);
+    double readNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / ITERATIONS;
+
+    CHECK_EQ(frame.count, MAX_DEVICES);
+    printf("    %d devices, %u-byte frame: snapshot() %.0f ns, readSnapshot() %.0f ns\n",
+           MAX_DEVICES, (unsigned)sizeof(RegistrySnapshot), captureNs, readNs);
+    for (uint16_t i = 0; i < MAX_DEVICES; i++) delete devices[i];
+}
+
+int main() {
+    RUN_TEST(publishesInOrder);
+    RUN_TEST(concurrentReaderNeverSeesTornFrame);
+    RUN_TEST(registryCaptureUnderConcurrentReads);
+    RUN_TEST(benchmark);
+    return TEST_RESULT();
+}
@@ -0,0 +1,302 @@
+// Debouncer and DigitalInput on synthetic bounce traces: exactly one accepted
+// edge per press and per release, reported at the first physical edge, detected
+// window + 2 x (time bounced back) later; the same result at any update()
+// cadence; sub-window spikes rejected; device events back-dated to the edge.
+
+#include "TestSupport.h"
+#include "Core/Debouncer.h"
+#include "Core/EventBus.h"
+#include "Core/Logger.h"
+#include "Devices/DigitalInput.h"
+#include <deque>
+#include <random>
+#include <string.h>
+#include <vector>
+
+using namespace TwiST;
+
+static const uint32_t WINDOW = 10000;
+
+// Level changes of one contact, in time order
+struct Trace {
+    std::vector<DigitalEdge> edges;
+    std::vector<uint32_t> pressAt, releaseAt;     // First physical edge of each
+    std::vector<uint32_t> pressLatency, releaseLatency;
+
+    // Settle from `level` to !level at t, bouncing for up to maxBounceUs; bounces
+    // back are shorter than the contact they interrupt, so the integrator never
+    // empties and the ideal detection is window + 2 x (time spent bounced back)
+    uint32_t bounce(std::mt19937& rng, bool level, uint32_t t, uint32_t maxBounceUs) {
+        std::uniform_int_distribution<uint32_t> contact(200, 800), gap(20, 180);
+        uint32_t first = t, back = 0;
+        edges.push_back({t, !level});
+        for (uint32_t end = t + maxBounceUs; ;) {
+            t += contact(rng);
+            uint32_t g = gap(rng);
+            if (t + g > end) break;
+            edges.push_back({t, level});
+            edges.push_back({t + g, !level});
+            t += g;
+            back += g;
+        }
+        (level ? releaseAt : pressAt).push_back(first);
+        (level ? releaseLatency : pressLatency).push_back(WINDOW + 2 * back);
+        return t;
+    }
+
+    // `count` presses with random hold and rest times
+    static Trace presses(uint32_t seed, int count, uint32_t startUs) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> hold(30000, 400000), bounceUs(0, 4000);
+        Trace trace;
+        uint32_t t = startUs;
+        for (int i = 0; i < count; i++) {
+            t = trace.bounce(rng, false, t + hold(rng), bounceUs(rng));
+            t = trace.bounce(rng, true, t + hold(rng), bounceUs(rng));
+        }
+        return trace;
+    }
+};
+
+struct Transition {
+    bool state;
+    uint32_t physicalUs, detectedUs;
+};
+
+// Feed a trace, calling advance() every cadenceUs (0 = only at the end)
+static std::vector<Transition> debounce(const Trace& trace, uint32_t startUs, uint32_t cadenceUs) {
+    Debouncer d(WINDOW);
+    d.reset(false, startUs);
+    std::vector<Transition> out;
+    auto note = [&](bool changed) {
+        if (changed) out.push_back({d.getState(), d.getTransitionMicros(), d.getDetectedMicros()});
+    };
+
+    uint32_t endUs = trace.edges.back().timestampUs + 2 * WINDOW;
+    uint32_t nextPoll = startUs + cadenceUs;
+    for (const DigitalEdge& e : trace.edges) {
+        while (cadenceUs > 0 && nextPoll < e.timestampUs) {
+            note(d.advance(nextPoll));
+            nextPoll += cadenceUs;
+        }
+        note(d.edge(e.level, e.timestampUs));
+    }
+    note(d.advance(endUs));
+    return out;
+}
+
+static void onePressOneEdge() {
+    const uint32_t start = 1000;
+    Trace trace = Trace::presses(64, 200, start);
+    std::vector<Transition> seen = debounce(trace, start, 1000);
+
+    CHECK_EQ(seen.size(), 400);
+    int order = 0, physical = 0, latency = 0;
+    for (size_t i = 0; i < seen.size() && i < 400; i++) {
+        size_t press = i / 2;
+        bool pressed = (i % 2 == 0);
+        order += (seen[i].state == pressed);
+        physical += (seen[i].physicalUs == (pressed ? trace.pressAt[press] : trace.releaseAt[press]));
+        latency += (seen[i].detectedUs - seen[i].physicalUs ==
+                    (pressed ? trace.pressLatency[press] : trace.releaseLatency[press]));
+    }
+    CHECK_EQ(order, 400);
+    CHECK_EQ(physical, 400);
+    CHECK_EQ(latency, 400);
+}
+
+static void sameResultAtAnyCadence() {
+    const uint32_t start = 5000;
+    Trace trace = Trace::presses(65, 50, start);
+    std::vector<Transition> reference = debounce(trace, start, 1000);
+    CHECK_EQ(reference.size(), 100);
+
+    const uint32_t cadences[] = {1, 7000, 50000, 0};
+    for (uint32_t cadence : cadences) {
+        std::vector<Transition> seen = debounce(trace, start, cadence);
+        CHECK_EQ(seen.size(), reference.size());
+        int same = 0;
+        for (size_t i = 0; i < seen.size() && i < reference.size(); i++) {
+            same += (seen[i].state == reference[i].state && seen[i].physicalUs == reference[i].physicalUs &&
+                     seen[i].detectedUs == reference[i].detectedUs);
+        }
+        CHECK_EQ(same, (int)reference.size());
+    }
+}
+
+static void spikesRejected() {
+    Debouncer d(WINDOW);
+    d.reset(false, 0);
+    CHECK_EQ(d.getPendingMicros(0), UINT32_MAX);
+
+    // 100 isolated spikes up to 9.9 ms wide, each followed by a quiet window
+    std::mt19937 rng(66);
+    std::uniform_int_distribution<uint32_t> width(1, WINDOW - 100);
+    uint32_t t = 1000;
+    int flips = 0;
+    for (int i = 0; i < 100; i++) {
+        uint32_t w = width(rng);
+        flips += d.edge(true, t);
+        CHECK_EQ(d.getPendingMicros(t), WINDOW);
+        flips += d.edge(false, t + w);
+        t += w + WINDOW + 1;
+        flips += d.advance(t);
+    }
+    CHECK_EQ(flips, 0);
+    CHECK(!d.getState());
+    CHECK_EQ(d.getRejectedCount(), 100);
+
+    // Held one window exactly: accepted, not rejected
+    CHECK(!d.edge(true, t));
+    CHECK_EQ(d.getPendingMicros(t + 4000), WINDOW - 4000);
+    CHECK(!d.advance(t + WINDOW - 1));
+    CHECK(d.advance(t + WINDOW));
+    CHECK_EQ(d.getTransitionMicros(), t);
+    CHECK_EQ(d.getRejectedCount(), 100);
+
+    // A glitch while held is rejected too
+    t += 2 * WINDOW;
+    CHECK(!d.edge(false, t));
+    CHECK(!d.edge(true, t + 3000));
+    CHECK(!d.advance(t + 3000 + WINDOW));
+    CHECK(d.getState());
+    CHECK_EQ(d.getRejectedCount(), 101);
+}
+
+// One line driven from a trace: edges become visible once the clock passes them
+class TraceDriver : public IDigitalInputDriver {
+public:
+    std::deque<DigitalEdge> pending, queued;
+    bool level = false;
+    uint32_t dropped = 0;
+    size_t capacity = 64;
+
+    uint8_t getLineCount() const override { return 1; }
+    bool readLine(uint8_t) override { capture(); return level; }
+    bool popEdge(uint8_t, DigitalEdge& edge) override {
+        capture();
+        if (queued.empty()) return false;
+        edge = queued.front();
+        queued.pop_front();
+        return true;
+    }
+    uint32_t getDroppedEdges(uint8_t) const override { return dropped; }
+    uint32_t getPollInterval(uint8_t) const override { return UINT32_MAX; }   // Interrupt line
+
+private:
+    void capture() {
+        while (!pending.empty() && pending.front().timestampUs <= (uint32_t)Host::clockUs) {
+            level = pending.front().level;
+            if (queued.size() < capacity) queued.push_back(pending.front());
+            else dropped++;
+            pending.pop_front();
+        }
+    }
+};
+
+static std::vector<Event> events;
+static void record(const Event& evt) { events.push_back(evt); }
+
+static void deviceEventsAtPhysicalEdges() {
+    EventBus bus;
+    bus.subscribe("input.pressed", record);
+    bus.subscribe("input.released", record);
+    bus.subscribe("input.long_press", record);
+    events.clear();
+
+    Host::clockUs = 10000000;
+    uint32_t start = (uint32_t)Host::clockUs;
+    TraceDriver driver;
+    Devices::DigitalInput input(driver, 0, 640, "Start", bus);
+    CHECK(input.initialize());
+    input.setDebounceMs(WINDOW / 1000);
+    input.setLongPressMs(0);
+    CHECK_EQ(input.getTimeUntilUpdate(start), UINT32_MAX);      // Nothing pending, ISR wakes the loop
+
+    Trace trace = Trace::presses(67, 40, start + 1000);
+    driver.pending.assign(trace.edges.begin(), trace.edges.end());
+
+    // Loop wakes on each edge (the ISR) and when the device asks for it
+    uint64_t end = trace.edges.back().timestampUs + 2 * WINDOW;
+    int wakeups = 0;
+    while (Host::clockUs < end) {
+        input.update();
+        bus.processEvents();
+        wakeups++;
+        uint64_t next = end;
+        if (!driver.pending.empty()) next = driver.pending.front().timestampUs;
+        uint32_t wait = input.getTimeUntilUpdate((uint32_t)Host::clockUs);
+        if (wait != UINT32_MAX && Host::clockUs + wait < next) next = Host::clockUs + wait;
+        Host::clockUs = next > Host::clockUs ? next : Host::clockUs + 1;
+    }
+    input.update();
+    bus.processEvents();
+
+    CHECK_EQ(events.size(), 80);
+    CHECK_EQ(input.getPressCount(), 40);
+    CHECK_EQ(input.getRejectedCount(), 0);
+    int names = 0, backDated = 0;
+    for (size_t i = 0; i < events.size() && i < 80; i++) {
+        bool pressed = (i % 2 == 0);
+        uint32_t physical = pressed ? trace.pressAt[i / 2] : trace.releaseAt[i / 2];
+        names += (strcmp(events[i].name, pressed ? "input.pressed" : "input.released") == 0);
+        backDated += ((long)events[i].timestamp - (long)(physical / 1000) <= 1 &&
+                      (long)events[i].timestamp - (long)(physical / 1000) >= 0);
+        CHECK_EQ(events[i].sourceDeviceId, 640);
+    }
+    CHECK_EQ(names, 80);
+    CHECK_EQ(backDated, 80);
+    CHECK(wakeups < (int)trace.edges.size() + 3 * 80);
+    printf("    40 presses, %zu raw edges: %d loop wakeups\n", trace.edges.size(), wakeups);
+}
+
+static void deviceLongPressAndOverflow() {
+    EventBus bus;
+    bus.subscribe("input.pressed", record);
+    bus.subscribe("input.released", record);
+    bus.subscribe("input.long_press", record);
+    events.clear();
+
+    TraceDriver driver;
+    driver.capacity = 4;
+    Devices::DigitalInput input(driver, 0, 641, "Limit", bus);
+    CHECK(input.initialize());
+    input.setDebounceMs(WINDOW / 1000);
+    input.setLongPressMs(500);
+
+    // 20 bounce edges arrive before update() runs: the queue overflows and the
+    // device resynchronizes on the present level
+    uint32_t t = (uint32_t)Host::clockUs + 1000;
+    for (int i = 0; i < 20; i++) driver.pending.push_back({t + 100 * (uint32_t)i, i % 2 == 0});
+    driver.pending.push_back({t + 2000, true});
+    Host::advanceMs(5);
+    input.update();
+    CHECK(driver.dropped > 0);
+    CHECK(!input.isPressed());
+    Host::advanceMs(20);
+    input.update();
+    bus.processEvents();
+    CHECK(input.isPressed());
+    CHECK_EQ(events.size(), 1);
+
+    // Long press once, at 500 ms held, however often update() runs
+    uint32_t wait = input.getTimeUntilUpdate((uint32_t)Host::clockUs);
+    CHECK(wait > 400000 && wait <= 500000);
+    for (int i = 0; i < 200; i++) { Host::advanceMs(5); input.update(); }
+    bus.processEvents();
+    CHECK_EQ(events.size(), 2);
+    if (events.size() == 2) CHECK(strcmp(events[1].name, "input.long_press") == 0);
+    CHECK_EQ(input.getTimeUntilUpdate((uint32_t)Host::clockUs), UINT32_MAX);
+
+    input.setDebounceMs(0);                                     // Rejected, window kept
+    CHECK_EQ(input.getRejectedCount(), 0);
+}
+
+int main() {
+    RUN_TEST(onePressOneEdge);
+    RUN_TEST(sameResultAtAnyCadence);
+    RUN_TEST(spikesRejected);
+    RUN_TEST(deviceEventsAtPhysicalEdges);
+    RUN_TEST(deviceLongPressAndOverflow);
+    return TEST_RESULT();
+}
@@ -0,0 +1,290 @@
+// DistanceArray and PolarOccupancy on simulated ultrasonic echoes: a foreign
+// ping still echoing corrupts a reading, so independently timed sensors hear
+// each other while the round-robin ring never does; nearest range per sector
+// against a brute-force reference, UNKNOWN vs clear, expiry; sweep and
+// obstacle events with hysteresis.
+
+#include "TestSupport.h"
+#include "Core/EventBus.h"
+#include "Core/Logger.h"
+#include "Core/PolarOccupancy.h"
+#include "Devices/DistanceArray.h"
+#include <math.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+
+static const double SOUND_CM_PER_US = 0.0343;
+static const uint64_t ECHO_LIFE_US = 35000;     // Reverberation audible after a ping
+static const float MAX_RANGE = 400.0f;
+
+// Shared air: every ping keeps echoing for ECHO_LIFE_US
+struct Air {
+    struct Ping {
+        uint64_t atUs;
+        int sensor;
+        float rangeCm;              // Obstacle that ping reflects from
+    };
+    std::vector<Ping> pings;
+};
+
+// HC-SR04-like sensor: listens from its trigger until its own echo returns and
+// locks onto the first echo it hears, its own or a foreign one
+class SimSonar : public IDistanceDriver {
+public:
+    Air& air;
+    int id;
+    float obstacleCm;               // Truth along this sensor's beam, 0 = nothing in range
+    uint64_t triggeredUs = 0;
+    uint32_t readings = 0, corrupted = 0;
+
+    SimSonar(Air& a, int sensor, float cm) : air(a), id(sensor), obstacleCm(cm) {}
+
+    void triggerMeasurement() override {
+        triggeredUs = Host::clockUs;
+        air.pings.push_back({triggeredUs, id, obstacleCm});
+    }
+
+    float readDistanceCm() override {
+        uint64_t t = triggeredUs;
+        bool echo = obstacleCm > 0.0f && obstacleCm <= MAX_RANGE;
+        uint64_t own = echo ? t + (uint64_t)(2.0 * obstacleCm / SOUND_CM_PER_US) : t + ECHO_LIFE_US;
+        uint64_t heard = own;
+        for (const Air::Ping& p : air.pings) {
+            if (p.sensor == id || p.atUs > t || t - p.atUs >= ECHO_LIFE_US) continue;
+            uint64_t arrival = p.atUs + (uint64_t)(2.0 * p.rangeCm / SOUND_CM_PER_US);
+            if (arrival < t) arrival = t;                       // Reverberation still ringing
+            if (arrival < heard) heard = arrival;
+        }
+        readings++;
+        if (heard == own) return echo ? obstacleCm : 0.0f;
+        corrupted++;
+        return (float)((heard - t) * SOUND_CM_PER_US / 2.0);
+    }
+
+    bool isMeasurementReady() const override { return true; }
+    float getMaxRange() const override { return MAX_RANGE; }
+};
+
+// ===== PolarOccupancy =====
+
+static float angleDiff(float a, float b) {
+    float d = fmodf(a - b, 360.0f);
+    if (d > 180.0f) d -= 360.0f;
+    if (d < -180.0f) d += 360.0f;
+    return d;
+}
+
+static void nearestPerSector() {
+    // 12 sectors of 30 deg, 60 deg beams: each covers its own sector and one either side
+    PolarOccupancy map(12);
+    CHECK_EQ(map.addSource(0.0f, 60.0f, MAX_RANGE), 0);
+    CHECK_EQ(map.addSource(45.0f, 60.0f, MAX_RANGE), 1);
+    for (uint8_t s = 0; s < 12; s++) CHECK_EQ(map.getSectorRange(s), PolarOccupancy::UNKNOWN);
+    CHECK_EQ(map.getNearest(), PolarOccupancy::UNKNOWN);
+
+    map.update(0, 100.0f, 10);
+    map.update(1, 50.0f, 10);
+    CHECK_EQ(map.getSectorRange(11), 100.0f);
+    CHECK_EQ(map.getSectorRange(0), 100.0f);
+    CHECK_EQ(map.getSectorRange(1), 50.0f);                  // Under both beams - nearest wins
+    CHECK_EQ(map.getSectorRange(2), 50.0f);
+    CHECK_EQ(map.getSectorRange(3), PolarOccupancy::UNKNOWN); // Never seen is not clear
+    CHECK_EQ(map.rangeAt(-14.0f), 100.0f);
+    CHECK_EQ(map.rangeAt(50.0f), 50.0f);
+    CHECK_EQ(map.getNearest(), 50.0f);
+    CHECK_EQ(map.getNearestBearing(), 45.0f);
+
+    // No echo: clear up to max range
+    uint32_t seq = map.getSequence();
+    map.update(1, 0.0f, 20);
+    CHECK(map.getSequence() != seq);
+    CHECK_EQ(map.getSectorRange(1), 100.0f);
+    CHECK_EQ(map.getSectorRange(2), MAX_RANGE);
+    CHECK_EQ(map.getNearestBearing(), 0.0f);
+
+    // Source 0 goes stale: its sectors UNKNOWN, shared ones fall back to source 1
+    map.expire(115, 100);
+    CHECK_EQ(map.getSectorRange(0), PolarOccupancy::UNKNOWN);
+    CHECK_EQ(map.getSectorRange(1), MAX_RANGE);
+    CHECK_EQ(map.getSourceRange(0), PolarOccupancy::UNKNOWN);
+    CHECK_EQ(map.getNearest(), MAX_RANGE);
+    map.clear();
+    CHECK_EQ(map.getNearest(), PolarOccupancy::UNKNOWN);
+    map.update(5, 10.0f, 0);                                 // No such source
+    CHECK_EQ(map.getNearest(), PolarOccupancy::UNKNOWN);
+}
+
+static void matchesBruteForce() {
+    std::mt19937 rng(66);
+    std::uniform_real_distribution<float> bearing(-180.0f, 180.0f), beam(10.0f, 120.0f), range(-20.0f, 450.0f);
+    int mismatches = 0, updates = 0;
+    for (int round = 0; round < 50; round++) {
+        uint8_t sectors = (uint8_t)(4 + round % 33);
+        PolarOccupancy map(sectors);
+        float width = 360.0f / sectors;
+        float bearings[8], beams[8], readings[8];
+        for (int i = 0; i < 8; i++) {
+            bearings[i] = bearing(rng);
+            beams[i] = beam(rng);
+            readings[i] = PolarOccupancy::UNKNOWN;
+            CHECK_EQ(map.addSource(bearings[i], beams[i], MAX_RANGE), i);
+        }
+        CHECK_EQ(map.addSource(0.0f, 30.0f, MAX_RANGE), -1);
+
+        for (int u = 0; u < 200; u++, updates++) {
+            int src = (int)(rng() % 8);
+            float r = range(rng);
+            map.update((uint8_t)src, r, (uint32_t)u);
+            readings[src] = (r <= 0.0f || r > MAX_RANGE) ? MAX_RANGE : r;
+
+            for (uint8_t s = 0; s < sectors; s++) {
+                float best = PolarOccupancy::UNKNOWN;
+                for (int i = 0; i < 8; i++) {
+                    bool covers = fabsf(angleDiff(s * width, bearings[i])) < beams[i] / 2.0f + width / 2.0f ||
+                                  map.sectorOf(bearings[i]) == s;
+                    if (covers && readings[i] != PolarOccupancy::UNKNOWN && (best == PolarOccupancy::UNKNOWN || readings[i] < best)) {
+                        best = readings[i];
+                    }
+                }
+                if (map.getSectorRange(s) != best) mismatches++;
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(updates, 10000);
+}
+
+// ===== DistanceArray =====
+
+static std::vector<std::string> events;
+static void record(const Event& evt) { events.push_back(evt.name); }
+
+static int count(const char* name) {
+    int n = 0;
+    for (const std::string& e : events) n += (e == name);
+    return n;
+}
+
+// Four sensors at 0/90/180/270 looking at 80/150/220/60 cm
+struct Ring {
+    Air air;
+    SimSonar sonars[4] = {{air, 0, 80.0f}, {air, 1, 150.0f}, {air, 2, 220.0f}, {air, 3, 60.0f}};
+    IDistanceDriver* drivers[4] = {&sonars[0], &sonars[1], &sonars[2], &sonars[3]};
+    float bearings[4] = {0.0f, 90.0f, 180.0f, 270.0f};
+
+    uint32_t readings() const { uint32_t n = 0; for (const SimSonar& s : sonars) n += s.readings; return n; }
+    uint32_t corrupted() const { uint32_t n = 0; for (const SimSonar& s : sonars) n += s.corrupted; return n; }
+};
+
+// Loop passes every 1 ms
+static void runFor(Devices::DistanceArray& array, EventBus& bus, uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        Host::advanceMs(1);
+        array.update();
+        bus.processEvents();
+    }
+}
+
+static void independentTimersHearEachOther() {
+    // Each sensor on its own 100 ms timer, staggered as DistanceSensor devices would be
+    Ring ring;
+    const uint32_t offsets[4] = {0, 13, 29, 41};
+    for (uint32_t ms = 0; ms < 25000; ms++) {
+        Host::advanceMs(1);
+        for (int i = 0; i < 4; i++) {
+            if ((ms + 100 - offsets[i]) % 100 == 0) {
+                ring.sonars[i].triggerMeasurement();
+                ring.sonars[i].readDistanceCm();
+            }
+        }
+    }
+    printf("    independent 100 ms timers: %u of %u readings corrupted\n", (unsigned)ring.corrupted(),
+           (unsigned)ring.readings());
+    CHECK_EQ(ring.readings(), 1000);
+    CHECK(ring.corrupted() > 400);
+}
+
+static void roundRobinNeverHearsForeignPings() {
+    EventBus bus;
+    bus.subscribe("distance.array.sweep", record);
+    events.clear();
+    Ring ring;
+    Devices::DistanceArray array(ring.drivers, ring.bearings, 4, 660, "Sonar", bus, 12);
+    CHECK(array.initialize());
+    CHECK(!array.isInputReady());
+    CHECK_EQ(array.getTimeUntilUpdate((uint32_t)Host::clockUs), 0);
+
+    runFor(array, bus, 10000);                               // 40 ms slots: 250 readings
+    printf("    round-robin 40 ms slots: %u of %u readings corrupted\n", (unsigned)ring.corrupted(),
+           (unsigned)ring.readings());
+    CHECK_EQ(ring.readings(), 250);
+    CHECK_EQ(ring.corrupted(), 0);
+    CHECK_EQ(array.getSweepCount(), 62);
+    CHECK_EQ(count("distance.array.sweep"), 62);
+    CHECK(array.isInputReady());
+
+    // Every sector under a beam holds that sensor's truth; the rest are UNKNOWN
+    CHECK_EQ(array.rangeAt(0.0f), 80.0f);
+    CHECK_EQ(array.rangeAt(90.0f), 150.0f);
+    CHECK_EQ(array.rangeAt(180.0f), 220.0f);
+    CHECK_EQ(array.rangeAt(-90.0f), 60.0f);
+    CHECK_EQ(array.rangeAt(45.0f), PolarOccupancy::UNKNOWN);
+    CHECK_EQ(array.getNearest(), 60.0f);
+    CHECK_EQ(array.getNearestBearing(), 270.0f);
+    CHECK_NEAR(array.readAnalog(0), 80.0f / MAX_RANGE, 1e-6f);
+    CHECK_EQ(array.readAnalog(1), 0.0f);                     // UNKNOWN reads as 0
+    const Devices::RangeReading& last = array.getLastReading();
+    CHECK_EQ(last.sensor, 1);
+    CHECK_EQ(last.bearingDeg, 90.0f);
+
+    // Between slots the loop may sleep until the next sensor is due
+    uint32_t wait = array.getTimeUntilUpdate((uint32_t)Host::clockUs);
+    CHECK(wait > 0 && wait <= 40000);
+
+    // Slots shorter than the echo life bring the crosstalk back
+    array.setSlotInterval(20);
+    uint32_t before = ring.corrupted();
+    runFor(array, bus, 2000);
+    CHECK(ring.corrupted() - before > 50);
+}
+
+static void obstacleEventsWithHysteresis() {
+    EventBus bus;
+    bus.subscribe("obstacle.detected", record);
+    bus.subscribe("obstacle.cleared", record);
+    events.clear();
+    Ring ring;
+    ring.sonars[3].obstacleCm = 300.0f;
+    Devices::DistanceArray array(ring.drivers, ring.bearings, 4, 661, "Sonar", bus, 12);
+    array.setAlertDistance(50.0f);
+    CHECK(array.initialize());
+    runFor(array, bus, 400);
+    CHECK_EQ(count("obstacle.detected"), 0);
+
+    // Front obstacle approaches to 40 cm, hovers around the threshold, then leaves
+    const float path[] = {70.0f, 60.0f, 49.0f, 40.0f, 52.0f, 48.0f, 54.0f, 56.0f, 70.0f};
+    int detectedAt = -1, clearedAt = -1;
+    for (int i = 0; i < (int)(sizeof(path) / sizeof(path[0])); i++) {
+        ring.sonars[0].obstacleCm = path[i];
+        runFor(array, bus, 160);                             // One sweep
+        if (detectedAt < 0 && count("obstacle.detected") > 0) detectedAt = i;
+        if (clearedAt < 0 && count("obstacle.cleared") > 0) clearedAt = i;
+        CHECK_EQ(array.readDigital(0), path[i] < 50.0f);
+    }
+    CHECK_EQ(count("obstacle.detected"), 1);
+    CHECK_EQ(count("obstacle.cleared"), 1);
+    CHECK_EQ(detectedAt, 2);
+    CHECK_EQ(clearedAt, 7);                                  // First reading past 55 cm
+}
+
+int main() {
+    RUN_TEST(nearestPerSector);
+    RUN_TEST(matchesBruteForce);
+    RUN_TEST(independentTimersHearEachOther);
+    RUN_TEST(roundRobinNeverHearsForeignPings);
+    RUN_TEST(obstacleEventsWithHysteresis);
+    return TEST_RESULT();
+}
@@ -0,0 +1,144 @@
+// ESP32LEDC: logical -> hardware channel mapping, channel / timer exhaustion,
+// duty resolution. LEDC channel and timer counters are shared by every
+// instance, so the cases below run in order and build on each other.
+
+#include "TestSupport.h"
+#include "Drivers/PWM/ESP32LEDC.h"
+
+using TwiST::Drivers::ESP32LEDC;
+
+static ESP32LEDC servos(50, 14);       // 2 channels: hardware 0-1, timer 0
+static ESP32LEDC leds(1000, 10);       // 1 channel:  hardware 2, timer 1
+
+static void attachRejectsBadRequests() {
+    ESP32LEDC pwm(50, 14);
+    CHECK(pwm.attach(0, 4));
+    CHECK(!pwm.attach(0, 5));                          // Channel already mapped
+    CHECK(!pwm.attach(1, 4));                          // GPIO already used
+    CHECK(!pwm.attach(TWIST_LEDC_MAX_CHANNELS, 6));    // Out of range
+    CHECK_EQ(pwm.getAttachedCount(), 1);
+    CHECK_EQ(pwm.getHardwareChannel(0), -1);           // Not started yet
+}
+
+static void beginRejectsInvalidConfiguration() {
+    ESP32LEDC tooFine(50, 17);
+    CHECK(tooFine.attach(0, 4));
+    CHECK(!tooFine.begin());                           // 1-16 bits only
+
+    ESP32LEDC tooFast(2000, 16);
+    CHECK(tooFast.attach(0, 4));
+    CHECK(!tooFast.begin());                           // 2 kHz x 65536 > 80 MHz
+
+    ESP32LEDC empty(50, 14);
+    CHECK(!empty.begin());                             // Nothing attached
+
+    // Rejections claim nothing
+    for (int t = 0; t < LEDC_TIMER_MAX; t++) CHECK(!Host::ledcTimers[t].configured);
+}
+
+static void defaultResolution() {
+    ESP32LEDC pwm(50, 0);
+    CHECK_EQ(pwm.getResolution(), TWIST_LEDC_DEFAULT_BITS);
+}
+
+static void mapsLogicalChannelsInOrder() {
+    CHECK(servos.attach(3, 10));
+    CHECK(servos.attach(0, 11));
+    CHECK(servos.begin());
+    CHECK(servos.isStarted());
+
+    // Logical channels take hardware channels in ascending logical order
+    CHECK_EQ(servos.getHardwareChannel(0), 0);
+    CHECK_EQ(servos.getHardwareChannel(3), 1);
+    CHECK_EQ(servos.getHardwareChannel(1), -1);
+    CHECK_EQ(Host::ledcChannels[0].gpio, 11);
+    CHECK_EQ(Host::ledcChannels[1].gpio, 10);
+    CHECK_EQ(Host::ledcChannels[0].timer, 0);
+    CHECK_EQ(Host::ledcChannels[1].timer, 0);
+
+    CHECK(Host::ledcTimers[0].configured);
+    CHECK_EQ(Host::ledcTimers[0].freqHz, 50);
+    CHECK_EQ(Host::ledcTimers[0].bits, 14);
+
+    CHECK(!servos.attach(5, 12));                      // Mapping is frozen after begin()
+
+    // Unmapped channels are ignored
+    unsigned long before = Host::ledcChannels[0].updates + Host::ledcChannels[1].updates;
+    servos.setPWM(1, 1000);
+    servos.setPWM(TWIST_LEDC_MAX_CHANNELS, 1000);
+    CHECK_EQ(Host::ledcChannels[0].updates + Host::ledcChannels[1].updates, before);
+}
+
+static void dutyFollowsResolution() {
+    CHECK_EQ(servos.getMaxPWM(), 16383);
+
+    servos.setPWM(3, 1229);                            // ~1.5 ms at 50 Hz / 14-bit
+    CHECK_EQ(Host::ledcChannels[1].duty, 1229);
+    CHECK_EQ(Host::ledcChannels[1].updates, 1);
+    servos.setPWM(0, 20000);                           // Clamped to the top count
+    CHECK_EQ(Host::ledcChannels[0].duty, 16383);
+
+    CHECK(leds.attach(7, 20));
+    CHECK(leds.begin());
+    CHECK_EQ(leds.getHardwareChannel(7), 2);
+    CHECK_EQ(Host::ledcChannels[2].timer, 1);
+    CHECK_EQ(Host::ledcTimers[1].bits, 10);
+    CHECK_EQ(leds.getMaxPWM(), 1023);
+    leds.setPWM(7, 4095);
+    CHECK_EQ(Host::ledcChannels[2].duty, 1023);
+    leds.setPWM(7, 512);
+    CHECK_EQ(Host::ledcChannels[2].duty, 512);
+}
+
+static void rejectsWhenChannelsRunOut() {
+    // 3 of 6 hardware channels used - 4 more do not fit
+    ESP32LEDC wide(50, 14);
+    for (uint8_t i = 0; i < 4; i++) CHECK(wide.attach(i, 30 + i));
+    CHECK(!wide.begin());
+    CHECK(!Host::ledcTimers[2].configured);            // No timer claimed
+
+    static ESP32LEDC third(100, 12);
+    CHECK(third.attach(0, 40));
+    CHECK(third.begin());
+    CHECK_EQ(third.getHardwareChannel(0), 3);
+    CHECK_EQ(Host::ledcChannels[3].timer, 2);
+}
+
+static void rejectsWhenTimersRunOut() {
+    static ESP32LEDC fourth(200, 12);
+    CHECK(fourth.attach(0, 41));
+    CHECK(fourth.begin());
+    CHECK_EQ(Host::ledcChannels[4].timer, 3);
+
+    // Hardware channel 5 is still free, but all 4 timers are taken
+    ESP32LEDC fifth(300, 12);
+    CHECK(fifth.attach(0, 42));
+    CHECK(!fifth.begin());
+    CHECK_EQ(fifth.getHardwareChannel(0), -1);
+    CHECK_EQ(Host::ledcChannels[5].gpio, -1);
+}
+
+static void frequencyChangesAreValidated() {
+    servos.setFrequency(100.0f);
+    CHECK_EQ(Host::ledcTimers[0].freqHz, 100);
+
+    servos.setFrequency(5000.0f);                      // 5 kHz x 16384 > 80 MHz
+    CHECK_EQ(Host::ledcTimers[0].freqHz, 100);
+
+    leds.setFrequency(0.0f);
+    CHECK_EQ(Host::ledcTimers[1].freqHz, 1000);
+    leds.setFrequency(20000.0f);                       // 20 kHz x 1024 fits
+    CHECK_EQ(Host::ledcTimers[1].freqHz, 20000);
+}
+
+int main() {
+    RUN_TEST(attachRejectsBadRequests);
+    RUN_TEST(beginRejectsInvalidConfiguration);
+    RUN_TEST(defaultResolution);
+    RUN_TEST(mapsLogicalChannelsInOrder);
+    RUN_TEST(dutyFollowsResolution);
+    RUN_TEST(rejectsWhenChannelsRunOut);
+    RUN_TEST(rejectsWhenTimersRunOut);
+    RUN_TEST(frequencyChangesAreValidated);
+    return TEST_RESULT();
+}
@@ -0,0 +1,254 @@
+// EventBridge over a real 127.0.0.1 UDP socket pair (UDPTransport on the
+// board side, EventBridgeClient as the PC peer): topic filters, rate limits,
+// priority snapping, one datagram per tick; delivered counts and latency at
+// 1k / 10k / 50k events/s in both directions.
+
+#include "TestSupport.h"
+#include "EventBridgeClient.h"
+#include "Core/EventBridge.h"
+#include "Drivers/Transport/UDPTransport.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+using Drivers::UDPTransport;
+
+// Received on either side: name, source, priority and latency in ticks
+struct Seen {
+    std::string name;
+    uint16_t source;
+    uint8_t priority;
+    unsigned long latencyMs;
+};
+
+// Board (EventBus + EventBridge on UDPTransport) and PC client on one host
+struct Link {
+    EventBus bus;
+    UDPTransport transport;
+    EventBridge bridge;
+    EventBridgeClient* client;
+    std::vector<Seen> atClient, atBoard;
+    unsigned long maxClientLatency = 0, maxBoardLatency = 0;
+    uint32_t sentAtMs = 0;                             // Tick the client's last datagram left
+
+    Link() : transport(0), bridge(transport, bus), client(NULL) {
+        CHECK(transport.begin());
+        client = new EventBridgeClient(Host::udpBoundPort);
+        CHECK(client->isOpen());
+        CHECK(client->hello());
+        tick();                                        // Board learns the client's address
+    }
+    ~Link() { delete client; }
+
+    // One 1 ms loop pass in framework order (queued events first, bridge last)
+    void boardPass() {
+        Host::advanceMs(1);
+        bus.processEvents();
+        bridge.update();
+    }
+
+    void tick() {
+        boardPass();
+        client->poll(onClientEvent, this);
+    }
+
+    void listen(const char* topic, EventPriority priority = PRIORITY_NORMAL) {
+        bus.subscribe(topic, onBoardEvent, this, priority);
+    }
+
+    static void onClientEvent(const EventRecord& record, void* context) {
+        Link* link = static_cast<Link*>(context);
+        unsigned long latency = millis() - record.timestamp;
+        if (latency > link->maxClientLatency) link->maxClientLatency = latency;
+        if (link->atClient.size() < 100) {
+            link->atClient.push_back({std::string(record.name, record.nameLength), record.sourceDeviceId,
+                                      record.priority, latency});
+        }
+    }
+
+    // publishAsync() stamps arrival time, so latency is measured from the client's send tick
+    static void onBoardEvent(const Event& event, void* context) {
+        Link* link = static_cast<Link*>(context);
+        unsigned long latency = millis() - link->sentAtMs;
+        if (latency > link->maxBoardLatency) link->maxBoardLatency = latency;
+        if (link->atBoard.size() < 100) {
+            link->atBoard.push_back({event.name, event.sourceDeviceId, (uint8_t)event.priority, latency});
+        }
+    }
+
+    void publish(const char* name, uint16_t source = 0, EventPriority priority = PRIORITY_NORMAL) {
+        Event event = {name, source, NULL, priority, millis()};
+        bus.publish(event);
+    }
+};
+
+static void codecRoundTrip() {
+    uint8_t payload[64];
+    EventBatchWriter writer(payload, sizeof(payload), 0xBEEF);
+    CHECK(writer.add("a", 1, 10, 0x12345678));
+    CHECK(writer.add("bb.cc", 65535, 30, 7));
+    CHECK(!writer.add(std::string(256, 'x').c_str(), 0, 0, 0));   // Name over 255 bytes
+    size_t room = sizeof(payload) - writer.length();
+    CHECK(!writer.add(std::string(room - EventCodec::ENTRY_BASE_SIZE + 1, 'y').c_str(), 0, 0, 0));
+    CHECK(writer.add(std::string(room - EventCodec::ENTRY_BASE_SIZE, 'y').c_str(), 0, 0, 0));
+    CHECK_EQ(writer.length(), sizeof(payload));
+    CHECK_EQ(writer.getCount(), 3);
+
+    EventBatchReader reader(payload, writer.length());
+    EventRecord r;
+    CHECK(reader.isValid());
+    CHECK_EQ(reader.getSequence(), 0xBEEF);
+    CHECK(reader.next(r) && r.nameLength == 1 && r.name[0] == 'a' && r.timestamp == 0x12345678);
+    CHECK(reader.next(r) && r.sourceDeviceId == 65535 && r.priority == 30 && r.timestamp == 7);
+    CHECK(r.name == (const char*)payload + EventCodec::HEADER_SIZE + EventCodec::entrySize(1) + 1);
+    CHECK(reader.next(r));
+    CHECK(!reader.next(r));
+
+    // Every truncation decodes only whole events, then reports invalid
+    const size_t first = EventCodec::HEADER_SIZE + EventCodec::entrySize(1);
+    const size_t second = first + EventCodec::entrySize(5);
+    bool clean = true;
+    for (size_t length = 0; length < writer.length(); length++) {
+        EventBatchReader cut(payload, length);
+        int decoded = 0;
+        while (cut.next(r)) decoded++;
+        int complete = length >= second ? 2 : length >= first ? 1 : 0;
+        if (decoded != complete || cut.isValid()) clean = false;
+    }
+    CHECK(clean);
+}
+
+static void topicsFilterAndRateLimit() {
+    Link link;
+    CHECK(link.bridge.exportTopic("arm.fast"));
+    CHECK(link.bridge.exportTopic("arm.slow", 50));
+    CHECK(link.bridge.importTopic("app.estop"));
+    CHECK(!link.bridge.exportTopic("app.estop"));              // One direction per topic
+    link.listen("app.estop", PRIORITY_HIGH);
+
+    // Not exported: never leaves the board
+    link.publish("local.only");
+    link.publish("arm.fast", 7, PRIORITY_HIGH);
+    unsigned long flushes = link.bridge.getFlushCount();
+    link.tick();
+    CHECK_EQ(link.atClient.size(), 1);
+    CHECK(link.atClient[0].name == "arm.fast");
+    CHECK_EQ(link.atClient[0].source, 7);
+    CHECK_EQ(link.atClient[0].priority, PRIORITY_HIGH);
+    CHECK_EQ(link.bridge.getFlushCount(), flushes + 1);
+
+    // 20 events in one tick leave as one datagram (two frames at most)
+    for (int i = 0; i < 20; i++) link.publish("arm.fast", (uint16_t)i);
+    flushes = link.bridge.getFlushCount();
+    link.tick();
+    CHECK_EQ(link.atClient.size(), 21);
+    CHECK_EQ(link.bridge.getFlushCount(), flushes + 1);
+    CHECK_EQ(link.atClient[20].source, 19);
+
+    // 50 ms minimum interval: one per 50 ticks
+    for (int t = 0; t < 120; t++) {
+        link.publish("arm.slow");
+        link.tick();
+    }
+    size_t slow = 0;
+    for (const Seen& s : link.atClient) slow += (s.name == "arm.slow");
+    CHECK_EQ(slow, 3);                                         // t = 0, 50, 100
+    CHECK_EQ(link.bridge.getTopic(1)->rateLimited, 117);
+    CHECK_EQ(link.bridge.getEventsRateLimited(), 117);
+
+    // Incoming: only imported topics, priority snapped to a defined level
+    link.client->publish("app.estop", 3, 27, 0);
+    link.client->publish("arm.fast", 3, 10, 0);                // Exported, not imported
+    link.client->publish("app.other", 3, 10, 0);
+    link.client->flush();
+    link.sentAtMs = millis();
+    link.tick();
+    link.tick();
+    CHECK_EQ(link.atBoard.size(), 1);
+    CHECK(link.atBoard[0].name == "app.estop");
+    CHECK_EQ(link.atBoard[0].priority, PRIORITY_HIGH);         // 27 snaps down to 20
+    CHECK_EQ(link.atBoard[0].source, 3);
+    CHECK_EQ(link.bridge.getEventsRejected(), 2);
+    CHECK_EQ(link.bridge.getSequenceGapCount(), 0);
+    CHECK_EQ(link.client->getSequenceGapCount(), 0);
+    CHECK_EQ(link.client->getCrcErrorCount(), 0);
+}
+
+// ===== Throughput =====
+
+static void runRate(unsigned long eventsPerSecond) {
+    Link link;
+    CHECK(link.bridge.exportTopic("sensor.distance0"));        // 16-character names
+    CHECK(link.bridge.importTopic("dashboard.cmd000"));
+    link.listen("dashboard.cmd000");
+    link.tick();
+
+    typedef std::chrono::steady_clock Clock;
+    const unsigned long PER_TICK = eventsPerSecond / 1000;
+    const unsigned long TICKS = 1000;                          // 1 s at 1 kHz
+    double boardNs = 0.0;
+    unsigned long clientFull = 0;
+
+    for (unsigned long t = 0; t < TICKS; t++) {
+        Clock::time_point t0 = Clock::now();
+        for (unsigned long i = 0; i < PER_TICK; i++) link.publish("sensor.distance0", (uint16_t)i);
+        link.boardPass();
+        boardNs += std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+        link.client->poll(Link::onClientEvent, &link);
+
+        for (unsigned long i = 0; i < PER_TICK; i++) {
+            if (!link.client->publish("dashboard.cmd000", (uint16_t)i, PRIORITY_NORMAL, millis())) clientFull++;
+        }
+        link.client->flush();
+        link.sentAtMs = millis();
+    }
+    for (int drain = 0; drain < 5; drain++) {
+        link.client->flush();                                  // A frame that missed the last datagram
+        link.tick();
+    }
+
+    const unsigned long published = TICKS * PER_TICK;
+    unsigned long delivered = link.client->getEventsReceived();
+    unsigned long imported = link.bridge.getTopic(1)->forwarded;
+
+    // Every exported event is delivered or counted as dropped - never lost silently
+    CHECK_EQ(link.bridge.getEventsSent(), delivered);
+    CHECK_EQ(delivered + link.bridge.getEventsDropped(), published);
+    CHECK_EQ(link.client->getEventsSent() + clientFull, published);
+    CHECK_EQ(imported, link.client->getEventsSent());
+    CHECK_EQ(link.client->getCrcErrorCount(), 0);
+    CHECK_EQ(link.bridge.getEventsRejected(), 0);
+
+    if (eventsPerSecond <= 10000) {
+        CHECK_EQ(delivered, published);
+        CHECK_EQ(link.client->getSequenceGapCount(), 0);
+        CHECK(link.maxClientLatency <= 1);
+        CHECK_EQ(imported, published);
+        CHECK(link.maxBoardLatency <= 2);                      // Received next tick, listened the one after
+    } else {
+        // One TWIST_UDP_PACKET_SIZE datagram per tick caps each direction; whole
+        // frames that do not fit are dropped and show up as sequence gaps
+        CHECK(delivered >= 39000);
+        CHECK(imported >= 39000);
+        CHECK(link.client->getSequenceGapCount() > 0);
+    }
+
+    printf("    %5lu ev/s: out %lu delivered, %lu dropped, <= %lu ms | in %lu delivered, %lu dropped, <= %lu ms "
+           "| %.2f us/ev board-side\n",
+           eventsPerSecond, delivered, link.bridge.getEventsDropped(), link.maxClientLatency,
+           imported, clientFull, link.maxBoardLatency, boardNs / 1000.0 / (double)(2 * published));
+}
+
+static void throughput1k() { runRate(1000); }
+static void throughput10k() { runRate(10000); }
+static void throughput50k() { runRate(50000); }
+
+int main() {
+    RUN_TEST(codecRoundTrip);
+    RUN_TEST(topicsFilterAndRateLimit);
+    RUN_TEST(throughput1k);
+    RUN_TEST(throughput10k);
+    RUN_TEST(throughput50k);
+    return TEST_RESULT();
+}
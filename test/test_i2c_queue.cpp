@@ -0,0 +1,270 @@
+// I2CQueue: SPSC head / exec / tail ordering, full-queue drops, completion
+// retirement and retry notification; PCA9685 holding back writes while the
+// queue is full; when the loop may idle with and without a worker task.
+// No task ever runs - process() stands in for the worker.
+
+#include "TestSupport.h"
+#include "Core/I2CQueue.h"
+#include "Drivers/I2C/FakeI2CBus.h"
+#include "Drivers/I2C/FakePCA9685.h"
+#include "Drivers/PWM/PCA9685.h"
+
+using namespace TwiST;
+using Drivers::FakeI2CBus;
+using Drivers::FakePCA9685;
+
+struct Completions {
+    uint8_t order[64];
+    bool success[64];
+    int count = 0;
+};
+
+static void recordCompletion(uint8_t address, bool success, void* context) {
+    Completions* c = static_cast<Completions*>(context);
+    c->order[c->count] = address;
+    c->success[c->count] = success;
+    c->count++;
+}
+
+static void channelWrite(I2CQueue& queue, uint8_t address, uint8_t channel, uint16_t off,
+                         Completions* done = NULL) {
+    uint8_t data[4] = {0, 0, (uint8_t)(off & 0xFF), (uint8_t)(off >> 8)};
+    queue.writeRegister(address, (uint8_t)(FakePCA9685::LED0_ON_L + 4 * channel), data, 4,
+                        done ? recordCompletion : NULL, done);
+}
+
+static void workerRunsInSubmitOrder() {
+    FakeI2CBus bus;
+    I2CQueue queue(bus);
+    Completions done;
+
+    for (uint8_t ch = 0; ch < 16; ch++) channelWrite(queue, 0x40 + ch, ch, 100 + ch, &done);
+    CHECK_EQ(queue.getDepth(), 16);
+    CHECK_EQ(bus.getTransactionCount(), 0);
+
+    // Worker side runs part of the queue - slots stay owned until retired
+    CHECK_EQ(queue.process(5), 5);
+    CHECK_EQ(bus.getTransactionCount(), 5);
+    CHECK_EQ(queue.getDepth(), 16);
+    CHECK_EQ(done.count, 0);                           // Callbacks only from update()
+
+    queue.update();                                    // Runs the rest, retires all 16
+    CHECK_EQ(bus.getTransactionCount(), 16);
+    CHECK_EQ(queue.getDepth(), 0);
+    CHECK_EQ(done.count, 16);
+    for (uint8_t ch = 0; ch < 16; ch++) {
+        CHECK_EQ(done.order[ch], 0x40 + ch);
+        const FakeI2CBus::Record* r = bus.getRecord(15 - ch);
+        CHECK(r != NULL);
+        CHECK_EQ(r->address, 0x40 + ch);
+        CHECK_EQ(r->data[0], FakePCA9685::LED0_ON_L + 4 * ch);
+        CHECK_EQ(r->data[3] | (r->data[4] << 8), 100 + ch);
+    }
+    CHECK_EQ(queue.getSubmittedCount(), 16);
+    CHECK_EQ(queue.getCompletedCount(), 16);
+    CHECK_EQ(queue.getMaxDepth(), 16);
+}
+
+static void fullQueueDropsUntilRetired() {
+    FakeI2CBus bus;
+    I2CQueue queue(bus);
+    uint8_t data[4] = {1, 2, 3, 4};
+
+    for (int i = 0; i < TWIST_I2C_QUEUE_DEPTH; i++) CHECK(queue.writeRegister(0x40, 6, data, 4));
+    CHECK(queue.isFull());
+    CHECK(!queue.writeRegister(0x40, 6, data, 4));
+    CHECK_EQ(queue.getDroppedCount(), 1);
+
+    // Executed is not free: the slot is reused only after update() retires it
+    CHECK_EQ(queue.process(1), 1);
+    CHECK(queue.isFull());
+    CHECK(!queue.writeRegister(0x40, 6, data, 4));
+    CHECK_EQ(queue.getDroppedCount(), 2);
+
+    queue.update();
+    CHECK(!queue.isFull());
+    CHECK(queue.writeRegister(0x40, 6, data, 4));
+    CHECK_EQ(queue.getSubmittedCount(), TWIST_I2C_QUEUE_DEPTH + 1);
+    CHECK_EQ(queue.getMaxDepth(), TWIST_I2C_QUEUE_DEPTH);
+
+    // Too long for a slot - dropped without touching the ring
+    uint8_t big[TWIST_I2C_MAX_DATA] = {0};
+    CHECK(!queue.writeRegister(0x40, 6, big, TWIST_I2C_MAX_DATA));
+    CHECK_EQ(queue.getDroppedCount(), 3);
+    CHECK_EQ(queue.getDepth(), 1);
+}
+
+static void retirementReportsResultAndLatency() {
+    FakeI2CBus bus;
+    I2CQueue queue(bus);
+    Completions done;
+    bus.setNackAddress(0x41);
+
+    channelWrite(queue, 0x40, 0, 200, &done);
+    channelWrite(queue, 0x41, 0, 200, &done);
+    Host::advanceUs(750);
+    queue.update();
+
+    CHECK_EQ(done.count, 2);
+    CHECK(done.success[0]);
+    CHECK(!done.success[1]);
+    CHECK_EQ(queue.getCompletedCount(), 2);
+    CHECK_EQ(queue.getFailedCount(), 1);
+    CHECK_EQ(queue.getLastLatencyMicros(), 750);
+    CHECK_EQ(queue.getAverageLatencyMicros(), 750);
+
+    queue.resetStatistics();
+    CHECK_EQ(queue.getCompletedCount(), 0);
+    CHECK_EQ(queue.getFailedCount(), 0);
+    CHECK_EQ(queue.getMaxDepth(), 0);
+}
+
+static void idleOnlyWhileNothingToRetire() {
+    FakeI2CBus bus;
+    I2CQueue queue(bus);
+    const uint32_t WINDOW = TWIST_I2C_STATS_WINDOW_MS * 1000UL;
+    uint8_t data[4] = {0};
+
+    // Inline: queued work runs on the next update(), so the loop must not sleep
+    queue.update();                                    // Opens the utilization window
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), WINDOW);
+    queue.writeRegister(0x40, 6, data, 4);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), 0);
+    queue.update();
+    Host::advanceMs(10);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), WINDOW - 10000);
+
+    // Worker: transactions on the bus are its business until they complete
+    Host::taskCreateSucceeds = true;
+    CHECK(queue.startTask());
+    Host::taskCreateSucceeds = false;
+    CHECK(queue.isTaskRunning());
+    for (int i = 0; i < 3; i++) queue.writeRegister(0x40, 6, data, 4);
+    CHECK_EQ(queue.getDepth(), 3);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), WINDOW - 10000);
+
+    CHECK_EQ(queue.process(1), 1);                     // One finished, two still queued
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), 0);
+    queue.update();                                    // Worker runs - update() only retires
+    CHECK_EQ(queue.getCompletedCount(), 2);
+    CHECK_EQ(queue.getDepth(), 2);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), WINDOW - 10000);
+
+    CHECK_EQ(queue.process(), 2);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), 0);
+    queue.update();
+    CHECK_EQ(queue.getDepth(), 0);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), WINDOW - 10000);
+
+    // Window rollover still wakes the loop for the utilization sample
+    Host::advanceUs(WINDOW);
+    CHECK_EQ(queue.getTimeUntilUpdate(micros()), 0);
+}
+
+static int retries = 0;
+static void countRetry(void* context) { retries++; }
+
+static void retryRunsOnceSpaceIsFree() {
+    FakeI2CBus bus;
+    I2CQueue queue(bus);
+    uint8_t data[4] = {0};
+
+    for (int i = 0; i < TWIST_I2C_QUEUE_DEPTH; i++) queue.writeRegister(0x40, 6, data, 4);
+    retries = 0;
+    CHECK(queue.requestRetry(countRetry, NULL));
+    CHECK(queue.requestRetry(countRetry, NULL));       // Same waiter - no duplicate
+    queue.update();
+    CHECK_EQ(retries, 1);
+    queue.update();
+    CHECK_EQ(retries, 1);                              // One-shot
+
+    static int contexts[TWIST_I2C_RETRY_SLOTS + 1];
+    for (int i = 0; i < TWIST_I2C_RETRY_SLOTS; i++) CHECK(queue.requestRetry(countRetry, &contexts[i]));
+    CHECK(!queue.requestRetry(countRetry, &contexts[TWIST_I2C_RETRY_SLOTS]));
+    queue.update();                                    // Queue not full - all run
+    CHECK_EQ(retries, 1 + TWIST_I2C_RETRY_SLOTS);
+}
+
+static void pca9685HoldsWritesWhileFull() {
+    FakePCA9685 chip(0x40);
+    I2CQueue queue(chip);
+    Drivers::PCA9685 pwm(0x40);
+    pwm.setQueue(&queue);
+
+    // Another device fills the queue
+    for (int i = 0; i < TWIST_I2C_QUEUE_DEPTH; i++) channelWrite(queue, 0x41, 15, 0);
+    CHECK(queue.isFull());
+
+    pwm.setPWM(0, 300);
+    pwm.setPWM(0, 350);                                // Replaces the held 300
+    pwm.setOff(1);
+    CHECK_EQ(pwm.getPendingMask(), 0x0003);
+    CHECK_EQ(pwm.getDeferredCount(), 3);
+    CHECK_EQ(pwm.getCoalescedCount(), 1);
+    CHECK_EQ(queue.getDroppedCount(), 0);              // Held, not an I2CQueue drop
+
+    queue.update();                                    // Retire -> retry queues channel 0 and 1
+    CHECK_EQ(pwm.getPendingMask(), 0);
+    CHECK_EQ(chip.getChannelWrites(0), 0);
+    queue.update();
+    CHECK_EQ(chip.getOff(0), 350);
+    CHECK(!chip.isFullOff(0));
+    CHECK(chip.isFullOff(1));
+    CHECK_EQ(chip.getChannelWrites(0), 1);             // 300 never reached the chip
+
+    // Normal path again
+    pwm.setPWM(0, 410);
+    queue.update();
+    CHECK_EQ(chip.getOff(0), 410);
+    CHECK_EQ(pwm.getDeferredCount(), 3);
+}
+
+static void sixteenChannelRun() {
+    FakePCA9685 chip(0x40);
+    I2CQueue queue(chip);
+    Drivers::PCA9685 pwm(0x40);
+    pwm.setQueue(&queue);
+
+    const int TICKS = 200;
+    for (int tick = 0; tick < TICKS; tick++) {
+        for (uint8_t ch = 0; ch < 16; ch++) {
+            pwm.setPWM(ch, (uint16_t)(205 + ((tick * 7 + ch * 13) % 205)));
+        }
+        Host::advanceUs(2500);
+        queue.update();
+    }
+
+    CHECK_EQ(queue.getSubmittedCount(), TICKS * 16);
+    CHECK_EQ(queue.getCompletedCount(), TICKS * 16);
+    CHECK_EQ(queue.getDroppedCount(), 0);
+    CHECK_EQ(queue.getMaxDepth(), 16);
+    CHECK_EQ(pwm.getDeferredCount(), 0);
+    for (uint8_t ch = 0; ch < 16; ch++) {
+        CHECK_EQ(chip.getOff(ch), 205 + (((TICKS - 1) * 7 + ch * 13) % 205));
+        CHECK_EQ(chip.getOn(ch), 0);
+        CHECK_EQ(chip.getChannelWrites(ch), TICKS);
+    }
+}
+
+static void pca9685BlockingWithoutQueue() {
+    Host::resetAdafruit();
+    Drivers::PCA9685 pwm(0x40);
+    pwm.setPWM(4, 307);
+    pwm.setOff(5);
+    pwm.setPWM(16, 1);                                 // Out of range
+    CHECK_EQ(Host::adafruitWrites, 2);
+    CHECK_EQ(Host::adafruitChannels[4].off, 307);
+    CHECK_EQ(Host::adafruitChannels[5].off, 4096);
+}
+
+int main() {
+    RUN_TEST(workerRunsInSubmitOrder);
+    RUN_TEST(fullQueueDropsUntilRetired);
+    RUN_TEST(retirementReportsResultAndLatency);
+    RUN_TEST(idleOnlyWhileNothingToRetire);
+    RUN_TEST(retryRunsOnceSpaceIsFree);
+    RUN_TEST(pca9685HoldsWritesWhileFull);
+    RUN_TEST(sixteenChannelRun);
+    RUN_TEST(pca9685BlockingWithoutQueue);
+    return TEST_RESULT();
+}
@@ -0,0 +1,260 @@
+// JointConstraints: soft limits, keep-out half-planes and velocity limits
+// projected per write; a joint whose interval is empty holds its committed
+// value; isAllowed(); project() over 32 chained joints always lands on an
+// allowed pose, within a per-pass time budget.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/JointConstraints.h"
+#include "Core/Logger.h"
+#include <chrono>
+#include <random>
+
+using namespace TwiST;
+
+// Average host cost of one 32-joint project() pass (about 0.5 us at -O2)
+static const double PROJECT_BUDGET_US = 10.0;
+
+static void softLimitsClamp() {
+    JointConstraints limits;
+    FakeOutputDevice shoulder(1), elbow(2);
+    shoulder.value = 90.0f;
+    CHECK(limits.addJoint(shoulder, 10.0f, 170.0f));
+    CHECK(!limits.addJoint(shoulder, 0.0f, 180.0f));   // Already added
+    CHECK(!limits.addJoint(elbow, 90.0f, 10.0f));      // Inverted
+    CHECK(limits.addJoint(elbow, 0.0f, 180.0f));
+    CHECK_EQ(limits.getCommitted(0), 90.0f);           // Current value is the starting point
+
+    CHECK_EQ(limits.constrain(1, 200.0f), 170.0f);
+    CHECK_EQ(limits.constrain(1, -5.0f), 10.0f);
+    CHECK_EQ(limits.constrain(1, 42.0f), 42.0f);
+    CHECK_EQ(limits.getCommitted(0), 42.0f);
+    CHECK_EQ(limits.getLimitClampCount(), 2);
+    CHECK_EQ(limits.constrain(99, 1234.0f), 1234.0f);  // Not a joint - untouched
+
+    CHECK(limits.setSoftLimits(1, 40.0f, 50.0f));
+    CHECK(!limits.setSoftLimits(1, 50.0f, 40.0f));
+    CHECK(!limits.setSoftLimits(99, 0.0f, 1.0f));
+    CHECK_EQ(limits.constrain(1, 60.0f), 50.0f);
+}
+
+static void keepOutBoundsPartner() {
+    JointConstraints limits;
+    FakeOutputDevice shoulder(1), elbow(2);
+    shoulder.value = 30.0f;
+    elbow.value = 90.0f;
+    limits.addJoint(shoulder, 0.0f, 180.0f);
+    limits.addJoint(elbow, 0.0f, 180.0f);
+
+    CHECK(!limits.addKeepOut(1, -1.0f, 3, -1.0f, -60.0f));  // Unknown joint
+    CHECK(!limits.addKeepOut(1, -1.0f, 1, -1.0f, -60.0f));  // Same joint twice
+    CHECK(!limits.addKeepOut(1, 0.0f, 2, -1.0f, -60.0f));   // Use soft limits
+    CHECK(limits.addKeepOut(1, -1.0f, 2, -1.0f, -60.0f));   // shoulder + elbow >= 60
+    CHECK_EQ(limits.getKeepOutCount(), 1);
+
+    // Elbow bounded below by 60 - shoulder, shoulder by 60 - elbow
+    CHECK_EQ(limits.constrain(2, 0.0f), 30.0f);
+    CHECK_EQ(limits.constrain(1, 0.0f), 30.0f);        // Elbow now at 30
+    CHECK_EQ(limits.constrain(2, 45.0f), 45.0f);
+    CHECK_EQ(limits.constrain(1, 0.0f), 15.0f);
+    CHECK_EQ(limits.getKeepOutClampCount(), 3);
+
+    // Positive coefficient bounds from above: elbow <= 150 - shoulder
+    CHECK(limits.addKeepOut(2, 1.0f, 1, 1.0f, 150.0f));
+    CHECK_EQ(limits.constrain(2, 170.0f), 135.0f);
+    CHECK_EQ(limits.constrain(1, 170.0f), 15.0f);      // 150 - 135
+    float pose[] = {limits.getCommitted(0), limits.getCommitted(1)};
+    CHECK(limits.isAllowed(pose));
+}
+
+static void velocityLimitSlews() {
+    JointConstraints limits;
+    FakeOutputDevice wrist(5);
+    limits.addJoint(wrist, -90.0f, 90.0f, 100.0f);     // 100 deg/s
+
+    Host::advanceMs(10);
+    CHECK_NEAR(limits.constrain(5, 45.0f), 1.0f, 1e-4);
+    Host::advanceMs(10);
+    CHECK_NEAR(limits.constrain(5, 45.0f), 2.0f, 1e-4);
+    Host::advanceMs(10);
+    CHECK_NEAR(limits.constrain(5, -45.0f), 1.0f, 1e-4);   // Both directions
+
+    // Idle for a second: credited at most TWIST_CONSTRAINT_MAX_DT_MS
+    Host::advanceMs(1000);
+    CHECK_NEAR(limits.constrain(5, 45.0f), 1.0f + 100.0f * TWIST_CONSTRAINT_MAX_DT_MS / 1000.0f, 1e-4);
+
+    // Within reach: exact
+    Host::advanceMs(20);
+    float at = limits.getCommitted(0);
+    CHECK_EQ(limits.constrain(5, at - 1.5f), at - 1.5f);
+    CHECK_EQ(limits.getVelocityClampCount(), 4);
+
+    CHECK(limits.setVelocityLimit(5, 0.0f));           // Unlimited
+    CHECK_EQ(limits.constrain(5, 80.0f), 80.0f);
+    CHECK(!limits.setVelocityLimit(6, 10.0f));
+}
+
+static void emptyIntervalHoldsCommitted() {
+    JointConstraints limits;
+    FakeOutputDevice shoulder(1), elbow(2), wrist(3);
+    shoulder.value = 60.0f;
+    elbow.value = 50.0f;
+    wrist.value = 10.0f;
+    limits.addJoint(shoulder, 0.0f, 180.0f);
+    limits.addJoint(elbow, 0.0f, 180.0f);
+    limits.addJoint(wrist, 0.0f, 180.0f);
+
+    // Both keep-outs added while the pose already violates them (warned, accepted)
+    Logger::begin(Serial, Logger::Level::INFO);
+    Host::serialOutput.clear();
+    CHECK(limits.addKeepOut(1, 1.0f, 2, 1.0f, 100.0f));     // elbow <= 100 - shoulder = 40
+    CHECK(limits.addKeepOut(2, -1.0f, 3, -1.0f, -80.0f));   // elbow >= 80 - wrist = 70
+    CHECK(Host::serialOutput.find("violated by current pose") != std::string::npos);
+    float pose[] = {60.0f, 50.0f, 10.0f};
+    CHECK(!limits.isAllowed(pose));
+
+    // [70, 40] is empty: the elbow stays where it is, whatever is asked
+    CHECK_EQ(limits.constrain(2, 20.0f), 50.0f);
+    CHECK_EQ(limits.constrain(2, 90.0f), 50.0f);
+    CHECK_EQ(limits.getHoldCount(), 2);
+    CHECK_EQ(limits.getCommitted(1), 50.0f);
+
+    // Moving a partner opens the interval, then the elbow walks out of the zone
+    CHECK_EQ(limits.constrain(1, 20.0f), 20.0f);       // shoulder <= 100 - 50
+    CHECK_EQ(limits.constrain(2, 90.0f), 80.0f);       // [70, 80]
+    float fixed[] = {limits.getCommitted(0), limits.getCommitted(1), limits.getCommitted(2)};
+    CHECK(limits.isAllowed(fixed));
+    CHECK_EQ(limits.getHoldCount(), 2);
+}
+
+static void isAllowedChecksLimitsAndKeepOuts() {
+    JointConstraints limits;
+    FakeOutputDevice a(1), b(2);
+    a.value = 50.0f;
+    b.value = 50.0f;
+    limits.addJoint(a, 0.0f, 100.0f, 1.0f);            // Velocity limit is ignored by isAllowed()
+    limits.addJoint(b, 0.0f, 100.0f);
+    limits.addKeepOut(1, 1.0f, 2, 1.0f, 120.0f);
+
+    const float good[] = {0.0f, 100.0f};
+    const float edge[] = {60.0f, 60.0f};               // On the boundary is allowed
+    const float under[] = {-0.01f, 50.0f};
+    const float over[] = {50.0f, 100.01f};
+    const float inside[] = {70.0f, 60.0f};
+    CHECK(limits.isAllowed(good));
+    CHECK(limits.isAllowed(edge));
+    CHECK(!limits.isAllowed(under));
+    CHECK(!limits.isAllowed(over));
+    CHECK(!limits.isAllowed(inside));
+}
+
+// 32 joints in a chain: neighbours keep  q[i] + q[i+1] <= 200, and  q[0] - q[1] <= 90
+// fills the keep-out table; every fourth joint is velocity limited
+struct Chain {
+    FakeOutputDevice joints[32];
+    JointConstraints limits;
+
+    Chain() {
+        for (uint8_t i = 0; i < 32; i++) {
+            joints[i].id = (uint16_t)(100 + i);
+            joints[i].value = 45.0f;
+            limits.addJoint(joints[i], 0.0f, 180.0f, (i % 4 == 0) ? 90.0f : 0.0f);
+        }
+        for (uint8_t i = 0; i + 1 < 32; i++) {
+            limits.addKeepOut(100 + i, 1.0f, 101 + i, 1.0f, 200.0f);
+        }
+        limits.addKeepOut(100, 1.0f, 101, -1.0f, 90.0f);
+    }
+};
+
+static void projectLandsOnAllowedPose() {
+    Chain chain;
+    CHECK_EQ(chain.limits.getJointCount(), 32);
+    CHECK_EQ(chain.limits.getKeepOutCount(), TWIST_CONSTRAINT_MAX_KEEPOUTS);
+
+    std::mt19937 rng(59);
+    std::uniform_real_distribution<float> angle(-30.0f, 210.0f);
+    bool allowed = true, committedUntouched = true, velocityHeld = true;
+    unsigned long changed = 0;
+    for (int round = 0; round < 2000; round++) {
+        Host::advanceMs(5);
+        float values[32];
+        for (float& v : values) v = angle(rng);
+        changed += chain.limits.project(values);
+        if (!chain.limits.isAllowed(values)) allowed = false;
+        for (uint8_t i = 0; i < 32; i++) {
+            if (chain.limits.getCommitted(i) != 45.0f) committedUntouched = false;
+            // Never written: velocity credit is capped at TWIST_CONSTRAINT_MAX_DT_MS
+            if (i % 4 == 0 && fabsf(values[i] - 45.0f) > 90.0f * TWIST_CONSTRAINT_MAX_DT_MS / 1000.0f + 1e-3f) {
+                velocityHeld = false;
+            }
+        }
+    }
+    CHECK(allowed);
+    CHECK(committedUntouched);
+    CHECK(velocityHeld);
+    CHECK(changed > 0);
+
+    // Already-allowed requests pass unchanged
+    float same[32];
+    for (float& v : same) v = 45.0f;
+    CHECK_EQ(chain.limits.project(same), 0);
+
+    // constrain() stream: every committed pose stays allowed
+    bool committedAllowed = true;
+    for (int round = 0; round < 20000; round++) {
+        Host::advanceUs(500);
+        uint8_t i = (uint8_t)(rng() % 32);
+        chain.limits.constrain(100 + i, angle(rng));
+        float pose[32];
+        for (uint8_t j = 0; j < 32; j++) pose[j] = chain.limits.getCommitted(j);
+        if (!chain.limits.isAllowed(pose)) committedAllowed = false;
+    }
+    CHECK(committedAllowed);
+    CHECK_EQ(chain.limits.getHoldCount(), 0);          // Feasible committed pose never empties an interval
+}
+
+// ===== Timing =====
+
+static void projectWithinBudget() {
+    typedef std::chrono::steady_clock Clock;
+    Chain chain;
+    std::mt19937 rng(60);
+    std::uniform_real_distribution<float> angle(-30.0f, 210.0f);
+
+    const int PASSES = 200000;
+    static float requests[64][32];
+    for (auto& pose : requests) for (float& v : pose) v = angle(rng);
+
+    float values[32];
+    float sink = 0.0f;
+    Clock::time_point t0 = Clock::now();
+    for (int p = 0; p < PASSES; p++) {
+        memcpy(values, requests[p & 63], sizeof(values));
+        chain.limits.project(values);
+        sink += values[p & 31];
+    }
+    double projectUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / PASSES;
+
+    t0 = Clock::now();
+    for (int p = 0; p < PASSES; p++) {
+        for (uint8_t i = 0; i < 32; i++) sink += chain.limits.constrain(100 + i, requests[p & 63][i]);
+    }
+    double constrainUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / PASSES;
+
+    CHECK(projectUs < PROJECT_BUDGET_US);
+    CHECK(sink == sink);
+    printf("    32 joints / %u keep-outs: %.2f us per project(), %.2f us per 32 constrain() (budget %.0f us)\n",
+           chain.limits.getKeepOutCount(), projectUs, constrainUs, PROJECT_BUDGET_US);
+}
+
+int main() {
+    RUN_TEST(softLimitsClamp);
+    RUN_TEST(keepOutBoundsPartner);
+    RUN_TEST(velocityLimitSlews);
+    RUN_TEST(emptyIntervalHoldsCommitted);
+    RUN_TEST(isAllowedChecksLimitsAndKeepOuts);
+    RUN_TEST(projectLandsOnAllowedPose);
+    RUN_TEST(projectWithinBudget);
+    return TEST_RESULT();
+}
@@ -0,0 +1,303 @@
+// Kinematics: PlanarArm round trips through forward() on both elbow branches
+// and leaves q untouched out of reach; KinematicChain DLS converges from a
+// nearby seed and never leaves its joint limits; JointMap::apply() moves all
+// outputs or none.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/Kinematics.h"
+#include "Core/Logger.h"
+#include <chrono>
+#include <math.h>
+#include <random>
+
+using namespace TwiST;
+
+static const float PI_F = 3.14159265f;
+
+static void planarRoundTrip() {
+    PlanarArm arm(80.0f, 60.0f);
+    std::mt19937 rng(60);
+    std::uniform_real_distribution<float> radius(25.0f, 135.0f);     // Inside (l1 - l2, l1 + l2)
+    std::uniform_real_distribution<float> angle(-PI_F, PI_F);
+
+    float worst = 0.0f;
+    int solved = 0, upNegative = 0, downPositive = 0, mirrored = 0;
+    for (int i = 0; i < 1000; i++) {
+        float r = radius(rng), a = angle(rng);
+        float x = r * cosf(a), y = r * sinf(a);
+        float up[2], down[2], fx, fy;
+
+        arm.setElbowUp(true);
+        if (!arm.solve(x, y, up)) continue;
+        arm.forward(up, fx, fy);
+        worst = fmaxf(worst, hypotf(fx - x, fy - y));
+
+        arm.setElbowUp(false);
+        if (!arm.solve(x, y, down)) continue;
+        arm.forward(down, fx, fy);
+        worst = fmaxf(worst, hypotf(fx - x, fy - y));
+
+        solved++;
+        upNegative += (up[1] < 0.0f);
+        downPositive += (down[1] > 0.0f);
+        mirrored += (fabsf(up[1] + down[1]) < 1e-4f);                // Same elbow angle, other side
+    }
+    CHECK_EQ(solved, 1000);
+    CHECK_EQ(upNegative, 1000);
+    CHECK_EQ(downPositive, 1000);
+    CHECK_EQ(mirrored, 1000);
+    CHECK(worst < 1e-3f);
+
+    // 3-DOF: tool tip and orientation both reached, q[2] wrapped
+    PlanarArm wrist(80.0f, 60.0f, 30.0f);
+    CHECK_EQ(wrist.getJointCount(), 3);
+    CHECK_NEAR(wrist.getReach(), 170.0f, 1e-4f);
+    worst = 0.0f;
+    int wrapped = 0;
+    solved = 0;
+    for (int i = 0; i < 1000; i++) {
+        float r = radius(rng), a = angle(rng), phi = angle(rng);
+        float x = r * cosf(a) + 30.0f * cosf(phi), y = r * sinf(a) + 30.0f * sinf(phi);
+        float q[3], fx, fy;
+        wrist.setElbowUp(i & 1);
+        if (!wrist.solve(x, y, phi, q)) continue;
+        wrist.forward(q, fx, fy);
+        worst = fmaxf(worst, hypotf(fx - x, fy - y));
+        float tool = q[0] + q[1] + q[2];
+        wrapped += (fabsf(q[2]) <= PI_F + 1e-5f);
+        CHECK_NEAR(atan2f(sinf(tool - phi), cosf(tool - phi)), 0.0f, 1e-4f);
+        solved++;
+    }
+    CHECK_EQ(solved, 1000);
+    CHECK_EQ(wrapped, 1000);
+    CHECK(worst < 1e-3f);
+}
+
+static void outOfReachLeavesQ() {
+    PlanarArm arm(80.0f, 60.0f);
+    float q[3] = {0.25f, -0.5f, 0.75f};
+
+    CHECK(!arm.solve(141.0f, 0.0f, q));                              // Beyond l1 + l2
+    CHECK(!arm.solve(0.0f, 19.0f, q));                               // Inside |l1 - l2|
+    CHECK(!arm.solve(100.0f, 100.0f, q));
+    CHECK_EQ(q[0], 0.25f);
+    CHECK_EQ(q[1], -0.5f);
+
+    PlanarArm wrist(80.0f, 60.0f, 30.0f);
+    CHECK(!wrist.solve(200.0f, 0.0f, 0.0f, q));                      // Wrist centre at 170
+    CHECK(!wrist.solve(30.0f, 0.0f, 0.0f, q));                       // Wrist centre at the origin
+    CHECK_EQ(q[0], 0.25f);
+    CHECK_EQ(q[1], -0.5f);
+    CHECK_EQ(q[2], 0.75f);
+
+    // Boundary: fully stretched and fully folded are reachable
+    CHECK(arm.solve(140.0f, 0.0f, q));
+    CHECK_NEAR(q[0], 0.0f, 1e-4f);
+    CHECK_NEAR(q[1], 0.0f, 1e-3f);
+    CHECK(arm.solve(20.0f, 0.0f, q));
+    CHECK_NEAR(fabsf(q[1]), PI_F, 1e-3f);
+}
+
+// Base yaw, shoulder and elbow - the KinematicChain doc example with limits
+static void buildChain(KinematicChain& chain, float elbowMin, float elbowMax) {
+    CHECK(chain.addJoint(0.0f, PI_F / 2, 60.0f, 0.0f, -PI_F / 2, PI_F / 2));
+    CHECK(chain.addJoint(80.0f, 0.0f, 0.0f, 0.0f, 0.0f, PI_F));
+    CHECK(chain.addJoint(60.0f, 0.0f, 0.0f, 0.0f, elbowMin, elbowMax));
+}
+
+static bool withinLimits(const float* q, const float* lo, const float* hi, int n) {
+    for (int i = 0; i < n; i++) {
+        if (q[i] < lo[i] || q[i] > hi[i]) return false;
+    }
+    return true;
+}
+
+static void dlsConvergesNearSeed() {
+    KinematicChain chain;
+    buildChain(chain, -2.5f, 0.0f);
+    CHECK_EQ(chain.getJointCount(), 3);
+
+    // Fully stretched along +X at shoulder height
+    float zero[3] = {0.0f, 0.0f, 0.0f}, tip[3];
+    chain.forward(zero, tip);
+    CHECK_NEAR(tip[0], 140.0f, 1e-3f);
+    CHECK_NEAR(tip[1], 0.0f, 1e-3f);
+    CHECK_NEAR(tip[2], 60.0f, 1e-3f);
+
+    const float lo[3] = {-PI_F / 2, 0.0f, -2.5f}, hi[3] = {PI_F / 2, PI_F, 0.0f};
+    std::mt19937 rng(61);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f), nudge(-0.3f, 0.3f);
+    int converged = 0, inLimits = 0;
+    unsigned long iterations = 0;
+    for (int i = 0; i < 500; i++) {
+        float pose[3], q[3], target[3];
+        for (int j = 0; j < 3; j++) pose[j] = lo[j] + 0.1f + unit(rng) * (hi[j] - lo[j] - 0.2f);
+        chain.forward(pose, target);
+        for (int j = 0; j < 3; j++) q[j] = pose[j] + nudge(rng);
+
+        bool ok = chain.solve(target, q);
+        converged += ok;
+        inLimits += withinLimits(q, lo, hi, 3);
+        iterations += chain.getLastIterations();
+        if (ok) {
+            chain.forward(q, tip);
+            CHECK(chain.getLastError() <= 0.5f);
+            CHECK(sqrtf((tip[0] - target[0]) * (tip[0] - target[0]) + (tip[1] - target[1]) * (tip[1] - target[1]) +
+                        (tip[2] - target[2]) * (tip[2] - target[2])) <= 0.5f);
+        }
+    }
+    CHECK_EQ(converged, 500);
+    CHECK_EQ(inLimits, 500);
+    CHECK(iterations / 500.0 < 8.0);
+
+    // A full chain refuses more joints
+    KinematicChain full;
+    for (int i = 0; i < TWIST_IK_MAX_JOINTS; i++) CHECK(full.addJoint(10.0f, 0.0f, 0.0f));
+    CHECK(!full.addJoint(10.0f, 0.0f, 0.0f));
+    CHECK_EQ(full.getJointCount(), TWIST_IK_MAX_JOINTS);
+}
+
+static void dlsClampsToJointLimits() {
+    KinematicChain chain;
+    buildChain(chain, -1.0f, 0.0f);                                  // Elbow can fold at most 1 rad
+    const float lo[3] = {-PI_F / 2, 0.0f, -1.0f}, hi[3] = {PI_F / 2, PI_F, 0.0f};
+
+    // Seed outside the limits is pulled in before the first iteration
+    float q[3] = {3.0f, -1.0f, 2.0f};
+    float target[3];
+    float pose[3] = {0.2f, 0.6f, -0.5f};
+    chain.forward(pose, target);
+    chain.solve(target, q);
+    CHECK(withinLimits(q, lo, hi, 3));
+
+    // Folded target needs the elbow at -2.5 rad: unreachable, closest pose stays legal
+    float folded[3] = {0.0f, 1.2f, -2.5f};
+    chain.forward(folded, target);
+    float seed[3] = {0.0f, 1.0f, -0.8f};
+    CHECK(!chain.solve(target, seed));
+    CHECK(withinLimits(seed, lo, hi, 3));
+    CHECK_EQ(chain.getLastIterations(), 32);                         // Default iteration cap
+    CHECK(chain.getLastError() > 0.5f);
+    CHECK_NEAR(seed[2], -1.0f, 1e-5f);                               // Pinned at the elbow limit
+
+    // Target behind the base: yaw runs to its limit, never past it
+    float behind[3] = {-100.0f, 10.0f, 60.0f};
+    float yaw[3] = {1.4f, 0.5f, -0.5f};
+    chain.setSolverParameters(5.0f, 0.5f, 64, 0.2f);
+    CHECK(!chain.solve(behind, yaw));
+    CHECK(withinLimits(yaw, lo, hi, 3));
+    CHECK_EQ(chain.getLastIterations(), 64);
+}
+
+// FakeOutputDevice that counts every command, whichever kind
+struct CountingJoint : FakeOutputDevice {
+    using FakeOutputDevice::FakeOutputDevice;
+    int commands() const { return sets + moves; }
+};
+
+static void jointMapAllOrNothing() {
+    JointMap joints;
+    CountingJoint base(1), shoulder(2), elbow(3);
+    JointCalibration reversed;
+    reversed.scale = -57.2957795f;
+    JointCalibration narrow;
+    narrow.minValue = 45.0f;
+    narrow.maxValue = 135.0f;
+    JointCalibration zero;
+    zero.scale = 0.0f;
+
+    CHECK(joints.bind(0, base));
+    CHECK(joints.bind(2, elbow, narrow));
+    CHECK(!joints.bind(TWIST_IK_MAX_JOINTS, shoulder));
+    CHECK(!joints.bind(1, shoulder, zero));
+    CHECK_EQ(joints.getJointCount(), 3);
+
+    // Joint 1 unbound: nothing moves
+    float q[3] = {0.0f, 0.0f, 0.0f};
+    CHECK(!joints.apply(q));
+    CHECK_EQ(base.commands() + elbow.commands(), 0);
+    CHECK_EQ(joints.getRejectedCount(), 1);
+
+    CHECK(joints.bind(1, shoulder, reversed));
+    CHECK(joints.apply(q));
+    CHECK_EQ(base.sets, 1);
+    CHECK_EQ(shoulder.sets, 1);
+    CHECK_EQ(elbow.sets, 1);
+    CHECK_NEAR(shoulder.value, 90.0f, 1e-4f);
+
+    // Last joint out of its calibrated range: the first two must not move either
+    float pose[3] = {0.5f, 0.5f, 0.0f};
+    pose[2] = 50.0f / 57.2957795f;                                   // 140 deg > 135
+    CHECK(!joints.apply(pose, 300));
+    CHECK_EQ(base.commands() + shoulder.commands() + elbow.commands(), 3);
+    CHECK_EQ(joints.getRejectedCount(), 2);
+    float values[3];
+    CHECK(!joints.toOutputs(pose, values));
+
+    // First joint out of range (reversed scale pushes shoulder below 0)
+    pose[2] = 0.2f;
+    pose[1] = -1.7f;
+    CHECK(!joints.apply(pose, 300));
+    CHECK_EQ(base.commands() + shoulder.commands() + elbow.commands(), 3);
+    CHECK_EQ(joints.getRejectedCount(), 3);
+
+    // In range: every joint moves, timed moves go through moveTo()
+    pose[1] = 0.5f;
+    CHECK(joints.apply(pose, 300));
+    CHECK_EQ(base.moves, 1);
+    CHECK_EQ(shoulder.moves, 1);
+    CHECK_EQ(elbow.moves, 1);
+    CHECK_EQ(elbow.duration, 300);
+    CHECK_NEAR(base.target, 90.0f + 0.5f * 57.2957795f, 1e-3f);
+    CHECK_NEAR(shoulder.target, 90.0f - 0.5f * 57.2957795f, 1e-3f);
+
+    // read() inverts the calibration (IK seed)
+    base.value = base.target;
+    shoulder.value = shoulder.target;
+    elbow.value = elbow.target;
+    float seed[3];
+    joints.read(seed);
+    CHECK_NEAR(seed[0], 0.5f, 1e-5f);
+    CHECK_NEAR(seed[1], 0.5f, 1e-5f);
+    CHECK_NEAR(seed[2], 0.2f, 1e-5f);
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void solveTiming() {
+    typedef std::chrono::steady_clock Clock;
+    PlanarArm arm(80.0f, 60.0f);
+    KinematicChain chain;
+    buildChain(chain, -2.5f, 0.0f);
+    const int N = 100000;
+    float q[3] = {0.0f, 0.8f, -1.0f}, target[3], sink = 0.0f;
+    chain.forward(q, target);
+
+    Clock::time_point t0 = Clock::now();
+    for (int i = 0; i < N; i++) {
+        arm.solve(100.0f + (i & 15), 40.0f, q);
+        sink += q[0];
+    }
+    double planarUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / N;
+
+    t0 = Clock::now();
+    for (int i = 0; i < N / 10; i++) {
+        float seed[3] = {0.1f, 0.6f, -0.7f};
+        chain.solve(target, seed);
+        sink += seed[0];
+    }
+    double dlsUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / (N / 10);
+    CHECK(sink == sink);
+    printf("    planar 2-DOF %.3f us/solve, DLS 3-DOF %.3f us/solve\n", planarUs, dlsUs);
+}
+
+int main() {
+    RUN_TEST(planarRoundTrip);
+    RUN_TEST(outOfReachLeavesQ);
+    RUN_TEST(dlsConvergesNearSeed);
+    RUN_TEST(dlsClampsToJointLimits);
+    RUN_TEST(jointMapAllOrNothing);
+    RUN_TEST(solveTiming);
+    return TEST_RESULT();
+}
@@ -0,0 +1,214 @@
+// LoopHistogram log2 buckets and percentiles against exact order statistics;
+// LoopMonitor period / work / late counts, longest-section culprit
+// attribution, rate-limited warnings and the watchdog ISR message.
+
+#include "TestSupport.h"
+#include "Core/LoopMonitor.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+
+extern "C" void esp_task_wdt_isr_user_handler(void);
+
+static size_t countOf(const std::string& text, const char* needle) {
+    size_t count = 0;
+    for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) count++;
+    return count;
+}
+
+// ===== LoopHistogram =====
+
+static void percentilesResolveToBucketBounds() {
+    LoopHistogram h;
+    CHECK_EQ(h.getCount(), 0);
+    CHECK_EQ(h.getPercentile(99), 0);
+    CHECK_EQ(h.getMin(), 0);
+
+    for (uint32_t us = 1; us <= 1000; us++) h.add(us);
+    CHECK_EQ(h.getCount(), 1000);
+    CHECK_EQ(h.getMin(), 1);
+    CHECK_EQ(h.getMax(), 1000);
+    CHECK_EQ(h.getMean(), 500);
+    CHECK_EQ(h.getPercentile(0), 1);                   // Sample 1 sits in bucket 0
+    CHECK_EQ(h.getPercentile(50), 511);                // Sample 500 -> [256, 512)
+    CHECK_EQ(h.getPercentile(90), 1000);               // [512, 1024) clamped to max
+    CHECK_EQ(h.getPercentile(99), 1000);
+    CHECK_EQ(h.getPercentile(200), 1000);              // Over 100 = max
+
+    h.reset();
+    h.add(0);
+    h.add(UINT32_MAX);
+    CHECK_EQ(h.getMin(), 0);
+    CHECK_EQ(h.getPercentile(50), 1);
+    CHECK_EQ(h.getPercentile(100), UINT32_MAX);        // Top bucket has no 2^32 bound
+    CHECK_EQ(h.getMean(), UINT32_MAX / 2);             // 64-bit sum
+}
+
+static void percentilesBoundExactValues() {
+    // Loop-like durations: mostly 300-900 us, a tail out to tens of ms
+    std::mt19937 rng(54);
+    std::lognormal_distribution<double> duration(6.3, 0.9);
+    const uint8_t PERCENTS[] = {1, 10, 50, 75, 90, 95, 99, 100};
+
+    for (int round = 0; round < 20; round++) {
+        LoopHistogram h;
+        std::vector<uint32_t> samples;
+        size_t n = 10 + rng() % 5000;
+        for (size_t i = 0; i < n; i++) {
+            uint32_t us = (uint32_t)duration(rng);
+            samples.push_back(us);
+            h.add(us);
+        }
+        std::sort(samples.begin(), samples.end());
+
+        // Never below the exact value, never more than one bucket (2x) above it
+        bool bounded = true;
+        for (uint8_t p : PERCENTS) {
+            size_t rank = (n * p + 99) / 100;
+            uint32_t exact = samples[(rank ? rank : 1) - 1];
+            uint32_t approx = h.getPercentile(p);
+            uint32_t limit = exact ? 2 * exact - 1 : 1;
+            if (approx < exact || approx > limit || approx > samples.back()) bounded = false;
+        }
+        CHECK(bounded);
+        CHECK_EQ(h.getMax(), samples.back());
+        CHECK_EQ(h.getMin(), samples.front());
+    }
+}
+
+// ===== LoopMonitor =====
+
+// One update() pass: device sections of the given durations, then idle until the next period
+static void runPass(LoopMonitor& monitor, const char* const* names, const uint32_t* sectionUs, size_t sections,
+                    uint32_t periodUs) {
+    uint32_t start = (uint32_t)micros();
+    monitor.beginPass(start);
+    for (size_t i = 0; i < sections; i++) {
+        monitor.enterSection(SECTION_DEVICE, names[i]);
+        Host::advanceUs(sectionUs[i]);
+        monitor.exitSection();
+    }
+    monitor.endPass((uint32_t)micros());
+    Host::clockUs += periodUs - ((uint32_t)micros() - start);
+}
+
+static void statisticsAndCulprits() {
+    static const char* const NAMES[] = {"Servo", "Gripper", "Lidar"};
+    LoopMonitor monitor;
+    monitor.setBudget(5000);
+    Host::clockUs = 10000000ULL;
+
+    uint32_t normal[] = {300, 200, 400};
+    for (int i = 0; i < 100; i++) runPass(monitor, NAMES, normal, 3, 10000);
+    CHECK_EQ(monitor.getLateCount(), 0);
+    CHECK_EQ(monitor.getLastCulprit().kind, SECTION_NONE);
+    CHECK_EQ(monitor.getWork().getMax(), 900);
+    CHECK_EQ(monitor.getPeriod().getCount(), 99);      // First pass has no predecessor
+    CHECK_EQ(monitor.getPeriod().getMin(), 10000);
+    CHECK_EQ(monitor.getPeriod().getMax(), 10000);
+
+    // Gripper stalls once, Lidar stalls longer later: last vs worst
+    uint32_t gripperStall[] = {300, 6000, 400};
+    uint32_t lidarStall[] = {300, 200, 9000};
+    uint32_t servoStall[] = {5500, 200, 400};
+    runPass(monitor, NAMES, gripperStall, 3, 10000);
+    CHECK_EQ(monitor.getLateCount(), 1);
+    CHECK(monitor.getLastCulprit().name == NAMES[1]);
+    CHECK_EQ(monitor.getLastCulprit().durationUs, 6000);
+
+    runPass(monitor, NAMES, lidarStall, 3, 12000);
+    runPass(monitor, NAMES, servoStall, 3, 10000);
+    CHECK_EQ(monitor.getLateCount(), 3);
+    CHECK(monitor.getLastCulprit().name == NAMES[0]);
+    CHECK_EQ(monitor.getLastCulprit().durationUs, 5500);
+    CHECK(monitor.getWorstCulprit().name == NAMES[2]);
+    CHECK_EQ(monitor.getWorstCulprit().durationUs, 9000);
+    CHECK_EQ(monitor.getWork().getMax(), 9500);
+    CHECK_EQ(monitor.getPeriod().getMax(), 12000);
+    CHECK_EQ(monitor.getPeriod().getPercentile(99), 12000);   // 10 and 12 ms share [8192, 16384)
+    CHECK_EQ(monitor.getWork().getPercentile(50), 1023);      // 900 us -> top of [512, 1024)
+
+    // A pass exactly on budget is not late
+    uint32_t onBudget[] = {5000};
+    runPass(monitor, NAMES, onBudget, 1, 10000);
+    CHECK_EQ(monitor.getLateCount(), 3);
+
+    monitor.reset();
+    CHECK_EQ(monitor.getLateCount(), 0);
+    CHECK_EQ(monitor.getWork().getCount(), 0);
+    CHECK_EQ(monitor.getWorstCulprit().durationUs, 0);
+}
+
+static void describeNamesEveryKind() {
+    char buffer[48];
+    LoopSection events = {SECTION_EVENTS, 0, NULL, 0};
+    LoopSection service = {SECTION_SERVICE, 0, "NodeLink", 0};
+    LoopSection device = {SECTION_DEVICE, 0, "Gripper", 0};
+    LoopSection bridge = {SECTION_BRIDGE, 2, NULL, 0};
+    LoopSection none = {SECTION_NONE, 0, NULL, 0};
+    LoopSection unnamed = {SECTION_DEVICE, 0, NULL, 0};
+    CHECK(std::string(LoopMonitor::describe(events, buffer, sizeof(buffer))) == "event processing");
+    CHECK(std::string(LoopMonitor::describe(service, buffer, sizeof(buffer))) == "service 'NodeLink'");
+    CHECK(std::string(LoopMonitor::describe(device, buffer, sizeof(buffer))) == "device 'Gripper'");
+    CHECK(std::string(LoopMonitor::describe(bridge, buffer, sizeof(buffer))) == "bridge #2");
+    CHECK(std::string(LoopMonitor::describe(none, buffer, sizeof(buffer))) == "framework");
+    CHECK(std::string(LoopMonitor::describe(unnamed, buffer, sizeof(buffer))) == "device '?'");
+    CHECK(std::string(LoopMonitor::describe(device, buffer, 8)) == "device ");   // Truncated, terminated
+}
+
+static void warningsAreRateLimited() {
+    static const char* const NAMES[] = {"Slow"};
+    Logger::begin(Serial, Logger::Level::INFO);
+    Host::serialOutput.clear();
+    LoopMonitor monitor;
+    monitor.setBudget(1000);
+    Host::clockUs = 50000000ULL;
+
+    // 10 ms passes, every one late: one warning per second, not one per pass
+    uint32_t slow[] = {2000};
+    for (int i = 0; i < 250; i++) runPass(monitor, NAMES, slow, 1, 10000);
+    CHECK_EQ(monitor.getLateCount(), 250);
+    CHECK_EQ(countOf(Host::serialOutput, "Over budget"), 3);
+    CHECK(Host::serialOutput.find("Over budget: 2000 us (device 'Slow': 2000 us)") != std::string::npos);
+}
+
+static void watchdogIsrNamesBlockingSection() {
+    LoopMonitor monitor;
+    CHECK(monitor.enableWatchdog(2000));
+    CHECK(monitor.isWatchdogEnabled());
+
+    Host::romOutput.clear();
+    monitor.beginPass((uint32_t)micros());
+    monitor.enterSection(SECTION_DEVICE, "Gripper");
+    esp_task_wdt_isr_user_handler();                   // Fires while the device blocks
+    CHECK(Host::romOutput == "[TWDT] TwiST loop blocked in device 'Gripper' #0\n");
+    monitor.exitSection();
+
+    Host::romOutput.clear();
+    monitor.enterSection(SECTION_BRIDGE, NULL, 3);
+    esp_task_wdt_isr_user_handler();
+    CHECK(Host::romOutput == "[TWDT] TwiST loop blocked in bridge '' #3\n");
+    monitor.exitSection();
+
+    Host::romOutput.clear();
+    esp_task_wdt_isr_user_handler();                   // Between sections
+    CHECK(Host::romOutput == "[TWDT] TwiST loop blocked in framework '' #3\n");
+    monitor.endPass((uint32_t)micros());
+
+    monitor.disableWatchdog();
+    CHECK(!monitor.isWatchdogEnabled());
+}
+
+int main() {
+    RUN_TEST(percentilesResolveToBucketBounds);
+    RUN_TEST(percentilesBoundExactValues);
+    RUN_TEST(statisticsAndCulprits);
+    RUN_TEST(describeNamesEveryKind);
+    RUN_TEST(warningsAreRateLimited);
+    RUN_TEST(watchdogIsrNamesBlockingSection);
+    return TEST_RESULT();
+}
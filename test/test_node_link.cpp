@@ -0,0 +1,271 @@
+// Two NodeLink instances over a LoopbackTransport pair: the peer's
+// RemoteOutput / RemoteInput proxies converge on the owner's devices;
+// proxy commands reach the owner and come back as replicated state;
+// a lossy link resyncs through full refreshes; a silent owner goes stale.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/DeviceRegistry.h"
+#include "Core/NodeLink.h"
+#include "Devices/RemoteInput.h"
+#include "Devices/RemoteOutput.h"
+#include "Drivers/Transport/LoopbackTransport.h"
+#include <math.h>
+
+using namespace TwiST;
+using Devices::RemoteInput;
+using Devices::RemoteOutput;
+using Drivers::LoopbackTransport;
+
+// Owner-side servo stand-in: moveTo() ramps linearly in update()
+struct RampOutput : FakeOutputDevice {
+    bool enabled = true;
+    float from = 0.0f;
+    unsigned long startMs = 0;
+
+    explicit RampOutput(uint16_t deviceId) : FakeOutputDevice(deviceId) {}
+
+    void enable() override { enabled = true; }
+    void disable() override { enabled = false; }
+    bool isEnabled() const override { return enabled; }
+    bool isMoving() const override { return moving; }
+
+    void moveTo(float t, unsigned long ms) override {
+        FakeOutputDevice::moveTo(t, ms);
+        from = value;
+        startMs = millis();
+        moving = true;
+    }
+    void update() override {
+        if (!moving) return;
+        unsigned long elapsed = millis() - startMs;
+        if (elapsed >= duration) {
+            value = target;
+            moving = false;
+        } else {
+            value = from + (target - from) * (float)elapsed / (float)duration;
+        }
+    }
+};
+
+// Owner-side three-axis input whose readings the test scripts
+struct ScriptedInput : IInputDevice {
+    uint16_t id;
+    float axes[3] = {0.0f, 0.0f, 0.0f};
+
+    explicit ScriptedInput(uint16_t deviceId) : id(deviceId) {}
+
+    bool initialize() override { return true; }
+    void shutdown() override {}
+    void update() override {}
+    DeviceInfo getInfo() const override { return {"Scripted", "Scripted", id, CAP_INPUT, 3}; }
+    const char* getName() const override { return "Scripted"; }
+    uint16_t getCapabilities() const override { return CAP_INPUT; }
+    bool hasCapability(DeviceCapability cap) const override { return cap == CAP_INPUT; }
+    DeviceState getState() const override { return STATE_READY; }
+    void enable() override {}
+    void disable() override {}
+    bool isEnabled() const override { return true; }
+    bool configure(const JsonDocument&) override { return true; }
+    void getConfiguration(JsonDocument&) const override {}
+    void toJson(JsonDocument&) const override {}
+    bool fromJson(const JsonDocument&) override { return true; }
+    float readAnalog(uint8_t axis) override { return axis < 3 ? axes[axis] : 0.0f; }
+    bool readDigital(uint8_t) override { return false; }
+    bool isInputReady() override { return true; }
+};
+
+static const uint16_t ARM_ID = 10, STICK_ID = 11;
+
+struct Nodes {
+    LoopbackTransport ownerEnd, peerEnd;
+    DeviceRegistry ownerRegistry, peerRegistry;
+    NodeLink owner, peer;
+    RampOutput arm;
+    ScriptedInput stick;
+    RemoteOutput remoteArm;
+    RemoteInput remoteStick;
+    bool ownerRunning = true;
+
+    Nodes()
+        : owner(ownerEnd, ownerRegistry, 1), peer(peerEnd, peerRegistry, 2),
+          arm(ARM_ID), stick(STICK_ID),
+          remoteArm(peer, ARM_ID, 500, "RemoteArm"), remoteStick(peer, STICK_ID, 501, "RemoteStick") {
+        LoopbackTransport::connect(ownerEnd, peerEnd);
+        arm.value = 90.0f;
+        ownerRegistry.registerDevice(&arm);
+        ownerRegistry.registerDevice(&stick);
+        owner.exportAll();
+        peerRegistry.registerDevice(&remoteArm);
+        peerRegistry.registerDevice(&remoteStick);
+        peerRegistry.initializeAll();
+    }
+
+    // One 5 ms loop pass on both nodes
+    void tick() {
+        Host::advanceMs(5);
+        if (ownerRunning) {
+            owner.update();
+            ownerRegistry.updateAll();
+        }
+        peer.update();
+        peerRegistry.updateAll();
+    }
+
+    void run(unsigned long ms) {
+        for (unsigned long t = 0; t < ms; t += 5) tick();
+    }
+
+    bool converged() {
+        if (remoteArm.getValue() != arm.value || remoteArm.isMoving() != arm.moving) return false;
+        for (uint8_t a = 0; a < 3; a++) {
+            if (remoteStick.readAnalog(a) != stick.axes[a]) return false;
+        }
+        return true;
+    }
+};
+
+static void proxiesPickUpInitialState() {
+    Nodes n;
+    CHECK(!n.remoteArm.hasRemoteState());
+    CHECK_EQ(n.peer.getProxyCount(), 2);
+    CHECK_EQ(n.owner.getExportCount(), 2);
+
+    n.stick.axes[0] = 0.25f;
+    n.stick.axes[2] = -0.75f;
+    n.run(100);
+
+    CHECK(n.owner.isConnected() && n.peer.isConnected());
+    CHECK(n.remoteArm.hasRemoteState() && n.remoteStick.hasRemoteState());
+    CHECK_EQ(n.remoteStick.getAxisCount(), 3);
+    CHECK(n.converged());
+    CHECK_EQ(n.remoteArm.getState(), STATE_READY);
+    CHECK_EQ(n.remoteStick.getState(), STATE_READY);
+    CHECK_EQ(n.peer.getPeerNodeId(), 1);
+}
+
+static void inputFollowsOwner() {
+    Nodes n;
+    n.run(100);
+
+    // 2 s of continuous motion: the proxy lags at most one 20 ms batch (+ delta threshold)
+    float worst = 0.0f;
+    float history[5][3] = {};
+    for (int k = 0; k < 400; k++) {
+        for (uint8_t a = 0; a < 3; a++) n.stick.axes[a] = sinf(k * 0.01f * (a + 1));
+        n.tick();
+        for (uint8_t a = 0; a < 3; a++) {
+            float best = 1e9f;
+            for (int h = 0; h < 5; h++) best = fminf(best, fabsf(n.remoteStick.readAnalog(a) - history[h][a]));
+            best = fminf(best, fabsf(n.remoteStick.readAnalog(a) - n.stick.axes[a]));
+            if (k >= 5 && best > worst) worst = best;
+            for (int h = 4; h > 0; h--) history[h][a] = history[h - 1][a];
+            history[0][a] = n.stick.axes[a];
+        }
+    }
+    CHECK(worst <= 0.01f + 1e-6f);
+
+    // Owner holds still: exact after the next batches
+    n.run(60);
+    CHECK(n.converged());
+    CHECK(n.peer.getStatesApplied() > 0);
+    CHECK_EQ(n.peer.getSequenceGapCount(), 0);
+}
+
+static void commandsRoundTrip() {
+    Nodes n;
+    n.run(100);
+
+    // Several setValue() in one pass: coalesced into one command, latest wins
+    n.remoteArm.setValue(30.0f);
+    n.remoteArm.setValue(40.0f);
+    n.remoteArm.setValue(42.0f);
+    n.run(10);
+    CHECK_EQ(n.arm.sets, 1);
+    CHECK_EQ(n.arm.value, 42.0f);
+    CHECK(n.peer.getCommandsCoalesced() >= 2);
+    n.run(40);
+    CHECK_EQ(n.remoteArm.getValue(), 42.0f);            // Came back as replicated state
+
+    // moveTo: moving flag and final position replicate
+    n.remoteArm.moveTo(120.0f, 200);
+    n.run(60);
+    CHECK(n.arm.moving);
+    CHECK(n.remoteArm.isMoving());
+    float midway = n.remoteArm.getValue();
+    CHECK(midway > 42.0f && midway < 120.0f);
+    n.run(300);
+    CHECK(!n.arm.moving);
+    CHECK(n.converged());
+    CHECK_EQ(n.remoteArm.getValue(), 120.0f);
+    CHECK_EQ(n.arm.duration, 200);
+
+    // Enable / disable reach the owner
+    n.remoteArm.disable();
+    n.run(10);
+    CHECK(!n.arm.enabled);
+    n.remoteArm.enable();
+    n.run(10);
+    CHECK(n.arm.enabled);
+    CHECK_EQ(n.peer.getCommandsDropped(), 0);
+}
+
+static void lossyLinkResyncs() {
+    Nodes n;
+    n.ownerEnd.setDropEvery(97);                       // Corrupts owner -> peer frames
+    n.run(100);
+
+    for (int k = 0; k < 400; k++) {
+        for (uint8_t a = 0; a < 3; a++) n.stick.axes[a] = 0.5f * sinf(k * 0.02f + a);
+        if (k % 100 == 0) n.arm.moveTo((float)(k / 4), 150);
+        n.tick();
+    }
+    CHECK(n.peer.getSequenceGapCount() > 0);           // Loss was seen, full refresh requested
+
+    // Settles once the owner stops changing, despite continued loss: a desynced
+    // parser flushes at heartbeat rate, then the next gap requests a full batch
+    unsigned long settleMs = 0;
+    while (!n.converged() && settleMs < 10000) {
+        n.tick();
+        settleMs += 5;
+    }
+    CHECK(n.converged());
+    printf("    %lu batches sent, %lu received, %lu gaps, settled %lu ms after motion stopped\n",
+           n.owner.getBatchesSent(), n.peer.getBatchesReceived(), n.peer.getSequenceGapCount(), settleMs);
+}
+
+static void silentOwnerGoesStale() {
+    Nodes n;
+    n.run(100);
+    CHECK_EQ(n.remoteArm.getState(), STATE_READY);
+
+    // Idle but connected: heartbeats keep unchanged proxies fresh
+    n.run(2000);
+    CHECK_EQ(n.remoteArm.getState(), STATE_READY);
+    CHECK(n.remoteStick.isInputReady());
+    CHECK(n.remoteArm.getStateAge() <= TWIST_NODE_HEARTBEAT_MS + 20);   // + one 50 Hz batch period
+
+    n.ownerRunning = false;
+    n.run(600);                                        // Past the 500 ms stale limit
+    CHECK_EQ(n.remoteArm.getState(), STATE_ERROR);
+    CHECK(!n.remoteStick.isInputReady());
+
+    n.run(TWIST_NODE_TIMEOUT_MS);
+    CHECK(!n.peer.isConnected());
+
+    n.stick.axes[1] = 0.5f;                            // Changed while the owner was away
+    n.ownerRunning = true;
+    n.run(100);
+    CHECK(n.peer.isConnected());
+    CHECK_EQ(n.remoteArm.getState(), STATE_READY);
+    CHECK(n.converged());
+}
+
+int main() {
+    RUN_TEST(proxiesPickUpInitialState);
+    RUN_TEST(inputFollowsOwner);
+    RUN_TEST(commandsRoundTrip);
+    RUN_TEST(lossyLinkResyncs);
+    RUN_TEST(silentOwnerGoesStale);
+    return TEST_RESULT();
+}
@@ -0,0 +1,206 @@
+// OutputConditioner stages alone and chained: pass-through, deadband
+// accumulation, slew rate, low-pass step response, call-rate independence,
+// quiet-period and micros() wrap time steps; a noisy square-wave trace
+// through deadband + slew + low-pass checked against a reference model.
+
+#include "TestSupport.h"
+#include "Core/OutputConditioner.h"
+#include <math.h>
+#include <random>
+
+using namespace TwiST;
+
+static void passThroughWhenOff() {
+    OutputConditioner c;
+    CHECK(!c.isActive());
+    c.reset(300, 0);
+
+    uint16_t out = 0;
+    const uint16_t trace[] = {300, 301, 299, 450, 450, 120};
+    for (int i = 0; i < 6; i++) {
+        CHECK(c.step(trace[i], i * 1000, out));        // Every call writes, even repeats
+        CHECK_EQ(out, trace[i]);
+    }
+    CHECK_EQ(c.getWriteCount(), 6);
+    CHECK(c.isSettled());
+}
+
+static void deadbandAccumulatesSmallChanges() {
+    OutputConditioner c;
+    c.setDeadband(2);
+    c.reset(300, 0);
+    uint16_t out = 0;
+
+    // +/-2 wiggle around the written value - nothing written
+    const int wiggle[] = {1, -2, 2, 0, -1, 2, -2};
+    for (int i = 0; i < 7; i++) CHECK(!c.step((uint16_t)(300 + wiggle[i]), i * 1000, out));
+    CHECK_EQ(c.getOutput(), 300);
+    CHECK_EQ(c.getSuppressedCount(), 7);
+
+    // A slow 1-tick-per-call ramp is written every third tick, never lost
+    c.resetCounters();
+    for (int i = 1; i <= 12; i++) {
+        bool wrote = c.step((uint16_t)(300 + i), (10 + i) * 1000, out);
+        CHECK_EQ(wrote, i % 3 == 0);
+        if (wrote) CHECK_EQ(out, 300 + i);
+    }
+    CHECK_EQ(c.getWriteCount(), 4);
+    CHECK_EQ(c.getOutput(), 312);
+    CHECK(c.isSettled());
+}
+
+static void slewLimitsSpeed() {
+    OutputConditioner c;
+    c.setSlewRate(400.0f);                             // 8 ticks per 20 ms frame
+    c.reset(300, 0);
+    uint16_t out = 0;
+
+    for (int k = 1; k <= 50; k++) {
+        CHECK(c.step(700, k * 20000, out));
+        CHECK_EQ(out, 300 + 8 * k);
+        CHECK_EQ(c.isSettled(), k == 50);
+    }
+    CHECK(!c.step(700, 51 * 20000, out));              // Arrived after exactly 1 s
+
+    // Reversal is limited the same way
+    CHECK(c.step(100, 52 * 20000, out));
+    CHECK_EQ(out, 692);
+}
+
+static void lowPassStepResponse() {
+    OutputConditioner c;
+    c.setSmoothing(30000);                             // 30 ms time constant
+    c.reset(300, 0);
+    uint16_t out = 300;
+    uint16_t last = 300;
+
+    for (uint32_t t = 1000; t <= 300000; t += 1000) {
+        c.step(700, t, out);
+        CHECK(out >= last);                            // Monotonic, no overshoot
+        CHECK(out <= 700);
+        last = out;
+        if (t == 30000) CHECK_NEAR(out, 300 + 400 * (1.0 - exp(-1.0)), 4.0);
+        if (t == 90000) CHECK_NEAR(out, 300 + 400 * (1.0 - exp(-3.0)), 4.0);
+    }
+    CHECK_EQ(out, 700);                                // Snaps to the request at the end
+    CHECK(c.isSettled());
+}
+
+static void independentOfCallRate() {
+    OutputConditioner fast, slow;
+    fast.setSmoothing(25000);
+    fast.setSlewRate(2000.0f);
+    slow.setSmoothing(25000);
+    slow.setSlewRate(2000.0f);
+    fast.reset(300, 0);
+    slow.reset(300, 0);
+
+    uint16_t a = 0, b = 0;
+    double worst = 0.0;
+    for (uint32_t t = 1000; t <= 200000; t += 1000) {
+        fast.step(600, t, a);
+        if (t % 5000 == 0) {
+            slow.step(600, t, b);
+            double gap = fabs((double)fast.getOutput() - (double)slow.getOutput());
+            if (gap > worst) worst = gap;
+        }
+    }
+    CHECK(worst <= 6.0);                               // 1 kHz vs 200 Hz track the same curve
+    CHECK_EQ(fast.getOutput(), slow.getOutput());
+}
+
+static void quietPeriodAndMicrosWrap() {
+    OutputConditioner c;
+    c.setSlewRate(400.0f);
+    c.reset(300, 0);
+    uint16_t out = 0;
+
+    // 10 s of silence counts as one 20 ms frame - no jump
+    CHECK(c.step(700, 10000000, out));
+    CHECK_EQ(out, 300 + 400 * TWIST_CONDITIONER_MAX_STEP_US / 1000000);
+
+    // 32-bit micros() wrapping between calls is a 10 ms step
+    c.reset(300, 0xFFFFFFFFu - 4999);
+    CHECK(c.step(700, 5000, out));
+    CHECK_EQ(out, 304);
+}
+
+// ===== Noisy trace through all three stages =====
+
+// Straightforward double-precision model of low-pass then slew
+struct Reference {
+    double filtered, position;
+    double tauUs, slew;
+
+    void step(double request, double dtUs) {
+        filtered += (request - filtered) * dtUs / (tauUs + dtUs);
+        double limit = slew * dtUs / 1e6;
+        double delta = filtered - position;
+        position += (delta > limit) ? limit : (delta < -limit) ? -limit : delta;
+    }
+};
+
+static void noisyTraceThroughAllStages() {
+    const uint16_t DEADBAND = 2;
+    OutputConditioner c;
+    c.setDeadband(DEADBAND);
+    c.setSlewRate(1000.0f);
+    c.setSmoothing(20000);
+    c.reset(300, 0);
+    Reference model = {300.0, 300.0, 20000.0, 1000.0};
+
+    // 1 kHz samples: 300 <-> 500 square wave, 400 ms per level, +/-3 tick noise
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> noise(-3, 3);
+    const uint32_t LEVEL_MS = 400;
+    const uint32_t STEPS = 7 * LEVEL_MS;               // Six edges, ends on the low level
+
+    uint16_t out = 0;
+    uint32_t lastWriteUs = 0;
+    uint16_t lastWritten = 300;
+    uint32_t edgeWrites = 0, plateauWrites = 0;
+    double worstLag = 0.0;
+    bool slewRespected = true;
+
+    for (uint32_t k = 1; k <= STEPS; k++) {
+        uint32_t t = k * 1000;
+        int level = (((k - 1) / LEVEL_MS) % 2) ? 500 : 300;
+        uint16_t request = (uint16_t)(level + noise(rng));
+        model.step(request, 1000.0);
+
+        if (c.step(request, t, out)) {
+            // Never faster than the slew rate (plus rounding)
+            if (fabs((double)out - lastWritten) > 1000.0 * (t - lastWriteUs) / 1e6 + 1.0) slewRespected = false;
+            if ((k - 1) % LEVEL_MS < LEVEL_MS / 2) edgeWrites++;
+            else plateauWrites++;                      // Second half of a level: noise only
+            lastWritten = out;
+            lastWriteUs = t;
+        }
+        // Written output stays within the deadband of the model
+        double lag = fabs((double)c.getOutput() - model.position);
+        if (lag > worstLag) worstLag = lag;
+    }
+
+    printf("    %u samples: %u writes (%u on edges, %u on plateaus), worst lag %.2f ticks\n",
+           STEPS, c.getWriteCount(), edgeWrites, plateauWrites, worstLag);
+    CHECK(slewRespected);
+    CHECK(worstLag <= DEADBAND + 1.0);
+    CHECK_EQ(c.getWriteCount() + c.getSuppressedCount(), STEPS);
+
+    // A 200-tick edge moves in deadband + 1 steps: about 67 writes, not 200
+    CHECK(edgeWrites >= 6 * 60 && edgeWrites <= 6 * 70);
+    // Filtered noise mostly stays inside the deadband: at most one correction per level
+    CHECK(plateauWrites <= 7);
+    CHECK_NEAR(c.getOutput(), 300.0, DEADBAND + 1.0);
+}
+
+int main() {
+    RUN_TEST(passThroughWhenOff);
+    RUN_TEST(deadbandAccumulatesSmallChanges);
+    RUN_TEST(slewLimitsSpeed);
+    RUN_TEST(lowPassStepResponse);
+    RUN_TEST(independentOfCallRate);
+    RUN_TEST(quietPeriodAndMicrosWrap);
+    RUN_TEST(noisyTraceThroughAllStages);
+    return TEST_RESULT();
+}
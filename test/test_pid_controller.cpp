@@ -0,0 +1,308 @@
+// PIDController and DCServo against simulated first-order plants: PI settling
+// on a first-order lag, integral frozen while saturated (recovery after an
+// unreachable setpoint), no derivative kick on setpoint steps, the derivative
+// filter's time constant; DCServo tracking, settling and stall recovery on a
+// gearmotor model driven at a random loop cadence.
+
+#include "TestSupport.h"
+#include "Core/EventBus.h"
+#include "Core/Logger.h"
+#include "Core/PIDController.h"
+#include "Devices/DCServo.h"
+#include <chrono>
+#include <math.h>
+#include <random>
+
+using namespace TwiST;
+
+// y' = (gain * u - y) / tau, integrated in 10 us substeps
+struct Lag {
+    double y = 0.0, gain, tau;
+    Lag(double g, double t) : gain(g), tau(t) {}
+    void run(int32_t u, uint32_t us) {
+        for (uint32_t t = 0; t < us; t += 10) y += (gain * u - y) * 10e-6 / tau;
+    }
+    int32_t read() const { return (int32_t)lround(y); }
+};
+
+struct Response {
+    double overshoot = 0.0;     // Past the setpoint, in counts
+    double settleS = -1.0;      // Last entry into the +/- band
+};
+
+// Run a PID at 1 kHz on a lag for `seconds`; band in counts
+static Response runLag(PIDController& pid, Lag& plant, int32_t setpoint, double seconds, double band) {
+    Response r;
+    double start = plant.y;
+    bool inside = false;
+    for (int i = 0; i < (int)(seconds * 1000); i++) {
+        int32_t u = pid.step(setpoint, plant.read());
+        plant.run(u, 1000);
+        double past = (setpoint >= start) ? plant.y - setpoint : setpoint - plant.y;
+        if (past > r.overshoot) r.overshoot = past;
+        bool in = fabs(plant.y - setpoint) <= band;
+        if (in && !inside) r.settleS = (i + 1) / 1000.0;
+        inside = in;
+    }
+    if (!inside) r.settleS = -1.0;
+    return r;
+}
+
+static void piSettlesOnLag() {
+    // tau = 50 ms, unity gain: PI with the zero on the plant pole closes at 40 rad/s
+    Lag plant(1.0, 0.05);
+    PIDController pid(1000);
+    pid.setGains(2.0f, 40.0f, 0.0f);
+    pid.setOutputLimit(4000);
+    pid.reset(0);
+
+    Response r = runLag(pid, plant, 1000, 1.0, 10.0);
+    printf("    step 0 -> 1000: settled within 1%% in %.3f s, overshoot %.1f counts\n", r.settleS, r.overshoot);
+    CHECK(r.settleS > 0.0 && r.settleS < 0.15);             // ~4.6 / 40 rad/s
+    CHECK(r.overshoot < 5.0);
+    CHECK_NEAR(plant.y, 1000.0, 1.0);                        // Integral removes the offset
+    CHECK_NEAR(pid.getIntegral(), 1000, 2);                  // Holding 1000 takes u = 1000
+    CHECK(!pid.isSaturated());
+
+    // Same loop at 250 Hz: gains re-scaled with the period, same response
+    Lag slow(1.0, 0.05);
+    PIDController pid4(4000);
+    pid4.setGains(2.0f, 40.0f, 0.0f);
+    pid4.setOutputLimit(4000);
+    pid4.reset(0);
+    double settle4 = -1.0;
+    for (int i = 0; i < 250; i++) {
+        slow.run(pid4.step(1000, slow.read()), 4000);
+        if (settle4 < 0.0 && fabs(slow.y - 1000.0) <= 10.0) settle4 = (i + 1) * 0.004;
+    }
+    CHECK(settle4 > 0.0 && fabs(settle4 - r.settleS) < 0.03);
+    CHECK_NEAR(slow.y, 1000.0, 1.0);
+}
+
+static void integralFrozenWhileSaturated() {
+    // Plant tops out at 1000 with the output limited to 1000
+    Lag plant(1.0, 0.05);
+    PIDController pid(1000);
+    pid.setGains(2.0f, 40.0f, 0.0f);
+    pid.setOutputLimit(1000);
+    pid.reset(0);
+
+    // Saturated for most of the rise: nothing stored up to overshoot with
+    Response rise = runLag(pid, plant, 900, 1.0, 9.0);
+    printf("    0 -> 900 saturated at 1000: settled within 1%% in %.3f s, overshoot %.1f counts\n",
+           rise.settleS, rise.overshoot);
+    CHECK(rise.settleS > 0.0 && rise.settleS < 0.3);
+    CHECK(rise.overshoot < 9.0);
+    CHECK_NEAR(plant.y, 900.0, 1.0);
+
+    // 1500 is unreachable
+    runLag(pid, plant, 1500, 2.0, 10.0);
+    CHECK(pid.isSaturated());
+    CHECK_EQ(pid.getOutput(), 1000);
+    int32_t held = pid.getIntegral();
+    CHECK(held <= 1000);
+    runLag(pid, plant, 1500, 1.0, 10.0);
+    CHECK_EQ(pid.getIntegral(), held);                       // Frozen, not winding up
+
+    // Back to a reachable setpoint: out of saturation on the first sample
+    pid.step(500, plant.read());
+    CHECK(!pid.isSaturated());
+    Response r = runLag(pid, plant, 500, 1.0, 5.0);
+    printf("    1500 (unreachable, 3 s) -> 500: integral held at %d, settled within 1%% in %.3f s\n",
+           (int)held, r.settleS);
+    CHECK(r.settleS > 0.0 && r.settleS < 0.5);
+    CHECK_NEAR(plant.y, 500.0, 1.0);
+
+    // Lowering the limit clamps an integral already held
+    pid.setOutputLimit(200);
+    CHECK(pid.getIntegral() <= 200);
+}
+
+static void noDerivativeKick() {
+    PIDController pid(1000);
+    pid.setGains(1.0f, 0.0f, 0.5f);                          // Kd / dt = 500 per count
+    pid.setOutputLimit(1000000);
+    pid.reset(0);
+
+    // Setpoint jump with the measurement still: P only, no 500x kick
+    CHECK_EQ(pid.step(1000, 0), 1000);
+    CHECK_EQ(pid.step(1000, 0), 1000);
+    // Measurement moving toward the setpoint: D brakes it
+    CHECK_EQ(pid.step(1000, 10), 990 - 5000);
+    CHECK_EQ(pid.step(-1000, 10), -1010);                    // Reverse jump, no kick either
+
+    // Filter shift 3: the D term reaches (1 - 7/8^n) of -Kd * rate after n samples
+    pid.setDerivativeFilter(3);
+    pid.reset(0);
+    int32_t m = 0;
+    bool follows = true;
+    for (int n = 1; n <= 60; n++) {
+        m += 2;                                              // 2000 counts/s
+        int32_t d = pid.step(m, m);                          // Zero error - output is D alone
+        double expected = -1000.0 * (1.0 - pow(7.0 / 8.0, n));
+        if (fabs(d - expected) > 2.0) follows = false;
+    }
+    CHECK(follows);
+    CHECK_NEAR(pid.getOutput(), -1000, 5);
+}
+
+static void feedForwardAndFriction() {
+    PIDController pid(1000);
+    pid.setGains(0.0f, 0.0f, 0.0f);
+    pid.setFeedForward(0.5f, -120);                          // Sign of ks ignored
+    pid.setOutputLimit(4095);
+    pid.reset(0);
+    CHECK_EQ(pid.step(0, 0, 2000), 1000 + 120);
+    CHECK_EQ(pid.step(0, 0, -2000), -1000 - 120);
+    CHECK_EQ(pid.step(0, 0, 0), 0);                          // No friction offset at rest
+    CHECK_EQ(pid.step(0, 0, 100000), 4095);
+    CHECK(pid.isSaturated());
+}
+
+// 12 V gearmotor behind an H-bridge: 250 deg/s at full duty, 15 ms mechanical
+// time constant, 5 % duty lost to friction, 4096 counts/rev
+struct Gearmotor : IEncoderDriver, IPWMDriver {
+    static constexpr double COUNTS_PER_DEG = 4096.0 / 360.0;
+    double position = 0.0, velocity = 0.0;                   // Counts, counts/s
+    uint16_t dutyA = 0, dutyB = 0;
+    uint32_t writes = 0, bothDriven = 0;
+    bool stalled = false;
+
+    int32_t readCount() override { return (int32_t)floor(position); }
+    void setCount(int32_t count) override { position = count; }
+    void setPWM(uint8_t channel, uint16_t value) override {
+        (channel == 4 ? dutyA : dutyB) = value;
+        writes++;
+    }
+    uint16_t getMaxPWM() const override { return 4095; }
+
+    void run(uint32_t us) {
+        if (dutyA != 0 && dutyB != 0) bothDriven++;          // Shoot-through on a real bridge
+        double duty = ((double)dutyA - dutyB) / 4095.0;
+        double drive = fabs(duty) <= 0.05 ? 0.0 : (duty - copysign(0.05, duty)) / 0.95;
+        double top = 250.0 * COUNTS_PER_DEG;
+        for (uint32_t t = 0; t < us; t += 10) {
+            velocity += (top * drive - velocity) * 10e-6 / 0.015;
+            if (stalled) velocity = 0.0;
+            position += velocity * 10e-6;
+        }
+    }
+};
+
+static int settledEvents = 0;
+static void onSettled(const Event&) { settledEvents++; }
+
+static void configure(Devices::DCServo& servo) {
+    servo.setCountsPerUnit(Gearmotor::COUNTS_PER_DEG);
+    servo.setGains(0.04f, 0.2f, 0.0008f);
+    servo.setFeedForward(0.0038f, 0.05f);
+    servo.setMaxSpeed(180.0f);
+    servo.setTolerance(0.25f);
+}
+
+// Loop calls every 150-950 us at random; the motor runs in between
+static void runServo(Devices::DCServo& servo, Gearmotor& motor, EventBus& bus, std::mt19937& rng, double seconds) {
+    std::uniform_int_distribution<uint32_t> gap(150, 950);
+    uint64_t end = Host::clockUs + (uint64_t)(seconds * 1e6);
+    while (Host::clockUs < end) {
+        uint32_t us = gap(rng);
+        motor.run(us);
+        Host::advanceUs(us);
+        servo.update();
+        bus.processEvents();
+    }
+}
+
+static void servoTracksAndSettles() {
+    EventBus bus;
+    bus.subscribe("motor.settled", onSettled);
+    settledEvents = 0;
+    Gearmotor motor;
+    Devices::DCServo servo(motor, motor, 4, 5, 650, "Elbow", bus, 1000);
+    configure(servo);
+    CHECK(servo.initialize());
+    std::mt19937 rng(65);
+
+    // Holding where it started: no PWM traffic beyond the two zeroes at initialize()
+    runServo(servo, motor, bus, rng, 0.5);
+    CHECK_EQ(motor.writes, 2);
+
+    servo.moveTo(90.0f, 0);                                  // 0.5 s at max speed
+    runServo(servo, motor, bus, rng, 0.5);
+    float tracking = servo.getMaxTrackingError();
+    runServo(servo, motor, bus, rng, 1.0);
+    printf("    90 deg at 180 deg/s: max tracking error %.2f deg, at rest %.3f deg, %u ticks, %u missed\n",
+           tracking, servo.getValue(), (unsigned)servo.getTickCount(), (unsigned)servo.getMissedTicks());
+    CHECK(tracking < 3.0f);                                  // Reference starts at full speed; 2.7 deg of motor lag
+    CHECK_NEAR(servo.getValue(), 90.0f, 0.25f);
+    CHECK(!servo.isMoving());
+    CHECK_EQ(settledEvents, 1);
+    CHECK(servo.getMissedTicks() < servo.getTickCount() / 20);  // Gaps past 1 ms only
+
+    // At rest the integral works against friction without leaving the tolerance
+    float low = 1e9f, high = -1e9f;
+    for (int i = 0; i < 50; i++) {
+        runServo(servo, motor, bus, rng, 0.01);
+        low = fminf(low, servo.getValue());
+        high = fmaxf(high, servo.getValue());
+    }
+    CHECK(low >= 90.0f - 0.25f && high <= 90.0f + 0.25f);
+    CHECK_EQ(settledEvents, 1);
+    CHECK_EQ(motor.bothDriven, 0);
+}
+
+static void stallRecoversWithoutOvershoot() {
+    EventBus bus;
+    Gearmotor motor;
+    Devices::DCServo servo(motor, motor, 4, 5, 651, "Elbow", bus, 1000);
+    configure(servo);
+    CHECK(servo.initialize());
+    std::mt19937 rng(165);
+
+    // Blocked 0.8 s into a 90 deg move, then released
+    servo.moveTo(90.0f, 0);
+    runServo(servo, motor, bus, rng, 0.2);
+    motor.stalled = true;
+    runServo(servo, motor, bus, rng, 0.8);
+    CHECK(fabsf(servo.getOutput()) > 0.99f);                 // Pushing as hard as it can
+    motor.stalled = false;
+
+    float peak = 0.0f;
+    for (int i = 0; i < 300; i++) {
+        runServo(servo, motor, bus, rng, 0.01);
+        if (servo.getValue() > peak) peak = servo.getValue();
+    }
+    printf("    stalled 0.8 s during a 90 deg move: peak %.2f deg\n", peak);
+    CHECK(peak < 90.0f + 8.0f);                              // Unbounded integral: past the 180 deg mark
+    CHECK_NEAR(servo.getValue(), 90.0f, 0.25f);
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void stepTiming() {
+    PIDController pid(1000);
+    pid.setGains(2.0f, 40.0f, 0.02f);
+    pid.setFeedForward(0.35f, 120);
+    pid.setOutputLimit(4095);
+    pid.setDerivativeFilter(2);
+    pid.reset(0);
+
+    const int N = 2000000;
+    int64_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < N; i++) sink += pid.step(i & 1023, (i * 7) & 1023, i & 255);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / N;
+    printf("    step(): %.1f ns\n", ns);
+    CHECK(sink != 0);
+}
+
+int main() {
+    RUN_TEST(piSettlesOnLag);
+    RUN_TEST(integralFrozenWhileSaturated);
+    RUN_TEST(noDerivativeKick);
+    RUN_TEST(feedForwardAndFriction);
+    RUN_TEST(servoTracksAndSettles);
+    RUN_TEST(stallRecoversWithoutOvershoot);
+    RUN_TEST(stepTiming);
+    return TEST_RESULT();
+}
@@ -0,0 +1,115 @@
+// PowerManager idle on the simulated clock with a DistanceSensor as the only
+// deadline: waits past ~71 minutes clamp to UINT32_MAX instead of wrapping to
+// a short wait, the loop sleeps to the sensor's interval instead of spinning,
+// and a long interval sleeps to the configured cap on every pass.
+
+#include "TestSupport.h"
+#include "Core/EventBus.h"
+#include "Core/PowerManager.h"
+#include "Core/Logger.h"
+#include "Devices/DistanceSensor.h"
+
+using namespace TwiST;
+using Devices::DistanceSensor;
+
+// Echo at a fixed distance, counting pings
+struct FixedEcho : IDistanceDriver {
+    uint32_t pings = 0;
+    void triggerMeasurement() override { pings++; }
+    float readDistanceCm() override { return 42.0f; }
+    bool isMeasurementReady() const override { return true; }
+    float getMaxRange() const override { return 400.0f; }
+};
+
+// One loop pass costs passUs of work, then idles until the sensor is due
+static uint32_t runLoop(DistanceSensor& sensor, PowerManager& power, EventBus& bus,
+                        uint32_t seconds, uint32_t passUs) {
+    uint64_t end = Host::clockUs + seconds * 1000000ULL;
+    uint32_t passes = 0;
+    while (Host::clockUs < end) {
+        sensor.update();
+        bus.processEvents();
+        Host::advanceUs(passUs);
+        power.idle(sensor.getTimeUntilUpdate(micros()));
+        passes++;
+    }
+    return passes;
+}
+
+static void waitsClampedBeforeMicroseconds() {
+    EventBus bus;
+    FixedEcho echo;
+    struct Case { unsigned long intervalMs; uint32_t expectedUs; } cases[] = {
+        {100, 100000}, {4294967, 4294967000UL}, {4294968, UINT32_MAX}, {7200000, UINT32_MAX}};
+    for (const Case& c : cases) {
+        DistanceSensor sensor(echo, 690, "Sonar", bus, c.intervalMs);
+        CHECK_EQ(sensor.getTimeUntilUpdate(micros()), UINT32_MAX);   // Not initialized
+        CHECK(sensor.initialize());
+        CHECK_EQ(sensor.getTimeUntilUpdate(micros()), c.expectedUs);
+    }
+    // 4294968 ms in microseconds wraps to a 704 us wait without the clamp
+    printf("    4294968 ms interval: %lu us unclamped, %lu us clamped\n",
+           (unsigned long)(uint32_t)4294968000ULL, (unsigned long)UINT32_MAX);
+
+    // Part of the interval gone: the rest, then due
+    DistanceSensor sensor(echo, 691, "Sonar", bus, 100);
+    CHECK(sensor.initialize());
+    Host::advanceMs(30);
+    CHECK_EQ(sensor.getTimeUntilUpdate(micros()), 70000);
+    Host::advanceMs(70);
+    CHECK_EQ(sensor.getTimeUntilUpdate(micros()), 0);
+}
+
+static void loopSleepsToSensorInterval() {
+    EventBus bus;
+    FixedEcho busyEcho, idleEcho;
+    DistanceSensor busy(busyEcho, 692, "Sonar", bus, 100);
+    DistanceSensor idle(idleEcho, 693, "Sonar", bus, 100);
+    CHECK(busy.initialize());
+    CHECK(idle.initialize());
+
+    // Same 5 s, 200 us of work per pass: spinning vs sleeping between pings
+    PowerManager spinning;
+    uint32_t spinPasses = runLoop(busy, spinning, bus, 5, 200);
+    PowerManager sleeping;
+    sleeping.setEnabled(true);
+    uint32_t sleepPasses = runLoop(idle, sleeping, bus, 5, 200);
+
+    printf("    100 ms sensor, 5 s: %u passes spinning (%.0f/s, duty %.2f), %u sleeping (%.0f/s, duty %.3f)\n",
+           (unsigned)spinPasses, spinning.getWakeupsPerSecond(), spinning.getDutyCycle(),
+           (unsigned)sleepPasses, sleeping.getWakeupsPerSecond(), sleeping.getDutyCycle());
+    CHECK_EQ(spinPasses, 25000);
+    CHECK_EQ(spinning.getSleepCount(), 0);
+    CHECK(sleepPasses < spinPasses / 50);
+    CHECK(sleeping.getWakeupsPerSecond() < 100.0f);
+    CHECK(sleeping.getDutyCycle() < 0.05f);
+    CHECK(idleEcho.pings >= 49 && idleEcho.pings <= 50);         // Sleeping never costs a reading
+    CHECK(busyEcho.pings >= 49 && busyEcho.pings <= 50);
+}
+
+static void longIntervalSleepsToCap() {
+    EventBus bus;
+    FixedEcho echo;
+    DistanceSensor sensor(echo, 694, "Sonar", bus, 4294968UL + 5000);
+    CHECK(sensor.initialize());
+    PowerManager power;
+    power.setEnabled(true);
+    power.setSleepLimits(1000, 2000000);
+
+    // Unclamped, the wait wraps to ~5 s and counts down to nothing 5 s in:
+    // the loop would spin there while the sensor is still 71 minutes away
+    uint32_t passes = runLoop(sensor, power, bus, 20, 200);
+    printf("    71 min sensor, 20 s: %u passes, %lu sleeps, %.2f wakeups/s\n",
+           (unsigned)passes, power.getSleepCount(), power.getWakeupsPerSecond());
+    CHECK_EQ(power.getSleepCount(), passes);                       // Every pass sleeps
+    CHECK(passes <= 11);
+    CHECK(power.getWakeupsPerSecond() <= 0.5f);
+    CHECK_EQ(echo.pings, 0);
+}
+
+int main() {
+    RUN_TEST(waitsClampedBeforeMicroseconds);
+    RUN_TEST(loopSleepsToSensorInterval);
+    RUN_TEST(longIntervalSleepsToCap);
+    return TEST_RESULT();
+}
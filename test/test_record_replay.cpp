@@ -0,0 +1,233 @@
+// Driver record / replay against a checked-in recording: a joystick and a
+// distance sensor steer two conditioned servos; replaying
+// fixtures/servo_replay.twrl through ReplayADC / ReplayDistance must
+// reproduce every recorded setPWM() exactly, and a behaviour change must show.
+//
+// Regenerate the fixture after an intended output change (run from test/):
+//   ./build/test_record_replay --write-fixture
+
+#include "TestSupport.h"
+#include "Core/EventBus.h"
+#include "Core/RecordLog.h"
+#include "Devices/DistanceSensor.h"
+#include "Devices/Joystick.h"
+#include "Devices/Servo.h"
+#include "Drivers/Record/RecordingDrivers.h"
+#include "Drivers/Record/ReplayDrivers.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace TwiST;
+
+static const char* const FIXTURE = "fixtures/servo_replay.twrl";
+static const uint32_t PASSES = 150;                    // 3 s at 50 Hz
+static const uint64_t START_US = 10000000ULL;
+
+// ===== Scripted sensors (the "field" the fixture was recorded in) =====
+
+// Integer-only signals: the live run records the same bytes on any host
+static uint32_t nextNoise(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 16;
+}
+
+// Triangle sweep over most of the range plus +/-40 counts of pot noise
+struct SweepADC : IADCDriver {
+    uint32_t reads = 0, period, noise;
+    SweepADC(uint32_t p, uint32_t seed) : period(p), noise(seed) {}
+    uint16_t readRaw() override {
+        uint32_t phase = reads++ % period;
+        uint32_t ramp = (phase < period / 2) ? phase : period - phase;
+        return (uint16_t)(150 + ramp * 3800 / (period / 2) + nextNoise(noise) % 81 - 40);
+    }
+    uint16_t getMaxValue() const override { return 4095; }
+};
+
+// Obstacle approaching at 0.9 cm per read with sub-millimetre jitter the log rounds away
+struct ApproachDistance : IDistanceDriver {
+    uint32_t reads = 0, noise = 99;
+    void triggerMeasurement() override {}
+    float readDistanceCm() override {
+        int32_t um = 80000 - 900 * (int32_t)reads++ + (int32_t)(nextNoise(noise) % 6275) - 3137;
+        return um / 1000.0f;
+    }
+    bool isMeasurementReady() const override { return true; }
+    float getMaxRange() const override { return 400.0f; }
+};
+
+struct NullPWM : IPWMDriver {
+    void setPWM(uint8_t, uint16_t) override {}
+    uint16_t getMaxPWM() const override { return 4095; }
+};
+
+// In-memory IRecordSink producing the same bytes DriverRecorder writes
+struct MemorySink : IRecordSink {
+    std::vector<uint8_t> bytes;
+    MemorySink() : bytes(RecordLog::HEADER_SIZE) { RecordLog::writeHeader(bytes.data()); }
+    void record(RecordKind kind, uint8_t stream, uint8_t channel, uint16_t value) override {
+        RecordEntry entry = {(uint32_t)micros(), kind, channel, stream, value};
+        size_t at = bytes.size();
+        bytes.resize(at + RecordLog::RECORD_SIZE);
+        RecordLog::writeRecord(entry, &bytes[at]);
+    }
+};
+
+// ===== The application under test =====
+
+struct Outputs {
+    std::vector<uint16_t> base, lift;                  // Servo output ticks after every pass
+};
+
+static Outputs runScenario(IADCDriver& x, IADCDriver& y, IDistanceDriver& distance, IPWMDriver& pwm,
+                           uint16_t liftMaxStep = 520) {
+    Host::clockUs = START_US;
+    EventBus bus;
+    Devices::Joystick stick(x, y, 10, "Stick", bus);
+    Devices::DistanceSensor ranger(distance, 11, "Ranger", bus, 40);
+    Devices::Servo base(pwm, 0, 20, "Base", bus);
+    Devices::Servo lift(pwm, 1, 21, "Lift", bus);
+    base.calibrateBySteps(110, 520);
+    lift.calibrateBySteps(110, liftMaxStep);
+    base.setOutputSmoothing(60);
+    base.setOutputDeadband(2);
+    lift.setOutputSlewRate(300.0f);
+    stick.initialize();
+    ranger.initialize();
+    base.initialize();
+    lift.initialize();
+
+    Outputs outputs;
+    for (uint32_t k = 0; k < PASSES; k++) {
+        Host::advanceMs(20);
+        stick.update();
+        ranger.update();
+        base.setValue(stick.getX() * 180.0f);
+        if (stick.getY() > 0.8f) base.moveTo(90.0f, 300);
+        float d = ranger.getDistance();
+        lift.setValue(d < 20.0f ? 20.0f : (d > 70.0f ? 160.0f : 20.0f + (d - 20.0f) * 2.8f));
+        base.update();
+        lift.update();
+        outputs.base.push_back(base.getOutputTicks());
+        outputs.lift.push_back(lift.getOutputTicks());
+    }
+    return outputs;
+}
+
+static std::vector<uint8_t> recordLive(Outputs* outputs = NULL) {
+    SweepADC x(120, 7), y(202, 11);
+    ApproachDistance distance;
+    NullPWM servoBoard;
+    MemorySink sink;
+    Drivers::RecordingADC recX(x, sink, 0), recY(y, sink, 1);
+    Drivers::RecordingDistance recDistance(distance, sink, 0);
+    Drivers::RecordingPWM recPwm(servoBoard, sink, 0);
+    Outputs live = runScenario(recX, recY, recDistance, recPwm);
+    if (outputs) *outputs = live;
+    return sink.bytes;
+}
+
+static std::vector<uint8_t> loadFixture() {
+    std::vector<uint8_t> bytes;
+    FILE* file = fopen(FIXTURE, "rb");
+    if (!file) return bytes;
+    uint8_t chunk[512];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) bytes.insert(bytes.end(), chunk, chunk + n);
+    fclose(file);
+    return bytes;
+}
+
+// ===== Cases =====
+
+static void fixtureIsReadable() {
+    std::vector<uint8_t> bytes = loadFixture();
+    CHECK(!bytes.empty());
+    RecordLogReader log(bytes.data(), bytes.size());
+    CHECK(log.isValid());
+    CHECK_EQ((bytes.size() - RecordLog::HEADER_SIZE) % RecordLog::RECORD_SIZE, 0);
+
+    size_t counts[4] = {0, 0, 0, 0};
+    bool ordered = true;
+    for (size_t i = 0; i < log.getRecordCount(); i++) {
+        RecordEntry e = log.at(i);
+        if (e.kind >= RECORD_ADC_READ && e.kind <= RECORD_PWM_SET) counts[e.kind]++;
+        if (i > 0 && e.timestampUs < log.at(i - 1).timestampUs) ordered = false;
+    }
+    CHECK(ordered);
+    CHECK_EQ(counts[RECORD_ADC_READ], 2 * PASSES);      // getX() + getY() per pass
+    CHECK(counts[RECORD_DISTANCE_READ] >= PASSES / 2);
+    CHECK(counts[RECORD_PWM_SET] > PASSES);             // Both servos moved most passes
+    printf("    %s: %zu bytes, %zu ADC / %zu distance / %zu PWM records\n", FIXTURE, bytes.size(),
+           counts[RECORD_ADC_READ], counts[RECORD_DISTANCE_READ], counts[RECORD_PWM_SET]);
+}
+
+static void replayReproducesEveryOutput() {
+    std::vector<uint8_t> bytes = loadFixture();
+    RecordLogReader log(bytes.data(), bytes.size());
+    Drivers::ReplayADC x(log, 0), y(log, 1);
+    Drivers::ReplayDistance distance(log, 0);
+    Drivers::ReplayPWM pwm(log, 0);
+
+    runScenario(x, y, distance, pwm);
+
+    size_t recorded = 0;
+    for (size_t i = 0; i < log.getRecordCount(); i++) recorded += log.at(i).kind == RECORD_PWM_SET;
+    CHECK_EQ(pwm.getMismatchCount(), 0);
+    CHECK_EQ(pwm.getFirstMismatchIndex(), -1);
+    CHECK_EQ(pwm.getMatchCount(), recorded);
+    CHECK_EQ(pwm.getExtraWriteCount(), 0);
+    CHECK(!x.isExhausted() && !distance.isExhausted());   // Consumed exactly, nothing invented
+    x.readRaw();
+    CHECK(x.isExhausted());
+}
+
+static void replayMatchesLiveDevices() {
+    // Same scenario live and replayed: device-level outputs identical pass by pass
+    Outputs live;
+    std::vector<uint8_t> bytes = recordLive(&live);
+    RecordLogReader log(bytes.data(), bytes.size());
+    Drivers::ReplayADC x(log, 0), y(log, 1);
+    Drivers::ReplayDistance distance(log, 0);
+    Drivers::ReplayPWM pwm(log, 0);
+    Outputs replayed = runScenario(x, y, distance, pwm);
+
+    CHECK(live.base == replayed.base);
+    CHECK(live.lift == replayed.lift);
+    CHECK_EQ(pwm.getMismatchCount(), 0);
+
+    // The live run still records the checked-in fixture byte for byte
+    CHECK(bytes == loadFixture());
+}
+
+static void behaviourChangeIsDetected() {
+    std::vector<uint8_t> bytes = loadFixture();
+    RecordLogReader log(bytes.data(), bytes.size());
+    Drivers::ReplayADC x(log, 0), y(log, 1);
+    Drivers::ReplayDistance distance(log, 0);
+    Drivers::ReplayPWM pwm(log, 0);
+
+    runScenario(x, y, distance, pwm, 540);             // Lift recalibrated
+    CHECK(pwm.getMismatchCount() > 0);
+    CHECK(pwm.getFirstMismatchIndex() >= 0);
+}
+
+int main(int argc, char** argv) {
+    if (argc == 2 && strcmp(argv[1], "--write-fixture") == 0) {
+        std::vector<uint8_t> bytes = recordLive();
+        FILE* file = fopen(FIXTURE, "wb");
+        if (!file || fwrite(bytes.data(), 1, bytes.size(), file) != bytes.size()) {
+            printf("cannot write %s\n", FIXTURE);
+            return 1;
+        }
+        fclose(file);
+        printf("wrote %s (%zu bytes)\n", FIXTURE, bytes.size());
+        return 0;
+    }
+
+    RUN_TEST(fixtureIsReadable);
+    RUN_TEST(replayReproducesEveryOutput);
+    RUN_TEST(replayMatchesLiveDevices);
+    RUN_TEST(behaviourChangeIsDetected);
+    return TEST_RESULT();
+}
@@ -0,0 +1,367 @@
+// SafetySupervisor under the simulated clock: grants and their expiry,
+// throttled and deferred admission (two Servos - the deferred one starts
+// once the other's grant ends), overload hysteresis, and a stalled output
+// being disabled with one CRITICAL "safety.stall" event.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/EventBus.h"
+#include "Core/I2CQueue.h"
+#include "Core/Logger.h"
+#include "Core/SafetySupervisor.h"
+#include "Devices/Servo.h"
+#include "Drivers/I2C/FakePCA9685.h"
+#include "Drivers/PWM/PCA9685.h"
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+using Devices::Servo;
+using Drivers::FakePCA9685;
+
+// Output whose enable / disable the supervisor can observe
+struct SwitchedOutput : FakeOutputDevice {
+    bool enabled = true;
+    explicit SwitchedOutput(uint16_t deviceId) : FakeOutputDevice(deviceId) {}
+    void enable() override { enabled = true; }
+    void disable() override { enabled = false; }
+    bool isEnabled() const override { return enabled; }
+};
+
+// Feedback potentiometer whose reading the test sets
+struct FeedbackPot : IInputDevice {
+    float reading = 0.5f;
+
+    bool initialize() override { return true; }
+    void shutdown() override {}
+    void update() override {}
+    DeviceInfo getInfo() const override { return {"Pot", "Pot", 90, CAP_INPUT, 1}; }
+    const char* getName() const override { return "Pot"; }
+    uint16_t getCapabilities() const override { return CAP_INPUT; }
+    bool hasCapability(DeviceCapability cap) const override { return cap == CAP_INPUT; }
+    DeviceState getState() const override { return STATE_READY; }
+    void enable() override {}
+    void disable() override {}
+    bool isEnabled() const override { return true; }
+    bool configure(const JsonDocument&) override { return true; }
+    void getConfiguration(JsonDocument&) const override {}
+    void toJson(JsonDocument&) const override {}
+    bool fromJson(const JsonDocument&) override { return true; }
+    float readAnalog(uint8_t) override { return reading; }
+    bool readDigital(uint8_t) override { return false; }
+    bool isInputReady() override { return true; }
+};
+
+struct Published {
+    std::string name;
+    uint16_t source;
+    EventPriority priority;
+};
+
+static std::vector<Published> published;
+
+static void record(const Event& event) {
+    published.push_back({event.name, event.sourceDeviceId, event.priority});
+}
+
+static void listen(EventBus& bus) {
+    published.clear();
+    bus.subscribe("safety.overload", record, PRIORITY_CRITICAL);
+    bus.subscribe("safety.stall", record, PRIORITY_CRITICAL);
+}
+
+// Default ServoLoadModel: 10 mA idle + 1.5 mA per deg/s, 700 mA cap, 400 deg/s jumps
+static float draw(float dps) { return 10.0f + 1.5f * dps; }
+
+static void grantsExpire() {
+    EventBus bus;
+    SafetySupervisor safety(bus, 1000.0f);
+    SwitchedOutput a(1), b(2);
+    CHECK(safety.supervise(a));
+    CHECK(safety.supervise(b));
+    CHECK(!safety.supervise(a));                       // Already supervised
+
+    // 90 deg in 900 ms = 100 deg/s: fits, duration unchanged
+    unsigned long duration = 900;
+    CHECK(safety.requestMove(1, 0.0f, 90.0f, duration));
+    CHECK_EQ(duration, 900);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), draw(100) + draw(0), 0.01);
+
+    // Grant still held at 899 ms, gone at 900 - even though nobody released it
+    Host::advanceMs(899);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), draw(100) + draw(0), 0.01);
+    Host::advanceMs(1);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), 2 * draw(0), 0.01);
+
+    // Un-timed jump: 400 deg/s for distance / maxSpeed = 225 ms
+    duration = 0;
+    CHECK(safety.requestMove(2, 0.0f, 90.0f, duration));
+    CHECK_EQ(duration, 0);
+    Host::advanceMs(224);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), draw(400) + draw(0), 0.01);
+    Host::advanceMs(1);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), 2 * draw(0), 0.01);
+
+    // releaseMove() ends a grant early; unsupervised ids and zero distance pass through
+    duration = 900;
+    CHECK(safety.requestMove(1, 0.0f, 90.0f, duration));
+    safety.releaseMove(1);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), 2 * draw(0), 0.01);
+    duration = 1;
+    CHECK(safety.requestMove(77, 0.0f, 180.0f, duration));
+    CHECK(safety.requestMove(1, 45.0f, 45.0f, duration));
+    CHECK_EQ(safety.getGrantedCount(), 3);
+    CHECK_EQ(safety.getPeakLoad(), draw(400) + draw(0));
+}
+
+static void overBudgetMovesThrottle() {
+    EventBus bus;
+    SafetySupervisor safety(bus, 500.0f);
+    SwitchedOutput a(1), b(2);
+    safety.supervise(a);
+    safety.supervise(b);
+
+    unsigned long duration = 450;                      // 200 deg/s = 310 mA
+    CHECK(safety.requestMove(1, 0.0f, 90.0f, duration));
+
+    // 300 deg/s would need 460 mA; 190 mA left allows 120 deg/s (>= 25 % of 300)
+    duration = 300;
+    CHECK(safety.requestMove(2, 0.0f, 90.0f, duration));
+    CHECK_EQ(duration, 750);                           // ceil(90 / 120 deg/s)
+    CHECK_EQ(safety.getThrottledCount(), 1);
+    safety.update();
+    CHECK_NEAR(safety.getEstimatedLoad(), 500.0f, 0.01);
+    CHECK(!safety.isOverloaded());
+
+    // Alone on the bus: throttled below the minimum rather than waiting forever
+    SafetySupervisor tight(bus, 100.0f);
+    tight.supervise(a);
+    duration = 300;
+    CHECK(tight.requestMove(1, 0.0f, 90.0f, duration));
+    CHECK_EQ(duration, 1500);                          // (100 - 10) / 1.5 = 60 deg/s
+    CHECK_EQ(tight.getDeferredCount(), 0);
+
+    // Budget below idle: nothing to throttle to - starts, and the overload is reported
+    SafetySupervisor starved(bus, 5.0f);
+    starved.supervise(a);
+    duration = 300;
+    CHECK(starved.requestMove(1, 0.0f, 90.0f, duration));
+    CHECK_EQ(duration, 300);
+    listen(bus);
+    starved.update();
+    CHECK(starved.isOverloaded());
+    CHECK_EQ(published.size(), 1);
+}
+
+struct ServoRig {
+    FakePCA9685 chip;
+    I2CQueue queue;
+    Drivers::PCA9685 pwm;
+    EventBus bus;
+    Servo shoulder, elbow;
+    SafetySupervisor safety;
+
+    ServoRig(float budgetMa)
+        : chip(0x40), queue(chip), pwm(0x40),
+          shoulder(pwm, 0, 1, "Shoulder", bus), elbow(pwm, 1, 2, "Elbow", bus), safety(bus, budgetMa) {
+        pwm.setQueue(&queue);
+        Servo* servos[] = {&shoulder, &elbow};
+        for (Servo* s : servos) {
+            s->calibrateBySteps(110, 540);
+            s->initialize();
+            safety.supervise(*s);
+            s->setMotionSupervisor(&safety);
+        }
+        queue.update();
+    }
+
+    void tick() {
+        Host::advanceMs(10);
+        shoulder.update();
+        elbow.update();
+        safety.update();
+        queue.update();
+    }
+};
+
+static void deferredMoveStartsWhenBudgetFrees() {
+    ServoRig rig(380.0f);
+    CHECK_EQ(rig.shoulder.getValue(), 90.0f);
+
+    // Both at 200 deg/s (310 mA each, 380 mA budget): the elbow could only crawl at 40 deg/s - waits
+    rig.shoulder.moveTo(180.0f, 450);
+    rig.elbow.moveTo(0.0f, 450);
+    CHECK(rig.elbow.isMoveDeferred());
+    CHECK(rig.elbow.isMoving());
+    CHECK_EQ(rig.safety.getDeferredCount(), 1);
+
+    // Held in place, retried every update without re-counting
+    unsigned long startedAt = 0;
+    unsigned long t0 = millis();
+    for (int i = 0; i < 100 && startedAt == 0; i++) {
+        rig.tick();
+        if (!rig.elbow.isMoveDeferred()) startedAt = millis() - t0;
+        else CHECK_EQ(rig.elbow.getValue(), 90.0f);
+    }
+    CHECK_EQ(rig.safety.getDeferredCount(), 1);
+    CHECK_EQ(rig.shoulder.getValue(), 180.0f);
+    CHECK_EQ(startedAt, 450);                          // The update that ends the shoulder's move
+    CHECK_EQ(rig.safety.getThrottledCount(), 0);       // Finished move is not counted as load
+
+    // Then runs at the requested speed, budget to itself
+    unsigned long doneAt = 0;
+    for (int i = 0; i < 100 && doneAt == 0; i++) {
+        rig.tick();
+        if (!rig.elbow.isMoving()) doneAt = millis() - t0;
+    }
+    CHECK_EQ(doneAt, 900);
+    CHECK_EQ(rig.elbow.getValue(), 0.0f);
+    CHECK_NEAR(rig.safety.getPeakLoad(), draw(200) + draw(0), 0.01);
+    CHECK(!rig.safety.isOverloaded());
+
+    // stop() abandons a deferred move
+    rig.shoulder.moveTo(90.0f, 450);
+    rig.elbow.moveTo(90.0f, 300);
+    CHECK(rig.elbow.isMoveDeferred());
+    rig.elbow.stop();
+    for (int i = 0; i < 60; i++) rig.tick();
+    CHECK_EQ(rig.elbow.getValue(), 0.0f);
+    CHECK_EQ(rig.safety.getDeferredCount(), 2);
+}
+
+static void streamedOverloadHasHysteresis() {
+    EventBus bus;
+    listen(bus);
+    SafetySupervisor safety(bus, 300.0f);
+    SwitchedOutput a(1), b(2);
+    safety.supervise(a);
+    safety.supervise(b);
+
+    // Ungated setValue() streams: 3 deg per 10 ms = 300 deg/s each, observed through a 1:1 filter
+    safety.update();
+    for (int i = 0; i < 20; i++) {
+        Host::advanceMs(10);
+        a.value += 3.0f;
+        b.value -= 3.0f;
+        safety.update();
+    }
+    CHECK(safety.isOverloaded());
+    CHECK_EQ(safety.getOverloadCount(), 1);            // One event per episode
+    CHECK_EQ(published.size(), 1);
+    CHECK(published[0].name == "safety.overload");
+    CHECK_EQ(published[0].source, 0);
+    CHECK_EQ(published[0].priority, PRIORITY_CRITICAL);
+    CHECK(Host::serialOutput.find("over budget 300 mA") != std::string::npos);
+
+    // Dropping just under budget is not enough to clear; stopping is
+    for (int i = 0; i < 20; i++) {
+        Host::advanceMs(10);
+        a.value += 1.75f;                              // 272.5 + 10 mA: under budget, above 90 %
+        safety.update();
+    }
+    CHECK(safety.isOverloaded());
+    for (int i = 0; i < 20; i++) {
+        Host::advanceMs(10);
+        safety.update();
+    }
+    CHECK(!safety.isOverloaded());
+    CHECK_NEAR(safety.getEstimatedLoad(), 2 * draw(0), 0.5);
+
+    // A second episode is a second event
+    for (int i = 0; i < 20; i++) {
+        Host::advanceMs(10);
+        a.value += 3.0f;
+        b.value -= 3.0f;
+        safety.update();
+    }
+    CHECK_EQ(safety.getOverloadCount(), 2);
+    CHECK_EQ(published.size(), 2);
+}
+
+static void stallDisablesOutput() {
+    EventBus bus;
+    listen(bus);
+    SafetySupervisor safety(bus, 1000.0f);
+    SwitchedOutput arm(7);
+    FeedbackPot pot;
+    arm.value = 90.0f;
+    safety.supervise(arm);
+    CHECK(!safety.attachFeedback(8, pot, 0, 0.0f, 180.0f));   // Not supervised
+    CHECK(safety.attachFeedback(7, pot, 0, 0.0f, 180.0f));
+    safety.setStallDetection(10.0f, 300);
+
+    // Within tolerance (pot 0.5 = 90 deg, then 99 deg)
+    for (int i = 0; i < 50; i++) {
+        Host::advanceMs(10);
+        pot.reading = (i % 2) ? 0.55f : 0.5f;
+        safety.update();
+    }
+    CHECK_EQ(safety.getStallCount(), 0);
+
+    // Brief mismatch shorter than 300 ms: no stall
+    pot.reading = 0.3f;                                // 54 deg vs 90 commanded
+    for (int i = 0; i < 25; i++) {
+        Host::advanceMs(10);
+        safety.update();
+    }
+    pot.reading = 0.5f;
+    Host::advanceMs(10);
+    safety.update();
+    CHECK_EQ(safety.getStallCount(), 0);
+    CHECK(arm.enabled);
+
+    // Held mismatch: stalls 300 ms after it was first seen, once
+    pot.reading = 0.3f;
+    Host::advanceMs(10);
+    safety.update();
+    unsigned long since = millis();
+    unsigned long stalledAfter = 0;
+    for (int i = 0; i < 60; i++) {
+        Host::advanceMs(10);
+        safety.update();
+        if (stalledAfter == 0 && safety.getStallCount() > 0) stalledAfter = millis() - since;
+    }
+    CHECK_EQ(stalledAfter, 300);
+    CHECK_EQ(safety.getStallCount(), 1);
+    CHECK(!arm.enabled);
+    CHECK_EQ(published.size(), 1);
+    CHECK(published[0].name == "safety.stall");
+    CHECK_EQ(published[0].source, 7);
+    CHECK_EQ(published[0].priority, PRIORITY_CRITICAL);
+
+    // Re-enabling re-arms detection: still jammed, stalls again
+    arm.enable();
+    for (int i = 0; i < 40; i++) {
+        Host::advanceMs(10);
+        safety.update();
+    }
+    CHECK_EQ(safety.getStallCount(), 2);
+    CHECK(!arm.enabled);
+
+    // Reporting only: output stays on
+    safety.setStallDetection(10.0f, 300, false);
+    arm.enable();
+    for (int i = 0; i < 40; i++) {
+        Host::advanceMs(10);
+        safety.update();
+    }
+    CHECK_EQ(safety.getStallCount(), 3);
+    CHECK(arm.enabled);
+    CHECK_EQ(published.size(), 3);
+}
+
+int main() {
+    Logger::begin(Serial, Logger::Level::INFO);
+    RUN_TEST(grantsExpire);
+    RUN_TEST(overBudgetMovesThrottle);
+    RUN_TEST(deferredMoveStartsWhenBudgetFrees);
+    RUN_TEST(streamedOverloadHasHysteresis);
+    RUN_TEST(stallDisablesOutput);
+    return TEST_RESULT();
+}
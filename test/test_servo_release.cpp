@@ -0,0 +1,160 @@
+// Servo hold policy at register level: release sets the full-OFF bit (0x10
+// in LEDn_OFF_H) on the FakePCA9685 model, the next setPWM() clears it,
+// streamed repeats stay limp; getTimeUntilUpdate() for long release delays.
+
+#include "TestSupport.h"
+#include "Core/EventBus.h"
+#include "Core/I2CQueue.h"
+#include "Devices/Servo.h"
+#include "Drivers/I2C/FakePCA9685.h"
+#include "Drivers/PWM/PCA9685.h"
+
+using namespace TwiST;
+using Devices::Servo;
+using Drivers::FakePCA9685;
+
+static const uint8_t CH = 3;
+static const uint8_t OFF_H = FakePCA9685::LED0_ON_L + 4 * CH + 3;
+
+struct Rig {
+    FakePCA9685 chip;
+    I2CQueue queue;
+    Drivers::PCA9685 pwm;
+    EventBus bus;
+    Servo servo;
+
+    Rig() : chip(0x40), queue(chip), pwm(0x40), servo(pwm, CH, 100, "Elbow", bus) {
+        pwm.setQueue(&queue);
+        servo.calibrateBySteps(110, 540);
+        servo.initialize();
+        queue.update();
+    }
+
+    void run(unsigned long ms) {
+        for (unsigned long t = 0; t < ms; t += 20) {
+            Host::advanceMs(20);
+            servo.update();
+            queue.update();
+        }
+    }
+};
+
+static void powerOnIsFullOff() {
+    FakePCA9685 chip(0x40);
+    for (uint8_t ch = 0; ch < 16; ch++) {
+        CHECK_EQ(chip.getRegister(FakePCA9685::LED0_ON_L + 4 * ch + 3), 0x10);
+        CHECK(chip.isFullOff(ch));
+    }
+}
+
+static void releaseSetsFullOffBit() {
+    Rig rig;
+    CHECK_EQ(rig.chip.getRegister(OFF_H) & 0x10, 0);   // initialize() wrote a pulse
+    CHECK_EQ(rig.chip.getDuty(CH), 325);               // Middle of 110..540
+
+    rig.servo.setHoldPolicy(Servo::RELEASE_WHEN_IDLE, 500);
+    rig.servo.moveTo(150, 400);
+    rig.run(400);
+    CHECK(!rig.servo.isReleased());
+    uint16_t rest = rig.servo.getOutputTicks();
+    CHECK_EQ(rig.chip.getOff(CH), rest);
+
+    rig.run(600);                                      // 500 ms at rest
+    CHECK(rig.servo.isReleased());
+    CHECK_EQ(rig.servo.getReleaseCount(), 1);
+    CHECK_EQ(rig.chip.getRegister(OFF_H), 0x10);       // Full-OFF, counter bits cleared
+    CHECK(rig.chip.isFullOff(CH));
+    CHECK_EQ(rig.chip.getDuty(CH), 0);
+    CHECK_EQ(rig.servo.getOutputTicks(), rest);        // Output remembered for reattach
+}
+
+static void repeatsStayLimpAndMoveReattaches() {
+    Rig rig;
+    rig.servo.setHoldPolicy(Servo::RELEASE_WHEN_IDLE, 500);
+    rig.servo.moveTo(150, 400);
+    rig.run(1000);
+    CHECK(rig.servo.isReleased());
+    unsigned long writes = rig.chip.getChannelWrites(CH);
+
+    // Streamed input repeating the rest position - no bus traffic
+    for (int i = 0; i < 50; i++) {
+        rig.servo.setValue(150);
+        Host::advanceMs(20);
+        rig.servo.update();
+        rig.queue.update();
+    }
+    CHECK(rig.servo.isReleased());
+    CHECK_EQ(rig.chip.getChannelWrites(CH), writes);
+
+    // New position: one write that clears the full-OFF bit
+    rig.servo.setValue(140);
+    rig.queue.update();
+    CHECK(!rig.servo.isReleased());
+    CHECK_EQ(rig.servo.getReattachCount(), 1);
+    CHECK_EQ(rig.chip.getChannelWrites(CH), writes + 1);
+    CHECK_EQ(rig.chip.getRegister(OFF_H) & 0x10, 0);
+    CHECK_EQ(rig.chip.getDuty(CH), rig.servo.getOutputTicks());
+}
+
+static void attachRestoresLastPulse() {
+    Rig rig;
+    rig.servo.setValue(60);
+    rig.queue.update();
+    uint16_t held = rig.servo.getOutputTicks();
+
+    rig.servo.release();
+    rig.queue.update();
+    CHECK(rig.chip.isFullOff(CH));
+    rig.servo.release();                               // Already released - no write
+    rig.queue.update();
+    CHECK_EQ(rig.servo.getReleaseCount(), 1);
+
+    rig.servo.attach();
+    rig.queue.update();
+    CHECK(!rig.chip.isFullOff(CH));
+    CHECK_EQ(rig.chip.getOff(CH), held);
+    CHECK_EQ(rig.chip.getOn(CH), 0);
+    CHECK_EQ(rig.servo.getReattachCount(), 1);
+}
+
+static void disablePolicyFollowsEnable() {
+    Rig rig;
+    rig.servo.setHoldPolicy(Servo::RELEASE_WHEN_DISABLED);
+    rig.run(3000);
+    CHECK(!rig.servo.isReleased());                    // Idle alone does not release
+
+    rig.servo.disable();
+    rig.queue.update();
+    CHECK(rig.chip.isFullOff(CH));
+    rig.servo.enable();
+    rig.queue.update();
+    CHECK(!rig.chip.isFullOff(CH));
+    CHECK_EQ(rig.chip.getDuty(CH), rig.servo.getOutputTicks());
+}
+
+static void longReleaseDelayDoesNotWrap() {
+    Rig rig;
+    uint32_t now = (uint32_t)micros();
+
+    rig.servo.setHoldPolicy(Servo::RELEASE_WHEN_IDLE, 60000UL);
+    CHECK_EQ(rig.servo.getTimeUntilUpdate(now), 60000000UL);
+
+    // 5,000,000 ms x 1000 wraps 32 bits - must clamp, not come back small
+    rig.servo.setHoldPolicy(Servo::RELEASE_WHEN_IDLE, 5000000UL);
+    CHECK_EQ(rig.servo.getTimeUntilUpdate(now), UINT32_MAX);
+
+    Host::advanceMs(5000000UL - 1000UL);               // 1 s left
+    CHECK_EQ(rig.servo.getTimeUntilUpdate((uint32_t)micros()), 1000000UL);
+    Host::advanceMs(1000);
+    CHECK_EQ(rig.servo.getTimeUntilUpdate((uint32_t)micros()), 0);
+}
+
+int main() {
+    RUN_TEST(powerOnIsFullOff);
+    RUN_TEST(releaseSetsFullOffBit);
+    RUN_TEST(repeatsStayLimpAndMoveReattaches);
+    RUN_TEST(attachRestoresLastPulse);
+    RUN_TEST(disablePolicyFollowsEnable);
+    RUN_TEST(longReleaseDelayDoesNotWrap);
+    return TEST_RESULT();
+}
@@ -0,0 +1,304 @@
+// StateMachine exit / entry order on A { B { C, D } }, E: sibling with a
+// transition action, self transition, internal transition, child to
+// ancestor, guard falling through to the parent, events raised inside an
+// entry action (run to completion); statistics, invalid tables, timing.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/DeviceRegistry.h"
+#include "Core/EventBus.h"
+#include "Core/Logger.h"
+#include "Core/StateMachine.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+
+static EventBus bus;
+static std::string trace;
+static int noiseOnEntry = 0;                           // Extra events raised by E's entry
+
+static void note(const char* step) {
+    if (!trace.empty()) trace += ' ';
+    trace += step;
+}
+
+static std::string take() {
+    std::string steps = trace;
+    trace.clear();
+    return steps;
+}
+
+static void publish(const char* name, uint16_t source = 0) {
+    Event event = {};
+    event.name = name;
+    event.sourceDeviceId = source;
+    bus.publish(event);
+}
+
+static void enterA(void*) { note("+A"); }
+static void exitA(void*)  { note("-A"); }
+static void enterB(void*) { note("+B"); }
+static void exitB(void*)  { note("-B"); }
+static void enterC(void*) { note("+C"); }
+static void exitC(void*)  { note("-C"); }
+static void enterD(void*) { note("+D"); }
+static void exitD(void*)  { note("-D"); }
+static void exitE(void*)  { note("-E"); }
+static void enterE(void*) {
+    note("+E");
+    for (int i = 0; i < noiseOnEntry; i++) publish("noise");
+    publish("go");                                     // Must wait until E is fully entered
+    note("E-published");
+}
+
+static bool isNear(const Event& event, void*) { return event.sourceDeviceId < 50; }
+static void act(const Event&, void*) { note("act"); }
+static void internal(const Event&, void*) { note("internal"); }
+
+enum { A, B, C, D, E };
+
+static const StateDef states[] = {
+    // name  parent        initial       entry   exit   device value  ms
+    { "A",   HSM_NO_STATE, B,            enterA, exitA, 0,     0.0f,  0   },
+    { "B",   A,            C,            enterB, exitB, 0,     0.0f,  0   },
+    { "C",   B,            HSM_NO_STATE, enterC, exitC, 100,   30.0f, 800 },
+    { "D",   B,            HSM_NO_STATE, enterD, exitD, 100,   90.0f, 0   },
+    { "E",   HSM_NO_STATE, HSM_NO_STATE, enterE, exitE, 0,     0.0f,  0   },
+};
+
+static const TransitionDef transitions[] = {
+    // from  event    guard   to            action
+    { C,     "dist",  isNear, D,            act      },    // 0: guarded sibling
+    { D,     "dist",  NULL,   D,            NULL     },    // 1: self transition
+    { B,     "dist",  NULL,   C,            NULL     },    // 2: parent handles what C's guard rejects
+    { A,     "stop",  NULL,   E,            NULL     },    // 3: inherited from the top
+    { E,     "go",    NULL,   A,            NULL     },    // 4: raised inside E's entry
+    { D,     "tick",  NULL,   HSM_NO_STATE, internal },    // 5: internal
+    { D,     "up",    NULL,   B,            NULL     },    // 6: child to ancestor
+    { E,     "noise", NULL,   HSM_NO_STATE, NULL     },    // 7: fills the deferred queue
+};
+
+struct Rig {
+    DeviceRegistry registry;
+    FakeOutputDevice servo;
+    StateMachine machine;
+
+    Rig() : servo(100), machine(bus, &registry, states, 5, transitions, 8) {
+        registry.registerDevice(&servo);
+        trace.clear();
+        noiseOnEntry = 0;
+    }
+};
+
+static void beginEntersNestedInitialStates() {
+    Rig rig;
+    CHECK(rig.machine.begin(A));
+    CHECK(take() == "+A +B +C");                       // Outermost first
+    CHECK_EQ(rig.machine.getState(), C);
+    CHECK(rig.machine.isIn(A) && rig.machine.isIn(B) && !rig.machine.isIn(D));
+    CHECK_EQ(rig.servo.moves, 1);                      // C's entry command
+    CHECK_EQ(rig.servo.target, 30.0f);
+    CHECK_EQ(rig.servo.duration, 800);
+}
+
+static void siblingExitsBeforeActionBeforeEntry() {
+    Rig rig;
+    rig.machine.begin(A);
+    take();
+
+    publish("dist", 10);
+    CHECK(take() == "-C act +D");                      // Common parent B is not exited
+    CHECK_EQ(rig.machine.getState(), D);
+    CHECK_EQ(rig.servo.sets, 1);                       // D's entry command, durationMs 0
+    CHECK_EQ(rig.servo.value, 90.0f);
+}
+
+static void selfAndInternalTransitions() {
+    Rig rig;
+    rig.machine.begin(A);
+    publish("dist", 10);
+    take();
+
+    publish("dist", 99);
+    CHECK(take() == "-D +D");                          // External self transition
+    CHECK_EQ(rig.machine.getEntryCount(D), 2);
+    CHECK_EQ(rig.servo.sets, 2);
+
+    publish("tick");
+    CHECK(take() == "internal");                       // No exit / entry
+    CHECK_EQ(rig.machine.getState(), D);
+    CHECK_EQ(rig.machine.getEntryCount(D), 2);
+}
+
+static void childToAncestorReentersAncestor() {
+    Rig rig;
+    rig.machine.begin(A);
+    publish("dist", 10);
+    take();
+
+    publish("up");
+    CHECK(take() == "-D -B +B +C");                    // Target B is exited and re-entered
+    CHECK_EQ(rig.machine.getState(), C);
+    CHECK_EQ(rig.machine.getEntryCount(A), 1);
+
+    // C's guard rejects; B's transition to C is external from B
+    publish("dist", 99);
+    CHECK(take() == "-C -B +B +C");
+    CHECK_EQ(rig.machine.getFireCount(0), 1);
+    CHECK_EQ(rig.machine.getFireCount(2), 1);
+}
+
+static void eventRaisedDuringEntryRunsAfterIt() {
+    Rig rig;
+    rig.machine.begin(A);
+    take();
+
+    publish("stop");
+    // E's entry publishes "go" - it is handled only after E's entry returns
+    CHECK(take() == "-C -B -A +E E-published -E +A +B +C");
+    CHECK_EQ(rig.machine.getState(), C);
+    CHECK_EQ(rig.machine.getEntryCount(E), 1);
+    CHECK_EQ(rig.machine.getEntryCount(A), 2);
+    CHECK_EQ(rig.machine.getFireCount(3), 1);
+    CHECK_EQ(rig.machine.getFireCount(4), 1);
+    CHECK_EQ(rig.machine.getDeferredDropCount(), 0);
+
+    publish("none");                                   // Not in the table - never reaches the machine
+    publish("go");                                     // In the table, nothing handles it in C
+    CHECK_EQ(rig.machine.getUnhandledCount(), 1);
+    CHECK_EQ(rig.machine.getState(), C);
+}
+
+static void fullDeferredQueueDrops() {
+    Rig rig;
+    rig.machine.begin(A);
+    take();
+
+    noiseOnEntry = TWIST_HSM_DEFER_QUEUE;
+    publish("stop");
+    CHECK_EQ(rig.machine.getDeferredDropCount(), 1);   // "go" did not fit
+    CHECK_EQ(rig.machine.getState(), E);
+    CHECK_EQ(rig.machine.getFireCount(7), TWIST_HSM_DEFER_QUEUE);
+    CHECK(take() == "-C -B -A +E E-published");
+}
+
+static void residencyFollowsClock() {
+    Rig rig;
+    rig.machine.begin(A);
+
+    Host::advanceMs(100);
+    publish("dist", 10);                               // C -> D
+    Host::advanceMs(50);
+    publish("up");                                     // D -> B -> C
+    Host::advanceMs(30);
+
+    CHECK_EQ(rig.machine.getResidencyUs(C), 130000);
+    CHECK_EQ(rig.machine.getResidencyUs(D), 50000);
+    CHECK_EQ(rig.machine.getResidencyUs(B), 180000);
+    CHECK_EQ(rig.machine.getResidencyUs(A), 180000);
+    CHECK_EQ(rig.machine.getResidencyUs(E), 0);
+    CHECK_EQ(rig.machine.getEntryCount(B), 2);
+    CHECK_EQ(rig.machine.getTransitionCount(), 2);
+}
+
+static bool logged(const char* text) {
+    bool found = Host::serialOutput.find(text) != std::string::npos;
+    Host::serialOutput.clear();
+    return found;
+}
+
+static void invalidTablesAreRefused() {
+    Logger::begin(Serial, Logger::Level::INFO);
+    Host::serialOutput.clear();
+
+    static const StateDef cycle[] = {
+        { "X", 1, HSM_NO_STATE, NULL, NULL, 0, 0.0f, 0 },
+        { "Y", 0, HSM_NO_STATE, NULL, NULL, 0, 0.0f, 0 },
+    };
+    StateMachine looped(bus, NULL, cycle, 2, NULL, 0);
+    CHECK(!looped.begin(0));
+    CHECK(!looped.isStarted());
+    CHECK(logged("parent cycle"));
+
+    DeviceRegistry registry;
+    static const StateDef missing[] = {
+        { "X", HSM_NO_STATE, HSM_NO_STATE, NULL, NULL, 7, 0.0f, 0 },  // Device 7 not registered
+    };
+    StateMachine unresolved(bus, &registry, missing, 1, NULL, 0);
+    CHECK(!unresolved.begin(0));
+    CHECK(logged("device 7 is not a registered output"));
+
+    static const StateDef single[] = {
+        { "X", HSM_NO_STATE, HSM_NO_STATE, NULL, NULL, 0, 0.0f, 0 },
+    };
+    static const TransitionDef outside[] = {
+        { 0, "dist", NULL, 3, NULL },                  // Target out of range
+    };
+    StateMachine dangling(bus, NULL, single, 1, outside, 1);
+    CHECK(!dangling.begin(0));
+    CHECK(logged("Transition 0: bad source, target or event"));
+
+    StateMachine wrongStart(bus, NULL, single, 1, NULL, 0);
+    CHECK(!wrongStart.begin(1));
+    CHECK(logged("Initial state 1 out of range"));
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void benchmark() {
+    typedef std::chrono::steady_clock Clock;
+    static const char* names[8] = {"distance.changed", "input.pressed", "input.released", "encoder.changed",
+                                   "safety.overload", "safety.stall", "servo.move.complete", "joystick.moved"};
+
+    // 16 states in four chains four deep, two transitions per state
+    static char stateNames[16][4];
+    static StateDef table[16];
+    static TransitionDef edges[32];
+    for (int i = 0; i < 16; i++) {
+        int level = i % 4;
+        int leaf = (i / 4) * 4 + 3;
+        snprintf(stateNames[i], sizeof(stateNames[i]), "S%d", i);
+        table[i] = {stateNames[i], (uint8_t)(level ? i - 1 : HSM_NO_STATE),
+                    (uint8_t)(level < 3 ? i + 1 : HSM_NO_STATE), NULL, NULL, 0, 0.0f, 0};
+        edges[2 * i] = {(uint8_t)i, names[i % 8], NULL, (uint8_t)(((i / 4 + 1) % 4) * 4), NULL};
+        edges[2 * i + 1] = {(uint8_t)leaf, names[(i + 3) % 8], NULL, (uint8_t)leaf, NULL};
+    }
+
+    EventBus ownBus;
+    StateMachine machine(ownBus, NULL, table, 16, edges, 32);
+    CHECK(machine.begin(0));
+
+    const int N = 1000000;
+    std::vector<Event> events(64);
+    for (int i = 0; i < 64; i++) {
+        events[i] = {};
+        events[i].name = names[(i * 5) % 8];
+    }
+
+    Clock::time_point t0 = Clock::now();
+    for (int i = 0; i < N; i++) ownBus.publish(events[i & 63]);
+    double viaBusNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / N;
+
+    t0 = Clock::now();
+    for (int i = 0; i < N; i++) machine.dispatch(events[i & 63]);
+    double directNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / N;
+
+    CHECK_EQ(machine.getDispatchCount(), 2 * N);
+    printf("    16 states / 32 transitions: publish() %.0f ns, dispatch() %.0f ns per event, %lu fired\n",
+           viaBusNs, directNs, machine.getTransitionCount());
+}
+
+int main() {
+    RUN_TEST(beginEntersNestedInitialStates);
+    RUN_TEST(siblingExitsBeforeActionBeforeEntry);
+    RUN_TEST(selfAndInternalTransitions);
+    RUN_TEST(childToAncestorReentersAncestor);
+    RUN_TEST(eventRaisedDuringEntryRunsAfterIt);
+    RUN_TEST(fullDeferredQueueDrops);
+    RUN_TEST(residencyFollowsClock);
+    RUN_TEST(invalidTablesAreRefused);
+    RUN_TEST(benchmark);
+    return TEST_RESULT();
+}
@@ -0,0 +1,177 @@
+// Static arena: no operator new once startup is sealed, over many framework
+// passes of servos on a queued PCA9685 plus a debounced button; an
+// exhausted or sealed arena halts through Logger::fatal().
+// This file replaces the global operator new / delete to count calls
+// (built without TWIST_ENABLE_HEAP_MONITOR, which would replace them too).
+
+#include "TestSupport.h"
+#include "TwiST.h"
+#include "Core/Arena.h"
+#include "Core/I2CQueue.h"
+#include "Devices/DigitalInput.h"
+#include "Devices/Servo.h"
+#include "Drivers/I2C/FakePCA9685.h"
+#include "Drivers/PWM/PCA9685.h"
+#include <new>
+#include <stdlib.h>
+
+using namespace TwiST;
+
+// ===== Counting allocator =====
+
+static unsigned long allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// ===== Scripted button: toggles every 37 ms =====
+
+struct ToggleInput : IDigitalInputDriver {
+    bool level = false;
+    uint64_t nextUs = 0;
+    DigitalEdge edges[8];
+    uint8_t head = 0, tail = 0;
+
+    uint8_t getLineCount() const override { return 1; }
+    bool readLine(uint8_t) override { return level; }
+    bool popEdge(uint8_t, DigitalEdge& edge) override {
+        if (head == tail) return false;
+        edge = edges[tail++ % 8];
+        return true;
+    }
+    uint32_t getDroppedEdges(uint8_t) const override { return 0; }
+    void poll() override {
+        if (Host::clockUs < nextUs) return;
+        nextUs = Host::clockUs + 37000;
+        level = !level;
+        edges[head++ % 8] = DigitalEdge{(uint32_t)Host::clockUs, level};
+    }
+};
+
+static const int SERVOS = 6;
+
+constexpr size_t ARENA_BYTES = SERVOS * Arena::footprint<Devices::Servo>()
+                             + Arena::footprint<Devices::DigitalInput>()
+                             + Arena::footprint<Drivers::PCA9685>()
+                             + Arena::footprint<ToggleInput>();
+static StaticArena<ARENA_BYTES> arena("TEST");
+
+static int presses = 0;
+static void countPress(const Event&, void*) { presses++; }
+
+static void noAllocationAfterSeal() {
+    TwiSTFramework framework;
+    Drivers::FakePCA9685 chip(0x40);
+    I2CQueue queue(chip);
+
+    Drivers::PCA9685* pwm = arena.createOrHalt<Drivers::PCA9685>(0x40);
+    pwm->setQueue(&queue);
+    ToggleInput* input = arena.createOrHalt<ToggleInput>();
+
+    Devices::Servo* servos[SERVOS];
+    for (int i = 0; i < SERVOS; i++) {
+        servos[i] = arena.createOrHalt<Devices::Servo>(*pwm, (uint8_t)i, (uint16_t)(10 + i), "Joint",
+                                                      framework.eventBus());
+        servos[i]->calibrateBySteps(110, 540);
+        framework.registry()->registerDevice(servos[i]);
+    }
+    Devices::DigitalInput* button = arena.createOrHalt<Devices::DigitalInput>(
+        *input, (uint8_t)0, (uint16_t)30, "Button", framework.eventBus());
+    framework.registry()->registerDevice(button);
+    framework.eventBus().subscribe("input.pressed", countPress, NULL);
+    framework.addService(&queue, SERVICE_AFTER_BRIDGES);
+
+    CHECK_EQ(arena.getUsed(), ARENA_BYTES);            // Sized exactly
+    CHECK_EQ(arena.getObjectCount(), SERVOS + 3);
+
+    framework.initialize(false);
+    framework.registry()->initializeAll();
+    arena.seal();
+    CHECK(arena.create<ToggleInput>() == NULL);        // Sealed
+    CHECK_EQ(arena.getFailedCount(), 1);
+
+    framework.update();                                // First pass seals the heap monitor
+    CHECK(framework.heap().isSealed());
+
+    // 10 simulated minutes at 1 kHz: moves, streamed setpoints, button events
+    const unsigned long PASSES = 600000UL;
+    unsigned long before = allocations;
+    for (unsigned long k = 0; k < PASSES; k++) {
+        Host::advanceUs(1000);
+        if (k % 2000 == 0) {
+            for (int i = 0; i < SERVOS; i++) servos[i]->moveTo((k / 2000 + i) % 2 ? 30 : 150, 900);
+        }
+        if (k % 5 == 0) {
+            Devices::Servo* s = servos[(k / 5) % SERVOS];
+            s->setValue(s->getValue() + (float)((k / 5) % 3) - 1.0f);
+        }
+        framework.update();
+    }
+
+    CHECK_EQ(allocations - before, 0);
+    CHECK(presses > 7000);                             // The loop did real work
+    CHECK(chip.getTransactionCount() > 100000);
+    CHECK_EQ(queue.getDroppedCount(), 0);
+
+    // Negative control: a late allocation is seen by the counter
+    int* volatile late = new int[4];
+    CHECK_EQ(allocations - before, 1);
+    delete[] late;
+}
+
+static void exhaustedArenaHalts() {
+    Logger::begin(Serial, Logger::Level::INFO);
+    Host::serialOutput.clear();
+
+    StaticArena<Arena::footprint<ToggleInput>()> small("SMALL");
+    CHECK(small.createOrHalt<ToggleInput>() != NULL);  // Exact fit
+
+    bool halted = false;
+    Host::trapHalt = true;
+    try {
+        small.createOrHalt<ToggleInput>();             // One too many
+    } catch (const Host::Halted&) {
+        halted = true;
+    }
+    Host::trapHalt = false;
+
+    CHECK(halted);
+    CHECK_EQ(small.getFailedCount(), 1);
+    CHECK(Host::serialOutput.find("SMALL full") != std::string::npos);
+    CHECK(Host::serialOutput.find("[FATAL]") != std::string::npos);
+    CHECK(Host::serialOutput.find("SMALL arena exhausted") != std::string::npos);
+    CHECK(Host::serialOutput.find("System halted") != std::string::npos);
+}
+
+static void sealedArenaHalts() {
+    StaticArena<64> spare("SPARE");
+    spare.seal();
+
+    bool halted = false;
+    Host::trapHalt = true;
+    try {
+        spare.createOrHalt<ToggleInput>();
+    } catch (const Host::Halted&) {
+        halted = true;
+    }
+    Host::trapHalt = false;
+
+    CHECK(halted);
+    CHECK_EQ(spare.getUsed(), 0);
+}
+
+int main() {
+    RUN_TEST(noAllocationAfterSeal);
+    RUN_TEST(exhaustedArenaHalts);
+    RUN_TEST(sealedArenaHalts);
+    return TEST_RESULT();
+}
@@ -0,0 +1,179 @@
+// StepEngine timer ISR on the simulated hardware timer: rising edges land on
+// the StepRamp deadlines, the falling edge is its own alarm (the clock only
+// moves between alarms, so an ISR that waited for a tick would never return),
+// coincident axes share one register write, deadlines closer than an alarm
+// round trip are served late without shifting the plan.
+
+#include "TestSupport.h"
+#include "Drivers/Stepper/StepEngine.h"
+#include "Core/Logger.h"
+#include <vector>
+
+using namespace TwiST;
+using Drivers::StepEngine;
+
+static const uint32_t STEP_A = 1UL << 4;
+static const uint32_t STEP_B = 1UL << 12;
+
+struct Edges {
+    std::vector<uint64_t> rising, falling;
+};
+
+// Fire alarms until the engine stops arming; edges of one STEP pin
+static Edges runToRest(uint32_t stepMask, unsigned long maxAlarms = 1000000) {
+    Edges edges;
+    size_t seen = Host::gpioWrites.size();
+    for (unsigned long i = 0; i < maxAlarms && Host::fireTimer(); i++) {
+        for (; seen < Host::gpioWrites.size(); seen++) {
+            const Host::GpioWrite& w = Host::gpioWrites[seen];
+            if (w.mask & stepMask) (w.set ? edges.rising : edges.falling).push_back(w.tick);
+        }
+    }
+    return edges;
+}
+
+static void startEngine(StepEngine& engine, uint8_t axes) {
+    Host::gpioWrites.clear();
+    Host::gpioOut = 0;
+    Host::timerArmed = false;
+    Host::timerAlarmsInPast = 0;
+    CHECK_EQ(engine.addAxis(4, 5), 0);
+    if (axes > 1) CHECK_EQ(engine.addAxis(12, 13), 1);
+    CHECK(engine.begin());
+}
+
+static void pulsesLandOnRampDeadlines() {
+    StepEngine engine;
+    startEngine(engine, 1);
+    uint64_t start = Host::clockUs;
+    CHECK(engine.move(0, 2000, 4000.0f, 20000.0f));
+    CHECK(engine.isMoving(0));
+    Edges edges = runToRest(STEP_A);
+
+    CHECK_EQ(edges.rising.size(), 2000);
+    CHECK_EQ(edges.falling.size(), 2000);
+    CHECK_EQ(engine.getPosition(0), 2000);
+    CHECK_EQ(engine.getStepCount(), 2000);
+    CHECK(!engine.isMoving(0));
+    CHECK_EQ(Host::gpioOut, 0);
+    CHECK_EQ(Host::timerAlarmsInPast, 0);
+    CHECK_EQ(engine.getMaxLatenessTicks(), 0);
+
+    // Same plan, accumulated the way the engine does
+    StepRamp ramp;
+    CHECK(ramp.plan(2000, 4000.0f, 20000.0f, TWIST_STEP_TICK_HZ));
+    uint64_t due = start << 8;
+    int onTime = 0, widthOk = 0;
+    for (size_t i = 0; i < edges.rising.size(); i++) {
+        due += ramp.nextInterval();
+        onTime += (edges.rising[i] == (due >> 8));
+        uint64_t width = edges.falling[i] - edges.rising[i];
+        widthOk += (width >= TWIST_STEP_PULSE_TICKS && width <= TWIST_STEP_MIN_ARM_TICKS);
+    }
+    CHECK_EQ(onTime, 2000);
+    CHECK_EQ(widthOk, 2000);
+    CHECK_NEAR((double)(edges.rising.back() - start) / TWIST_STEP_TICK_HZ,
+               StepRamp::duration(2000, 4000.0f, 20000.0f), 1e-4);
+
+    // Backwards
+    CHECK(engine.move(0, -500, 4000.0f, 20000.0f));
+    runToRest(STEP_A);
+    CHECK_EQ(engine.getPosition(0), 1500);
+}
+
+static void coincidentAxesShareWrites() {
+    StepEngine engine;
+    startEngine(engine, 2);
+    uint8_t axes[2] = {0, 1};
+    int32_t steps[2] = {800, 800};
+    CHECK(engine.moveSynchronized(axes, steps, 2, 3000.0f, 15000.0f));
+    runToRest(STEP_A | STEP_B);
+
+    int together = 0, alone = 0;
+    for (const Host::GpioWrite& w : Host::gpioWrites) {
+        if (!w.set) continue;
+        if (w.mask == (STEP_A | STEP_B)) together++;
+        else alone++;
+    }
+    CHECK_EQ(together, 800);
+    CHECK_EQ(alone, 0);
+    CHECK_EQ(engine.getPosition(0), 800);
+    CHECK_EQ(engine.getPosition(1), 800);
+
+    // Half the distance on B: half the speed, same start and finish
+    steps[1] = -400;
+    CHECK(engine.moveSynchronized(axes, steps, 2, 3000.0f, 15000.0f));
+    runToRest(STEP_A);
+    CHECK_EQ(engine.getPosition(0), 1600);
+    CHECK_EQ(engine.getPosition(1), 400);
+    CHECK_EQ(Host::gpioOut, 0);
+    CHECK_EQ(Host::timerAlarmsInPast, 0);
+}
+
+static void closeDeadlinesServedLateNotWaited() {
+    // 200k steps/s: 5-tick intervals against a 3-tick pulse and 3-tick arming,
+    // a second axis slightly slower so its edges fall inside the first one's pulses
+    StepEngine engine;
+    startEngine(engine, 2);
+    uint64_t start = Host::clockUs;
+    CHECK(engine.move(0, 4000, 200000.0f, 20000000.0f));
+    CHECK(engine.move(1, 4000, 190000.0f, 20000000.0f));
+    size_t alarms = 0;
+    while (Host::fireTimer()) alarms++;
+
+    CHECK_EQ(engine.getPosition(0), 4000);
+    CHECK_EQ(engine.getPosition(1), 4000);
+    CHECK_EQ(Host::gpioOut, 0);
+    CHECK_EQ(Host::timerAlarmsInPast, 0);
+
+    // Every rising edge on or after its deadline, never more than a pulse and
+    // an arming late; the plan itself does not slip
+    StepRamp ramp;
+    CHECK(ramp.plan(4000, 200000.0f, 20000000.0f, TWIST_STEP_TICK_HZ));
+    uint64_t due = start << 8;
+    size_t step = 0;
+    uint64_t worstLate = 0;
+    bool early = false;
+    for (const Host::GpioWrite& w : Host::gpioWrites) {
+        if (!w.set || !(w.mask & STEP_A)) continue;
+        due += ramp.nextInterval();
+        if (w.tick < (due >> 8)) early = true;
+        else if (w.tick - (due >> 8) > worstLate) worstLate = w.tick - (due >> 8);
+        step++;
+    }
+    CHECK_EQ(step, 4000);
+    CHECK(!early);
+    CHECK(worstLate <= 2 * TWIST_STEP_MIN_ARM_TICKS);
+    printf("    200k + 190k steps/s: %zu alarms, worst %llu ticks late\n", alarms, (unsigned long long)worstLate);
+}
+
+static void immediateStopDropsPulse() {
+    StepEngine engine;
+    startEngine(engine, 1);
+    CHECK(engine.move(0, 1000, 2000.0f, 10000.0f));
+    CHECK(Host::fireTimer());                          // First rising edge
+    CHECK_EQ(Host::gpioOut, STEP_A);
+    engine.stop(0, true);
+    CHECK(!engine.isMoving(0));
+    CHECK(Host::fireTimer());                          // Falling edge still served
+    CHECK_EQ(Host::gpioOut, 0);
+    CHECK(!Host::fireTimer());                         // Nothing armed after it
+    CHECK_EQ(engine.getPosition(0), 1);
+
+    // Smooth stop mid-cruise: comes to rest on the ramp, fewer steps than planned
+    CHECK(engine.move(0, 1000, 2000.0f, 10000.0f));
+    for (int i = 0; i < 1000; i++) Host::fireTimer();  // 500 steps
+    engine.stop(0, false);
+    runToRest(STEP_A);
+    CHECK(!engine.isMoving(0));
+    // Step 501 was already scheduled; then v^2 / 2a = 200 steps to rest
+    CHECK_EQ(engine.getPosition(0), 1 + 501 + 200);
+}
+
+int main() {
+    RUN_TEST(pulsesLandOnRampDeadlines);
+    RUN_TEST(coincidentAxesShareWrites);
+    RUN_TEST(closeDeadlinesServedLateNotWaited);
+    RUN_TEST(immediateStopDropsPulse);
+    return TEST_RESULT();
+}
@@ -0,0 +1,191 @@
+// StepRamp against the analytic trapezoid: every step time compared with the
+// instant the ideal profile reaches that position, per phase (ramp up,
+// cruise, ramp down), the last step against duration(); triangles down to a
+// single step; decelerate() from the ramp and from cruise.
+
+#include "TestSupport.h"
+#include "Core/StepRamp.h"
+#include <math.h>
+#include <vector>
+
+using namespace TwiST;
+
+static const uint32_t TICK_HZ = 1000000;
+
+// Ideal time (seconds) at which a rest-to-rest move of `steps` reaches step k
+struct Ideal {
+    double steps, v, a, rampSteps, total;
+    bool triangle;
+
+    Ideal(uint32_t d, double maxSpeed, double acceleration)
+        : steps(d), v(maxSpeed), a(acceleration), rampSteps(maxSpeed * maxSpeed / (2.0 * acceleration)),
+          triangle(2.0 * rampSteps >= d) {
+        total = triangle ? 2.0 * sqrt(d / a) : d / v + v / a;
+    }
+
+    double at(uint32_t k) const {
+        double peak = triangle ? steps / 2.0 : rampSteps;
+        if (k <= peak) return sqrt(2.0 * k / a);
+        if (k >= steps - peak) return total - sqrt(2.0 * (steps - k) / a);
+        return v / a + (k - rampSteps) / v;
+    }
+};
+
+// Step times from nextInterval(), accumulated exactly as StepEngine does
+struct Run {
+    std::vector<double> times;
+
+    void collect(StepRamp& ramp) {
+        uint64_t due = 0;
+        for (uint32_t iv; (iv = ramp.nextInterval()) != 0;) {
+            due += iv;
+            times.push_back((double)due / 256.0 / TICK_HZ);
+        }
+    }
+    double end() const { return times.empty() ? 0.0 : times.back(); }
+};
+
+// Worst |actual - ideal| over steps [from, to] (1-based), in ticks
+static double worstError(const Run& run, const Ideal& ideal, uint32_t from, uint32_t to) {
+    double worst = 0.0;
+    for (uint32_t k = from; k <= to && k <= run.times.size(); k++) {
+        worst = fmax(worst, fabs(run.times[k - 1] - ideal.at(k)) * TICK_HZ);
+    }
+    return worst;
+}
+
+struct Case {
+    uint32_t steps;
+    float v, a;
+};
+
+static void followsTrapezoid() {
+    const Case cases[] = {
+        {100000, 25000.0f, 50000.0f},       // Long move at the top rate
+        {100000, 25000.0f, 200000.0f},
+        {20000, 4000.0f, 1000.0f},
+        {3200, 8000.0f, 20000.0f},
+        {200, 1000.0f, 5000.0f},            // Ramp of 100 steps, no cruise left
+        {201, 1000.0f, 5000.0f},            // One middle step across the peak
+        {1000, 300.0f, 100000.0f},          // Ramp shorter than the opening table
+    };
+
+    for (const Case& c : cases) {
+        StepRamp ramp;
+        CHECK(ramp.plan(c.steps, c.v, c.a, TICK_HZ));
+        Ideal ideal(c.steps, c.v, c.a);
+        Run run;
+        run.collect(ramp);
+
+        CHECK_EQ(run.times.size(), c.steps);
+        CHECK(ramp.isDone());
+        CHECK_EQ(ramp.getIssuedSteps(), c.steps);
+        CHECK_EQ(ramp.nextInterval(), 0);
+
+        uint32_t ramped = ideal.triangle ? c.steps / 2 : (uint32_t)ideal.rampSteps;
+        // Each ramp may be off by 1e-4 of the first interval; down and end carry both
+        double tolerance = 1e-4 * TICK_HZ * sqrt(2.0 / c.a) + 1.0;
+        double up = worstError(run, ideal, 1, ramped);
+        double cruise = worstError(run, ideal, ramped + 1, c.steps - ramped);
+        double down = worstError(run, ideal, c.steps - ramped + 1, c.steps);
+        double endTicks = (run.end() - StepRamp::duration(c.steps, c.v, c.a)) * TICK_HZ;
+
+        printf("    %6u steps %5.0f/s %6.0f/s^2: up %.2f, cruise %.2f, down %.2f ticks; end %+.2f ticks\n",
+               (unsigned)c.steps, c.v, c.a, up, cruise, down, endTicks);
+        CHECK(up <= tolerance);
+        CHECK(cruise <= tolerance);
+        CHECK(down <= 2.0 * tolerance);
+        CHECK(fabs(endTicks) <= 2.0 * tolerance);
+        CHECK_NEAR(StepRamp::duration(c.steps, c.v, c.a), ideal.total, 1e-5 * ideal.total);
+    }
+}
+
+static void singleStepTakesWholeTriangle() {
+    // a = 100 steps/s^2: step 1 alone is a 0.2 s triangle, not sqrt(2 / a)
+    StepRamp ramp;
+    CHECK(ramp.plan(1, 25000.0f, 100.0f, TICK_HZ));
+    Run run;
+    run.collect(ramp);
+    CHECK_EQ(run.times.size(), 1);
+    CHECK_NEAR(run.end(), 0.2, 1e-6);
+    CHECK_NEAR(StepRamp::duration(1, 25000.0f, 100.0f), 0.2f, 1e-6f);
+
+    for (uint32_t d = 2; d <= 40; d++) {
+        CHECK(ramp.plan(d, 25000.0f, 100.0f, TICK_HZ));
+        Run r;
+        r.collect(ramp);
+        CHECK_EQ(r.times.size(), d);
+        CHECK_NEAR(r.end(), StepRamp::duration(d, 25000.0f, 100.0f), 2e-4 * sqrt(2.0 / 100.0) + 1e-6);
+    }
+
+    CHECK(ramp.plan(0, 1000.0f, 1000.0f, TICK_HZ));
+    CHECK_EQ(ramp.nextInterval(), 0);
+    CHECK(!ramp.plan(10, 0.0f, 1000.0f, TICK_HZ));
+    CHECK(!ramp.plan(10, 1000.0f, -1.0f, TICK_HZ));
+    CHECK(!ramp.plan(10, 1000.0f, 1000.0f, 0));
+    CHECK_EQ(ramp.nextInterval(), 0);
+    CHECK_EQ(StepRamp::duration(10, 0.0f, 1000.0f), 0.0f);
+}
+
+static void durationMatchesProfile() {
+    // Triangle below v^2 / a steps, trapezoid above, continuous at the switch
+    CHECK_NEAR(StepRamp::duration(400, 2000.0f, 10000.0f), 0.4f, 1e-6f);
+    CHECK_NEAR(StepRamp::duration(100, 2000.0f, 10000.0f), 0.2f, 1e-6f);
+    CHECK_NEAR(StepRamp::duration(1400, 2000.0f, 10000.0f), 0.9f, 1e-6f);
+    CHECK_NEAR(StepRamp::duration(399, 2000.0f, 10000.0f), StepRamp::duration(401, 2000.0f, 10000.0f), 2e-3f);
+}
+
+static void decelerateComesToRest() {
+    // From the ramp: as many steps down as were taken up, same intervals mirrored
+    StepRamp ramp;
+    CHECK(ramp.plan(10000, 5000.0f, 10000.0f, TICK_HZ));
+    std::vector<uint32_t> up;
+    for (int i = 0; i < 300; i++) up.push_back(ramp.nextInterval());
+    ramp.decelerate();
+    CHECK_EQ(ramp.getTotalSteps(), 600);
+    std::vector<uint32_t> down;
+    for (uint32_t iv; (iv = ramp.nextInterval()) != 0;) down.push_back(iv);
+    CHECK_EQ(down.size(), 300);
+    uint32_t worst = 0;
+    for (size_t i = 0; i < down.size(); i++) {
+        uint32_t a = down[i], b = up[up.size() - 1 - i];
+        uint32_t diff = a > b ? a - b : b - a;
+        if (diff > worst) worst = diff;
+    }
+    CHECK(worst <= 256);                                               // One tick
+    CHECK_EQ(down.back(), up.front());
+
+    // From cruise: back to rest over the 1250-step ramp, never lengthening the move
+    CHECK(ramp.plan(10000, 5000.0f, 10000.0f, TICK_HZ));
+    for (int i = 0; i < 5000; i++) ramp.nextInterval();
+    ramp.decelerate();
+    CHECK_EQ(ramp.getTotalSteps(), 6250);
+    ramp.decelerate();                                                 // Already decelerating
+    CHECK_EQ(ramp.getTotalSteps(), 6250);
+    uint32_t previous = 0, steps = 0;
+    bool slowing = true;
+    for (uint32_t iv; (iv = ramp.nextInterval()) != 0; steps++) {
+        if (iv + 1 < previous) slowing = false;
+        previous = iv;
+    }
+    CHECK_EQ(steps, 1250);
+    CHECK(slowing);
+
+    CHECK(ramp.plan(100, 5000.0f, 10000.0f, TICK_HZ));
+    for (int i = 0; i < 90; i++) ramp.nextInterval();
+    ramp.decelerate();
+    CHECK_EQ(ramp.getTotalSteps(), 100);
+
+    CHECK(ramp.plan(100, 5000.0f, 10000.0f, TICK_HZ));
+    ramp.decelerate();                                                 // Not started
+    CHECK(ramp.isDone());
+    CHECK_EQ(ramp.nextInterval(), 0);
+}
+
+int main() {
+    RUN_TEST(followsTrapezoid);
+    RUN_TEST(singleStepTakesWholeTriangle);
+    RUN_TEST(durationMatchesProfile);
+    RUN_TEST(decelerateComesToRest);
+    return TEST_RESULT();
+}
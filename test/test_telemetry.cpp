@@ -0,0 +1,190 @@
+// Telemetry frames end to end: the worst-case payload (every channel a
+// 5-byte varint) passes the host WireFrameParser; the service over a
+// LoopbackTransport decodes exactly, resyncs after a saturated link;
+// encode / parse / decode throughput.
+
+#include "TestSupport.h"
+#include "Core/Telemetry.h"
+#include "Core/TelemetryCodec.h"
+#include "Core/WireFrame.h"
+#include "Drivers/Transport/LoopbackTransport.h"
+#include <chrono>
+#include <deque>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+using namespace TwiST;
+using Drivers::LoopbackTransport;
+
+static const uint8_t CHANNELS = TWIST_TELEMETRY_MAX_CHANNELS;
+
+static void worstCaseFrameParses() {
+    int32_t values[CHANNELS];
+    for (uint8_t i = 0; i < CHANNELS; i++) values[i] = (i % 2) ? INT32_MAX : INT32_MIN;
+
+    TelemetryEncoder encoder;
+    TelemetryDecoder decoder;
+    WireFrameParser parser;
+    uint8_t frame[WireFrame::OVERHEAD + TelemetryCodec::MAX_PAYLOAD];
+
+    for (int pass = 0; pass < 2; pass++) {
+        // Keyframe of extremes, then a delta frame where every change is about 2^31
+        size_t length = encoder.encode(values, CHANNELS, 1000 + pass, pass == 0,
+                                       WireFrame::payload(frame), TelemetryCodec::MAX_PAYLOAD);
+        CHECK(length > 0);
+        CHECK(length <= TWIST_WIRE_MAX_PAYLOAD);
+        if (pass == 1) CHECK_EQ(length, TelemetryCodec::MAX_PAYLOAD);   // Bitmap + 5 bytes each
+
+        size_t total = WireFrame::finalize(frame, WIRE_TELEMETRY, (uint16_t)length);
+        bool complete = false;
+        for (size_t i = 0; i < total; i++) complete = parser.feed(frame[i]);
+        CHECK(complete);
+        CHECK_EQ(parser.getOversizeCount(), 0);
+        CHECK(decoder.decode(parser.payload(), parser.length()));
+        CHECK(memcmp(decoder.getValues(), values, sizeof(values)) == 0);
+
+        for (uint8_t i = 0; i < CHANNELS; i++) values[i] = (values[i] == INT32_MIN) ? 0 : -1;
+    }
+}
+
+// ===== Service over a loopback link =====
+
+static int32_t signal[CHANNELS];
+static int32_t sampleSignal(void* context) { return *static_cast<int32_t*>(context); }
+
+// Joint-like traces: slow sines at different rates, two channels held still
+static void advanceSignal(uint32_t frame) {
+    for (uint8_t i = 0; i < CHANNELS; i++) {
+        signal[i] = (i < 2) ? 1000 * i : (int32_t)(9000.0 * sin(frame * 0.002 * (i + 1)));
+    }
+}
+
+struct Link {
+    LoopbackTransport device, host;
+    Telemetry telemetry;
+    WireFrameParser parser;
+    TelemetryDecoder decoder;
+    std::deque<std::vector<int32_t> > expected;
+    unsigned long decoded = 0, mismatched = 0;
+
+    Link() : telemetry(device, 1000) {
+        LoopbackTransport::connect(device, host);
+        for (uint8_t i = 0; i < CHANNELS; i++) telemetry.addChannel(sampleSignal, &signal[i]);
+    }
+
+    // One 1 ms frame period; remembers what was sampled when a frame went out
+    void produce(uint32_t frame) {
+        advanceSignal(frame);
+        Host::advanceUs(1000);
+        unsigned long before = telemetry.getFramesSent();
+        telemetry.update();
+        if (telemetry.getFramesSent() != before) expected.push_back(std::vector<int32_t>(signal, signal + CHANNELS));
+    }
+
+    void consume() {
+        uint8_t buffer[256];
+        size_t n;
+        while ((n = host.receive(buffer, sizeof(buffer))) > 0) {
+            for (size_t i = 0; i < n; i++) {
+                if (!parser.feed(buffer[i]) || parser.type() != WIRE_TELEMETRY) continue;
+                bool valid = decoder.decode(parser.payload(), parser.length());
+                CHECK(!expected.empty());
+                if (expected.empty()) return;
+                if (valid) {
+                    decoded++;
+                    if (memcmp(decoder.getValues(), expected.front().data(), CHANNELS * sizeof(int32_t)) != 0) {
+                        mismatched++;
+                    }
+                }
+                expected.pop_front();
+            }
+        }
+    }
+};
+
+static void serviceRoundTripIsExact() {
+    Link link;
+    const uint32_t FRAMES = 5000;
+    for (uint32_t f = 0; f < FRAMES; f++) {
+        link.produce(f);
+        link.consume();
+    }
+
+    unsigned long bytes = link.telemetry.getBytesSent();
+    printf("    %lu frames, %.1f bytes/frame on the wire (%u raw)\n",
+           link.telemetry.getFramesSent(), (double)bytes / link.telemetry.getFramesSent(),
+           (unsigned)(CHANNELS * sizeof(int32_t)));
+    CHECK_EQ(link.telemetry.getFramesSent(), FRAMES);
+    CHECK_EQ(link.telemetry.getFramesDropped(), 0);
+    CHECK_EQ(link.decoded, FRAMES);
+    CHECK_EQ(link.mismatched, 0);
+    CHECK_EQ(link.decoder.getLostFrameCount(), 0);
+    CHECK_EQ(link.parser.getCrcErrorCount(), 0);
+    CHECK(bytes < FRAMES * CHANNELS * sizeof(int32_t));   // Smaller than raw values, envelope included
+}
+
+static void saturatedLinkResyncs() {
+    Link link;
+    // Host stops reading: the 2 KB loopback ring fills and frames are dropped
+    for (uint32_t f = 0; f < 200; f++) link.produce(f);
+    CHECK(link.telemetry.getFramesDropped() > 0);
+
+    link.consume();
+    unsigned long decodedWhileSaturated = link.decoded;
+    for (uint32_t f = 200; f < 400; f++) {
+        link.produce(f);
+        link.consume();
+    }
+    CHECK_EQ(link.mismatched, 0);
+    CHECK(link.decoder.isSynced());                    // Resynced on the keyframe after the drop
+    CHECK(link.decoded >= decodedWhileSaturated + 200);
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void throughput() {
+    typedef std::chrono::steady_clock Clock;
+    const uint32_t FRAMES = 200000;
+    static int32_t samples[FRAMES / 4][CHANNELS];
+    static uint8_t stream[FRAMES / 4 * (WireFrame::OVERHEAD + TelemetryCodec::MAX_PAYLOAD)];
+    for (uint32_t f = 0; f < FRAMES / 4; f++) {
+        advanceSignal(f);
+        memcpy(samples[f], signal, sizeof(signal));
+    }
+
+    TelemetryEncoder encoder;
+    size_t used = 0;
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t f = 0; f < FRAMES / 4; f++) {
+        uint8_t* frame = stream + used;
+        size_t length = encoder.encode(samples[f], CHANNELS, f * 1000, f % 100 == 0,
+                                       WireFrame::payload(frame), TelemetryCodec::MAX_PAYLOAD);
+        used += WireFrame::finalize(frame, WIRE_TELEMETRY, (uint16_t)length);
+    }
+    double encodeNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / (FRAMES / 4);
+
+    WireFrameParser parser;
+    TelemetryDecoder decoder;
+    unsigned long frames = 0;
+    t0 = Clock::now();
+    for (int repeat = 0; repeat < 4; repeat++) {
+        decoder.reset();
+        for (size_t i = 0; i < used; i++) {
+            if (parser.feed(stream[i]) && decoder.decode(parser.payload(), parser.length())) frames++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    CHECK_EQ(frames, FRAMES);
+
+    printf("    %u channels: encode + frame %.0f ns; parse + decode %.0f ns/frame, %.1f MB/s of wire data\n",
+           CHANNELS, encodeNs, seconds * 1e9 / frames, 4.0 * used / seconds / 1e6);
+}
+
+int main() {
+    RUN_TEST(worstCaseFrameParses);
+    RUN_TEST(serviceRoundTripIsExact);
+    RUN_TEST(saturatedLinkResyncs);
+    RUN_TEST(throughput);
+    return TEST_RESULT();
+}
@@ -0,0 +1,232 @@
+// TimerService: min-heap order against a reference ordered map, FIFO among
+// equal deadlines, generation-checked handles, periodic timers, 32-bit
+// micros() wrap; scheduling / firing cost with 10k pending timers.
+// Built with TWIST_TIMER_CAPACITY=10000.
+
+#include "TestSupport.h"
+#include "FakeOutputDevice.h"
+#include "Core/EventBus.h"
+#include "Core/TimerService.h"
+#include <chrono>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace TwiST;
+
+static EventBus bus;
+static TimerService timers(bus);
+static std::vector<uint32_t> fired;
+
+static void record(void* context) { fired.push_back((uint32_t)(uintptr_t)context); }
+static void tick(unsigned long us) { Host::advanceUs(us); timers.update(); }
+
+static int opened = 0;
+static void onOpen(const Event&, void*) { opened++; }
+
+static void deviceActionsAcrossMicrosWrap() {
+    Host::clockUs = 0xFFFFFFFFULL - 300000;            // 32-bit micros() wraps in 0.3 s
+    timers.update();
+    uint64_t start = timers.now();
+    FakeOutputDevice out;
+    bus.subscribe("gripper.open", onOpen, NULL);
+
+    TimerHandle set = timers.setValue(out, 90.0f, 500000);
+    TimerHandle move = timers.moveTo(out, 30.0f, 800, 600000);
+    CHECK(timers.publish("gripper.open", 7, 500000) != 0);
+    CHECK(timers.isPending(set));
+    CHECK_EQ(timers.getRemaining(move), 600000);
+
+    tick(499999);
+    CHECK_EQ(out.sets, 0);
+    tick(1);
+    CHECK_EQ(out.sets, 1);
+    CHECK_EQ(out.value, 90.0f);
+    CHECK(!timers.isPending(set));
+    CHECK(!timers.cancel(set));                        // Already fired
+    CHECK_EQ(timers.getRemaining(set), UINT64_MAX);
+    bus.processEvents();
+    CHECK_EQ(opened, 1);
+
+    tick(100000);
+    CHECK_EQ(out.moves, 1);
+    CHECK_EQ(out.target, 30.0f);
+    CHECK_EQ(out.duration, 800);
+    CHECK_EQ(timers.now() - start, 600000);            // Crossed the wrap without a jump
+    CHECK_EQ(timers.getPendingCount(), 0);
+}
+
+static void equalDeadlinesFireInScheduleOrder() {
+    fired.clear();
+    uint64_t deadline = timers.now() + 1000;
+    TimerAction action = {};
+    action.type = TIMER_CALLBACK;
+    action.callback = record;
+
+    TimerHandle h[5];
+    for (int i = 0; i < 5; i++) {
+        action.context = (void*)(uintptr_t)i;
+        h[i] = timers.scheduleAt(deadline, action);
+    }
+    CHECK(timers.cancel(h[2]));
+    CHECK(!timers.cancel(h[2]));
+
+    tick(999);
+    CHECK(fired.empty());
+    tick(1);
+    CHECK((fired == std::vector<uint32_t>{0, 1, 3, 4}));
+    CHECK_EQ(timers.getPendingCount(), 0);
+}
+
+static void handlesAreGenerationChecked() {
+    TimerHandle first = timers.call(record, NULL, 100);
+    CHECK(first != 0);
+    CHECK(timers.cancel(first));
+
+    // The freed entry is reused with a new generation - the old handle stays dead
+    TimerHandle second = timers.call(record, NULL, 100);
+    CHECK(second != 0);
+    CHECK(second != first);
+    CHECK_EQ(second & 0xFFFF, first & 0xFFFF);         // Same pool entry
+    CHECK(!timers.isPending(first));
+    CHECK(!timers.cancel(first));
+    CHECK(timers.isPending(second));
+
+    CHECK(!timers.isPending(0));
+    CHECK(!timers.cancel(0));
+    CHECK(!timers.cancel(0xFFFF0000u | TimerService::CAPACITY));   // Index out of range
+    timers.cancel(second);
+}
+
+static TimerHandle self = 0;
+static int selfCount = 0;
+static void cancelSelfOnThird(void*) {
+    if (++selfCount == 3) timers.cancel(self);
+}
+
+static void periodicTimers() {
+    self = timers.call(cancelSelfOnThird, NULL, 1000, 1000);
+    for (int i = 0; i < 10; i++) tick(1000);
+    CHECK_EQ(selfCount, 3);
+    CHECK(!timers.isPending(self));
+
+    // Fixed rate: a late pass fires once and skips the missed periods
+    fired.clear();
+    unsigned long skippedBefore = timers.getSkippedPeriods();
+    TimerHandle p = timers.call(record, (void*)5, 0, 1000);
+    tick(10500);
+    CHECK_EQ(fired.size(), 1);
+    CHECK(timers.getSkippedPeriods() > skippedBefore);
+    CHECK_EQ(timers.getRemaining(p), 1000);             // Resumes from now, no burst
+    tick(999);
+    CHECK_EQ(fired.size(), 1);
+    tick(1);
+    CHECK_EQ(fired.size(), 2);
+    timers.cancel(p);
+
+    unsigned long rejected = timers.getRejectedCount();
+    CHECK_EQ(timers.call(NULL, NULL, 0), 0);
+    CHECK_EQ(timers.getRejectedCount(), rejected + 1);
+    CHECK_EQ(timers.getPendingCount(), 0);
+}
+
+static void matchesReferenceOrder() {
+    std::mt19937 rng(42);
+    typedef std::pair<uint64_t, uint32_t> Key;        // Deadline, schedule order
+    std::multimap<Key, uint32_t> reference;
+    std::map<uint32_t, TimerHandle> live;
+    std::map<uint32_t, Key> keys;
+    uint32_t id = 0, sequence = 0;
+    bool match = true;
+    fired.clear();
+
+    for (int step = 0; step < 200000 && match; step++) {
+        int op = rng() % 10;
+        if (op < 5 && timers.getPendingCount() < TimerService::CAPACITY) {
+            uint32_t delay = rng() % 2000000;
+            TimerHandle h = timers.call(record, (void*)(uintptr_t)id, delay);
+            Key key(timers.now() + delay, sequence++);
+            reference.insert({key, id});
+            live[id] = h;
+            keys[id] = key;
+            id++;
+        } else if (op < 7 && !live.empty()) {
+            auto it = live.begin();
+            std::advance(it, rng() % std::min<size_t>(live.size(), 64));
+            CHECK(timers.cancel(it->second));
+            auto range = reference.equal_range(keys[it->first]);
+            for (auto r = range.first; r != range.second; ++r) {
+                if (r->second == it->first) { reference.erase(r); break; }
+            }
+            keys.erase(it->first);
+            live.erase(it);
+        } else {
+            size_t before = fired.size();
+            tick(rng() % 2000);
+            std::vector<uint32_t> expected;
+            while (!reference.empty() && reference.begin()->first.first <= timers.now()) {
+                uint32_t due = reference.begin()->second;
+                expected.push_back(due);
+                live.erase(due);
+                keys.erase(due);
+                reference.erase(reference.begin());
+            }
+            std::vector<uint32_t> got(fired.begin() + before, fired.end());
+            if (got != expected) {
+                printf("    order mismatch at step %d\n", step);
+                match = false;
+            }
+        }
+    }
+    CHECK(match);
+    CHECK_EQ(timers.getPendingCount(), reference.size());
+    printf("    %u scheduled, peak %u pending\n", id, (unsigned)timers.getPeakPendingCount());
+    CHECK(timers.getPeakPendingCount() > 1000);
+    timers.cancelAll();
+    CHECK_EQ(timers.getPendingCount(), 0);
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void benchmark() {
+    typedef std::chrono::steady_clock Clock;
+    const int N = TimerService::CAPACITY;
+    std::mt19937 rng(7);
+    std::vector<TimerHandle> handles(N);
+    fired.clear();
+    fired.reserve(2 * N);
+
+    Clock::time_point t0 = Clock::now();
+    for (int i = 0; i < N; i++) handles[i] = timers.call(record, (void*)(uintptr_t)i, 1000 + rng() % 1000000);
+    double scheduleNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / N;
+    CHECK_EQ(timers.getPendingCount(), N);
+    CHECK_EQ(timers.call(record, NULL, 1), 0);         // Pool full
+
+    t0 = Clock::now();
+    for (int i = 0; i < 100000; i++) timers.update();  // Nothing due
+    double idleNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / 100000;
+
+    t0 = Clock::now();
+    for (int i = 0; i < N; i += 2) timers.cancel(handles[i]);
+    double cancelNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / (N / 2);
+
+    unsigned long before = timers.getFiredCount();
+    t0 = Clock::now();
+    while (timers.getPendingCount() > 0) tick(1000);
+    double fireNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count()
+                  / (timers.getFiredCount() - before);
+    CHECK_EQ(timers.getFiredCount() - before, N / 2);
+
+    printf("    %d pending: schedule %.0f ns, cancel %.0f ns, fire %.0f ns; idle update() %.1f ns\n",
+           N, scheduleNs, cancelNs, fireNs, idleNs);
+}
+
+int main() {
+    RUN_TEST(deviceActionsAcrossMicrosWrap);
+    RUN_TEST(equalDeadlinesFireInScheduleOrder);
+    RUN_TEST(handlesAreGenerationChecked);
+    RUN_TEST(periodicTimers);
+    RUN_TEST(matchesReferenceOrder);
+    RUN_TEST(benchmark);
+    return TEST_RESULT();
+}
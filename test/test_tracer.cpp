@@ -0,0 +1,177 @@
+// Tracer ring buffer and Chrome export: nested scopes under the simulated
+// clock, spans across the 32-bit micros() wrap, name escaping, records
+// intact after the ring wraps several times; per-span cost.
+
+#include "TestSupport.h"
+#include "Core/Tracer.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace TwiST;
+
+static const size_t CAPACITY = TWIST_TRACE_BUFFER_SIZE;
+
+struct Span {
+    std::string name;
+    unsigned long ts, dur;
+};
+
+// Reads back what exportChromeJson() wrote - one event per line
+static std::vector<Span> exportSpans() {
+    Host::serialOutput.clear();
+    size_t written = Tracer::exportChromeJson(Serial);
+    const std::string& json = Host::serialOutput;
+
+    std::vector<Span> spans;
+    size_t at = 0;
+    while ((at = json.find("\n{\"name\":\"", at)) != std::string::npos) {
+        at += 10;
+        Span span;
+        while (at < json.size() && json[at] != '"') {
+            if (json[at] == '\\') at++;
+            span.name += json[at++];
+        }
+        if (sscanf(json.c_str() + at, "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%lu,\"dur\":%lu}",
+                   &span.ts, &span.dur) == 2) {
+            spans.push_back(span);
+        }
+    }
+    CHECK_EQ(spans.size(), written);
+    CHECK_EQ(json.compare(0, 16, "{\"traceEvents\":["), 0);
+    const std::string tail = "\n],\"displayTimeUnit\":\"ns\"}\n";
+    CHECK(json.size() > tail.size() && json.compare(json.size() - tail.size(), tail.size(), tail) == 0);
+    return spans;
+}
+
+static void nestedScopesUseSimulatedTime() {
+    Tracer::clear();
+    Host::clockUs = 5000000ULL;
+    {
+        TWIST_TRACE_SCOPE("outer");
+        Host::advanceUs(100);
+        {
+            TWIST_TRACE_SCOPE("inner");
+            Host::advanceUs(250);
+        }
+        Host::advanceUs(50);
+    }
+
+    std::vector<Span> spans = exportSpans();
+    CHECK_EQ(spans.size(), 2);
+    CHECK(spans[0].name == "inner");                   // Recorded on close: inner first
+    CHECK_EQ(spans[0].ts, 5000100);
+    CHECK_EQ(spans[0].dur, 250);
+    CHECK(spans[1].name == "outer");
+    CHECK_EQ(spans[1].ts, 5000000);
+    CHECK_EQ(spans[1].dur, 400);
+}
+
+static void spanAcrossMicrosWrap() {
+    Tracer::clear();
+    Host::clockUs = 0xFFFFFF00ULL;
+    {
+        TWIST_TRACE_SCOPE("wrap");
+        Host::advanceUs(0x300);
+    }
+    std::vector<Span> spans = exportSpans();
+    CHECK_EQ(spans.size(), 1);
+    CHECK_EQ(spans[0].ts, 0xFFFFFF00UL);
+    CHECK_EQ(spans[0].dur, 0x300);
+}
+
+static void namesAreEscaped() {
+    Tracer::clear();
+    Tracer::record("say \"hi\" \\ bye", 10, 1);
+    std::vector<Span> spans = exportSpans();
+    CHECK_EQ(spans.size(), 1);
+    CHECK(spans[0].name == "say \"hi\" \\ bye");
+    CHECK(Host::serialOutput.find("\"say \\\"hi\\\" \\\\ bye\"") != std::string::npos);
+}
+
+static void disabledRecordsNothing() {
+    Tracer::clear();
+    Tracer::setEnabled(false);
+    { TWIST_TRACE_SCOPE("off"); }
+    Tracer::record("off", 1, 1);
+    CHECK_EQ(Tracer::getRecordCount(), 0);
+    Tracer::setEnabled(true);
+    { TWIST_TRACE_SCOPE("on"); }
+    CHECK_EQ(Tracer::getRecordCount(), 1);
+}
+
+static void recordsIntactAfterWrap() {
+    // Distinct name, start and duration per span so any mix-up shows
+    static char names[3 * CAPACITY + 17][12];
+    const size_t TOTAL = sizeof(names) / sizeof(names[0]);
+    for (size_t i = 0; i < TOTAL; i++) snprintf(names[i], sizeof(names[i]), "span%zu", i);
+
+    Tracer::clear();
+    for (size_t i = 0; i < TOTAL; i++) {
+        Tracer::record(names[i], (uint32_t)(1000 + 10 * i), (uint32_t)(i % 7 + 1));
+        CHECK_EQ(Tracer::getRecordCount(), i < CAPACITY ? i + 1 : CAPACITY);
+    }
+    CHECK_EQ(Tracer::getOverwrittenCount(), TOTAL - CAPACITY);
+
+    // Exactly the newest CAPACITY spans, oldest first
+    std::vector<Span> spans = exportSpans();
+    CHECK_EQ(spans.size(), CAPACITY);
+    bool intact = true;
+    for (size_t k = 0; k < spans.size(); k++) {
+        size_t i = TOTAL - CAPACITY + k;
+        if (spans[k].name != names[i] || spans[k].ts != 1000 + 10 * i || spans[k].dur != i % 7 + 1) intact = false;
+    }
+    CHECK(intact);
+
+    // Export pauses recording but leaves it enabled afterwards
+    CHECK(Tracer::isEnabled());
+    CHECK_EQ(Tracer::getRecordCount(), CAPACITY);
+    Tracer::clear();
+    CHECK_EQ(Tracer::getRecordCount(), 0);
+    CHECK_EQ(Tracer::getOverwrittenCount(), 0);
+    CHECK_EQ(exportSpans().size(), 0);
+}
+
+// ===== Timing (reported, not asserted) =====
+
+static void spanCost() {
+    typedef std::chrono::steady_clock Clock;
+    const uint32_t SPANS = 2000000;
+
+    // First CAPACITY spans fill the ring; the rest overwrite
+    Tracer::clear();
+    Clock::time_point t0 = Clock::now();
+    for (uint32_t i = 0; i < SPANS; i++) {
+        TWIST_TRACE_SCOPE("bench");
+        Host::clockUs++;
+    }
+    double scopeNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / SPANS;
+    CHECK_EQ(Tracer::getOverwrittenCount(), SPANS - CAPACITY);
+
+    Tracer::setEnabled(false);
+    t0 = Clock::now();
+    for (uint32_t i = 0; i < SPANS; i++) {
+        TWIST_TRACE_SCOPE("bench");
+        Host::clockUs++;
+    }
+    double disabledNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / SPANS;
+    Tracer::setEnabled(true);
+
+    std::vector<Span> spans = exportSpans();
+    bool intact = true;
+    for (size_t k = 0; k < spans.size(); k++) intact = intact && spans[k].name == "bench" && spans[k].dur == 1;
+    CHECK(intact);
+
+    printf("    %zu-slot ring: %.1f ns per enabled span (wrapping), %.1f ns disabled\n",
+           CAPACITY, scopeNs, disabledNs);
+}
+
+int main() {
+    RUN_TEST(nestedScopesUseSimulatedTime);
+    RUN_TEST(spanAcrossMicrosWrap);
+    RUN_TEST(namesAreEscaped);
+    RUN_TEST(disabledRecordsNothing);
+    RUN_TEST(recordsIntactAfterWrap);
+    RUN_TEST(spanCost);
+    return TEST_RESULT();
+}